@@ -135,13 +135,6 @@
 #include "utils/typcache.h"
 
 
-/*
- * For Hyperloglog, we define an error margin of 0.3%. If the number of
- * distinct values estimated by hyperloglog is within an error of 0.3%,
- * we consider everything as distinct.
- */
-#define GP_HLL_ERROR_MARGIN  0.003
-
 /* Fix attr number of return record of function gp_acquire_sample_rows */
 #define FIX_ATTR_NUM  3
 
@@ -3791,20 +3784,9 @@ merge_leaf_stats(VacAttrStatsP stats,
 	List *all_children_list;
 	List *oid_list;
 	StdAnalyzeData *mystats = (StdAnalyzeData *) stats->extra_data;
-	int numPartitions;
-
+	MergedLeafStats merged;
 	ListCell *lc;
-	float *relTuples;
-	float *nDistincts;
-	float *nMultiples;
-	int relNum;
-	float totalTuples = 0;
-	float nmultiple = 0; // number of values that appeared more than once
-	bool allDistinct = false;
 	int slot_idx = 0;
-	int sampleCount = 0;
-	Oid ltopr = mystats->ltopr;
-	Oid eqopr = mystats->eqopr;
 
 	ereport(DEBUG2,
 			(errmsg("Merging leaf partition stats to calculate root partition stats : column %s",
@@ -3826,447 +3808,43 @@ merge_leaf_stats(VacAttrStatsP stats,
 
 		oid_list = lappend_oid(oid_list, pkrelid);
 	}
-	numPartitions = list_length(oid_list);
-
-	relTuples = (float *) palloc0(sizeof(float) * numPartitions);
-	nDistincts = (float *) palloc0(sizeof(float) * numPartitions);
-	nMultiples = (float *) palloc0(sizeof(float) * numPartitions);
-
-	relNum = 0;
-	foreach (lc, oid_list)
-	{
-		Oid			pkrelid = lfirst_oid(lc);
-
-		relTuples[relNum] = get_rel_reltuples(pkrelid);
-		totalTuples = totalTuples + relTuples[relNum];
-		relNum++;
-	}
-
-	if (totalTuples == 0.0)
-		return;
-
-	MemoryContext old_context;
-
-	HeapTuple *heaptupleStats =
-		(HeapTuple *) palloc(numPartitions * sizeof(HeapTuple));
-
-	// NDV calculations
-	float4 colAvgWidth = 0;
-	float4 nullCount = 0;
-	GpHLLCounter *hllcounters = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
-	GpHLLCounter *hllcounters_fullscan = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
-	GpHLLCounter *hllcounters_copy = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
-
-	GpHLLCounter finalHLL = NULL;
-	GpHLLCounter finalHLLFull = NULL;
-	int i = 0;
-	double ndistinct = 0.0;
-	int fullhll_count = 0;
-	int samplehll_count = 0;
-	int totalhll_count = 0;
-	foreach (lc, oid_list)
-	{
-		Oid		leaf_relid = lfirst_oid(lc);
-		int32	stawidth = 0;
-		float4	stanullfrac = 0.0;
-
-		const char *attname = get_attname(stats->attr->attrelid, stats->attr->attnum, false);
-
-		/*
-		 * fetch_leaf_attnum and fetch_leaf_att_stats retrieve leaf partition
-		 * table's pg_attribute tuple and pg_statistic tuple through index scan
-		 * instead of system catalog cache. Since if using system catalog cache,
-		 * the total tuple entries insert into the cache will up to:
-		 * (number_of_leaf_tables * number_of_column_in_this_table) pg_attribute tuples
-		 * +
-		 * (number_of_leaf_tables * number_of_column_in_this_table) pg_statistic tuples
-		 * which could use extremely large memroy in CacheMemoryContext.
-		 * This happens when all of the leaf tables are analyzed. And the current function
-		 * will execute for all columns.
-		 *
-		 * fetch_leaf_att_stats copy the original tuple, so remember to free it.
-		 *
-		 * As a side-effect, ANALYZE same root table serveral times in same session is much
-		 * more slower than before since we don't rely on system catalog cache.
-		 *
-		 * But we still using the tuple descriptor in system catalog cache to retrieve
-		 * attribute in fetched tuples. See get_attstatsslot.
-		 */
-		AttrNumber child_attno = fetch_leaf_attnum(leaf_relid, attname);
-		heaptupleStats[i] = fetch_leaf_att_stats(leaf_relid, child_attno);
-
-		// if there is no colstats, we can skip this partition's stats
-		if (!HeapTupleIsValid(heaptupleStats[i]))
-		{
-			i++;
-			continue;
-		}
-
-		stawidth = ((Form_pg_statistic) GETSTRUCT(heaptupleStats[i]))->stawidth;
-		stanullfrac = ((Form_pg_statistic) GETSTRUCT(heaptupleStats[i]))->stanullfrac;
-		colAvgWidth = colAvgWidth + (stawidth > 0 ? stawidth : 0) * relTuples[i];
-		nullCount = nullCount + (stanullfrac > 0.0 ? stanullfrac : 0.0) * relTuples[i];
-
-		AttStatsSlot hllSlot;
-
-		(void) get_attstatsslot(&hllSlot, heaptupleStats[i], STATISTIC_KIND_FULLHLL,
-								InvalidOid, ATTSTATSSLOT_VALUES);
-
-		if (hllSlot.nvalues > 0)
-		{
-			hllcounters_fullscan[i] = (GpHLLCounter) DatumGetByteaP(hllSlot.values[0]);
-			GpHLLCounter finalHLLFull_intermediate = finalHLLFull;
-			finalHLLFull = gp_hyperloglog_merge_counters(finalHLLFull_intermediate, hllcounters_fullscan[i]);
-			if (NULL != finalHLLFull_intermediate)
-			{
-				pfree(finalHLLFull_intermediate);
-			}
-			free_attstatsslot(&hllSlot);
-			fullhll_count++;
-			totalhll_count++;
-		}
-
-		(void) get_attstatsslot(&hllSlot, heaptupleStats[i], STATISTIC_KIND_HLL,
-								InvalidOid, ATTSTATSSLOT_VALUES);
-
-		if (hllSlot.nvalues > 0)
-		{
-			hllcounters[i] = (GpHLLCounter) DatumGetByteaP(hllSlot.values[0]);
-			nDistincts[i] = (float) hllcounters[i]->ndistinct;
-			nMultiples[i] = (float) hllcounters[i]->nmultiples;
-			sampleCount += hllcounters[i]->samplerows;
-			hllcounters_copy[i] = gp_hll_copy(hllcounters[i]);
-			GpHLLCounter finalHLL_intermediate = finalHLL;
-			finalHLL = gp_hyperloglog_merge_counters(finalHLL_intermediate, hllcounters[i]);
-			if (NULL != finalHLL_intermediate)
-			{
-				pfree(finalHLL_intermediate);
-			}
-			free_attstatsslot(&hllSlot);
-			samplehll_count++;
-			totalhll_count++;
-		}
-		i++;
-	}
 
-	if (totalhll_count == 0)
-	{
-		/*
-		 * If neither HLL nor HLL Full scan stats are available,
-		 * continue merging stats based on the defaults, instead
-		 * of reading them from HLL counter.
-		 */
-	}
-	else
+	if (!merge_leaf_att_stats(stats->attr->attrelid, stats->attr->attnum,
+							  oid_list, stats->attr->attstattarget,
+							  mystats->eqopr, mystats->ltopr,
+							  stats->anl_context, &merged))
 	{
-		/*
-		 * If all partitions have HLL full scan counters,
-		 * merge root NDV's based on leaf partition HLL full scan
-		 * counter
-		 */
-		if (fullhll_count == totalhll_count)
-		{
-			ndistinct = gp_hyperloglog_estimate(finalHLLFull);
-			pfree(finalHLLFull);
-			/*
-			 * For fullscan the ndistinct is calculated based on the entire table scan
-			 * so if it's within the marginal error, we consider everything as distinct,
-			 * else the ndistinct value will provide the actual value and we do not ,
-			 * need to do any additional calculation for the nmultiple
-			 */
-			if ((fabs(totalTuples - ndistinct) / (float) totalTuples) < GP_HLL_ERROR_MARGIN)
-			{
-				allDistinct = true;
-			}
-			nmultiple = ndistinct;
-		}
-		/*
-		 * Else if all partitions have HLL counter based on sampled data,
-		 * merge root NDV's based on leaf partition HLL counter on
-		 * sampled data
-		 */
-		else if (finalHLL != NULL && samplehll_count == totalhll_count)
-		{
-			ndistinct = gp_hyperloglog_estimate(finalHLL);
-			pfree(finalHLL);
-			/*
-			 * For sampled HLL counter, the ndistinct calculated is based on the
-			 * sampled data. We consider everything distinct if the ndistinct
-			 * calculated is within marginal error, else we need to calculate
-			 * the number of distinct values for the table based on the estimator
-			 * proposed by Haas and Stokes, used later in the code.
-			 */
-			if ((fabs(sampleCount - ndistinct) / (float) sampleCount) < GP_HLL_ERROR_MARGIN)
-			{
-				allDistinct = true;
-			}
-			else
-			{
-				/*
-				 * The gp_hyperloglog_estimate() utility merges the number of
-				 * distnct values accurately, but for the NDV estimator used later
-				 * in the code, we also need additional information for nmultiples,
-				 * i.e., the number of values that appeared more than once.
-				 * At this point we have the information for nmultiples for each
-				 * partition, but the nmultiples in one partition can be accounted as
-				 * a distinct value in some other partition. In order to merge the
-				 * approximate nmultiples better, we extract unique values in each
-				 * partition as follows,
-				 * P1 -> ndistinct1 , nmultiple1
-				 * P2 -> ndistinct2 , nmultiple2
-				 * P3 -> ndistinct3 , nmultiple3
-				 * Root -> ndistinct(Root) (using gp_hyperloglog_estimate)
-				 * nunique1 = ndistinct(Root) - gp_hyperloglog_estimate(P2 & P3)
-				 * nunique2 = ndistinct(Root) - gp_hyperloglog_estimate(P1 & P3)
-				 * nunique3 = ndistinct(Root) - gp_hyperloglog_estimate(P2 & P1)
-				 * And finally once we have unique values in individual partitions,
-				 * we can get the nmultiples on the ROOT as seen below,
-				 * nmultiple(Root) = ndistinct(Root) - (sum of uniques in each partition)
-				 */
-				/*
-				 * hllcounters_left array stores the merged hll result of all the
-				 * hll counters towards the left of index i and excluding the hll
-				 * counter at index i
-				 */
-				GpHLLCounter *hllcounters_left = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
-
-				/*
-				 * hllcounters_right array stores the merged hll result of all the
-				 * hll counters towards the right of index i and excluding the hll
-				 * counter at index i
-				 */
-				GpHLLCounter *hllcounters_right = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
-
-				hllcounters_left[0] = gp_hyperloglog_init_def();
-				hllcounters_right[numPartitions - 1] = gp_hyperloglog_init_def();
-
-				/*
-				 * The following loop populates the left and right array by accumulating the merged
-				 * result of all the hll counters towards the left/right of the given index i excluding
-				 * the counter at index i.
-				 * Note that there might be empty values for some partitions, in which case the
-				 * corresponding element in the left/right arrays will simply be the value
-				 * of its neighbor.
-				 * For E.g If the hllcounters_copy array is 1, null, 2, 3, null, 4
-				 * the left and right arrays will be as follows:
-				 * hllcounters_left:  default, 1, 1, (1,2), (1,2,3), (1,2,3)
-				 * hllcounters_right: (2,3,4), (2,3,4), (3,4), 4, 4, default
-				 */
-				/*
-				 * The first and the last element in the left and right arrays
-				 * are default values since there is no element towards
-				 * the left or right of them
-				 */
-				for (i = 1; i < numPartitions; i++)
-				{
-					/* populate left array */
-					if (nDistincts[i - 1] == 0)
-					{
-						hllcounters_left[i] = gp_hll_copy(hllcounters_left[i - 1]);
-					}
-					else
-					{
-						GpHLLCounter hllcounter_temp1 = gp_hll_copy(hllcounters_copy[i - 1]);
-						GpHLLCounter hllcounter_temp2 = gp_hll_copy(hllcounters_left[i - 1]);
-						hllcounters_left[i] = gp_hyperloglog_merge_counters(hllcounter_temp1, hllcounter_temp2);
-						pfree(hllcounter_temp1);
-						pfree(hllcounter_temp2);
-					}
-
-					/* populate right array */
-					if (nDistincts[numPartitions - i] == 0)
-					{
-						hllcounters_right[numPartitions - i - 1] = gp_hll_copy(hllcounters_right[numPartitions - i]);
-					}
-					else
-					{
-						GpHLLCounter hllcounter_temp1 = gp_hll_copy(hllcounters_copy[numPartitions - i]);
-						GpHLLCounter hllcounter_temp2 = gp_hll_copy(hllcounters_right[numPartitions - i]);
-						hllcounters_right[numPartitions - i - 1] = gp_hyperloglog_merge_counters(hllcounter_temp1, hllcounter_temp2);
-						pfree(hllcounter_temp1);
-						pfree(hllcounter_temp2);
-					}
-				}
-
-				int nUnique = 0;
-				for (i = 0; i < numPartitions; i++)
-				{
-					/* Skip if statistics are missing for the partition */
-					if (nDistincts[i] == 0)
-						continue;
-
-					GpHLLCounter hllcounter_temp1 = gp_hll_copy(hllcounters_left[i]);
-					GpHLLCounter hllcounter_temp2 = gp_hll_copy(hllcounters_right[i]);
-					GpHLLCounter final = NULL;
-					final = gp_hyperloglog_merge_counters(hllcounter_temp1, hllcounter_temp2);
-
-					pfree(hllcounter_temp1);
-					pfree(hllcounter_temp2);
-
-					if (final != NULL)
-					{
-						float nUniques = ndistinct - gp_hyperloglog_estimate(final);
-						nUnique += nUniques;
-						nmultiple += nMultiples[i] * (nUniques / nDistincts[i]);
-						pfree(final);
-					}
-					else
-					{
-						nUnique = ndistinct;
-						break;
-					}
-				}
-
-				// nmultiples for the ROOT
-				nmultiple += ndistinct - nUnique;
-
-				if (nmultiple < 0)
-					nmultiple = 0;
-
-				pfree(hllcounters_left);
-				pfree(hllcounters_right);
-			}
-		}
-		else
-		{
-			/* Else error out due to incompatible leaf HLL counter merge */
-			pfree(hllcounters);
-			pfree(hllcounters_fullscan);
-			pfree(hllcounters_copy);
-			pfree(nDistincts);
-			pfree(nMultiples);
-
+		if (merged.hll_inconsistent)
 			ereport(ERROR,
 					(errmsg("ANALYZE cannot merge since not all non-empty leaf partitions have consistent hyperloglog statistics for merge"),
 					 errhint("Re-run ANALYZE or ANALYZE FULLSCAN")));
-		}
-	}
-	pfree(hllcounters);
-	pfree(hllcounters_fullscan);
-	pfree(hllcounters_copy);
-	pfree(nDistincts);
-	pfree(nMultiples);
-
-	if (allDistinct || (!OidIsValid(eqopr) && !OidIsValid(ltopr)))
-	{
-		/* If we found no repeated values, assume it's a unique column */
-		ndistinct = -1.0;
-	}
-	else if ((int) nmultiple >= (int) ndistinct)
-	{
-		/*
-		 * Every value in the sample appeared more than once.  Assume the
-		 * column has just these values.
-		 */
-	}
-	else
-	{
-		/*----------
-		 * Estimate the number of distinct values using the estimator
-		 * proposed by Haas and Stokes in IBM Research Report RJ 10025:
-		 *		n*d / (n - f1 + f1*n/N)
-		 * where f1 is the number of distinct values that occurred
-		 * exactly once in our sample of n rows (from a total of N),
-		 * and d is the total number of distinct values in the sample.
-		 * This is their Duj1 estimator; the other estimators they
-		 * recommend are considerably more complex, and are numerically
-		 * very unstable when n is much smaller than N.
-		 *
-		 * Overwidth values are assumed to have been distinct.
-		 *----------
-		 */
-		int f1 = ndistinct - nmultiple;
-		int d = f1 + nmultiple;
-		double numer, denom, stadistinct;
-
-		numer = (double) sampleCount * (double) d;
-
-		denom = (double) (sampleCount - f1) +
-				(double) f1 * (double) sampleCount / totalTuples;
-
-		stadistinct = numer / denom;
-		/* Clamp to sane range in case of roundoff error */
-		if (stadistinct < (double) d)
-			stadistinct = (double) d;
-		if (stadistinct > totalTuples)
-			stadistinct = totalTuples;
-		ndistinct = floor(stadistinct + 0.5);
+		return;
 	}
 
-	ndistinct = round(ndistinct);
-	if (ndistinct > 0.1 * totalTuples)
-		ndistinct = -(ndistinct / totalTuples);
-
-	// finalize NDV calculation
-	stats->stadistinct = ndistinct;
+	stats->stadistinct = merged.stadistinct;
 	stats->stats_valid = true;
-	stats->stawidth = colAvgWidth / totalTuples;
-	stats->stanullfrac = (float4) nullCount / (float4) totalTuples;
-
-	// MCV calculations
-	MCVFreqPair **mcvpairArray = NULL;
-	int rem_mcv = 0;
-	int num_mcv = 0;
-	if (ndistinct > -1 && OidIsValid(eqopr))
-	{
-		if (ndistinct < 0)
-		{
-			ndistinct = -ndistinct * totalTuples;
-		}
-
-		old_context = MemoryContextSwitchTo(stats->anl_context);
-
-		void *resultMCV[2];
-
-		mcvpairArray = aggregate_leaf_partition_MCVs(
-			stats->attr->attrelid, stats->attr->attnum,
-			numPartitions, heaptupleStats, relTuples,
-			stats->attr->attstattarget, ndistinct, &num_mcv, &rem_mcv,
-			resultMCV);
-		MemoryContextSwitchTo(old_context);
+	stats->stawidth = merged.stawidth;
+	stats->stanullfrac = merged.stanullfrac;
 
-		if (num_mcv > 0)
-		{
-			stats->stakind[slot_idx] = STATISTIC_KIND_MCV;
-			stats->staop[slot_idx] = mystats->eqopr;
-			stats->stavalues[slot_idx] = (Datum *) resultMCV[0];
-			stats->numvalues[slot_idx] = num_mcv;
-			stats->stanumbers[slot_idx] = (float4 *) resultMCV[1];
-			stats->numnumbers[slot_idx] = num_mcv;
-			slot_idx++;
-		}
-	}
-
-	// Histogram calculation
-	if (OidIsValid(eqopr) && OidIsValid(ltopr))
+	if (merged.num_mcv > 0)
 	{
-		old_context = MemoryContextSwitchTo(stats->anl_context);
-
-		void *resultHistogram[1];
-		int num_hist = aggregate_leaf_partition_histograms(
-			stats->attr->attrelid, stats->attr->attnum,
-			numPartitions, heaptupleStats, relTuples,
-			stats->attr->attstattarget, mcvpairArray + num_mcv,
-			rem_mcv, resultHistogram);
-		MemoryContextSwitchTo(old_context);
-		if (num_hist > 0)
-		{
-			stats->stakind[slot_idx] = STATISTIC_KIND_HISTOGRAM;
-			stats->staop[slot_idx] = mystats->ltopr;
-			stats->stavalues[slot_idx] = (Datum *) resultHistogram[0];
-			stats->numvalues[slot_idx] = num_hist;
-			slot_idx++;
-		}
+		stats->stakind[slot_idx] = STATISTIC_KIND_MCV;
+		stats->staop[slot_idx] = mystats->eqopr;
+		stats->stavalues[slot_idx] = merged.mcv_values;
+		stats->numvalues[slot_idx] = merged.num_mcv;
+		stats->stanumbers[slot_idx] = merged.mcv_freqs;
+		stats->numnumbers[slot_idx] = merged.num_mcv;
+		slot_idx++;
 	}
-	for (i = 0; i < numPartitions; i++)
+
+	if (merged.num_hist > 0)
 	{
-		if (HeapTupleIsValid(heaptupleStats[i]))
-			heap_freetuple(heaptupleStats[i]);
+		stats->stakind[slot_idx] = STATISTIC_KIND_HISTOGRAM;
+		stats->staop[slot_idx] = mystats->ltopr;
+		stats->stavalues[slot_idx] = merged.hist_values;
+		stats->numvalues[slot_idx] = merged.num_hist;
+		slot_idx++;
 	}
-	if (num_mcv > 0)
-		pfree(mcvpairArray);
-	pfree(heaptupleStats);
-	pfree(relTuples);
 }
 
 /*
@@ -10,6 +10,8 @@
  */
 #include "postgres.h"
 
+#include <math.h>
+
 #include "access/genam.h"
 #include "access/heapam.h"
 #include "catalog/indexing.h"
@@ -28,7 +30,14 @@
 #include "utils/lsyscache.h"
 #include "utils/syscache.h"
 #include "utils/hsearch.h"
+#include "utils/hyperloglog/gp_hyperloglog.h"
 
+/*
+ * For Hyperloglog, we define an error margin of 0.3%. If the number of
+ * distinct values estimated by hyperloglog is within an error of 0.3%,
+ * we consider everything as distinct.
+ */
+#define GP_HLL_ERROR_MARGIN  0.003
 
 typedef struct MCVFreqEntry
 {
@@ -1284,3 +1293,473 @@ leaf_parts_analyzed(Oid attrelid, Oid relid_exclude, List *va_cols, int elevel)
 
 	return !all_parts_empty;
 }
+
+/*
+ * merge_leaf_att_stats() -- merge the stats of a column of leaf partitions
+ *
+ *	Computes the null fraction, the average width, the (estimated) number of
+ *	distinct values, the most common values and the histogram of column
+ *	attnum of the partitioned table relid from the pg_statistic entries of
+ *	the given leaf partitions. The number of distinct values is estimated by
+ *	merging the hyperloglog counters of the leaf partitions. The MCVs and the
+ *	histogram are allocated in result_context.
+ *
+ *	eqopr and ltopr are the default "=" and "<" operators of the column's
+ *	type. Returns false, without merging, if the leaf partitions are empty
+ *	or if their hyperloglog counters cannot be merged; result->hll_inconsistent
+ *	tells the latter apart.
+ */
+bool
+merge_leaf_att_stats(Oid relid, AttrNumber attnum, List *leaf_oids,
+					 int stattarget, Oid eqopr, Oid ltopr,
+					 MemoryContext result_context, MergedLeafStats *result)
+{
+	List *oid_list = leaf_oids;
+	int numPartitions = list_length(leaf_oids);
+
+	ListCell *lc;
+	float *relTuples;
+	float *nDistincts;
+	float *nMultiples;
+	int relNum;
+	float totalTuples = 0;
+	float nmultiple = 0; // number of values that appeared more than once
+	bool allDistinct = false;
+	int sampleCount = 0;
+
+	memset(result, 0, sizeof(MergedLeafStats));
+
+	relTuples = (float *) palloc0(sizeof(float) * numPartitions);
+	nDistincts = (float *) palloc0(sizeof(float) * numPartitions);
+	nMultiples = (float *) palloc0(sizeof(float) * numPartitions);
+
+	relNum = 0;
+	foreach (lc, oid_list)
+	{
+		Oid			pkrelid = lfirst_oid(lc);
+
+		relTuples[relNum] = get_rel_reltuples(pkrelid);
+		totalTuples = totalTuples + relTuples[relNum];
+		relNum++;
+	}
+
+	if (totalTuples == 0.0)
+		return false;
+
+	MemoryContext old_context;
+
+	HeapTuple *heaptupleStats =
+		(HeapTuple *) palloc(numPartitions * sizeof(HeapTuple));
+
+	// NDV calculations
+	float4 colAvgWidth = 0;
+	float4 nullCount = 0;
+	GpHLLCounter *hllcounters = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
+	GpHLLCounter *hllcounters_fullscan = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
+	GpHLLCounter *hllcounters_copy = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
+
+	GpHLLCounter finalHLL = NULL;
+	GpHLLCounter finalHLLFull = NULL;
+	int i = 0;
+	double ndistinct = 0.0;
+	int fullhll_count = 0;
+	int samplehll_count = 0;
+	int totalhll_count = 0;
+	foreach (lc, oid_list)
+	{
+		Oid		leaf_relid = lfirst_oid(lc);
+		int32	stawidth = 0;
+		float4	stanullfrac = 0.0;
+
+		const char *attname = get_attname(relid, attnum, false);
+
+		/*
+		 * fetch_leaf_attnum and fetch_leaf_att_stats retrieve leaf partition
+		 * table's pg_attribute tuple and pg_statistic tuple through index scan
+		 * instead of system catalog cache. Since if using system catalog cache,
+		 * the total tuple entries insert into the cache will up to:
+		 * (number_of_leaf_tables * number_of_column_in_this_table) pg_attribute tuples
+		 * +
+		 * (number_of_leaf_tables * number_of_column_in_this_table) pg_statistic tuples
+		 * which could use extremely large memroy in CacheMemoryContext.
+		 * This happens when all of the leaf tables are analyzed. And the current function
+		 * will execute for all columns.
+		 *
+		 * fetch_leaf_att_stats copy the original tuple, so remember to free it.
+		 *
+		 * As a side-effect, ANALYZE same root table serveral times in same session is much
+		 * more slower than before since we don't rely on system catalog cache.
+		 *
+		 * But we still using the tuple descriptor in system catalog cache to retrieve
+		 * attribute in fetched tuples. See get_attstatsslot.
+		 */
+		AttrNumber child_attno = fetch_leaf_attnum(leaf_relid, attname);
+		heaptupleStats[i] = fetch_leaf_att_stats(leaf_relid, child_attno);
+
+		// if there is no colstats, we can skip this partition's stats
+		if (!HeapTupleIsValid(heaptupleStats[i]))
+		{
+			i++;
+			continue;
+		}
+
+		stawidth = ((Form_pg_statistic) GETSTRUCT(heaptupleStats[i]))->stawidth;
+		stanullfrac = ((Form_pg_statistic) GETSTRUCT(heaptupleStats[i]))->stanullfrac;
+		colAvgWidth = colAvgWidth + (stawidth > 0 ? stawidth : 0) * relTuples[i];
+		nullCount = nullCount + (stanullfrac > 0.0 ? stanullfrac : 0.0) * relTuples[i];
+
+		AttStatsSlot hllSlot;
+
+		(void) get_attstatsslot(&hllSlot, heaptupleStats[i], STATISTIC_KIND_FULLHLL,
+								InvalidOid, ATTSTATSSLOT_VALUES);
+
+		if (hllSlot.nvalues > 0)
+		{
+			hllcounters_fullscan[i] = (GpHLLCounter) DatumGetByteaP(hllSlot.values[0]);
+			GpHLLCounter finalHLLFull_intermediate = finalHLLFull;
+			finalHLLFull = gp_hyperloglog_merge_counters(finalHLLFull_intermediate, hllcounters_fullscan[i]);
+			if (NULL != finalHLLFull_intermediate)
+			{
+				pfree(finalHLLFull_intermediate);
+			}
+			free_attstatsslot(&hllSlot);
+			fullhll_count++;
+			totalhll_count++;
+		}
+
+		(void) get_attstatsslot(&hllSlot, heaptupleStats[i], STATISTIC_KIND_HLL,
+								InvalidOid, ATTSTATSSLOT_VALUES);
+
+		if (hllSlot.nvalues > 0)
+		{
+			hllcounters[i] = (GpHLLCounter) DatumGetByteaP(hllSlot.values[0]);
+			nDistincts[i] = (float) hllcounters[i]->ndistinct;
+			nMultiples[i] = (float) hllcounters[i]->nmultiples;
+			sampleCount += hllcounters[i]->samplerows;
+			hllcounters_copy[i] = gp_hll_copy(hllcounters[i]);
+			GpHLLCounter finalHLL_intermediate = finalHLL;
+			finalHLL = gp_hyperloglog_merge_counters(finalHLL_intermediate, hllcounters[i]);
+			if (NULL != finalHLL_intermediate)
+			{
+				pfree(finalHLL_intermediate);
+			}
+			free_attstatsslot(&hllSlot);
+			samplehll_count++;
+			totalhll_count++;
+		}
+		i++;
+	}
+
+	if (totalhll_count == 0)
+	{
+		/*
+		 * If neither HLL nor HLL Full scan stats are available,
+		 * continue merging stats based on the defaults, instead
+		 * of reading them from HLL counter.
+		 */
+	}
+	else
+	{
+		/*
+		 * If all partitions have HLL full scan counters,
+		 * merge root NDV's based on leaf partition HLL full scan
+		 * counter
+		 */
+		if (fullhll_count == totalhll_count)
+		{
+			ndistinct = gp_hyperloglog_estimate(finalHLLFull);
+			pfree(finalHLLFull);
+			/*
+			 * For fullscan the ndistinct is calculated based on the entire table scan
+			 * so if it's within the marginal error, we consider everything as distinct,
+			 * else the ndistinct value will provide the actual value and we do not ,
+			 * need to do any additional calculation for the nmultiple
+			 */
+			if ((fabs(totalTuples - ndistinct) / (float) totalTuples) < GP_HLL_ERROR_MARGIN)
+			{
+				allDistinct = true;
+			}
+			nmultiple = ndistinct;
+		}
+		/*
+		 * Else if all partitions have HLL counter based on sampled data,
+		 * merge root NDV's based on leaf partition HLL counter on
+		 * sampled data
+		 */
+		else if (finalHLL != NULL && samplehll_count == totalhll_count)
+		{
+			ndistinct = gp_hyperloglog_estimate(finalHLL);
+			pfree(finalHLL);
+			/*
+			 * For sampled HLL counter, the ndistinct calculated is based on the
+			 * sampled data. We consider everything distinct if the ndistinct
+			 * calculated is within marginal error, else we need to calculate
+			 * the number of distinct values for the table based on the estimator
+			 * proposed by Haas and Stokes, used later in the code.
+			 */
+			if ((fabs(sampleCount - ndistinct) / (float) sampleCount) < GP_HLL_ERROR_MARGIN)
+			{
+				allDistinct = true;
+			}
+			else
+			{
+				/*
+				 * The gp_hyperloglog_estimate() utility merges the number of
+				 * distnct values accurately, but for the NDV estimator used later
+				 * in the code, we also need additional information for nmultiples,
+				 * i.e., the number of values that appeared more than once.
+				 * At this point we have the information for nmultiples for each
+				 * partition, but the nmultiples in one partition can be accounted as
+				 * a distinct value in some other partition. In order to merge the
+				 * approximate nmultiples better, we extract unique values in each
+				 * partition as follows,
+				 * P1 -> ndistinct1 , nmultiple1
+				 * P2 -> ndistinct2 , nmultiple2
+				 * P3 -> ndistinct3 , nmultiple3
+				 * Root -> ndistinct(Root) (using gp_hyperloglog_estimate)
+				 * nunique1 = ndistinct(Root) - gp_hyperloglog_estimate(P2 & P3)
+				 * nunique2 = ndistinct(Root) - gp_hyperloglog_estimate(P1 & P3)
+				 * nunique3 = ndistinct(Root) - gp_hyperloglog_estimate(P2 & P1)
+				 * And finally once we have unique values in individual partitions,
+				 * we can get the nmultiples on the ROOT as seen below,
+				 * nmultiple(Root) = ndistinct(Root) - (sum of uniques in each partition)
+				 */
+				/*
+				 * hllcounters_left array stores the merged hll result of all the
+				 * hll counters towards the left of index i and excluding the hll
+				 * counter at index i
+				 */
+				GpHLLCounter *hllcounters_left = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
+
+				/*
+				 * hllcounters_right array stores the merged hll result of all the
+				 * hll counters towards the right of index i and excluding the hll
+				 * counter at index i
+				 */
+				GpHLLCounter *hllcounters_right = (GpHLLCounter *) palloc0(numPartitions * sizeof(GpHLLCounter));
+
+				hllcounters_left[0] = gp_hyperloglog_init_def();
+				hllcounters_right[numPartitions - 1] = gp_hyperloglog_init_def();
+
+				/*
+				 * The following loop populates the left and right array by accumulating the merged
+				 * result of all the hll counters towards the left/right of the given index i excluding
+				 * the counter at index i.
+				 * Note that there might be empty values for some partitions, in which case the
+				 * corresponding element in the left/right arrays will simply be the value
+				 * of its neighbor.
+				 * For E.g If the hllcounters_copy array is 1, null, 2, 3, null, 4
+				 * the left and right arrays will be as follows:
+				 * hllcounters_left:  default, 1, 1, (1,2), (1,2,3), (1,2,3)
+				 * hllcounters_right: (2,3,4), (2,3,4), (3,4), 4, 4, default
+				 */
+				/*
+				 * The first and the last element in the left and right arrays
+				 * are default values since there is no element towards
+				 * the left or right of them
+				 */
+				for (i = 1; i < numPartitions; i++)
+				{
+					/* populate left array */
+					if (nDistincts[i - 1] == 0)
+					{
+						hllcounters_left[i] = gp_hll_copy(hllcounters_left[i - 1]);
+					}
+					else
+					{
+						GpHLLCounter hllcounter_temp1 = gp_hll_copy(hllcounters_copy[i - 1]);
+						GpHLLCounter hllcounter_temp2 = gp_hll_copy(hllcounters_left[i - 1]);
+						hllcounters_left[i] = gp_hyperloglog_merge_counters(hllcounter_temp1, hllcounter_temp2);
+						pfree(hllcounter_temp1);
+						pfree(hllcounter_temp2);
+					}
+
+					/* populate right array */
+					if (nDistincts[numPartitions - i] == 0)
+					{
+						hllcounters_right[numPartitions - i - 1] = gp_hll_copy(hllcounters_right[numPartitions - i]);
+					}
+					else
+					{
+						GpHLLCounter hllcounter_temp1 = gp_hll_copy(hllcounters_copy[numPartitions - i]);
+						GpHLLCounter hllcounter_temp2 = gp_hll_copy(hllcounters_right[numPartitions - i]);
+						hllcounters_right[numPartitions - i - 1] = gp_hyperloglog_merge_counters(hllcounter_temp1, hllcounter_temp2);
+						pfree(hllcounter_temp1);
+						pfree(hllcounter_temp2);
+					}
+				}
+
+				int nUnique = 0;
+				for (i = 0; i < numPartitions; i++)
+				{
+					/* Skip if statistics are missing for the partition */
+					if (nDistincts[i] == 0)
+						continue;
+
+					GpHLLCounter hllcounter_temp1 = gp_hll_copy(hllcounters_left[i]);
+					GpHLLCounter hllcounter_temp2 = gp_hll_copy(hllcounters_right[i]);
+					GpHLLCounter final = NULL;
+					final = gp_hyperloglog_merge_counters(hllcounter_temp1, hllcounter_temp2);
+
+					pfree(hllcounter_temp1);
+					pfree(hllcounter_temp2);
+
+					if (final != NULL)
+					{
+						float nUniques = ndistinct - gp_hyperloglog_estimate(final);
+						nUnique += nUniques;
+						nmultiple += nMultiples[i] * (nUniques / nDistincts[i]);
+						pfree(final);
+					}
+					else
+					{
+						nUnique = ndistinct;
+						break;
+					}
+				}
+
+				// nmultiples for the ROOT
+				nmultiple += ndistinct - nUnique;
+
+				if (nmultiple < 0)
+					nmultiple = 0;
+
+				pfree(hllcounters_left);
+				pfree(hllcounters_right);
+			}
+		}
+		else
+		{
+			/* Else error out due to incompatible leaf HLL counter merge */
+			pfree(hllcounters);
+			pfree(hllcounters_fullscan);
+			pfree(hllcounters_copy);
+			pfree(nDistincts);
+			pfree(nMultiples);
+
+			result->hll_inconsistent = true;
+			return false;
+		}
+	}
+	pfree(hllcounters);
+	pfree(hllcounters_fullscan);
+	pfree(hllcounters_copy);
+	pfree(nDistincts);
+	pfree(nMultiples);
+
+	if (allDistinct || (!OidIsValid(eqopr) && !OidIsValid(ltopr)))
+	{
+		/* If we found no repeated values, assume it's a unique column */
+		ndistinct = -1.0;
+	}
+	else if ((int) nmultiple >= (int) ndistinct)
+	{
+		/*
+		 * Every value in the sample appeared more than once.  Assume the
+		 * column has just these values.
+		 */
+	}
+	else
+	{
+		/*----------
+		 * Estimate the number of distinct values using the estimator
+		 * proposed by Haas and Stokes in IBM Research Report RJ 10025:
+		 *		n*d / (n - f1 + f1*n/N)
+		 * where f1 is the number of distinct values that occurred
+		 * exactly once in our sample of n rows (from a total of N),
+		 * and d is the total number of distinct values in the sample.
+		 * This is their Duj1 estimator; the other estimators they
+		 * recommend are considerably more complex, and are numerically
+		 * very unstable when n is much smaller than N.
+		 *
+		 * Overwidth values are assumed to have been distinct.
+		 *----------
+		 */
+		int f1 = ndistinct - nmultiple;
+		int d = f1 + nmultiple;
+		double numer, denom, stadistinct;
+
+		numer = (double) sampleCount * (double) d;
+
+		denom = (double) (sampleCount - f1) +
+				(double) f1 * (double) sampleCount / totalTuples;
+
+		stadistinct = numer / denom;
+		/* Clamp to sane range in case of roundoff error */
+		if (stadistinct < (double) d)
+			stadistinct = (double) d;
+		if (stadistinct > totalTuples)
+			stadistinct = totalTuples;
+		ndistinct = floor(stadistinct + 0.5);
+	}
+
+	ndistinct = round(ndistinct);
+	if (ndistinct > 0.1 * totalTuples)
+		ndistinct = -(ndistinct / totalTuples);
+
+	// finalize NDV calculation
+	result->totalTuples = totalTuples;
+	result->stadistinct = ndistinct;
+	result->stawidth = colAvgWidth / totalTuples;
+	result->stanullfrac = (float4) nullCount / (float4) totalTuples;
+
+	// MCV calculations
+	MCVFreqPair **mcvpairArray = NULL;
+	int rem_mcv = 0;
+	int num_mcv = 0;
+	if (ndistinct > -1 && OidIsValid(eqopr))
+	{
+		if (ndistinct < 0)
+		{
+			ndistinct = -ndistinct * totalTuples;
+		}
+
+		old_context = MemoryContextSwitchTo(result_context);
+
+		void *resultMCV[2];
+
+		mcvpairArray = aggregate_leaf_partition_MCVs(
+			relid, attnum,
+			numPartitions, heaptupleStats, relTuples,
+			stattarget, ndistinct, &num_mcv, &rem_mcv,
+			resultMCV);
+		MemoryContextSwitchTo(old_context);
+
+		if (num_mcv > 0)
+		{
+			result->num_mcv = num_mcv;
+			result->mcv_values = (Datum *) resultMCV[0];
+			result->mcv_freqs = (float4 *) resultMCV[1];
+		}
+	}
+
+	// Histogram calculation
+	if (OidIsValid(eqopr) && OidIsValid(ltopr))
+	{
+		old_context = MemoryContextSwitchTo(result_context);
+
+		void *resultHistogram[1];
+		int num_hist = aggregate_leaf_partition_histograms(
+			relid, attnum,
+			numPartitions, heaptupleStats, relTuples,
+			stattarget, mcvpairArray + num_mcv,
+			rem_mcv, resultHistogram);
+		MemoryContextSwitchTo(old_context);
+		if (num_hist > 0)
+		{
+			result->num_hist = num_hist;
+			result->hist_values = (Datum *) resultHistogram[0];
+		}
+	}
+	for (i = 0; i < numPartitions; i++)
+	{
+		if (HeapTupleIsValid(heaptupleStats[i]))
+			heap_freetuple(heaptupleStats[i]);
+	}
+	if (num_mcv > 0)
+		pfree(mcvpairArray);
+	pfree(heaptupleStats);
+	pfree(relTuples);
+
+	return true;
+}
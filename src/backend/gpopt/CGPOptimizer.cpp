@@ -215,6 +215,36 @@ CGPOptimizer::TerminateGPOPT()
 	gpos_terminate();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CGPOptimizer::CheckCostModelParams
+//
+//	@doc:
+//		Check the value of the optimizer_cost_model_params GUC; return the
+//		position at which it is malformed, or null if it is well formed
+//
+//---------------------------------------------------------------------------
+const char *
+CGPOptimizer::CheckCostModelParams(const char *params)
+{
+	return COptTasks::CheckCostModelParams(params);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGPOptimizer::CheckSearchStrategy
+//
+//	@doc:
+//		Check the value of the optimizer_search_strategy GUC; return the
+//		position at which it is malformed, or null if it is well formed
+//
+//---------------------------------------------------------------------------
+const char *
+CGPOptimizer::CheckSearchStrategy(const char *stages)
+{
+	return COptTasks::CheckSearchStrategy(stages);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		GPOPTOptimizedPlan
@@ -301,4 +331,36 @@ TerminateGPOPT()
 }
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CheckCostModelParams()
+//
+//	@doc:
+//		Check the value of the optimizer_cost_model_params GUC
+//
+//---------------------------------------------------------------------------
+extern "C" {
+const char *
+CheckCostModelParams(const char *params)
+{
+	return CGPOptimizer::CheckCostModelParams(params);
+}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CheckSearchStrategy()
+//
+//	@doc:
+//		Check the value of the optimizer_search_strategy GUC
+//
+//---------------------------------------------------------------------------
+extern "C" {
+const char *
+CheckSearchStrategy(const char *stages)
+{
+	return CGPOptimizer::CheckSearchStrategy(stages);
+}
+}
+
 // EOF
@@ -20,6 +20,7 @@ extern "C" {
 }
 
 #include "gpopt/config/CConfigParamMapping.h"
+#include "gpopt/gpdbwrappers.h"
 #include "gpopt/xforms/CXform.h"
 
 using namespace gpos;
@@ -172,6 +173,11 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 GPOS_WSZ_LIT(
 		 "Enable stats derivation of partitioned tables with dynamic partition elimination.")},
 
+	{EopttraceMergeLeafPartitionStats, &optimizer_merge_partition_stats,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Merge the statistics of the leaf partitions that survive static partition elimination.")},
+
 	{EopttraceEnumeratePlans, &optimizer_enumerate_plans,
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT("Enable plan enumeration.")},
@@ -255,6 +261,11 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 GPOS_WSZ_LIT(
 		 "Allows the constraint framework to derive array constraints in the optimizer.")},
 
+	{EopttraceEnableAdaptiveSearch, &optimizer_adaptive_search,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Pick the search stages and their time budgets from the estimated size of the search space.")},
+
 	{EopttraceForceAggSkewAvoidance, &optimizer_force_agg_skew_avoidance,
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT(
@@ -473,6 +484,13 @@ CConfigParamMapping::PackConfigParamInBitset(
 	// enable using opfamilies in distribution specs for GPDB 6
 	traceflag_bitset->ExchangeSet(EopttraceConsiderOpfamiliesForDistribution);
 
+	// let constraint derivation order text types natively when the default
+	// collation orders them bytewise
+	if (gpdb::DefaultCollationIsC())
+	{
+		traceflag_bitset->ExchangeSet(EopttraceDefaultCollationIsC);
+	}
+
 	return traceflag_bitset;
 }
 
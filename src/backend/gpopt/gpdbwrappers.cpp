@@ -32,17 +32,24 @@
 #include "catalog/pg_collation.h"
 extern "C" {
 #include "access/external.h"
+#include "catalog/partition.h"
 #include "catalog/pg_inherits.h"
+#include "catalog/pg_statistic_ext.h"
+#include "commands/analyzeutils.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
 #include "optimizer/optimizer.h"
 #include "optimizer/plancat.h"
 #include "parser/parse_agg.h"
+#include "partitioning/partbounds.h"
 #include "partitioning/partdesc.h"
+#include "statistics/statistics.h"
 #include "storage/lmgr.h"
 #include "utils/fmgroids.h"
+#include "utils/mdcache_shmem.h"
 #include "utils/memutils.h"
 #include "utils/partcache.h"
+#include "utils/pg_locale.h"
 }
 #define GP_WRAP_START                                            \
 	sigjmp_buf local_sigjmp_buf;                                 \
@@ -362,6 +369,17 @@ gpdb::BmsAddMember(Bitmapset *a, int x)
 	return nullptr;
 }
 
+int
+gpdb::BmsNextMember(const Bitmapset *a, int prevbit)
+{
+	GP_WRAP_START;
+	{
+		return bms_next_member(a, prevbit);
+	}
+	GP_WRAP_END;
+	return -2;
+}
+
 void *
 gpdb::CopyObject(void *from)
 {
@@ -837,6 +855,44 @@ gpdb::GetRelationPartConstraints(Relation rel)
 	return nullptr;
 }
 
+Node *
+gpdb::GetPartitionBoundConstraint(Relation parent, Oid part_oid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_class */
+		HeapTuple tuple;
+		Datum bound_datum;
+		bool isnull;
+		List *part_quals = NIL;
+
+		tuple = SearchSysCache1(RELOID, ObjectIdGetDatum(part_oid));
+		if (!HeapTupleIsValid(tuple))
+			elog(ERROR, "cache lookup failed for relation %u", part_oid);
+
+		/*
+		 * Unlike RelationGetPartitionQual(), this neither opens the partition
+		 * nor maps the quals to its attribute numbers.
+		 */
+		bound_datum = SysCacheGetAttr(RELOID, tuple,
+									  Anum_pg_class_relpartbound, &isnull);
+		if (!isnull)
+		{
+			PartitionBoundSpec *bound = castNode(
+				PartitionBoundSpec,
+				stringToNode(TextDatumGetCString(bound_datum)));
+
+			part_quals = get_qual_from_partbound(nullptr, parent, bound);
+		}
+		ReleaseSysCache(tuple);
+
+		/* no quals, e.g. for a lone default partition, make a true constant */
+		return (Node *) make_ands_explicit(part_quals);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
 #if 0
 bool
 gpdb::HasExternalPartition
@@ -2033,6 +2089,169 @@ gpdb::GetRelationIndexes(Relation relation)
 	return NIL;
 }
 
+List *
+gpdb::GetExtStatisticsOids(Relation rel)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: from relcache */
+		return RelationGetStatExtList(rel);
+	}
+	GP_WRAP_END;
+	return NIL;
+}
+
+// Is the given kind of an extended statistics object built? ANALYZE fills
+// in only the kinds it could compute, and loading a missing one errors out
+static bool
+ext_stats_kind_is_built(Oid stat_oid, char kind)
+{
+	/* catalog tables: pg_statistic_ext_data */
+	HeapTuple tuple =
+		SearchSysCache1(STATEXTDATASTXOID, ObjectIdGetDatum(stat_oid));
+	bool is_built;
+
+	if (!HeapTupleIsValid(tuple))
+		return false;
+
+	is_built = statext_is_kind_built(tuple, kind);
+	ReleaseSysCache(tuple);
+
+	return is_built;
+}
+
+MVNDistinct *
+gpdb::GetMVNDistinct(Oid stat_oid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_statistic_ext_data */
+		if (ext_stats_kind_is_built(stat_oid, STATS_EXT_NDISTINCT))
+			return statext_ndistinct_load(stat_oid);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
+MVDependencies *
+gpdb::GetMVDependencies(Oid stat_oid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_statistic_ext_data */
+		if (ext_stats_kind_is_built(stat_oid, STATS_EXT_DEPENDENCIES))
+			return statext_dependencies_load(stat_oid);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
+MCVList *
+gpdb::GetMCVList(Oid stat_oid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_statistic_ext_data */
+		if (ext_stats_kind_is_built(stat_oid, STATS_EXT_MCV))
+			return statext_mcv_load(stat_oid);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
+List *
+gpdb::GetExtStatisticsKeys(Oid stat_oid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_statistic_ext */
+		HeapTuple tuple =
+			SearchSysCache1(STATEXTOID, ObjectIdGetDatum(stat_oid));
+		List *attnos = NIL;
+
+		if (!HeapTupleIsValid(tuple))
+			elog(ERROR, "cache lookup failed for statistics object %u",
+				 stat_oid);
+
+		/* the keys are kept sorted, as are the dimensions of the MCV list */
+		Form_pg_statistic_ext stat_form =
+			(Form_pg_statistic_ext) GETSTRUCT(tuple);
+		for (int i = 0; i < stat_form->stxkeys.dim1; i++)
+			attnos = lappend_int(attnos, stat_form->stxkeys.values[i]);
+
+		ReleaseSysCache(tuple);
+		return attnos;
+	}
+	GP_WRAP_END;
+	return NIL;
+}
+
+void
+gpdb::FreeMVNDistinct(MVNDistinct *ndistinct)
+{
+	GP_WRAP_START;
+	{
+		/* the items are allocated along with the struct, but not their sets */
+		for (uint32 i = 0; i < ndistinct->nitems; i++)
+			bms_free(ndistinct->items[i].attrs);
+		pfree(ndistinct);
+		return;
+	}
+	GP_WRAP_END;
+}
+
+void
+gpdb::FreeMVDependencies(MVDependencies *dependencies)
+{
+	GP_WRAP_START;
+	{
+		for (uint32 i = 0; i < dependencies->ndeps; i++)
+			pfree(dependencies->deps[i]);
+		pfree(dependencies);
+		return;
+	}
+	GP_WRAP_END;
+}
+
+bool
+gpdb::MergeLeafAttStats(Oid rel_oid, AttrNumber attno, List *leaf_oids,
+						MergedLeafStats *result)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_attribute, pg_class, pg_statistic, pg_type */
+		HeapTuple att_tuple = SearchSysCache2(
+			ATTNUM, ObjectIdGetDatum(rel_oid), Int16GetDatum(attno));
+		Oid att_type;
+		int stattarget;
+		Oid eq_opr;
+		Oid lt_opr;
+
+		if (!HeapTupleIsValid(att_tuple))
+			return false;
+
+		att_type = ((Form_pg_attribute) GETSTRUCT(att_tuple))->atttypid;
+		stattarget = ((Form_pg_attribute) GETSTRUCT(att_tuple))->attstattarget;
+		ReleaseSysCache(att_tuple);
+
+		if (stattarget < 0)
+			stattarget = default_statistics_target;
+
+		/* ANALYZE merges leaf statistics under the same conditions */
+		get_sort_group_operators(att_type, false, false, false, &lt_opr,
+								 &eq_opr, nullptr, nullptr);
+		if (!OidIsValid(eq_opr) || !OidIsValid(lt_opr) ||
+			!op_hashjoinable(eq_opr, att_type))
+			return false;
+
+		return merge_leaf_att_stats(rel_oid, attno, leaf_oids, stattarget,
+									eq_opr, lt_opr, CurrentMemoryContext,
+									result);
+	}
+	GP_WRAP_END;
+	return false;
+}
+
 gpdb::RelationWrapper
 gpdb::GetRelation(Oid rel_oid)
 {
@@ -2245,6 +2464,17 @@ gpdb::CheckCollation(Node *node)
 	return -1;
 }
 
+bool
+gpdb::DefaultCollationIsC()
+{
+	GP_WRAP_START;
+	{
+		return lc_collate_is_c(DEFAULT_COLLATION_OID);
+	}
+	GP_WRAP_END;
+	return false;
+}
+
 Node *
 gpdb::CoerceToCommonType(ParseState *pstate, Node *node, Oid target_type,
 						 const char *context)
@@ -2519,16 +2749,20 @@ gpdb::CountLeafPartTables
 #endif
 
 /*
- * To detect changes to catalog tables that require resetting the Metadata
- * Cache, we use the normal PostgreSQL catalog cache invalidation mechanism.
- * We register a callback to a cache on all the catalog tables that contain
- * information that's contained in the ORCA metadata cache.
-
- * There is no fine-grained mechanism in the metadata cache for invalidating
- * individual entries ATM, so we just blow the whole cache whenever anything
- * changes. The callback simply increments a counter. Whenever we start
- * planning a query, we check the counter to see if it has changed since the
- * last planned query, and reset the whole cache if it has.
+ * To detect changes to catalog tables that affect the Metadata Cache, we use
+ * the normal PostgreSQL catalog cache invalidation mechanism. We register a
+ * callback to a cache on all the catalog tables that contain information
+ * that's contained in the ORCA metadata cache.
+ *
+ * The callbacks record the invalidation events: the OIDs of invalidated
+ * relations, and the hash values of invalidated syscache entries. Whenever
+ * we start planning a query, COptTasks checks each cached object against
+ * the pending events and evicts only the affected ones (see
+ * MDCacheRelationIsInvalid() and friends below). We fall back to resetting
+ * the whole cache when an event cannot be attributed to individual objects:
+ * a full cache flush, too many pending events, or changes to operators and
+ * operator families, which are looked up indirectly through types and
+ * comparisons.
  *
  * To make sure we've covered all catalog tables that contain information
  * that's stored in the metadata cache, there are "catalog tables: xxx"
@@ -2537,41 +2771,95 @@ gpdb::CountLeafPartTables
  * anything fetched via the wrapper functions in this file can end up in the
  * metadata cache and hence need to have an invalidation callback registered.
  */
-static bool mdcache_invalidation_counter_registered = false;
-static int64 mdcache_invalidation_counter = 0;
-static int64 last_mdcache_invalidation_counter = 0;
+#define MDCACHE_MAX_PENDING_INVALIDATIONS 1024
+
+typedef struct MDCacheSyscacheInvalidation
+{
+	int cacheid;
+	uint32 hashvalue;
+} MDCacheSyscacheInvalidation;
+
+static bool mdcache_invalidation_callbacks_registered = false;
+static bool mdcache_needs_reset = false;
+
+/* invalidations recorded since the last query */
+static Oid mdcache_invalid_relids[MDCACHE_MAX_PENDING_INVALIDATIONS];
+static int mdcache_num_invalid_relids = 0;
+
+static MDCacheSyscacheInvalidation
+	mdcache_invalid_syscache_entries[MDCACHE_MAX_PENDING_INVALIDATIONS];
+static int mdcache_num_invalid_syscache_entries = 0;
+
+/*
+ * Invalidations being applied to the cache by the current query. Events
+ * that arrive while they are applied (catalog lookups may accept
+ * invalidation messages) are recorded above, for the next query.
+ */
+static Oid mdcache_applied_relids[MDCACHE_MAX_PENDING_INVALIDATIONS];
+static int mdcache_num_applied_relids = 0;
+
+static MDCacheSyscacheInvalidation
+	mdcache_applied_syscache_entries[MDCACHE_MAX_PENDING_INVALIDATIONS];
+static int mdcache_num_applied_syscache_entries = 0;
 
 static void
-mdsyscache_invalidation_counter_callback(Datum arg, int cacheid,
-										 uint32 hashvalue)
+mdsyscache_reset_callback(Datum arg, int cacheid, uint32 hashvalue)
 {
-	mdcache_invalidation_counter++;
+	mdcache_needs_reset = true;
 }
 
 static void
-mdrelcache_invalidation_counter_callback(Datum arg, Oid relid)
+mdsyscache_invalidation_callback(Datum arg, int cacheid, uint32 hashvalue)
 {
-	mdcache_invalidation_counter++;
+	/* hash value 0 means the whole syscache was flushed */
+	if (0 == hashvalue ||
+		MDCACHE_MAX_PENDING_INVALIDATIONS ==
+			mdcache_num_invalid_syscache_entries)
+	{
+		mdcache_needs_reset = true;
+		return;
+	}
+
+	mdcache_invalid_syscache_entries[mdcache_num_invalid_syscache_entries]
+		.cacheid = cacheid;
+	mdcache_invalid_syscache_entries[mdcache_num_invalid_syscache_entries]
+		.hashvalue = hashvalue;
+	mdcache_num_invalid_syscache_entries++;
+}
+
+static void
+mdrelcache_invalidation_callback(Datum arg, Oid relid)
+{
+	/* InvalidOid means the whole relcache was flushed */
+	if (InvalidOid == relid ||
+		MDCACHE_MAX_PENDING_INVALIDATIONS == mdcache_num_invalid_relids)
+	{
+		mdcache_needs_reset = true;
+		return;
+	}
+
+	mdcache_invalid_relids[mdcache_num_invalid_relids++] = relid;
 }
 
 static void
 register_mdcache_invalidation_callbacks(void)
 {
-	/* These are all the catalog tables that we care about. */
+	/*
+	 * These are the catalog tables whose rows map to individual cache
+	 * objects.
+	 */
 	int metadata_caches[] = {
 		AGGFNOID,		  /* pg_aggregate */
-		AMOPOPID,		  /* pg_amop */
 		CASTSOURCETARGET, /* pg_cast */
 		CONSTROID,		  /* pg_constraint */
-		OPEROID,		  /* pg_operator */
-		OPFAMILYOID,	  /* pg_opfamily */
 #if 0
 		PARTOID,			/* pg_partition */
 		PARTRULEOID,		/* pg_partition_rule */
 #endif
-		STATRELATTINH, /* pg_statistics */
-		TYPEOID,	   /* pg_type */
-		PROCOID,	   /* pg_proc */
+		STATRELATTINH,	   /* pg_statistics */
+		STATEXTDATASTXOID, /* pg_statistic_ext_data */
+		TYPEOID,		   /* pg_type */
+		PROCOID,		   /* pg_proc */
 
 		/*
 		 * lookup_type_cache() will also access pg_opclass, via GetDefaultOpClass(),
@@ -2609,44 +2897,319 @@ register_mdcache_invalidation_callbacks(void)
 		 */
 		/* gp_segment_config */
 	};
+
+	/*
+	 * Operators and operator families are resolved indirectly, e.g. when
+	 * looking up the comparison operators of a type, so any change to
+	 * them resets the whole cache.
+	 */
+	int reset_caches[] = {
+		AMOPOPID,	 /* pg_amop */
+		OPEROID,	 /* pg_operator */
+		OPFAMILYOID, /* pg_opfamily */
+	};
 	unsigned int i;
 
 	for (i = 0; i < lengthof(metadata_caches); i++)
 	{
 		CacheRegisterSyscacheCallback(metadata_caches[i],
-									  &mdsyscache_invalidation_counter_callback,
+									  &mdsyscache_invalidation_callback,
 									  (Datum) 0);
 	}
 
+	for (i = 0; i < lengthof(reset_caches); i++)
+	{
+		CacheRegisterSyscacheCallback(
+			reset_caches[i], &mdsyscache_reset_callback, (Datum) 0);
+	}
+
 	/* also register the relcache callback */
-	CacheRegisterRelcacheCallback(&mdrelcache_invalidation_counter_callback,
+	CacheRegisterRelcacheCallback(&mdrelcache_invalidation_callback,
 								  (Datum) 0);
 }
 
-// Has there been any catalog changes since last call?
+static bool
+mdcache_syscache_entry_is_invalid(int cacheid, uint32 hashvalue)
+{
+	int i;
+
+	for (i = 0; i < mdcache_num_applied_syscache_entries; i++)
+	{
+		if (mdcache_applied_syscache_entries[i].cacheid == cacheid &&
+			mdcache_applied_syscache_entries[i].hashvalue == hashvalue)
+			return true;
+	}
+
+	return false;
+}
+
+// Has there been a catalog change since last call that cannot be handled
+// by evicting individual cache entries? If not, the invalidations recorded
+// since the last call become the ones checked by the MDCache*IsInvalid()
+// functions below.
 bool
 gpdb::MDCacheNeedsReset(void)
 {
 	GP_WRAP_START;
 	{
-		if (!mdcache_invalidation_counter_registered)
+		int num_relids;
+		int i;
+
+		if (!mdcache_invalidation_callbacks_registered)
 		{
 			register_mdcache_invalidation_callbacks();
-			mdcache_invalidation_counter_registered = true;
+			mdcache_invalidation_callbacks_registered = true;
+		}
+
+		/*
+		 * Statistics of partitioned tables are derived from their
+		 * partitions, so treat their ancestors as invalidated too.
+		 */
+		num_relids = mdcache_num_invalid_relids;
+		for (i = 0; i < num_relids && !mdcache_needs_reset; i++)
+		{
+			/* catalog tables: pg_inherits */
+			List *ancestors =
+				get_partition_ancestors(mdcache_invalid_relids[i]);
+			ListCell *lc;
+
+			foreach (lc, ancestors)
+			{
+				mdrelcache_invalidation_callback((Datum) 0, lfirst_oid(lc));
+			}
+			list_free(ancestors);
+		}
+
+		if (mdcache_needs_reset)
+		{
+			mdcache_needs_reset = false;
+			mdcache_num_invalid_relids = 0;
+			mdcache_num_invalid_syscache_entries = 0;
+			mdcache_num_applied_relids = 0;
+			mdcache_num_applied_syscache_entries = 0;
+
+			return true;
 		}
-		if (last_mdcache_invalidation_counter == mdcache_invalidation_counter)
+
+		memcpy(mdcache_applied_relids, mdcache_invalid_relids,
+			   mdcache_num_invalid_relids * sizeof(Oid));
+		mdcache_num_applied_relids = mdcache_num_invalid_relids;
+		mdcache_num_invalid_relids = 0;
+
+		memcpy(mdcache_applied_syscache_entries,
+			   mdcache_invalid_syscache_entries,
+			   mdcache_num_invalid_syscache_entries *
+				   sizeof(MDCacheSyscacheInvalidation));
+		mdcache_num_applied_syscache_entries =
+			mdcache_num_invalid_syscache_entries;
+		mdcache_num_invalid_syscache_entries = 0;
+
+		return false;
+	}
+	GP_WRAP_END;
+
+	return true;
+}
+
+// Are there invalidations of individual cache entries to apply?
+bool
+gpdb::MDCacheHasPendingInvalidations(void)
+{
+	return (0 < mdcache_num_applied_relids ||
+			0 < mdcache_num_applied_syscache_entries);
+}
+
+// Has the given relation been invalidated since the last query?
+bool
+gpdb::MDCacheRelationIsInvalid(Oid relid)
+{
+	int i;
+
+	for (i = 0; i < mdcache_num_applied_relids; i++)
+	{
+		if (mdcache_applied_relids[i] == relid)
+			return true;
+	}
+
+	return false;
+}
+
+// Has the pg_type, pg_proc, pg_aggregate or pg_constraint entry with the
+// given OID been invalidated since the last query?
+bool
+gpdb::MDCacheObjectIsInvalid(Oid oid)
+{
+	GP_WRAP_START;
+	{
+		int oid_caches[] = {TYPEOID, PROCOID, AGGFNOID, CONSTROID};
+		unsigned int i;
+
+		if (0 == mdcache_num_applied_syscache_entries)
 			return false;
-		else
+
+		for (i = 0; i < lengthof(oid_caches); i++)
+		{
+			if (mdcache_syscache_entry_is_invalid(
+					oid_caches[i], GetSysCacheHashValue1(
+									   oid_caches[i], ObjectIdGetDatum(oid))))
+				return true;
+		}
+
+		return false;
+	}
+	GP_WRAP_END;
+
+	return true;
+}
+
+// Has the pg_cast entry for the given types been invalidated since the last
+// query?
+bool
+gpdb::MDCacheCastIsInvalid(Oid src_oid, Oid dest_oid)
+{
+	GP_WRAP_START;
+	{
+		if (0 == mdcache_num_applied_syscache_entries)
+			return false;
+
+		return mdcache_syscache_entry_is_invalid(
+			CASTSOURCETARGET,
+			GetSysCacheHashValue2(CASTSOURCETARGET, ObjectIdGetDatum(src_oid),
+								  ObjectIdGetDatum(dest_oid)));
+	}
+	GP_WRAP_END;
+
+	return true;
+}
+
+// Has any pg_statistic entry of the given relation been invalidated since
+// the last query?
+bool
+gpdb::MDCacheStatsAreInvalid(Oid relid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_class */
+		HeapTuple tuple;
+		int natts;
+		int attno;
+
+		if (0 == mdcache_num_applied_syscache_entries)
+			return false;
+
+		tuple = SearchSysCache1(RELOID, ObjectIdGetDatum(relid));
+		if (!HeapTupleIsValid(tuple))
+			return true;
+
+		natts = ((Form_pg_class) GETSTRUCT(tuple))->relnatts;
+		ReleaseSysCache(tuple);
+
+		for (attno = 1; attno <= natts; attno++)
 		{
-			last_mdcache_invalidation_counter = mdcache_invalidation_counter;
+			if (mdcache_syscache_entry_is_invalid(
+					STATRELATTINH,
+					GetSysCacheHashValue3(
+						STATRELATTINH, ObjectIdGetDatum(relid),
+						Int16GetDatum(attno), BoolGetDatum(false))) ||
+				mdcache_syscache_entry_is_invalid(
+					STATRELATTINH,
+					GetSysCacheHashValue3(
+						STATRELATTINH, ObjectIdGetDatum(relid),
+						Int16GetDatum(attno), BoolGetDatum(true))))
+				return true;
+		}
+
+		return false;
+	}
+	GP_WRAP_END;
+
+	return true;
+}
+
+// Has the data of any extended statistics object of the given relation been
+// invalidated since the last query? Creating or dropping a statistics object
+// invalidates the relation itself, ANALYZE only its pg_statistic_ext_data rows
+bool
+gpdb::MDCacheExtStatsAreInvalid(Oid relid)
+{
+	GP_WRAP_START;
+	{
+		Relation rel;
+		List *stat_oids;
+		ListCell *lc;
+		bool is_invalid = false;
+
+		if (0 == mdcache_num_applied_syscache_entries)
+			return false;
+
+		/* catalog tables: relcache */
+		rel = RelationIdGetRelation(relid);
+		if (!RelationIsValid(rel))
 			return true;
+
+		stat_oids = RelationGetStatExtList(rel);
+		RelationClose(rel);
+
+		foreach (lc, stat_oids)
+		{
+			if (mdcache_syscache_entry_is_invalid(
+					STATEXTDATASTXOID,
+					GetSysCacheHashValue1(STATEXTDATASTXOID,
+										  ObjectIdGetDatum(lfirst_oid(lc)))))
+			{
+				is_invalid = true;
+				break;
+			}
 		}
+		list_free(stat_oids);
+
+		return is_invalid;
 	}
 	GP_WRAP_END;
 
 	return true;
 }
 
+// catalog version to tag shared metadata cache lookups and insertions of the
+// current optimization with, or 0 if the shared cache cannot be used
+uint64
+gpdb::SharedMDCacheBeginOptimization(void)
+{
+	GP_WRAP_START;
+	{
+		return MDCacheShmemBeginOptimization();
+	}
+	GP_WRAP_END;
+
+	return 0;
+}
+
+// look up a serialized metadata object in the shared metadata cache
+char *
+gpdb::SharedMDCacheLookup(uint64 version, const char *key, Size *len)
+{
+	GP_WRAP_START;
+	{
+		return MDCacheShmemLookup(version, key, len);
+	}
+	GP_WRAP_END;
+
+	return nullptr;
+}
+
+// publish a serialized metadata object in the shared metadata cache
+void
+gpdb::SharedMDCacheInsert(uint64 version, const char *key, const char *data,
+						  Size len)
+{
+	GP_WRAP_START;
+	{
+		MDCacheShmemInsert(version, key, data, len);
+		return;
+	}
+	GP_WRAP_END;
+}
+
 // returns true if a query cancel is requested in GPDB
 bool
 gpdb::IsAbortRequested(void)
@@ -2775,6 +3338,24 @@ gpdb::GPDBAllocSetContextCreate()
 	return nullptr;
 }
 
+MemoryContext
+gpdb::GPDBGenerationContextCreate()
+{
+	GP_WRAP_START;
+	{
+		/*
+		 * Chunks are carved from large blocks in allocation order, and a
+		 * block is only released once all its chunks are freed, which suits
+		 * the ORCA pools whose objects mostly live as long as the pool.
+		 */
+		return GenerationContextCreate(OptimizerMemoryContext,
+									   "GPORCA arena memory pool",
+									   SLAB_LARGE_BLOCK_SIZE);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
 bool
 gpdb::ExpressionReturnsSet(Node *clause)
 {
@@ -16,7 +16,10 @@
 
 extern "C" {
 #include "postgres.h"
+
+#include "utils/mdcache_shmem.h"
 }
+#include "gpopt/gpdbwrappers.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/relcache/CMDProviderRelcache.h"
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
@@ -32,10 +35,14 @@ using namespace gpmd;
 //		CMDProviderRelcache::CMDProviderRelcache
 //
 //	@doc:
-//		Constructs a file-based metadata provider
+//		Constructs a relcache-based metadata provider. The provider lives
+//		for a single optimization, which fixes the catalog version of the
+//		shared metadata cache entries it may use.
 //
 //---------------------------------------------------------------------------
-CMDProviderRelcache::CMDProviderRelcache(CMemoryPool *mp) : m_mp(mp)
+CMDProviderRelcache::CMDProviderRelcache(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_shared_mdcache_version(gpdb::SharedMDCacheBeginOptimization())
 {
 	GPOS_ASSERT(nullptr != m_mp);
 }
@@ -66,16 +73,84 @@ CMDProviderRelcache::GetMDObjDXLStr(CMemoryPool *mp, CMDAccessor *md_accessor,
 	return str;
 }
 
-// return the requested metadata object
+// return the requested metadata object, from the shared metadata cache if
+// another backend of the same database has already translated it under the
+// current catalog version
 IMDCacheObject *
 CMDProviderRelcache::GetMDObj(CMemoryPool *mp, CMDAccessor *md_accessor,
 							  IMDId *mdid) const
 {
+	CHAR key[MDCACHE_SHMEM_KEYSIZE];
+	BOOL use_shared_cache = false;
+
+	if (0 != m_shared_mdcache_version)
+	{
+		// mdids serialize to ASCII, anything else is not worth caching
+		const WCHAR *mdid_str = mdid->GetBuffer();
+		ULONG ul = 0;
+		while (ul < MDCACHE_SHMEM_KEYSIZE - 1 && 0 != mdid_str[ul] &&
+			   0x80 > (ULONG) mdid_str[ul])
+		{
+			key[ul] = (CHAR) mdid_str[ul];
+			ul++;
+		}
+		key[ul] = '\0';
+		use_shared_cache = (0 == mdid_str[ul]);
+	}
+
+	if (use_shared_cache)
+	{
+		IMDCacheObject *md_obj = GetSharedMDObj(mp, key);
+		if (nullptr != md_obj)
+		{
+			return md_obj;
+		}
+	}
+
 	IMDCacheObject *md_obj =
 		CTranslatorRelcacheToDXL::RetrieveObject(mp, md_accessor, mdid);
 	GPOS_ASSERT(nullptr != md_obj);
 
+	if (use_shared_cache)
+	{
+		PublishSharedMDObj(mp, key, md_obj);
+	}
+
 	return md_obj;
 }
 
+// look up the object with the given serialized mdid in the shared metadata
+// cache and parse it, return nullptr if there is no current entry
+IMDCacheObject *
+CMDProviderRelcache::GetSharedMDObj(CMemoryPool *mp, const CHAR *key) const
+{
+	Size len = 0;
+	CHAR *data = gpdb::SharedMDCacheLookup(m_shared_mdcache_version, key, &len);
+	if (nullptr == data)
+	{
+		return nullptr;
+	}
+
+	GPOS_ASSERT(0 == len % GPOS_SIZEOF(WCHAR));
+	CWStringConst dxl_str(mp, (const WCHAR *) data);
+	gpdb::GPDBFree(data);
+
+	return CDXLUtils::ParseDXLToIMDIdCacheObj(mp, &dxl_str,
+											  nullptr /*xsd_file_path*/);
+}
+
+// serialize the given object and publish it in the shared metadata cache
+void
+CMDProviderRelcache::PublishSharedMDObj(CMemoryPool *mp, const CHAR *key,
+										const IMDCacheObject *md_obj) const
+{
+	CAutoP<CWStringDynamic> dxl_str(CDXLUtils::SerializeMDObj(
+		mp, md_obj, true /*fSerializeHeaders*/, false /*findent*/));
+
+	// include the terminator, so lookups can use the copy as is
+	gpdb::SharedMDCacheInsert(
+		m_shared_mdcache_version, key, (const CHAR *) dxl_str->GetBuffer(),
+		(dxl_str->Length() + 1) * GPOS_SIZEOF(WCHAR));
+}
+
 // EOF
@@ -25,6 +25,7 @@ extern "C" {
 }
 
 #include "gpos/base.h"
+#include "gpos/common/clibwrapper.h"
 
 #include "gpopt/gpdbwrappers.h"
 #include "gpopt/translate/CContextDXLToPlStmt.h"
@@ -51,6 +52,7 @@ CContextDXLToPlStmt::CContextDXLToPlStmt(
 	  m_param_types_list(NIL),
 	  m_distribution_hashops(distribution_hashops),
 	  m_rtable_entries_list(nullptr),
+	  m_rel_oid_to_rte_index_map(nullptr),
 	  m_partitioned_tables_list(nullptr),
 	  m_num_partition_selectors_array(nullptr),
 	  m_subplan_entries_list(nullptr),
@@ -59,11 +61,14 @@ CContextDXLToPlStmt::CContextDXLToPlStmt(
 	  m_result_relation_index(0),
 	  m_into_clause(nullptr),
 	  m_distribution_policy(nullptr),
-	  m_part_selector_to_param_map(nullptr)
+	  m_part_selector_to_param_map(nullptr),
+	  m_name_to_multibyte_map(nullptr)
 {
+	m_rel_oid_to_rte_index_map = GPOS_NEW(m_mp) UlongToUlongMap(m_mp);
 	m_cte_consumer_info = GPOS_NEW(m_mp) HMUlCTEConsumerInfo(m_mp);
 	m_num_partition_selectors_array = GPOS_NEW(m_mp) ULongPtrArray(m_mp);
 	m_part_selector_to_param_map = GPOS_NEW(m_mp) UlongToUlongMap(m_mp);
+	m_name_to_multibyte_map = GPOS_NEW(m_mp) NameToMultiByteMap(m_mp);
 }
 
 //---------------------------------------------------------------------------
@@ -79,6 +84,8 @@ CContextDXLToPlStmt::~CContextDXLToPlStmt()
 	m_cte_consumer_info->Release();
 	m_num_partition_selectors_array->Release();
 	m_part_selector_to_param_map->Release();
+	m_rel_oid_to_rte_index_map->Release();
+	m_name_to_multibyte_map->Release();
 }
 
 //---------------------------------------------------------------------------
@@ -216,6 +223,15 @@ CContextDXLToPlStmt::AddRTE(RangeTblEntry *rte, BOOL is_result_relation)
 {
 	m_rtable_entries_list = gpdb::LAppend(m_rtable_entries_list, rte);
 
+	// remember the first entry of each relation for FindRTE
+	ULONG reloid = rte->relid;
+	if (nullptr == m_rel_oid_to_rte_index_map->Find(&reloid))
+	{
+		m_rel_oid_to_rte_index_map->Insert(
+			GPOS_NEW(m_mp) ULONG(reloid),
+			GPOS_NEW(m_mp) ULONG(gpdb::ListLength(m_rtable_entries_list)));
+	}
+
 	rte->inFromCl = true;
 
 	if (is_result_relation)
@@ -549,20 +565,77 @@ CContextDXLToPlStmt::GetParamIdForSelector(OID oid_type, ULONG selectorId)
 	return *param_id;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CContextDXLToPlStmt::FindRTE
+//
+//	@doc:
+//		Index of the first range table entry of the given relation, or -1
+//		if the relation is not in the range table yet
+//
+//---------------------------------------------------------------------------
 Index
 CContextDXLToPlStmt::FindRTE(Oid reloid)
 {
-	ListCell *lc;
-	int idx = 0;
+	ULONG oid = reloid;
+	ULONG *rte_index = m_rel_oid_to_rte_index_map->Find(&oid);
+	if (nullptr == rte_index)
+	{
+		return -1;
+	}
+	return *rte_index;
+}
+
+// hash of a wide character name
+ULONG
+CContextDXLToPlStmt::HashName(const WCHAR *name)
+{
+	return gpos::HashByteArray((const BYTE *) name,
+							   GPOS_WSZ_LENGTH(name) * GPOS_SIZEOF(WCHAR));
+}
 
-	ForEachWithCount(lc, m_rtable_entries_list, idx)
+// equality of wide character names
+BOOL
+CContextDXLToPlStmt::EqualNames(const WCHAR *name, const WCHAR *other_name)
+{
+	const ULONG length = GPOS_WSZ_LENGTH(name);
+	return length == GPOS_WSZ_LENGTH(other_name) &&
+		   0 == clib::Wcsncmp(name, other_name, length);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CContextDXLToPlStmt::GetMultiByteName
+//
+//	@doc:
+//		Multibyte conversion of the given name, converting it on first use.
+//		The conversion is shared by all plan nodes using the name, so
+//		callers must not modify it
+//
+//---------------------------------------------------------------------------
+CHAR *
+CContextDXLToPlStmt::GetMultiByteName(const CWStringBase *name)
+{
+	GPOS_ASSERT(nullptr != name);
+
+	const WCHAR *wsz = name->GetBuffer();
+	CHAR *mb_name = m_name_to_multibyte_map->Find(wsz);
+	if (nullptr != mb_name)
 	{
-		RangeTblEntry *rte = (RangeTblEntry *) lfirst(lc);
-		if (rte->relid == reloid)
-		{
-			return idx + 1;
-		}
+		return mb_name;
 	}
-	return -1;
+
+	mb_name = CTranslatorUtils::CreateMultiByteCharStringFromWCString(wsz);
+
+	const ULONG length = GPOS_WSZ_LENGTH(wsz);
+	WCHAR *wsz_copy = GPOS_NEW_ARRAY(m_mp, WCHAR, length + 1);
+	clib::Wmemcpy(wsz_copy, wsz, length + 1);
+
+	BOOL inserted GPOS_ASSERTS_ONLY =
+		m_name_to_multibyte_map->Insert(wsz_copy, mb_name);
+	GPOS_ASSERT(inserted);
+
+	return mb_name;
 }
+
 // EOF
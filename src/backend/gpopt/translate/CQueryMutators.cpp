@@ -1045,37 +1045,62 @@ CQueryMutators::NormalizeHaving(CMemoryPool *mp, CMDAccessor *md_accessor,
 //		CQueryMutators::NormalizeQuery
 //
 //	@doc:
-//		Normalize queries with having and group by clauses
+//		Normalize queries with having and group by clauses.
+//
+//		Flattening join alias vars returns a copy of the query, which the
+//		remaining steps normalize in turn. Each step copies the whole query
+//		tree, including its subqueries, so it only runs when the query has
+//		something to normalize; otherwise the copy is passed on as is. The
+//		translator normalizes every query level, so copying at each step
+//		would copy nested subqueries many times over.
 //---------------------------------------------------------------------------
 Query *
 CQueryMutators::NormalizeQuery(CMemoryPool *mp, CMDAccessor *md_accessor,
 							   const Query *query, ULONG query_level)
 {
 	// flatten join alias vars defined at the current level of the query
-	Query *pqueryResolveJoinVarReferences =
+	Query *new_query =
 		gpdb::FlattenJoinAliasVar(const_cast<Query *>(query), query_level);
 
 	// eliminate distinct clause
-	Query *pqueryEliminateDistinct =
-		CQueryMutators::EliminateDistinctClause(pqueryResolveJoinVarReferences);
-	GPOS_ASSERT(nullptr == pqueryEliminateDistinct->distinctClause);
-	gpdb::GPDBFree(pqueryResolveJoinVarReferences);
+	if (0 < gpdb::ListLength(new_query->distinctClause))
+	{
+		Query *pqueryEliminateDistinct =
+			CQueryMutators::EliminateDistinctClause(new_query);
+		gpdb::GPDBFree(new_query);
+		new_query = pqueryEliminateDistinct;
+	}
+	GPOS_ASSERT(nullptr == new_query->distinctClause);
 
 	// normalize window operator's project list
-	Query *pqueryWindowPlNormalized = CQueryMutators::NormalizeWindowProjList(
-		mp, md_accessor, pqueryEliminateDistinct);
-	gpdb::GPDBFree(pqueryEliminateDistinct);
+	if (NeedsProjListWindowNormalization(new_query))
+	{
+		Query *pqueryWindowPlNormalized =
+			CQueryMutators::NormalizeWindowProjList(mp, md_accessor,
+													new_query);
+		gpdb::GPDBFree(new_query);
+		new_query = pqueryWindowPlNormalized;
+	}
 
 	// pull-up having quals into a select
-	Query *pqueryHavingNormalized = CQueryMutators::NormalizeHaving(
-		mp, md_accessor, pqueryWindowPlNormalized);
-	GPOS_ASSERT(nullptr == pqueryHavingNormalized->havingQual);
-	gpdb::GPDBFree(pqueryWindowPlNormalized);
+	if (nullptr != new_query->havingQual)
+	{
+		Query *pqueryHavingNormalized =
+			CQueryMutators::NormalizeHaving(mp, md_accessor, new_query);
+		gpdb::GPDBFree(new_query);
+		new_query = pqueryHavingNormalized;
+	}
+	GPOS_ASSERT(nullptr == new_query->havingQual);
 
 	// normalize the group by project list
-	Query *new_query = CQueryMutators::NormalizeGroupByProjList(
-		mp, md_accessor, pqueryHavingNormalized);
-	gpdb::GPDBFree(pqueryHavingNormalized);
+	if (NeedsProjListNormalization(new_query))
+	{
+		Query *pqueryGrpByNormalized =
+			CQueryMutators::NormalizeGroupByProjList(mp, md_accessor,
+													 new_query);
+		gpdb::GPDBFree(new_query);
+		new_query = pqueryGrpByNormalized;
+	}
 
 	return new_query;
 }
@@ -1537,8 +1537,8 @@ CTranslatorDXLToPlStmt::TranslateDXLTvfToRangeTblEntry(
 			CDXLScalarProjElem::Cast(proj_elem_dxlnode->GetOperator());
 
 		CHAR *col_name_char_array =
-			CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-				dxl_proj_elem->GetMdNameAlias()->GetMDName()->GetBuffer());
+			m_dxl_to_plstmt_context->GetMultiByteName(
+				dxl_proj_elem->GetMdNameAlias()->GetMDName());
 
 		Value *val_colname = gpdb::MakeStringValue(col_name_char_array);
 		alias->colnames = gpdb::LAppend(alias->colnames, val_colname);
@@ -1631,8 +1631,8 @@ CTranslatorDXLToPlStmt::TranslateDXLValueScanToRangeTblEntry(
 			CDXLScalarProjElem::Cast(proj_elem_dxlnode->GetOperator());
 
 		CHAR *col_name_char_array =
-			CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-				dxl_proj_elem->GetMdNameAlias()->GetMDName()->GetBuffer());
+			m_dxl_to_plstmt_context->GetMultiByteName(
+				dxl_proj_elem->GetMdNameAlias()->GetMDName());
 
 		Value *val_colname = gpdb::MakeStringValue(col_name_char_array);
 		alias->colnames = gpdb::LAppend(alias->colnames, val_colname);
@@ -3013,8 +3013,8 @@ CTranslatorDXLToPlStmt::TranslateDXLSubQueryScan(
 	alias->colnames = NIL;
 
 	// get table alias
-	alias->aliasname = CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-		subquery_scan_dxlop->MdName()->GetMDName()->GetBuffer());
+	alias->aliasname = m_dxl_to_plstmt_context->GetMultiByteName(
+		subquery_scan_dxlop->MdName()->GetMDName());
 
 	// get column names from child project list
 	CDXLTranslateContextBaseTable base_table_context(m_mp);
@@ -3539,8 +3539,8 @@ CTranslatorDXLToPlStmt::TranslateDXLAppend(
 		TargetEntry *target_entry = MakeNode(TargetEntry);
 		target_entry->expr = (Expr *) var;
 		target_entry->resname =
-			CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-				sc_proj_elem_dxlop->GetMdNameAlias()->GetMDName()->GetBuffer());
+			m_dxl_to_plstmt_context->GetMultiByteName(
+				sc_proj_elem_dxlop->GetMdNameAlias()->GetMDName());
 		target_entry->resno = attno;
 
 		// add column mapping to output translation context
@@ -3740,8 +3740,8 @@ CTranslatorDXLToPlStmt::TranslateDXLCTEConsumerToSharedScan(
 			gpdb::MakeVar(OUTER_VAR, (AttrNumber)(ul + 1), oid_type,
 						  sc_ident_dxlop->TypeModifier(), 0 /* varlevelsup */);
 
-		CHAR *resname = CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-			sc_proj_elem_dxlop->GetMdNameAlias()->GetMDName()->GetBuffer());
+		CHAR *resname = m_dxl_to_plstmt_context->GetMultiByteName(
+			sc_proj_elem_dxlop->GetMdNameAlias()->GetMDName());
 		TargetEntry *target_entry = gpdb::MakeTargetEntry(
 			(Expr *) var, (AttrNumber)(ul + 1), resname, false /* resjunk */);
 		plan->targetlist = gpdb::LAppend(plan->targetlist, target_entry);
@@ -4330,8 +4330,8 @@ CTranslatorDXLToPlStmt::TranslateDXLTblDescrToRangeTblEntry(
 	alias->colnames = NIL;
 
 	// get table alias
-	alias->aliasname = CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-		table_descr->MdName()->GetMDName()->GetBuffer());
+	alias->aliasname = m_dxl_to_plstmt_context->GetMultiByteName(
+		table_descr->MdName()->GetMDName());
 
 	// get column names
 	const ULONG arity = table_descr->Arity();
@@ -4361,8 +4361,8 @@ CTranslatorDXLToPlStmt::TranslateDXLTblDescrToRangeTblEntry(
 
 			// non-system attribute
 			CHAR *col_name_char_array =
-				CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-					dxl_col_descr->MdName()->GetMDName()->GetBuffer());
+				m_dxl_to_plstmt_context->GetMultiByteName(
+					dxl_col_descr->MdName()->GetMDName());
 			Value *val_colname = gpdb::MakeStringValue(col_name_char_array);
 
 			alias->colnames = gpdb::LAppend(alias->colnames, val_colname);
@@ -4438,8 +4438,8 @@ CTranslatorDXLToPlStmt::TranslateDXLProjList(
 		TargetEntry *target_entry = MakeNode(TargetEntry);
 		target_entry->expr = expr;
 		target_entry->resname =
-			CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-				sc_proj_elem_dxlop->GetMdNameAlias()->GetMDName()->GetBuffer());
+			m_dxl_to_plstmt_context->GetMultiByteName(
+				sc_proj_elem_dxlop->GetMdNameAlias()->GetMDName());
 		target_entry->resno = (AttrNumber)(ul + 1);
 
 		if (IsA(expr, Var))
@@ -4551,8 +4551,8 @@ CTranslatorDXLToPlStmt::CreateTargetListWithNullsForDroppedCols(
 		}
 
 		CHAR *name_str =
-			CTranslatorUtils::CreateMultiByteCharStringFromWCString(
-				md_col->Mdname().GetMDName()->GetBuffer());
+			m_dxl_to_plstmt_context->GetMultiByteName(
+				md_col->Mdname().GetMDName());
 		TargetEntry *te_new =
 			gpdb::MakeTargetEntry(expr, resno, name_str, false /*resjunk*/);
 		result_list = gpdb::LAppend(result_list, te_new);
@@ -201,8 +201,13 @@ CTranslatorQueryToDXL::CTranslatorQueryToDXL(
 		}
 	}
 
-	// check if the query has any unsupported node types
-	CheckUnsupportedNodeTypes(query);
+	// check if the query has any unsupported node types; the check walks
+	// into subqueries and CTEs, so it only needs to run on the top-level
+	// query rather than once more for every nested query level
+	if (0 == query_level)
+	{
+		CheckUnsupportedNodeTypes(query);
+	}
 
 	// check if the query has SIRV functions in the targetlist without a FROM clause
 	CheckSirvFuncsWithoutFromClause(query);
@@ -23,7 +23,10 @@ extern "C" {
 #include "catalog/pg_proc.h"
 #include "catalog/pg_statistic.h"
 #include "cdb/cdbhash.h"
+#include "commands/analyzeutils.h"
+#include "partitioning/partbounds.h"
 #include "partitioning/partdesc.h"
+#include "statistics/statistics.h"
 #include "utils/array.h"
 #include "utils/datum.h"
 #include "utils/elog.h"
@@ -52,11 +55,13 @@ extern "C" {
 #include "naucrates/dxl/xml/dxltokens.h"
 #include "naucrates/exception.h"
 #include "naucrates/md/CDXLColStats.h"
+#include "naucrates/md/CDXLExtStats.h"
 #include "naucrates/md/CDXLRelStats.h"
 #include "naucrates/md/CMDArrayCoerceCastGPDB.h"
 #include "naucrates/md/CMDCastGPDB.h"
 #include "naucrates/md/CMDIdCast.h"
 #include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
 #include "naucrates/md/CMDIdRelStats.h"
 #include "naucrates/md/CMDIdScCmp.h"
 #include "naucrates/md/CMDIndexGPDB.h"
@@ -111,6 +116,10 @@ CTranslatorRelcacheToDXL::RetrieveObject(CMemoryPool *mp,
 			md_obj = RetrieveColStats(mp, md_accessor, mdid);
 			break;
 
+		case IMDId::EmdidExtStats:
+			md_obj = RetrieveExtStats(mp, mdid);
+			break;
+
 		case IMDId::EmdidCastFunc:
 			md_obj = RetrieveCast(mp, mdid);
 			break;
@@ -362,6 +371,9 @@ CTranslatorRelcacheToDXL::RetrieveRel(CMemoryPool *mp, CMDAccessor *md_accessor,
 	BOOL is_partitioned = false;
 	IMDRelation *md_rel = nullptr;
 	IMdIdArray *partition_oids = nullptr;
+	CDXLNodeArray *partition_bounds = nullptr;
+	CDXLDatumArray *part_range_bounds = nullptr;
+	IntPtrArray *part_range_slots = nullptr;
 
 	/*
 	 * Pretend that there are no triggers, because we don't want ORCA to handle
@@ -417,13 +429,20 @@ CTranslatorRelcacheToDXL::RetrieveRel(CMemoryPool *mp, CMDAccessor *md_accessor,
 		{
 			Oid oid = rel->rd_partdesc->oids[i];
 			partition_oids->Append(GPOS_NEW(mp) CMDIdGPDB(oid));
-			if (gpdb::RelIsPartitioned(oid))
+			if (!rel->rd_partdesc->is_leaf[i])
 			{
 				// Multi-level partitioned tables are unsupported - fall back
 				GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
 						   GPOS_WSZ_LIT("Multi-level partitioned tables"));
 			}
 		}
+
+		// translate the partition bounds up front, so that partitions can be
+		// eliminated without retrieving their metadata
+		partition_bounds =
+			RetrievePartBoundsForRel(mp, md_accessor, rel.get(), mdcol_array);
+		RetrievePartRangeBoundsForRel(mp, md_accessor, rel.get(),
+									  &part_range_bounds, &part_range_slots);
 	}
 
 	// get key sets
@@ -474,7 +493,8 @@ CTranslatorRelcacheToDXL::RetrieveRel(CMemoryPool *mp, CMDAccessor *md_accessor,
 		md_rel = GPOS_NEW(mp) CMDRelationGPDB(
 			mp, mdid, mdname, is_temporary, rel_storage_type, dist, mdcol_array,
 			distr_cols, distr_op_families, part_keys, part_types,
-			num_leaf_partitions, partition_oids, convert_hash_to_random,
+			num_leaf_partitions, partition_oids, partition_bounds,
+			part_range_bounds, part_range_slots, convert_hash_to_random,
 			keyset_array, md_index_info_array, mdid_triggers_array,
 			check_constraint_mdids, mdpart_constraint, has_oids);
 	}
@@ -1682,6 +1702,167 @@ CTranslatorRelcacheToDXL::RetrieveRelStats(CMemoryPool *mp, IMDId *mdid)
 	return dxl_rel_stats;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveExtStats
+//
+//	@doc:
+//		Retrieve the ndistinct coefficients, functional dependencies and
+//		most common values lists of the extended statistics objects of a
+//		relation. Statistics objects, or kinds of them, that have not been
+//		built by ANALYZE are skipped.
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *
+CTranslatorRelcacheToDXL::RetrieveExtStats(CMemoryPool *mp, IMDId *mdid)
+{
+	CMDIdExtStats *mdid_ext_stats = CMDIdExtStats::CastMdid(mdid);
+	IMDId *mdid_rel = mdid_ext_stats->GetRelMdId();
+	OID rel_oid = CMDIdGPDB::CastMdid(mdid_rel)->Oid();
+
+	gpdb::RelationWrapper rel = gpdb::GetRelation(rel_oid);
+	if (!rel)
+	{
+		GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound,
+				   mdid->GetBuffer());
+	}
+
+	CWStringDynamic *relname_str = CDXLUtils::CreateDynamicStringFromCharArray(
+		mp, NameStr(rel->rd_rel->relname));
+	CMDName *mdname = GPOS_NEW(mp) CMDName(mp, relname_str);
+	// CMDName ctor created a copy of the string
+	GPOS_DELETE(relname_str);
+
+	CMDNDistinctArray *ndistincts = GPOS_NEW(mp) CMDNDistinctArray(mp);
+	CMDDependencyArray *dependencies = GPOS_NEW(mp) CMDDependencyArray(mp);
+	CMDMCVListArray *mcv_lists = GPOS_NEW(mp) CMDMCVListArray(mp);
+
+	List *stat_oids = gpdb::GetExtStatisticsOids(rel.get());
+	ListCell *lc = nullptr;
+	ForEach(lc, stat_oids)
+	{
+		OID stat_oid = lfirst_oid(lc);
+
+		MVNDistinct *mv_ndistinct = gpdb::GetMVNDistinct(stat_oid);
+		for (ULONG ul = 0; nullptr != mv_ndistinct && ul < mv_ndistinct->nitems;
+			 ul++)
+		{
+			MVNDistinctItem *item = &mv_ndistinct->items[ul];
+			ULongPtrArray *attnos = GPOS_NEW(mp) ULongPtrArray(mp);
+			INT attno = -1;
+			while (0 <= (attno = gpdb::BmsNextMember(item->attrs, attno)))
+			{
+				attnos->Append(GPOS_NEW(mp) ULONG(attno));
+			}
+			ndistincts->Append(GPOS_NEW(mp) CMDNDistinct(
+				attnos, CDouble(item->ndistinct)));
+		}
+
+		MVDependencies *mv_dependencies = gpdb::GetMVDependencies(stat_oid);
+		for (ULONG ul = 0;
+			 nullptr != mv_dependencies && ul < mv_dependencies->ndeps; ul++)
+		{
+			// the last attribute is the one implied by all the others
+			MVDependency *dependency = mv_dependencies->deps[ul];
+			ULongPtrArray *from_attnos = GPOS_NEW(mp) ULongPtrArray(mp);
+			for (INT i = 0; i + 1 < dependency->nattributes; i++)
+			{
+				from_attnos->Append(
+					GPOS_NEW(mp) ULONG(dependency->attributes[i]));
+			}
+			ULONG to_attno =
+				dependency->attributes[dependency->nattributes - 1];
+			dependencies->Append(GPOS_NEW(mp) CMDDependency(
+				from_attnos, to_attno, CDouble(dependency->degree)));
+		}
+
+		MCVList *mcv_list = gpdb::GetMCVList(stat_oid);
+		if (nullptr != mcv_list)
+		{
+			mcv_lists->Append(
+				RetrieveExtStatsMCVList(mp, stat_oid, mcv_list));
+		}
+
+		if (nullptr != mv_ndistinct)
+		{
+			gpdb::FreeMVNDistinct(mv_ndistinct);
+		}
+		if (nullptr != mv_dependencies)
+		{
+			gpdb::FreeMVDependencies(mv_dependencies);
+		}
+		if (nullptr != mcv_list)
+		{
+			// the items and their values are allocated along with the list
+			gpdb::GPDBFree(mcv_list);
+		}
+	}
+	gpdb::ListFree(stat_oids);
+
+	mdid_ext_stats->AddRef();
+
+	return GPOS_NEW(mp) CDXLExtStats(mp, mdid_ext_stats, mdname, ndistincts,
+									 dependencies, mcv_lists);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveExtStatsMCVList
+//
+//	@doc:
+//		Translate the most common values list of an extended statistics
+//		object; the values of each combination are in the order of the
+//		columns of the statistics object
+//
+//---------------------------------------------------------------------------
+CMDMCVList *
+CTranslatorRelcacheToDXL::RetrieveExtStatsMCVList(CMemoryPool *mp,
+												  OID stat_oid,
+												  const MCVList *mcv_list)
+{
+	ULongPtrArray *attnos = GPOS_NEW(mp) ULongPtrArray(mp);
+	List *stat_keys = gpdb::GetExtStatisticsKeys(stat_oid);
+	ListCell *lc = nullptr;
+	ForEach(lc, stat_keys)
+	{
+		attnos->Append(GPOS_NEW(mp) ULONG(lfirst_int(lc)));
+	}
+	gpdb::ListFree(stat_keys);
+	GPOS_ASSERT(attnos->Size() == (ULONG) mcv_list->ndimensions);
+
+	IMDType *md_types[STATS_MAX_DIMENSIONS];
+	for (INT dim = 0; dim < mcv_list->ndimensions; dim++)
+	{
+		CMDIdGPDB *mdid_type = GPOS_NEW(mp) CMDIdGPDB(mcv_list->types[dim]);
+		md_types[dim] = RetrieveType(mp, mdid_type);
+		mdid_type->Release();
+	}
+
+	CMDMCVItemArray *items = GPOS_NEW(mp) CMDMCVItemArray(mp);
+	for (ULONG ul = 0; ul < mcv_list->nitems; ul++)
+	{
+		const MCVItem *mcv_item = &mcv_list->items[ul];
+		CDXLDatumArray *values = GPOS_NEW(mp) CDXLDatumArray(mp);
+		for (INT dim = 0; dim < mcv_list->ndimensions; dim++)
+		{
+			const IMDType *md_type = md_types[dim];
+			IDatum *datum = CTranslatorScalarToDXL::CreateIDatumFromGpdbDatum(
+				mp, md_type, mcv_item->isnull[dim], mcv_item->values[dim]);
+			values->Append(md_type->GetDatumVal(mp, datum));
+			datum->Release();
+		}
+		items->Append(GPOS_NEW(mp)
+						  CMDMCVItem(values, CDouble(mcv_item->frequency),
+									 CDouble(mcv_item->base_frequency)));
+	}
+	for (INT dim = 0; dim < mcv_list->ndimensions; dim++)
+	{
+		md_types[dim]->Release();
+	}
+
+	return GPOS_NEW(mp) CMDMCVList(attnos, items);
+}
+
 // Retrieve column statistics from relcache
 // If all statistics are missing, create dummy statistics
 // Also, if the statistics are broken, create dummy statistics
@@ -1712,23 +1893,35 @@ CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 		GPOS_NEW(mp) CMDName(mp, md_col->Mdname().GetMDName());
 	OID att_type = CMDIdGPDB::CastMdid(md_col->MdidType())->Oid();
 
-	CDXLBucketArray *dxl_stats_bucket_array = GPOS_NEW(mp) CDXLBucketArray(mp);
-
 	if (0 > attno)
 	{
+		CDXLBucketArray *dxl_stats_bucket_array =
+			GPOS_NEW(mp) CDXLBucketArray(mp);
 		mdid_col_stats->AddRef();
 		return GenerateStatsForSystemCols(mp, rel_oid, mdid_col_stats,
 										  md_colname, att_type, attno,
 										  dxl_stats_bucket_array, num_rows);
 	}
 
+	// statistics merged from those of the leaf partitions that survive
+	// static partition elimination; if they cannot be merged, fall back to
+	// the statistics ANALYZE merged from all the leaves into the root's
+	if (nullptr != mdid_col_stats->GetPartMdIds())
+	{
+		CDXLColStats *dxl_col_stats = RetrieveMergedColStats(
+			mp, mdid_col_stats, attno, md_colname, att_type);
+		if (nullptr != dxl_col_stats)
+		{
+			return dxl_col_stats;
+		}
+	}
+
 	// extract out histogram and mcv information from pg_statistic
 	HeapTuple stats_tup = gpdb::GetAttStats(rel_oid, attno);
 
 	// if there is no colstats
 	if (!HeapTupleIsValid(stats_tup))
 	{
-		dxl_stats_bucket_array->Release();
 		mdid_col_stats->AddRef();
 
 		CDouble width = CStatistics::DefaultColumnWidth;
@@ -1848,7 +2041,6 @@ CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 
 	if (is_dummy_stats)
 	{
-		dxl_stats_bucket_array->Release();
 		mdid_col_stats->AddRef();
 
 		CDouble col_width = CStatistics::DefaultColumnWidth;
@@ -1857,6 +2049,118 @@ CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 													md_colname, col_width);
 	}
 
+	CDXLColStats *dxl_col_stats = CreateDXLColStats(
+		mp, mdid_col_stats, md_colname, att_type, width, null_freq,
+		num_distinct, mcv_slot.values, mcv_slot.numbers,
+		ULONG(mcv_slot.nvalues), hist_slot.values, ULONG(hist_slot.nvalues));
+
+	// free up allocated datum and float4 arrays
+	gpdb::FreeAttrStatsSlot(&mcv_slot);
+	gpdb::FreeAttrStatsSlot(&hist_slot);
+
+	gpdb::FreeHeapTuple(stats_tup);
+
+	return dxl_col_stats;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveMergedColStats
+//
+//	@doc:
+//		Retrieve the statistics of a column of a partitioned table by merging
+//		those of the leaf partitions listed in the mdid, the way ANALYZE
+//		merges the statistics of all leaf partitions into the root's: the
+//		histograms and MCVs of the leaves are combined, and the number of
+//		distinct values is estimated from their merged HyperLogLog counters.
+//		Return null if the leaves are empty or if their statistics cannot be
+//		merged, without taking ownership of the column name.
+//
+//---------------------------------------------------------------------------
+CDXLColStats *
+CTranslatorRelcacheToDXL::RetrieveMergedColStats(CMemoryPool *mp,
+												 CMDIdColStats *mdid_col_stats,
+												 AttrNumber attno,
+												 CMDName *md_colname,
+												 OID att_type)
+{
+	OID rel_oid = CMDIdGPDB::CastMdid(mdid_col_stats->GetRelMdId())->Oid();
+	IMdIdArray *part_mdids = mdid_col_stats->GetPartMdIds();
+
+	List *leaf_oids = NIL;
+	for (ULONG ul = 0; ul < part_mdids->Size(); ul++)
+	{
+		leaf_oids = gpdb::LAppendOid(
+			leaf_oids, CMDIdGPDB::CastMdid((*part_mdids)[ul])->Oid());
+	}
+
+	MergedLeafStats merged;
+	BOOL is_merged =
+		gpdb::MergeLeafAttStats(rel_oid, attno, leaf_oids, &merged);
+	gpdb::ListFree(leaf_oids);
+
+	if (!is_merged)
+	{
+		return nullptr;
+	}
+
+	// null frequency and NDV
+	CDouble null_freq(0.0);
+	if (CStatistics::Epsilon < merged.stanullfrac)
+	{
+		null_freq = merged.stanullfrac;
+	}
+
+	CDouble num_distinct(1.0);
+	if (merged.stadistinct < 0)
+	{
+		num_distinct = CDouble(merged.totalTuples) * (1 - null_freq) *
+					   CDouble(-merged.stadistinct);
+	}
+	else
+	{
+		num_distinct = CDouble(merged.stadistinct);
+	}
+	num_distinct = num_distinct.Ceil();
+
+	// fix mcv and null frequencies (sometimes they can add up to more than 1.0)
+	NormalizeFrequencies(merged.mcv_freqs, (ULONG) merged.num_mcv, &null_freq);
+
+	CDXLColStats *dxl_col_stats = CreateDXLColStats(
+		mp, mdid_col_stats, md_colname, att_type, CDouble(merged.stawidth),
+		null_freq, num_distinct, merged.mcv_values, merged.mcv_freqs,
+		ULONG(merged.num_mcv), merged.hist_values, ULONG(merged.num_hist));
+
+	if (0 < merged.num_mcv)
+	{
+		gpdb::GPDBFree(merged.mcv_values);
+		gpdb::GPDBFree(merged.mcv_freqs);
+	}
+	if (0 < merged.num_hist)
+	{
+		gpdb::GPDBFree(merged.hist_values);
+	}
+
+	return dxl_col_stats;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::CreateDXLColStats
+//
+//	@doc:
+//		Create a column stats object from the null frequency, width, number
+//		of distinct values, MCVs and histogram of a column, in the form
+//		pg_statistic keeps them
+//
+//---------------------------------------------------------------------------
+CDXLColStats *
+CTranslatorRelcacheToDXL::CreateDXLColStats(
+	CMemoryPool *mp, CMDIdColStats *mdid_col_stats, CMDName *md_colname,
+	OID att_type, CDouble width, CDouble null_freq, CDouble num_distinct,
+	const Datum *mcv_values, const float4 *mcv_frequencies,
+	ULONG num_mcv_values, const Datum *hist_values, ULONG num_hist_values)
+{
 	CDouble num_ndv_buckets(0.0);
 	CDouble num_freq_buckets(0.0);
 	CDouble distinct_remaining(0.0);
@@ -1864,26 +2168,20 @@ CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 
 	// transform all the bits and pieces from pg_statistic
 	// to a single bucket structure
-	CDXLBucketArray *dxl_stats_bucket_array_transformed =
-		TransformStatsToDXLBucketArray(
-			mp, att_type, num_distinct, null_freq, mcv_slot.values,
-			mcv_slot.numbers, ULONG(mcv_slot.nvalues), hist_slot.values,
-			ULONG(hist_slot.nvalues));
+	CDXLBucketArray *dxl_stats_bucket_array = TransformStatsToDXLBucketArray(
+		mp, att_type, num_distinct, null_freq, mcv_values, mcv_frequencies,
+		num_mcv_values, hist_values, num_hist_values);
 
-	GPOS_ASSERT(nullptr != dxl_stats_bucket_array_transformed);
+	GPOS_ASSERT(nullptr != dxl_stats_bucket_array);
 
-	const ULONG num_buckets = dxl_stats_bucket_array_transformed->Size();
+	const ULONG num_buckets = dxl_stats_bucket_array->Size();
 	for (ULONG ul = 0; ul < num_buckets; ul++)
 	{
-		CDXLBucket *dxl_bucket = (*dxl_stats_bucket_array_transformed)[ul];
+		CDXLBucket *dxl_bucket = (*dxl_stats_bucket_array)[ul];
 		num_ndv_buckets = num_ndv_buckets + dxl_bucket->GetNumDistinct();
 		num_freq_buckets = num_freq_buckets + dxl_bucket->GetFrequency();
 	}
 
-	CUtils::AddRefAppend(dxl_stats_bucket_array,
-						 dxl_stats_bucket_array_transformed);
-	dxl_stats_bucket_array_transformed->Release();
-
 	// there will be remaining tuples if the merged histogram and the NULLS do not cover
 	// the total number of distinct values
 	if ((1 - CStatistics::Epsilon > num_freq_buckets + null_freq) &&
@@ -1895,20 +2193,12 @@ CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 			std::max(CDouble(0.0), (1 - num_freq_buckets - null_freq));
 	}
 
-	// free up allocated datum and float4 arrays
-	gpdb::FreeAttrStatsSlot(&mcv_slot);
-	gpdb::FreeAttrStatsSlot(&hist_slot);
-
-	gpdb::FreeHeapTuple(stats_tup);
-
 	// create col stats object
 	mdid_col_stats->AddRef();
-	CDXLColStats *dxl_col_stats = GPOS_NEW(mp) CDXLColStats(
+	return GPOS_NEW(mp) CDXLColStats(
 		mp, mdid_col_stats, md_colname, width, null_freq, distinct_remaining,
 		freq_remaining, dxl_stats_bucket_array, false /* is_col_stats_missing */
 	);
-
-	return dxl_col_stats;
 }
 
 
@@ -2228,7 +2518,7 @@ CTranslatorRelcacheToDXL::TransformStatsToDXLBucketArray(
 			CStatisticsUtils::MergeMCVHist(mp, gpdb_mcv_hist, histogram);
 		dxl_stats_bucket_array =
 			TransformHistogramToDXLBucketArray(mp, md_type, merged_hist);
-		GPOS_DELETE(merged_hist);
+		merged_hist->Release();
 	}
 	else
 	{
@@ -2240,12 +2530,9 @@ CTranslatorRelcacheToDXL::TransformStatsToDXLBucketArray(
 	// cleanup
 	mdid_atttype->Release();
 	md_type->Release();
-	GPOS_DELETE(gpdb_mcv_hist);
+	gpdb_mcv_hist->Release();
 
-	if (nullptr != histogram)
-	{
-		GPOS_DELETE(histogram);
-	}
+	CRefCount::SafeRelease(histogram);
 
 	return dxl_stats_bucket_array;
 }
@@ -2731,28 +3018,18 @@ CTranslatorRelcacheToDXL::RetrievePartConstraintForIndex(
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CTranslatorRelcacheToDXL::RetrievePartConstraintForRel
+//		CTranslatorRelcacheToDXL::CreatePartConstraintColDescrs
 //
 //	@doc:
-//		Retrieve part constraint for relation
+//		Column descriptors of the non-dropped columns of a relation, used to
+//		map the vars of its part constraints to column ids
 //
 //---------------------------------------------------------------------------
-CDXLNode *
-CTranslatorRelcacheToDXL::RetrievePartConstraintForRel(
-	CMemoryPool *mp, CMDAccessor *md_accessor, Relation rel,
-	CMDColumnArray *mdcol_array)
+CDXLColDescrArray *
+CTranslatorRelcacheToDXL::CreatePartConstraintColDescrs(
+	CMemoryPool *mp, CMDColumnArray *mdcol_array)
 {
-	// get the part constraints
-	Node *node = gpdb::GetRelationPartConstraints(rel);
-
-	if (nullptr == node)
-	{
-		return nullptr;
-	}
-
-	// create var-colid mapping for translating part constraints
-	CAutoRef<CDXLColDescrArray> dxl_col_descr_array(GPOS_NEW(mp)
-														CDXLColDescrArray(mp));
+	CDXLColDescrArray *dxl_col_descr_array = GPOS_NEW(mp) CDXLColDescrArray(mp);
 	const ULONG num_columns = mdcol_array->Size();
 	for (ULONG ul = 0, idx = 0; ul < num_columns; ul++)
 	{
@@ -2779,6 +3056,169 @@ CTranslatorRelcacheToDXL::RetrievePartConstraintForRel(
 		++idx;
 	}
 
+	return dxl_col_descr_array;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrievePartBoundsForRel
+//
+//	@doc:
+//		Retrieve the bound constraints of the partitions of a partitioned
+//		relation, in terms of its own columns and in the order of its
+//		partition descriptor. The bounds are read from the catalog, so the
+//		partitions themselves are not opened.
+//
+//---------------------------------------------------------------------------
+CDXLNodeArray *
+CTranslatorRelcacheToDXL::RetrievePartBoundsForRel(CMemoryPool *mp,
+												   CMDAccessor *md_accessor,
+												   Relation rel,
+												   CMDColumnArray *mdcol_array)
+{
+	CAutoRef<CDXLColDescrArray> dxl_col_descr_array(
+		CreatePartConstraintColDescrs(mp, mdcol_array));
+	CMappingVarColId var_colid_mapping(mp);
+	var_colid_mapping.LoadColumns(0 /*query_level */, 1 /* rteIndex */,
+								  dxl_col_descr_array.Value());
+
+	CDXLNodeArray *partition_bounds = GPOS_NEW(mp) CDXLNodeArray(mp);
+	for (int i = 0; i < rel->rd_partdesc->nparts; ++i)
+	{
+		Node *node = gpdb::GetPartitionBoundConstraint(
+			rel, rel->rd_partdesc->oids[i]);
+
+		CDXLNode *scalar_dxlnode =
+			CTranslatorScalarToDXL::TranslateStandaloneExprToDXL(
+				mp, md_accessor, &var_colid_mapping, (Expr *) node);
+		partition_bounds->Append(scalar_dxlnode);
+	}
+
+	return partition_bounds;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrievePartRangeBoundsForRel
+//
+//	@doc:
+//		Retrieve the finite bounds of a relation range partitioned on one
+//		column, in ascending order, and the position of the partition that
+//		holds the values of each slot between consecutive bounds. Values not
+//		in any range go to the default partition, if there is one. The bounds
+//		are kept sorted by the partition descriptor. Nothing is retrieved if
+//		they are not sorted the way ORCA compares values of the key type.
+//
+//---------------------------------------------------------------------------
+void
+CTranslatorRelcacheToDXL::RetrievePartRangeBoundsForRel(
+	CMemoryPool *mp, CMDAccessor *md_accessor, Relation rel,
+	CDXLDatumArray **part_range_bounds, IntPtrArray **part_range_slots)
+{
+	PartitionKey partkey = rel->rd_partkey;
+	PartitionBoundInfo boundinfo = rel->rd_partdesc->boundinfo;
+
+	*part_range_bounds = nullptr;
+	*part_range_slots = nullptr;
+
+	if (PARTITION_STRATEGY_RANGE != partkey->strategy ||
+		1 != partkey->partnatts || nullptr == boundinfo)
+	{
+		return;
+	}
+
+	// the bounds are sorted by the operator class and collation of the key,
+	// which must be those of the type for ORCA comparisons to agree
+	Oid type_oid = partkey->parttypid[0];
+	TypeCacheEntry *tce =
+		gpdb::LookupTypeCache(type_oid, TYPECACHE_BTREE_OPFAMILY);
+	if (tce->btree_opf != partkey->partopfamily[0] ||
+		partkey->partcollation[0] != partkey->parttypcoll[0])
+	{
+		return;
+	}
+
+	CMDIdGPDB *mdid_type = GPOS_NEW(mp) CMDIdGPDB(type_oid);
+	const IMDType *md_type = md_accessor->RetrieveType(mdid_type);
+	mdid_type->Release();
+
+	CAutoRef<CDXLDatumArray> bounds(GPOS_NEW(mp) CDXLDatumArray(mp));
+	CAutoRef<IntPtrArray> slots(GPOS_NEW(mp) IntPtrArray(mp));
+
+	// the partition descriptor stores, for each bound, the partition whose
+	// range ends at that bound, and one more entry for the values above the
+	// last bound; unbounded ranges end at a MINVALUE or MAXVALUE bound
+	INT last_slot = boundinfo->indexes[boundinfo->ndatums];
+	for (int i = 0; i < boundinfo->ndatums; ++i)
+	{
+		INT slot = boundinfo->indexes[i];
+		if (-1 == slot)
+		{
+			slot = boundinfo->default_index;
+		}
+
+		switch (boundinfo->kind[i][0])
+		{
+			case PARTITION_RANGE_DATUM_VALUE:
+				bounds->Append(CTranslatorScalarToDXL::TranslateDatumToDXL(
+					mp, md_type, partkey->parttypmod[0], false /* is_null */,
+					partkey->parttyplen[0], boundinfo->datums[i][0]));
+				slots->Append(GPOS_NEW(mp) INT(slot));
+				break;
+
+			case PARTITION_RANGE_DATUM_MINVALUE:
+				// no value is below the first bound if it is MINVALUE
+				if (0 != i)
+				{
+					return;
+				}
+				break;
+
+			case PARTITION_RANGE_DATUM_MAXVALUE:
+				// the values above the last finite bound go to the partition
+				// ending at MAXVALUE
+				if (boundinfo->ndatums - 1 != i)
+				{
+					return;
+				}
+				last_slot = slot;
+				break;
+		}
+	}
+	if (-1 == last_slot)
+	{
+		last_slot = boundinfo->default_index;
+	}
+	slots->Append(GPOS_NEW(mp) INT(last_slot));
+
+	*part_range_bounds = bounds.Reset();
+	*part_range_slots = slots.Reset();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrievePartConstraintForRel
+//
+//	@doc:
+//		Retrieve part constraint for relation
+//
+//---------------------------------------------------------------------------
+CDXLNode *
+CTranslatorRelcacheToDXL::RetrievePartConstraintForRel(
+	CMemoryPool *mp, CMDAccessor *md_accessor, Relation rel,
+	CMDColumnArray *mdcol_array)
+{
+	// get the part constraints
+	Node *node = gpdb::GetRelationPartConstraints(rel);
+
+	if (nullptr == node)
+	{
+		return nullptr;
+	}
+
+	// create var-colid mapping for translating part constraints
+	CAutoRef<CDXLColDescrArray> dxl_col_descr_array(
+		CreatePartConstraintColDescrs(mp, mdcol_array));
 	CMappingVarColId var_colid_mapping(mp);
 	var_colid_mapping.LoadColumns(0 /*query_level */, 1 /* rteIndex */,
 								  dxl_col_descr_array.Value());
@@ -24,6 +24,9 @@ extern "C" {
 #include "gpopt/translate/CTranslatorScalarToDXL.h"
 #include "gpopt/utils/CConstExprEvaluatorProxy.h"
 #include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/dxl/operators/CDXLScalarComp.h"
+#include "naucrates/dxl/operators/CDXLScalarConstValue.h"
+#include "naucrates/md/CMDIdGPDB.h"
 #include "naucrates/exception.h"
 
 using namespace gpdxl;
@@ -51,6 +54,81 @@ CConstExprEvaluatorProxy::CEmptyMappingColIdVar::VarFromDXLNodeScId(
 	return nullptr;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorProxy::~CConstExprEvaluatorProxy
+//
+//	@doc:
+//		Dtor; frees the cached comparison templates
+//
+//---------------------------------------------------------------------------
+CConstExprEvaluatorProxy::~CConstExprEvaluatorProxy()
+{
+	OidToOpExprMapIter iter(m_cmp_templates);
+	while (iter.Advance())
+	{
+		gpdb::GPDBFree(const_cast<OpExpr *>(iter.Value()));
+	}
+	m_cmp_templates->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorProxy::TranslateExpr
+//
+//	@doc:
+//		Translate 'dxl_expr' to a GPDB Expr. A comparison of two constants
+//		is built from the template of its operator, translated the first
+//		time the operator is seen, so that only the constants, and the
+//		collation that depends on their types, are translated
+//
+//---------------------------------------------------------------------------
+Expr *
+CConstExprEvaluatorProxy::TranslateExpr(const CDXLNode *dxl_expr)
+{
+	if (EdxlopScalarCmp != dxl_expr->GetOperator()->GetDXLOperator() ||
+		EdxlopScalarConstValue !=
+			(*dxl_expr)[EdxlsccmpIndexLeft]->GetOperator()->GetDXLOperator() ||
+		EdxlopScalarConstValue !=
+			(*dxl_expr)[EdxlsccmpIndexRight]->GetOperator()->GetDXLOperator())
+	{
+		return m_dxl2scalar_translator.TranslateDXLToScalar(dxl_expr,
+															&m_emptymapcidvar);
+	}
+
+	CDXLScalarComp *dxlop = CDXLScalarComp::Cast(dxl_expr->GetOperator());
+	ULONG opno = CMDIdGPDB::CastMdid(dxlop->MDId())->Oid();
+	const OpExpr *op_template = m_cmp_templates->Find(&opno);
+	if (nullptr == op_template)
+	{
+		OpExpr *op_expr =
+			(OpExpr *) m_dxl2scalar_translator.TranslateDXLToScalar(
+				dxl_expr, &m_emptymapcidvar);
+
+		OpExpr *new_template = MakeNode(OpExpr);
+		*new_template = *op_expr;
+		new_template->args = NIL;
+		m_cmp_templates->Insert(GPOS_NEW(m_mp) ULONG(opno), new_template);
+
+		return (Expr *) op_expr;
+	}
+
+	OpExpr *op_expr = MakeNode(OpExpr);
+	*op_expr = *op_template;
+	op_expr->args =
+		ListMake2(m_dxl2scalar_translator.TranslateDXLToScalar(
+					  (*dxl_expr)[EdxlsccmpIndexLeft], &m_emptymapcidvar),
+				  m_dxl2scalar_translator.TranslateDXLToScalar(
+					  (*dxl_expr)[EdxlsccmpIndexRight], &m_emptymapcidvar));
+
+	// a polymorphic operator, such as the comparison of arrays, takes
+	// arguments of different types, so the collation of the template is
+	// not necessarily that of these arguments
+	op_expr->inputcollid = gpdb::ExprCollation((Node *) op_expr->args);
+
+	return (Expr *) op_expr;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstExprEvaluatorProxy::EvaluateExpr
@@ -64,8 +142,7 @@ CDXLNode *
 CConstExprEvaluatorProxy::EvaluateExpr(const CDXLNode *dxl_expr)
 {
 	// Translate DXL -> GPDB Expr
-	Expr *expr = m_dxl2scalar_translator.TranslateDXLToScalar(
-		dxl_expr, &m_emptymapcidvar);
+	Expr *expr = TranslateExpr(dxl_expr);
 	GPOS_ASSERT(nullptr != expr);
 
 	// Evaluate the expression
@@ -25,9 +25,17 @@ extern "C" {
 using namespace gpos;
 
 // ctor
-CMemoryPoolPalloc::CMemoryPoolPalloc()
+CMemoryPoolPalloc::CMemoryPoolPalloc(EPoolKind kind)
+	: m_is_arena(EpkArena == kind)
 {
-	m_cxt = gpdb::GPDBAllocSetContextCreate();
+	if (m_is_arena)
+	{
+		m_cxt = gpdb::GPDBGenerationContextCreate();
+	}
+	else
+	{
+		m_cxt = gpdb::GPDBAllocSetContextCreate();
+	}
 }
 
 void *
@@ -86,6 +94,13 @@ CMemoryPoolPalloc::TearDown()
 ULLONG
 CMemoryPoolPalloc::TotalAllocatedSize() const
 {
+	if (m_is_arena)
+	{
+		// generation contexts do not take part in GPDB's memory accounting,
+		// but count the blocks they hold
+		return m_cxt->mem_allocated;
+	}
+
 	return MemoryContextGetCurrentSpace(m_cxt);
 }
 
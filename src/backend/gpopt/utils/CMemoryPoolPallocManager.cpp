@@ -14,6 +14,7 @@
 extern "C" {
 #include "postgres.h"
 
+#include "utils/guc.h"
 #include "utils/memutils.h"
 }
 
@@ -29,11 +30,17 @@ CMemoryPoolPallocManager::CMemoryPoolPallocManager(CMemoryPool *internal,
 {
 }
 
-// create new memory pool
+// create new memory pool; arena pools are only used when enabled, since
+// their memory is not tracked by VMEM
 CMemoryPool *
-CMemoryPoolPallocManager::NewMemoryPool()
+CMemoryPoolPallocManager::NewMemoryPool(CMemoryPool::EPoolKind kind)
 {
-	return GPOS_NEW(GetInternalMemoryPool()) CMemoryPoolPalloc();
+	if (!optimizer_use_arena_memory_pools)
+	{
+		kind = CMemoryPool::EpkGeneral;
+	}
+
+	return GPOS_NEW(GetInternalMemoryPool()) CMemoryPoolPalloc(kind);
 }
 
 void
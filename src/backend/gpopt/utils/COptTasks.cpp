@@ -15,6 +15,8 @@
 
 #include "gpopt/utils/COptTasks.h"
 
+#include <sys/stat.h>
+
 extern "C" {
 #include "cdb/cdbvars.h"
 #include "utils/fmgroids.h"
@@ -24,6 +26,8 @@ extern "C" {
 #include "gpos/_api.h"
 #include "gpos/base.h"
 #include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRef.h"
+#include "gpos/common/CAutoRg.h"
 #include "gpos/error/CException.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
@@ -53,6 +57,7 @@ extern "C" {
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
 #include "gpopt/translate/CTranslatorUtils.h"
 #include "gpopt/utils/CConstExprEvaluatorProxy.h"
+#include "gpopt/utils/CPlanCache.h"
 #include "gpopt/utils/gpdbdefs.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "naucrates/base/CQueryToDXLResult.h"
@@ -60,12 +65,16 @@ extern "C" {
 #include "naucrates/dxl/CIdGenerator.h"
 #include "naucrates/dxl/operators/CDXLNode.h"
 #include "naucrates/dxl/parser/CParseHandlerDXL.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "naucrates/exception.h"
 #include "naucrates/init.h"
 #include "naucrates/md/CMDIdCast.h"
+#include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
 #include "naucrates/md/CMDIdRelStats.h"
 #include "naucrates/md/CMDIdScCmp.h"
 #include "naucrates/md/CSystemId.h"
+#include "naucrates/md/IMDCheckConstraint.h"
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDRelStats.h"
 #include "naucrates/traceflags/traceflags.h"
@@ -75,11 +84,75 @@ using namespace gpopt;
 using namespace gpdxl;
 using namespace gpdbcost;
 
+ULLONG COptTasks::m_mdcache_kept_on_exception = 0;
+ULLONG COptTasks::m_mdcache_dropped_on_exception = 0;
+
+// search strategy loaded by a previous query, kept until the GUCs or the
+// strategy file change
+struct SSearchStrategyCache
+{
+	// memory pool holding the cached strategy, nullptr if none is cached
+	CMemoryPool *m_mp;
+
+	// value of optimizer_search_strategy the strategy was parsed from, or
+	// path of the file it was parsed from
+	CHAR *m_source;
+
+	// was the strategy parsed from a file?
+	BOOL m_is_file;
+
+	// modification time and size of the file
+	LINT m_mtime;
+	LINT m_size;
+
+	// parsed strategy, nullptr for the default strategy
+	CSearchStageArray *m_search_stage_array;
+};
+
+static SSearchStrategyCache search_strategy_cache = {nullptr, nullptr, false,
+													 0,		  0,	   nullptr};
+
+// context of metadata cache invalidation
+struct SMDCacheInvalidationContext
+{
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// cached results of statistics invalidation checks, keyed on relation oid
+	UlongToUlongMap *m_stats_invalid_map;
+};
+
+// are the relation with the given oid or its column statistics affected by
+// the recorded catalog changes
+static BOOL
+ColStatsAreInvalid(SMDCacheInvalidationContext *inval_ctxt, ULONG rel_oid)
+{
+	if (gpdb::MDCacheRelationIsInvalid(rel_oid))
+	{
+		return true;
+	}
+
+	// checking pg_statistic entries of a relation is relatively
+	// expensive, so do it once per relation
+	ULONG *is_invalid = inval_ctxt->m_stats_invalid_map->Find(&rel_oid);
+	if (nullptr == is_invalid)
+	{
+		CMemoryPool *mp = inval_ctxt->m_mp;
+		is_invalid = GPOS_NEW(mp) ULONG(gpdb::MDCacheStatsAreInvalid(rel_oid));
+		(void) inval_ctxt->m_stats_invalid_map->Insert(
+			GPOS_NEW(mp) ULONG(rel_oid), is_invalid);
+	}
+
+	return 0 != *is_invalid;
+}
+
 // size of error buffer
 #define GPOPT_ERROR_BUFFER_SIZE 10 * 1024 * 1024
 
-// definition of default AutoMemoryPool
-#define AUTO_MEM_POOL(amp) CAutoMemoryPool amp(CAutoMemoryPool::ElcExc)
+// definition of default AutoMemoryPool; most of what optimization allocates
+// lives until it is done, which suits an arena pool
+#define AUTO_MEM_POOL(amp) \
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, CMemoryPool::EpkArena)
 
 // default id for the source system
 const CSystemId default_sysid(IMDId::EmdidGPDB, GPOS_WSZ_STR_LENGTH("GPDB"));
@@ -301,37 +374,35 @@ COptTasks::ConvertToPlanStmtFromDXL(
 
 //---------------------------------------------------------------------------
 //	@function:
-//		COptTasks::LoadSearchStrategy
+//		COptTasks::LoadSearchStrategyFile
 //
 //	@doc:
 //		Load search strategy from given file
 //
 //---------------------------------------------------------------------------
 CSearchStageArray *
-COptTasks::LoadSearchStrategy(CMemoryPool *mp, char *path)
+COptTasks::LoadSearchStrategyFile(CMemoryPool *mp, const char *path)
 {
 	CSearchStageArray *search_strategy_arr = nullptr;
 	CParseHandlerDXL *dxl_parse_handler = nullptr;
 
 	GPOS_TRY
 	{
-		if (nullptr != path)
+		dxl_parse_handler =
+			CDXLUtils::GetParseHandlerForDXLFile(mp, path, nullptr);
+		if (nullptr != dxl_parse_handler)
 		{
-			dxl_parse_handler =
-				CDXLUtils::GetParseHandlerForDXLFile(mp, path, nullptr);
-			if (nullptr != dxl_parse_handler)
-			{
-				elog(DEBUG2, "\n[OPT]: Using search strategy in (%s)", path);
+			elog(DEBUG2, "\n[OPT]: Using search strategy in (%s)", path);
 
-				search_strategy_arr = dxl_parse_handler->GetSearchStageArray();
-				search_strategy_arr->AddRef();
-			}
+			search_strategy_arr = dxl_parse_handler->GetSearchStageArray();
+			search_strategy_arr->AddRef();
 		}
 	}
 	GPOS_CATCH_EX(ex)
 	{
 		if (GPOS_MATCH_EX(ex, gpdxl::ExmaGPDB, gpdxl::ExmiGPDBError))
 		{
+			GPOS_DELETE(dxl_parse_handler);
 			GPOS_RETHROW(ex);
 		}
 		elog(DEBUG2, "\n[OPT]: Using default search strategy");
@@ -344,6 +415,291 @@ COptTasks::LoadSearchStrategy(CMemoryPool *mp, char *path)
 	return search_strategy_arr;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::ParseSearchStages
+//
+//	@doc:
+//		Parse search stages defined in the optimizer_search_strategy GUC.
+//		Stages are separated by semicolons, and each stage is given as
+//		"time threshold:cost threshold:xform name,xform name,...", the
+//		same information a SearchStage element of a strategy file holds.
+//		Only checks the definition if no memory pool is given; the names
+//		of the xforms are only checked once the optimizer is initialized.
+//		Returns the position at which the definition is malformed, or null
+//		if it is well formed.
+//
+//---------------------------------------------------------------------------
+const char *
+COptTasks::ParseSearchStages(CMemoryPool *mp, const char *stages,
+							 CSearchStageArray **search_stage_array)
+{
+	GPOS_ASSERT_IMP(nullptr != mp, nullptr != search_stage_array);
+
+	CXformFactory *xform_factory = CXformFactory::Pxff();
+	CSearchStageArray *stage_array = nullptr;
+	if (nullptr != mp)
+	{
+		stage_array = GPOS_NEW(mp) CSearchStageArray(mp);
+	}
+	ULONG num_stages = 0;
+	const char *pos = stages;
+
+	while ('\0' != *pos)
+	{
+		char *end = nullptr;
+		ULONG time_threshold = (ULONG) strtoul(pos, &end, 10);
+		if (end == pos || ':' != *end)
+		{
+			break;
+		}
+		pos = end + 1;
+
+		DOUBLE cost_threshold = strtod(pos, &end);
+		if (end == pos || ':' != *end)
+		{
+			break;
+		}
+		pos = end + 1;
+
+		CXformSet *xform_set = nullptr;
+		if (nullptr != mp)
+		{
+			GPOS_ASSERT(nullptr != xform_factory);
+			xform_set = GPOS_NEW(mp) CXformSet(mp);
+		}
+
+		// a list of xforms ends with a name, not with a separator
+		BOOL is_valid_list = false;
+		while (true)
+		{
+			const ULONG length = (ULONG) strcspn(pos, ",;");
+			char name[NAMEDATALEN];
+			if (0 == length || NAMEDATALEN <= length)
+			{
+				break;
+			}
+			memcpy(name, pos, length);
+			name[length] = '\0';
+
+			if (nullptr != xform_factory)
+			{
+				CXform *xform = xform_factory->Pxf(name);
+				if (nullptr == xform)
+				{
+					break;
+				}
+				if (nullptr != xform_set)
+				{
+					(void) xform_set->ExchangeSet(xform->Exfid());
+				}
+			}
+
+			pos += length;
+			if (',' != *pos)
+			{
+				is_valid_list = true;
+				break;
+			}
+			pos++;
+		}
+
+		if (!is_valid_list || (';' != *pos && '\0' != *pos))
+		{
+			CRefCount::SafeRelease(xform_set);
+			break;
+		}
+
+		if (nullptr != stage_array)
+		{
+			stage_array->Append(GPOS_NEW(mp) CSearchStage(
+				xform_set, time_threshold, CCost(cost_threshold)));
+		}
+		num_stages++;
+
+		if (';' == *pos)
+		{
+			pos++;
+		}
+	}
+
+	if ('\0' != *pos || 0 == num_stages)
+	{
+		CRefCount::SafeRelease(stage_array);
+		return pos;
+	}
+
+	if (nullptr != stage_array)
+	{
+		elog(DEBUG2, "\n[OPT]: Using search strategy (%s)", stages);
+		*search_stage_array = stage_array;
+	}
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::CheckSearchStrategy
+//
+//	@doc:
+//		Check a definition of search stages for the optimizer_search_strategy
+//		GUC; return the position at which it is malformed, or null if it is
+//		well formed
+//
+//---------------------------------------------------------------------------
+const char *
+COptTasks::CheckSearchStrategy(const char *stages)
+{
+	return ParseSearchStages(nullptr /*mp*/, stages,
+							 nullptr /*search_stage_array*/);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::CopySearchStrategy
+//
+//	@doc:
+//		Create fresh search stages with the same settings as the given ones,
+//		since stages record the progress of the optimization using them
+//
+//---------------------------------------------------------------------------
+CSearchStageArray *
+COptTasks::CopySearchStrategy(CMemoryPool *mp,
+							  const CSearchStageArray *search_stage_array)
+{
+	if (nullptr == search_stage_array)
+	{
+		return nullptr;
+	}
+
+	CSearchStageArray *copy = GPOS_NEW(mp) CSearchStageArray(mp);
+	const ULONG size = search_stage_array->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		const CSearchStage *search_stage = (*search_stage_array)[ul];
+		CXformSet *xform_set = GPOS_NEW(mp) CXformSet(mp);
+		xform_set->Union(search_stage->GetXformSet());
+		copy->Append(GPOS_NEW(mp) CSearchStage(xform_set,
+											   search_stage->TimeThreshold(),
+											   search_stage->CostThreshold()));
+	}
+
+	return copy;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::ResetSearchStrategyCache
+//
+//	@doc:
+//		Drop the search strategy cached by a previous query
+//
+//---------------------------------------------------------------------------
+void
+COptTasks::ResetSearchStrategyCache()
+{
+	if (nullptr == search_strategy_cache.m_mp)
+	{
+		return;
+	}
+
+	CRefCount::SafeRelease(search_strategy_cache.m_search_stage_array);
+	CMemoryPoolManager::GetMemoryPoolMgr()->Destroy(search_strategy_cache.m_mp);
+	search_strategy_cache.m_mp = nullptr;
+	search_strategy_cache.m_source = nullptr;
+	search_strategy_cache.m_search_stage_array = nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::LoadSearchStrategy
+//
+//	@doc:
+//		Load the search strategy defined by the optimizer_search_strategy
+//		GUC, or else by the file at the given path. The parsed strategy is
+//		cached, and only parsed again when the GUC value, the path, or the
+//		modification time or size of the file change.
+//
+//---------------------------------------------------------------------------
+CSearchStageArray *
+COptTasks::LoadSearchStrategy(CMemoryPool *mp, char *path, char *stages)
+{
+	BOOL is_file = (nullptr == stages || '\0' == *stages);
+	const char *source = is_file ? path : stages;
+	LINT mtime = 0;
+	LINT size = 0;
+
+	struct stat file_stat;
+	if (is_file && (nullptr == path || 0 != stat(path, &file_stat)))
+	{
+		// also covers the "default" value of the GUC
+		ResetSearchStrategyCache();
+		elog(DEBUG2, "\n[OPT]: Using default search strategy");
+		return nullptr;
+	}
+	if (is_file)
+	{
+		mtime = (LINT) file_stat.st_mtime;
+		size = (LINT) file_stat.st_size;
+	}
+
+	if (nullptr != search_strategy_cache.m_mp &&
+		is_file == search_strategy_cache.m_is_file &&
+		0 == clib::Strcmp(source, search_strategy_cache.m_source) &&
+		mtime == search_strategy_cache.m_mtime &&
+		size == search_strategy_cache.m_size)
+	{
+		return CopySearchStrategy(mp,
+								  search_strategy_cache.m_search_stage_array);
+	}
+
+	// drop the previous strategy, and parse the new one in its own memory
+	// pool, which outlives the query
+	ResetSearchStrategyCache();
+
+	CMemoryPool *cache_mp =
+		CMemoryPoolManager::GetMemoryPoolMgr()->CreateMemoryPool();
+	CSearchStageArray *search_stage_array = nullptr;
+	GPOS_TRY
+	{
+		if (is_file)
+		{
+			search_stage_array = LoadSearchStrategyFile(cache_mp, path);
+		}
+		else if (nullptr != ParseSearchStages(cache_mp, stages,
+											  &search_stage_array))
+		{
+			// the check hook of the GUC has already reported a malformed
+			// definition, so only an xform name that could not be checked
+			// before the optimizer was initialized gets here
+			elog(DEBUG2, "\n[OPT]: Using default search strategy");
+		}
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		CMemoryPoolManager::GetMemoryPoolMgr()->Destroy(cache_mp);
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+
+	if (nullptr != search_stage_array)
+	{
+		elog(DEBUG1, "[OPT]: loaded search strategy from \"%s\"", source);
+	}
+
+	const ULONG length = clib::Strlen(source);
+	search_strategy_cache.m_source = GPOS_NEW_ARRAY(cache_mp, CHAR, length + 1);
+	clib::Strncpy(search_strategy_cache.m_source, source, length + 1);
+	search_strategy_cache.m_is_file = is_file;
+	search_strategy_cache.m_mtime = mtime;
+	search_strategy_cache.m_size = size;
+	search_strategy_cache.m_search_stage_array = search_stage_array;
+	search_strategy_cache.m_mp = cache_mp;
+
+	return CopySearchStrategy(mp, search_stage_array);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptTasks::CreateOptimizerConfig
@@ -392,6 +748,106 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model)
 		GPOS_NEW(mp) CWindowOids(OID(F_WINDOW_ROW_NUMBER), OID(F_WINDOW_RANK)));
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::OverrideCostModelParams
+//
+//	@doc:
+//		Override cost model parameters with those defined in the
+//		optimizer_cost_model_params GUC, such as the calibrated parameters
+//		emitted by scripts/cal_cost_model.py. Parameters are separated by
+//		commas, and each is given as "name=value", with the name of the
+//		parameter in the cost model. The bounds of a parameter are scaled
+//		along with its value. Only checks the definition if no cost model
+//		parameters are given, and returns the position at which it is
+//		malformed, or null if it is well formed.
+//
+//---------------------------------------------------------------------------
+const char *
+COptTasks::OverrideCostModelParams(ICostModelParams *cost_model_params,
+								   const char *params)
+{
+	const char *pos = params;
+
+	while ('\0' != *pos)
+	{
+		const ULONG length = (ULONG) strcspn(pos, "=,");
+		char name[NAMEDATALEN];
+		if (0 == length || NAMEDATALEN <= length || '=' != pos[length])
+		{
+			return pos;
+		}
+		memcpy(name, pos, length);
+		name[length] = '\0';
+
+		ICostModelParams::SCostParam *cost_param = nullptr;
+		if (nullptr == cost_model_params)
+		{
+			if (!CCostModelParamsGPDB::FParamName(name))
+			{
+				return pos;
+			}
+		}
+		else
+		{
+			cost_param = cost_model_params->PcpLookup(name);
+			if (nullptr == cost_param)
+			{
+				return pos;
+			}
+		}
+
+		char *end = nullptr;
+		DOUBLE value = strtod(pos + length + 1, &end);
+		if (end == pos + length + 1 || !(0.0 <= value) ||
+			(',' != *end && '\0' != *end))
+		{
+			return pos;
+		}
+
+		if (nullptr != cost_param)
+		{
+			DOUBLE old_value = cost_param->Get().Get();
+			DOUBLE lower_bound = value;
+			DOUBLE upper_bound = value;
+			if (0.0 < old_value)
+			{
+				lower_bound =
+					cost_param->GetLowerBoundVal().Get() * value / old_value;
+				upper_bound =
+					cost_param->GetUpperBoundVal().Get() * value / old_value;
+			}
+			cost_model_params->SetParam(cost_param->Id(), value, lower_bound,
+										upper_bound);
+		}
+
+		pos = end;
+		if (',' == *pos)
+		{
+			pos++;
+		}
+	}
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::CheckCostModelParams
+//
+//	@doc:
+//		Check a definition of cost model parameters for the
+//		optimizer_cost_model_params GUC, without a cost model, so that it
+//		can be checked before the optimizer is initialized; return the
+//		position at which it is malformed, or null if it is well formed
+//
+//---------------------------------------------------------------------------
+const char *
+COptTasks::CheckCostModelParams(const char *params)
+{
+	return OverrideCostModelParams(nullptr /*cost_model_params*/, params);
+}
+
 //---------------------------------------------------------------------------
 //		@function:
 //			COptTasks::SetCostModelParams
@@ -405,6 +861,16 @@ COptTasks::SetCostModelParams(ICostModel *cost_model)
 {
 	GPOS_ASSERT(nullptr != cost_model);
 
+	// parameters are only overridden if all of them are valid; the check
+	// hook of the GUC has already reported a malformed definition
+	if (nullptr != optimizer_cost_model_params &&
+		'\0' != *optimizer_cost_model_params &&
+		nullptr == CheckCostModelParams(optimizer_cost_model_params))
+	{
+		(void) OverrideCostModelParams(cost_model->GetCostModelParams(),
+									   optimizer_cost_model_params);
+	}
+
 	if (optimizer_nestloop_factor > 1.0)
 	{
 		// change NLJ cost factor
@@ -450,6 +916,248 @@ COptTasks::GetCostModel(CMemoryPool *mp, ULONG num_segments)
 	return cost_model;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::IsInvalidMdId
+//
+//	@doc:
+//		Check if the metadata object with the given id is affected by the
+//		catalog changes recorded since the last optimized query
+//
+//---------------------------------------------------------------------------
+BOOL
+COptTasks::IsInvalidMdId(const IMDId *mdid, void *context)
+{
+	SMDCacheInvalidationContext *inval_ctxt =
+		(SMDCacheInvalidationContext *) context;
+
+	switch (mdid->MdidType())
+	{
+		case IMDId::EmdidGPDB:
+		{
+			OID oid = CMDIdGPDB::CastMdid(mdid)->Oid();
+			return gpdb::MDCacheRelationIsInvalid(oid) ||
+				   gpdb::MDCacheObjectIsInvalid(oid);
+		}
+
+		case IMDId::EmdidRelStats:
+			return gpdb::MDCacheRelationIsInvalid(
+				CMDIdGPDB::CastMdid(
+					CMDIdRelStats::CastMdid(mdid)->GetRelMdId())
+					->Oid());
+
+		case IMDId::EmdidColStats:
+		{
+			const CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(mdid);
+			ULONG rel_oid =
+				CMDIdGPDB::CastMdid(mdid_col_stats->GetRelMdId())->Oid();
+			if (ColStatsAreInvalid(inval_ctxt, rel_oid))
+			{
+				return true;
+			}
+
+			// statistics merged from those of leaf partitions are affected
+			// by changes to any of them
+			IMdIdArray *part_mdids = mdid_col_stats->GetPartMdIds();
+			for (ULONG ul = 0; nullptr != part_mdids && ul < part_mdids->Size();
+				 ul++)
+			{
+				ULONG part_oid = CMDIdGPDB::CastMdid((*part_mdids)[ul])->Oid();
+				if (ColStatsAreInvalid(inval_ctxt, part_oid))
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		case IMDId::EmdidExtStats:
+		{
+			OID rel_oid =
+				CMDIdGPDB::CastMdid(CMDIdExtStats::CastMdid(mdid)->GetRelMdId())
+					->Oid();
+			return gpdb::MDCacheRelationIsInvalid(rel_oid) ||
+				   gpdb::MDCacheExtStatsAreInvalid(rel_oid);
+		}
+
+		case IMDId::EmdidCastFunc:
+		{
+			const CMDIdCast *mdid_cast = CMDIdCast::CastMdid(mdid);
+			return gpdb::MDCacheCastIsInvalid(
+				CMDIdGPDB::CastMdid(mdid_cast->MdidSrc())->Oid(),
+				CMDIdGPDB::CastMdid(mdid_cast->MdidDest())->Oid());
+		}
+
+		case IMDId::EmdidScCmp:
+			// comparisons only depend on operators, changes to which
+			// reset the whole cache
+			return false;
+
+		default:
+			return true;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::IsInvalidMDCacheEntry
+//
+//	@doc:
+//		Check if a metadata cache entry is affected by the catalog changes
+//		recorded since the last optimized query
+//
+//---------------------------------------------------------------------------
+BOOL
+COptTasks::IsInvalidMDCacheEntry(CMDKey *const &md_key, IMDCacheObject *md_obj,
+								 void *context)
+{
+	if (IsInvalidMdId(md_key->MDId(), context))
+	{
+		return true;
+	}
+
+	// check constraints also change with their relation
+	if (IMDCacheObject::EmdtCheckConstraint == md_obj->MDType())
+	{
+		IMDId *rel_mdid =
+			dynamic_cast<IMDCheckConstraint *>(md_obj)->GetRelMdId();
+		return gpdb::MDCacheRelationIsInvalid(
+			CMDIdGPDB::CastMdid(rel_mdid)->Oid());
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::IsInvalidPlanCacheEntry
+//
+//	@doc:
+//		Check if a cached plan depends on a metadata object affected by the
+//		catalog changes recorded since the last optimized query. The plan
+//		depends on the relation of every check constraint it uses as well,
+//		so the constraints need no special treatment here.
+//
+//---------------------------------------------------------------------------
+BOOL
+COptTasks::IsInvalidPlanCacheEntry(CPlanCacheKey *const &,	// plan_key
+								   CPlanCacheEntry *plan_entry, void *context)
+{
+	const IMdIdArray *mdids = plan_entry->GetMdIds();
+	const ULONG size = mdids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (IsInvalidMdId((*mdids)[ul], context))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::InvalidateMDCache
+//
+//	@doc:
+//		Evict the metadata and plan cache entries affected by catalog changes
+//		since the last optimized query, keeping the rest of the caches warm
+//
+//---------------------------------------------------------------------------
+void
+COptTasks::InvalidateMDCache(CMemoryPool *mp)
+{
+	SMDCacheInvalidationContext inval_ctxt;
+	inval_ctxt.m_mp = mp;
+	inval_ctxt.m_stats_invalid_map = GPOS_NEW(mp) UlongToUlongMap(mp);
+
+	(void) CMDCache::Invalidate(IsInvalidMDCacheEntry, &inval_ctxt);
+
+	if (CPlanCache::FInitialized())
+	{
+		(void) CPlanCache::Invalidate(IsInvalidPlanCacheEntry, &inval_ctxt);
+	}
+
+	inval_ctxt.m_stats_invalid_map->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::ShouldDropMDCache
+//
+//	@doc:
+//		Check if the metadata cache must be dropped after the given optimizer
+//		exception. Cache entries are only inserted once fully built, so an
+//		exception cannot leave a partial entry behind. The cache is kept for
+//		the expected fallbacks to the planner, for errors reported to the
+//		user, and for cancellations. It is dropped for anything unexpected,
+//		such as running out of memory, a failed assertion, or an error while
+//		reading the catalog, since those may stem from stale cache contents
+//		or leave the optimizer in a state we cannot reason about.
+//
+//---------------------------------------------------------------------------
+BOOL
+COptTasks::ShouldDropMDCache(CException &ex)
+{
+	if (GPOS_MATCH_EX(ex, CException::ExmaSystem, CException::ExmiAbort))
+	{
+		return false;
+	}
+
+	return IsLoggableFailure(ex) && !ShouldErrorOut(ex);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::CreatePlanCacheKey
+//
+//	@doc:
+//		Serialize the query and all optimizer inputs that may change the
+//		resulting plan into a plan cache key. Constants are part of the
+//		query, since they drive cardinality estimates and partition
+//		elimination.
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+COptTasks::CreatePlanCacheKey(CMemoryPool *mp, const CDXLNode *query_dxl,
+							  const CDXLNodeArray *query_output_dxlnode_array,
+							  const CDXLNodeArray *cte_dxlnode_array,
+							  const COptimizerConfig *optimizer_config,
+							  ULONG num_segments)
+{
+	CWStringDynamic *key = GPOS_NEW(mp) CWStringDynamic(mp);
+	COstreamString oss(key);
+
+	CDXLUtils::SerializeQuery(mp, oss, query_dxl, query_output_dxlnode_array,
+							  cte_dxlnode_array, false /*serialize_header_footer*/,
+							  false /*indentation*/);
+
+	// optimizer configuration, including the trace flags
+	{
+		CXMLSerializer xml_serializer(mp, oss, false /*indentation*/);
+		CBitSet *trace_flags =
+			CTask::Self()->GetTaskCtxt()->copy_trace_flags(mp);
+		optimizer_config->Serialize(mp, &xml_serializer, trace_flags);
+		trace_flags->Release();
+	}
+
+	// inputs not covered by the configuration
+	optimizer_config->GetCostModel()->GetCostModelParams()->OsPrint(oss);
+	oss << num_segments << " " << (ULONG) optimizer_cost_model;
+
+	// search strategy, as loaded by LoadSearchStrategy
+	if (nullptr != search_strategy_cache.m_mp)
+	{
+		oss << " " << search_strategy_cache.m_source << " "
+			<< search_strategy_cache.m_mtime << " "
+			<< search_strategy_cache.m_size;
+	}
+
+	return key;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptTasks::OptimizeTask
@@ -479,6 +1187,10 @@ COptTasks::OptimizeTask(void *ptr)
 	// the invalidation mechanism.
 	bool reset_mdcache = gpdb::MDCacheNeedsReset();
 
+	// cached plans are only kept valid by the invalidations applied to a
+	// live metadata cache
+	bool reset_plan_cache = reset_mdcache || !CMDCache::FInitialized();
+
 	// initialize metadata cache, or purge if needed, or change size if requested
 	if (!CMDCache::FInitialized())
 	{
@@ -490,16 +1202,58 @@ COptTasks::OptimizeTask(void *ptr)
 		CMDCache::Reset();
 		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
 	}
-	else if (CMDCache::ULLGetCacheQuota() !=
-			 (ULLONG) optimizer_mdcache_size * 1024L)
+	else
 	{
-		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		if (gpdb::MDCacheHasPendingInvalidations())
+		{
+			InvalidateMDCache(mp);
+		}
+
+		if (CMDCache::ULLGetCacheQuota() !=
+			(ULLONG) optimizer_mdcache_size * 1024L)
+		{
+			CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		}
 	}
 
+	// initialize plan cache, or purge if needed, or change size if requested
+	if (0 == optimizer_plan_cache_size || !optimizer_metadata_caching)
+	{
+		if (CPlanCache::FInitialized())
+		{
+			CPlanCache::Shutdown();
+		}
+	}
+	else if (!CPlanCache::FInitialized())
+	{
+		CPlanCache::Init();
+		CPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+	}
+	else if (reset_plan_cache)
+	{
+		CPlanCache::Reset();
+		CPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+	}
+	else if (CPlanCache::ULLGetCacheQuota() !=
+			 (ULLONG) optimizer_plan_cache_size * 1024L)
+	{
+		CPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+	}
+
+	// plans are not cached when the optimizer is asked to produce more than
+	// the plan itself
+	BOOL use_plan_cache =
+		CPlanCache::FInitialized() && !optimizer_enumerate_plans &&
+		!optimizer_sample_plans &&
+		OPTIMIZER_MINIDUMP_ALWAYS != optimizer_minidump &&
+		CMD_SELECT == opt_ctxt->m_query->commandType &&
+		PARENTSTMTTYPE_NONE == opt_ctxt->m_query->parentStmtType;
+
 
 	// load search strategy
 	CSearchStageArray *search_strategy_arr =
-		LoadSearchStrategy(mp, optimizer_search_strategy_path);
+		LoadSearchStrategy(mp, optimizer_search_strategy_path,
+						   optimizer_search_strategy);
 
 	CBitSet *trace_flags = nullptr;
 	CBitSet *enabled_trace_flags = nullptr;
@@ -508,6 +1262,8 @@ COptTasks::OptimizeTask(void *ptr)
 
 	IMdIdArray *col_stats = nullptr;
 	MdidHashSet *rel_stats = nullptr;
+	CWStringDynamic *plan_cache_key = nullptr;
+	BOOL plan_cache_hit = false;
 
 	GPOS_TRY
 	{
@@ -564,10 +1320,59 @@ COptTasks::OptimizeTask(void *ptr)
 			CAutoTraceFlag atf2(EopttraceUseLegacyOpfamilies,
 								use_legacy_opfamilies);
 
-			plan_dxl = COptimizer::PdxlnOptimize(
-				mp, &mda, query_dxl, query_output_dxlnode_array,
-				cte_dxlnode_array, expr_evaluator, num_segments, gp_session_id,
-				gp_command_count, search_strategy_arr, optimizer_config);
+			// columns without statistics, reported once the plan is ready;
+			// a cached plan brings along those found when it was built
+			col_stats = GPOS_NEW(mp) IMdIdArray(mp);
+
+			CHAR *cached_plan = nullptr;
+			if (use_plan_cache)
+			{
+				plan_cache_key = CreatePlanCacheKey(
+					mp, query_dxl, query_output_dxlnode_array,
+					cte_dxlnode_array, optimizer_config, num_segments);
+				cached_plan =
+					CPlanCache::Lookup(mp, plan_cache_key, col_stats);
+			}
+
+			if (nullptr != cached_plan)
+			{
+				plan_cache_hit = true;
+				ULLONG plan_id = 0;
+				ULLONG plan_space_size = 0;
+				plan_dxl = CDXLUtils::GetPlanDXLNode(
+					mp, cached_plan, nullptr /*xsd_file_path*/, &plan_id,
+					&plan_space_size);
+				GPOS_DELETE_ARRAY(cached_plan);
+			}
+			else
+			{
+				plan_dxl = COptimizer::PdxlnOptimize(
+					mp, &mda, query_dxl, query_output_dxlnode_array,
+					cte_dxlnode_array, expr_evaluator, num_segments,
+					gp_session_id, gp_command_count, search_strategy_arr,
+					optimizer_config);
+
+				CStatisticsConfig *stats_conf =
+					optimizer_config->GetStatsConf();
+				stats_conf->CollectMissingStatsColumns(col_stats);
+
+				if (nullptr != plan_cache_key)
+				{
+					CWStringDynamic plan_str(mp);
+					COstreamString oss(&plan_str);
+					CDXLUtils::SerializePlan(
+						mp, oss, plan_dxl, 0 /*plan_id*/,
+						0 /*plan_space_size*/,
+						true /*serialize_header_footer*/,
+						false /*indentation*/);
+					CAutoRg<CHAR> plan_mbstr(
+						CDXLUtils::CreateMultiByteCharStringFromWCString(
+							mp, plan_str.GetBuffer()));
+					CAutoRef<IMdIdArray> mdids(mda.GetAccessedMdIds(mp));
+					CPlanCache::Insert(plan_cache_key, plan_mbstr.Rgt(),
+									   mdids.Value(), col_stats);
+				}
+			}
 
 			if (opt_ctxt->m_should_serialize_plan_dxl)
 			{
@@ -595,10 +1400,6 @@ COptTasks::OptimizeTask(void *ptr)
 						query_to_dxl_translator->GetDistributionHashOpsKind()));
 			}
 
-			CStatisticsConfig *stats_conf = optimizer_config->GetStatsConf();
-			col_stats = GPOS_NEW(mp) IMdIdArray(mp);
-			stats_conf->CollectMissingStatsColumns(col_stats);
-
 			rel_stats = GPOS_NEW(mp) MdidHashSet(mp);
 			PrintMissingStatsWarning(mp, &mda, col_stats, rel_stats);
 
@@ -609,10 +1410,13 @@ COptTasks::OptimizeTask(void *ptr)
 			query_dxl->Release();
 			optimizer_config->Release();
 			plan_dxl->Release();
+			GPOS_DELETE(plan_cache_key);
+			plan_cache_key = nullptr;
 		}
 	}
 	GPOS_CATCH_EX(ex)
 	{
+		GPOS_DELETE(plan_cache_key);
 		ResetTraceflags(enabled_trace_flags, disabled_trace_flags);
 		CRefCount::SafeRelease(rel_stats);
 		CRefCount::SafeRelease(col_stats);
@@ -620,7 +1424,28 @@ COptTasks::OptimizeTask(void *ptr)
 		CRefCount::SafeRelease(disabled_trace_flags);
 		CRefCount::SafeRelease(trace_flags);
 		CRefCount::SafeRelease(plan_dxl);
-		CMDCache::Shutdown();
+
+		BOOL drop_mdcache = ShouldDropMDCache(ex);
+		if (drop_mdcache)
+		{
+			m_mdcache_dropped_on_exception++;
+		}
+		else
+		{
+			m_mdcache_kept_on_exception++;
+		}
+
+		elog(DEBUG1,
+			 "[OPT]: metadata cache %s after optimizer exception "
+			 "(kept " UINT64_FORMAT " times, dropped " UINT64_FORMAT " times)",
+			 drop_mdcache ? "dropped" : "kept",
+			 (uint64) m_mdcache_kept_on_exception,
+			 (uint64) m_mdcache_dropped_on_exception);
+
+		if (drop_mdcache || !optimizer_metadata_caching)
+		{
+			CMDCache::Shutdown();
+		}
 
 		IErrorContext *errctxt = CTask::Self()->GetErrCtxt();
 
@@ -643,6 +1468,11 @@ COptTasks::OptimizeTask(void *ptr)
 		CMDCache::Shutdown();
 	}
 
+	if (plan_cache_hit)
+	{
+		elog(DEBUG1, "[OPT]: plan cache hit");
+	}
+
 	return nullptr;
 }
 
@@ -0,0 +1,315 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPlanCache.cpp
+//
+//	@doc:
+//		Implementation of the cache of DXL plans produced by GPORCA
+//
+//---------------------------------------------------------------------------
+
+#include "gpopt/utils/CPlanCache.h"
+
+#include "gpos/memory/CCacheAccessor.h"
+#include "gpos/memory/CCacheFactory.h"
+#include "gpos/utils.h"
+
+using namespace gpos;
+using namespace gpmd;
+using namespace gpopt;
+
+// global instance of plan cache
+CPlanCache::PlanCache *CPlanCache::m_pcache = nullptr;
+
+// maximum size of the cache
+ULLONG CPlanCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::CPlanCacheKey
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPlanCacheKey::CPlanCacheKey(CMemoryPool *mp, const CWStringBase *str)
+	: m_str(GPOS_NEW(mp) CWStringDynamic(mp, str->GetBuffer())),
+	  m_hash(gpos::HashByteArray((const BYTE *) str->GetBuffer(),
+								 str->Length() * GPOS_SIZEOF(WCHAR)))
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::~CPlanCacheKey
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPlanCacheKey::~CPlanCacheKey()
+{
+	GPOS_DELETE(m_str);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::FEqualKey
+//
+//	@doc:
+//		Equality function for using plan cache keys in a cache
+//
+//---------------------------------------------------------------------------
+BOOL
+CPlanCacheKey::FEqualKey(CPlanCacheKey *const &left,
+						 CPlanCacheKey *const &right)
+{
+	if (nullptr == left && nullptr == right)
+	{
+		return true;
+	}
+
+	if (nullptr == left || nullptr == right)
+	{
+		return false;
+	}
+
+	return left->m_hash == right->m_hash && left->m_str->Equals(right->m_str);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::UlHashKey
+//
+//	@doc:
+//		Hash function for using plan cache keys in a cache
+//
+//---------------------------------------------------------------------------
+ULONG
+CPlanCacheKey::UlHashKey(CPlanCacheKey *const &key)
+{
+	return key->m_hash;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheEntry::CPlanCacheEntry
+//
+//	@doc:
+//		Ctor; the plan and the mdids are copied into the given memory pool,
+//		which is the memory pool of the cache entry
+//
+//---------------------------------------------------------------------------
+CPlanCacheEntry::CPlanCacheEntry(CMemoryPool *mp, const CHAR *plan_dxl,
+								 const IMdIdArray *mdids,
+								 const IMdIdArray *missing_stats_mdids)
+	: m_plan_dxl(nullptr),
+	  m_mdids(GPOS_NEW(mp) IMdIdArray(mp)),
+	  m_missing_stats_mdids(GPOS_NEW(mp) IMdIdArray(mp))
+{
+	const ULONG length = clib::Strlen(plan_dxl);
+	m_plan_dxl = GPOS_NEW_ARRAY(mp, CHAR, length + 1);
+	clib::Strncpy(m_plan_dxl, plan_dxl, length + 1);
+
+	const ULONG size = mdids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		m_mdids->Append((*mdids)[ul]->Copy(mp));
+	}
+
+	const ULONG num_missing_stats = missing_stats_mdids->Size();
+	for (ULONG ul = 0; ul < num_missing_stats; ul++)
+	{
+		m_missing_stats_mdids->Append((*missing_stats_mdids)[ul]->Copy(mp));
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheEntry::~CPlanCacheEntry
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPlanCacheEntry::~CPlanCacheEntry()
+{
+	GPOS_DELETE_ARRAY(m_plan_dxl);
+	m_mdids->Release();
+	m_missing_stats_mdids->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Init
+//
+//	@doc:
+//		Initializes global instance
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Init()
+{
+	GPOS_ASSERT(nullptr == m_pcache && "Plan cache was already created");
+
+	m_pcache = CCacheFactory::CreateCache<CPlanCacheEntry *, CPlanCacheKey *>(
+		true /*fUnique*/, m_ullCacheQuota, CPlanCacheKey::UlHashKey,
+		CPlanCacheKey::FEqualKey);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Shutdown
+//
+//	@doc:
+//		Cleans up the underlying cache
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Shutdown()
+{
+	GPOS_DELETE(m_pcache);
+	m_pcache = nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::SetCacheQuota
+//
+//	@doc:
+//		Set the maximum size of the cache
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::SetCacheQuota(ULLONG ullCacheQuota)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+	m_ullCacheQuota = ullCacheQuota;
+	m_pcache->SetCacheQuota(ullCacheQuota);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::ULLGetCacheQuota
+//
+//	@doc:
+//		Get the maximum size of the cache
+//
+//---------------------------------------------------------------------------
+ULLONG
+CPlanCache::ULLGetCacheQuota()
+{
+	GPOS_ASSERT_IMP(nullptr != m_pcache,
+					m_pcache->GetCacheQuota() == m_ullCacheQuota);
+	return m_ullCacheQuota;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Reset
+//
+//	@doc:
+//		Reset plan cache
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Reset()
+{
+	Shutdown();
+	Init();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Lookup
+//
+//	@doc:
+//		Return a copy, allocated in the given memory pool, of the plan
+//		cached for the given key, or nullptr if there is none. The column
+//		statistics that were missing when the plan was built are appended
+//		to the given array, so that callers can report them as on a miss.
+//
+//---------------------------------------------------------------------------
+CHAR *
+CPlanCache::Lookup(CMemoryPool *mp, const CWStringBase *key,
+				   IMdIdArray *missing_stats_mdids)
+{
+	GPOS_ASSERT(nullptr != missing_stats_mdids);
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+
+	CPlanCacheKey lookup_key(mp, key);
+
+	CCacheAccessor<CPlanCacheEntry *, CPlanCacheKey *> acc(m_pcache);
+	acc.Lookup(&lookup_key);
+	CPlanCacheEntry *entry = acc.Val();
+	if (nullptr == entry)
+	{
+		return nullptr;
+	}
+
+	const CHAR *plan_dxl = entry->GetPlanDXL();
+	const ULONG length = clib::Strlen(plan_dxl);
+	CHAR *result = GPOS_NEW_ARRAY(mp, CHAR, length + 1);
+	clib::Strncpy(result, plan_dxl, length + 1);
+
+	const IMdIdArray *cached_mdids = entry->GetMissingStatsMdIds();
+	const ULONG size = cached_mdids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		missing_stats_mdids->Append((*cached_mdids)[ul]->Copy(mp));
+	}
+
+	return result;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Insert
+//
+//	@doc:
+//		Cache the plan produced for the given key
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Insert(const CWStringBase *key, const CHAR *plan_dxl,
+				   const IMdIdArray *mdids,
+				   const IMdIdArray *missing_stats_mdids)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+
+	CCacheAccessor<CPlanCacheEntry *, CPlanCacheKey *> acc(m_pcache);
+	CMemoryPool *mp = acc.Pmp();
+
+	CPlanCacheKey *cache_key = GPOS_NEW(mp) CPlanCacheKey(mp, key);
+	CPlanCacheEntry *entry = GPOS_NEW(mp)
+		CPlanCacheEntry(mp, plan_dxl, mdids, missing_stats_mdids);
+
+	// if another plan was inserted for the same key in the meantime, the
+	// memory pool holding the new key and entry is destroyed along with the
+	// accessor
+	(void) acc.Insert(cache_key, entry);
+
+	// the cache owns the entry now
+	entry->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Invalidate
+//
+//	@doc:
+//		Remove the entries accepted by the given filter
+//
+//---------------------------------------------------------------------------
+ULONG
+CPlanCache::Invalidate(PlanCache::EntryFilterFuncPtr filter_func,
+					   void *context)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+
+	return m_pcache->InvalidateEntries(filter_func, context);
+}
+
+// EOF
@@ -289,6 +289,9 @@ public:
 	// lookup param by name
 	SCostParam *PcpLookup(const CHAR *szName) const override;
 
+	// is there a param of the given name
+	static BOOL FParamName(const CHAR *szName);
+
 	// set param by id
 	void SetParam(ULONG id, CDouble dVal, CDouble dLowerBound,
 				  CDouble dUpperBound) override;
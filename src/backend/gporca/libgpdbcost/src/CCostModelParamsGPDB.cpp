@@ -494,6 +494,32 @@ CCostModelParamsGPDB::PcpLookup(const CHAR *szName) const
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelParamsGPDB::FParamName
+//
+//	@doc:
+//		Is there a param of the given name; needs no instance, so that
+//		param names can be checked before the optimizer is initialized
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostModelParamsGPDB::FParamName(const CHAR *szName)
+{
+	GPOS_ASSERT(nullptr != szName);
+
+	for (ULONG ul = 0; ul < EcpSentinel; ul++)
+	{
+		if (0 == clib::Strcmp(szName, rgszCostParamNames[ul]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelParamsGPDB::SetParam
@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CFlatHashMap.h"
 #include "gpos/common/CHashMap.h"
 #include "gpos/common/CList.h"
 #include "gpos/common/DbgPrintMixin.h"
@@ -238,8 +239,8 @@ operator<<(IOstream &os, CColRef &cr)
 }
 
 // hash map: CColRef -> ULONG
-typedef CHashMap<CColRef, ULONG, CColRef::HashValue, gpos::Equals<CColRef>,
-				 CleanupNULL<CColRef>, CleanupDelete<ULONG> >
+typedef CFlatHashMap<CColRef, ULONG, CColRef::HashValue, gpos::Equals<CColRef>,
+					 CleanupNULL<CColRef>, CleanupDelete<ULONG> >
 	ColRefToUlongMap;
 
 typedef CDynamicPtrArray<ColRefToUlongMap, CleanupRelease>
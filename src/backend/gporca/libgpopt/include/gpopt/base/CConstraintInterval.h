@@ -64,6 +64,11 @@ private:
 	static void AppendOrExtend(CMemoryPool *mp, CRangeArray *pdrgprng,
 							   CRange *prange);
 
+	// index of the first range in the given array, starting at the given
+	// index, that is not disjoint from the given range and to its left
+	static ULONG UlFirstRangeNotBefore(CRangeArray *pdrgprng, ULONG ulStart,
+									   CRange *prange);
+
 	// difference between two ranges on the left side only -
 	// any difference on the right side is reported as residual range
 	static CRange *PrangeDiffWithRightResidual(CMemoryPool *mp,
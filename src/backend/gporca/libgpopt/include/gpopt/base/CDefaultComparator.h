@@ -19,6 +19,7 @@
 #define GPOPT_CDefaultComparator_H
 
 #include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
 
 #include "gpopt/base/IComparator.h"
 #include "naucrates/md/IMDType.h"
@@ -57,27 +58,80 @@ class IConstExprEvaluator;
 class CDefaultComparator : public IComparator
 {
 private:
+	// comparison evaluated by the constant expression evaluator
+	struct SComparison
+	{
+		// compared data, owned
+		IDatum *m_datum1;
+		IDatum *m_datum2;
+
+		// comparison type
+		IMDType::ECmpType m_cmp_type;
+
+		// ctor
+		SComparison(IDatum *datum1, IDatum *datum2,
+					IMDType::ECmpType cmp_type)
+			: m_datum1(datum1), m_datum2(datum2), m_cmp_type(cmp_type)
+		{
+		}
+
+		// dtor
+		~SComparison();
+
+		// hash function
+		static ULONG HashValue(const SComparison *comparison);
+
+		// equality function
+		static BOOL Equals(const SComparison *first,
+						   const SComparison *second);
+	};
+
+	// map of evaluated comparisons to their results
+	typedef CHashMap<SComparison, BOOL, SComparison::HashValue,
+					 SComparison::Equals, CleanupDelete<SComparison>,
+					 CleanupDelete<BOOL> >
+		ComparisonToResultMap;
+
+	// largest number of comparison results remembered
+	static const ULONG MaxMemoizedComparisons = 4096;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
 	// constant expression evaluator
 	IConstExprEvaluator *m_pceeval;
 
+	// results of comparisons evaluated so far by the constant expression
+	// evaluator; the comparator lives as long as the optimization context
+	mutable ComparisonToResultMap *m_comparison_results;
+
 	// construct a comparison expression from the given components and evaluate it
 	BOOL FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
 						 const IDatum *datum2,
 						 IMDType::ECmpType cmp_type) const;
 
+	// evaluate a comparison, looking up and remembering its result
+	BOOL FEvalComparisonMemo(const IDatum *datum1, const IDatum *datum2,
+							 IMDType::ECmpType cmp_type) const;
+
 	// return true iff we should use the internal (stats-based) evaluation
 	static BOOL FUseInternalEvaluator(const IDatum *datum1,
 									  const IDatum *datum2,
 									  BOOL *can_use_external_evaluator);
 
+	// compare data of byte-comparable types without the constant expression
+	// evaluator; return false if the comparison cannot be done natively
+	static BOOL FNativeComparison(const IDatum *datum1, const IDatum *datum2,
+								  IMDType::ECmpType cmp_type, BOOL *result);
+
 public:
 	CDefaultComparator(const CDefaultComparator &) = delete;
 
 	// ctor
-	CDefaultComparator(IConstExprEvaluator *pceeval);
+	CDefaultComparator(CMemoryPool *mp, IConstExprEvaluator *pceeval);
 
 	// dtor
-	~CDefaultComparator() override = default;
+	~CDefaultComparator() override;
 
 	// tests if the two arguments are equal
 	BOOL Equals(const IDatum *datum1, const IDatum *datum2) const override;
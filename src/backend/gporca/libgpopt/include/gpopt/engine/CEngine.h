@@ -34,6 +34,20 @@ class CReqdPropPlan;
 class CReqdPropRelational;
 class CEnumeratorConfig;
 
+// size of the search of an optimization, for tools that measure the
+// optimizer
+struct SEngineStats
+{
+	// number of memo groups
+	ULONG m_num_groups{0};
+
+	// number of group expressions in memo
+	ULONG m_num_group_exprs{0};
+
+	// number of jobs scheduled
+	ULLONG m_num_jobs{0};
+};
+
 //---------------------------------------------------------------------------
 //	@class:
 //		CEngine
@@ -80,6 +94,9 @@ private:
 	// number of alternatives generated by each xform
 	UlongPtrArray *m_pdrgpulpXformResults;
 
+	// number of jobs scheduled by optimization
+	ULLONG m_num_jobs;
+
 #ifdef GPOS_DEBUG
 
 	// a set of internal debugging function used for recursive
@@ -139,6 +156,9 @@ private:
 	// initialize query logical expression
 	void InitLogicalExpression(CExpression *pexpr);
 
+	// search strategy of a query for which none was given
+	CSearchStageArray *PdrgpssForQuery() const;
+
 	// insert children of the given expression to memo, and
 	// copy the resulting groups to the given group array
 	void InsertExpressionChildren(CExpression *pexpr,
@@ -256,6 +276,9 @@ public:
 	// extract a physical plan from the memo
 	CExpression *PexprExtractPlan();
 
+	// collect the size of the search
+	void CollectStats(SEngineStats *stats);
+
 	// check required properties;
 	// return false if it's impossible for the operator to satisfy one or more
 	BOOL FCheckReqdProps(CExpressionHandle &exprhdl, CReqdPropPlan *prpp,
@@ -47,6 +47,7 @@ class IMDProvider;
 class CMDProviderGeneric;
 class IMDColStats;
 class IMDRelStats;
+class IMDExtStats;
 class CDXLBucket;
 class IMDCast;
 class IMDScCmp;
@@ -54,6 +55,7 @@ class IMDScCmp;
 
 namespace gpnaucrates
 {
+class CExtendedStats;
 class CHistogram;
 class CBucket;
 class IStatistics;
@@ -243,16 +245,29 @@ private:
 	// initialize hash tables
 	void InitHashtables(CMemoryPool *mp);
 
-	// return the column statistics meta data object for a given column of a table
+	// return the column statistics meta data object for a given column of a
+	// table, merged from those of the given leaf partitions if any
 	const IMDColStats *Pmdcolstats(CMemoryPool *mp, IMDId *rel_mdid,
-								   ULONG ulPos);
+								   ULONG ulPos, IMdIdArray *part_mdids);
 
 	// record histogram and width information for a given column of a table
 	void RecordColumnStats(CMemoryPool *mp, IMDId *rel_mdid, ULONG colid,
 						   ULONG ulPos, BOOL isSystemCol, BOOL isEmptyTable,
 						   UlongToHistogramMap *col_histogram_mapping,
 						   UlongToDoubleMap *colid_width_mapping,
-						   CStatisticsConfig *stats_config);
+						   CStatisticsConfig *stats_config,
+						   IMdIdArray *part_mdids);
+
+	// set of the column ids of the given attnos
+	static CBitSet *MapAttnosToColIds(CMemoryPool *mp,
+									  const ULongPtrArray *attnos,
+									  IntToUlongMap *attno_colid_mapping);
+
+	// construct the multi-column statistics of the given columns of a
+	// relation from its MD extended stats object
+	CExtendedStats *GetExtendedStats(CMemoryPool *mp,
+									 const IMDExtStats *pmdextstats,
+									 CColRefSet *pcrsHist);
 
 	// construct a stats histogram from an MD column stats object
 	CHistogram *GetHistogram(CMemoryPool *mp, IMDId *mdid_type,
@@ -347,6 +362,9 @@ public:
 	// retrieve a relation stats object from the cache
 	const IMDRelStats *Pmdrelstats(IMDId *mdid);
 
+	// retrieve an extended stats object from the cache
+	const IMDExtStats *Pmdextstats(IMDId *mdid);
+
 	// retrieve a cast object from the cache
 	const IMDCast *Pmdcast(IMDId *mdid_src, IMDId *mdid_dest);
 
@@ -361,11 +379,18 @@ public:
 			*pcrsHist,	// set of column references for which stats are needed
 		CColRefSet *
 			pcrsWidth,	// set of column references for which the widths are needed
-		CStatisticsConfig *stats_config = nullptr);
+		CStatisticsConfig *stats_config = nullptr,
+		IMdIdArray *
+			part_mdids =
+				nullptr	 // leaf partitions to merge the statistics of, if any
+	);
 
 	// serialize object to passed stream
 	void Serialize(COstream &oos);
 
+	// ids of all objects accessed so far
+	IMdIdArray *GetAccessedMdIds(CMemoryPool *mp);
+
 	// serialize system ids to passed stream
 	void SerializeSysid(COstream &oos);
 };
@@ -78,6 +78,11 @@ public:
 	// reset global instance
 	static void Reset();
 
+	// remove the entries accepted by the given filter, keeping the rest
+	// of the cache; returns the number of removed entries
+	static ULONG Invalidate(
+		CMDAccessor::MDCache::EntryFilterFuncPtr filter_func, void *context);
+
 	// global accessor
 	static CMDAccessor::MDCache *
 	Pcache()
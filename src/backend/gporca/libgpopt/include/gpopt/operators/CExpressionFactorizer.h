@@ -19,6 +19,7 @@
 #define GPOPT_CExpressionFactorizer_H
 
 #include "gpos/base.h"
+#include "gpos/common/CHashMapIter.h"
 
 #include "gpopt/base/CUtils.h"
 #include "gpopt/operators/CExpression.h"
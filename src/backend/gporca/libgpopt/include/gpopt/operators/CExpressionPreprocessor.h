@@ -14,6 +14,7 @@
 #define GPOPT_CExpressionPreprocessor_H
 
 #include "gpos/base.h"
+#include "gpos/common/CHashMapIter.h"
 
 #include "gpopt/base/CColumnFactory.h"
 #include "gpopt/mdcache/CMDAccessor.h"
@@ -24,6 +25,9 @@ namespace gpopt
 {
 using namespace gpos;
 
+// fwd declarations
+class CPreprocessingPassStats;
+
 //---------------------------------------------------------------------------
 //	@class:
 //		CExpressionPreprocessor
@@ -34,6 +38,8 @@ using namespace gpos;
 //---------------------------------------------------------------------------
 class CExpressionPreprocessor
 {
+	friend class CExpressionPreprocessorTest;
+
 private:
 	// map CTE id to collected predicates
 	typedef CHashMap<ULONG, CExpressionArray, gpos::HashValue<ULONG>,
@@ -92,9 +98,8 @@ private:
 	static CExpression *PexprUnnestScalarSubqueries(CMemoryPool *mp,
 													CExpression *pexpr);
 
-	// remove superfluous limit nodes
-	static CExpression *PexprRemoveSuperfluousLimit(CMemoryPool *mp,
-													CExpression *pexpr);
+	// is the given expression a limit with neither row count nor offset
+	static BOOL FSuperfluousLimit(CExpression *pexpr);
 
 	// remove superfluous distinct nodes
 	static CExpression *PexprRemoveSuperfluousDistinctInDQA(CMemoryPool *mp,
@@ -152,9 +157,13 @@ private:
 	static CExpression *PexprOuterJoinToInnerJoin(CMemoryPool *mp,
 												  CExpression *pexpr);
 
-	// eliminate CTE Anchors for CTEs that have zero consumers
-	static CExpression *PexprRemoveUnusedCTEs(CMemoryPool *mp,
-											  CExpression *pexpr);
+	// is the given expression an anchor of a CTE that has zero consumers
+	static BOOL FUnusedCTEAnchor(CExpression *pexpr);
+
+	// eliminate CTE Anchors for CTEs that have zero consumers, and limits
+	// that have neither row count nor offset, in one traversal
+	static CExpression *PexprRemoveUnusedCTEsAndSuperfluousLimits(
+		CMemoryPool *mp, CExpression *pexpr);
 
 	// collect CTE predicates from consumers
 	static void CollectCTEPredicates(CMemoryPool *mp, CExpression *pexpr,
@@ -201,10 +210,39 @@ private:
 
 	static CExpression *PrunePartitions(CMemoryPool *mp, CExpression *expr);
 
+	// positions of the range partitions whose ranges overlap the given
+	// constraint on the partition key, found by binary search of the bounds
+	static CBitSet *PbsRangePartitions(CMemoryPool *mp,
+									   const IMDRelation *rootrel,
+									   const CColRef *part_key,
+									   CConstraint *key_cnstr);
+
+	// position of the slot between the range bounds that holds the given
+	// value, found by binary search
+	static ULONG UlRangeSlot(CMemoryPool *mp, CDXLDatumArray *bounds,
+							 const IDatum *datum, BOOL count_equal_bounds);
+
+	// return the given expression if the given children are its own, or a
+	// new expression with its operator over the given children otherwise;
+	// takes ownership of the children array
+	static CExpression *PexprRebuildIfChanged(
+		CMemoryPool *mp, CExpression *pexpr,
+		CExpressionArray *pdrgpexprChildren);
+
 	static CConstraint *PcnstrFromChildPartition(const IMDRelation *partrel,
 												 CColRefArray *pdrgpcrOutput,
 												 ColRefToUlongMap *col_mapping);
 
+	// constraint on the root columns from a part constraint
+	static CConstraint *PcnstrFromPartConstraint(CDXLNode *part_constraint,
+												 CColRefArray *pdrgpcrOutput,
+												 ULongPtrArray *mapped_colids);
+
+	// run the preprocessing passes, recording the time of each pass
+	static CExpression *PexprPreprocessPasses(
+		CMemoryPool *mp, CExpression *pexpr, CColRefSet *pcrsOutputAndOrderCols,
+		CPreprocessingPassStats *pstats);
+
 	// private ctor
 	CExpressionPreprocessor();
 
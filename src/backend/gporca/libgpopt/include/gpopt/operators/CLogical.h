@@ -309,11 +309,13 @@ public:
 		return true;
 	}
 
-	// helper for deriving statistics on a base table
+	// helper for deriving statistics on a base table, or on the given leaf
+	// partitions of a partitioned table
 	static IStatistics *PstatsBaseTable(CMemoryPool *mp,
 										CExpressionHandle &exprhdl,
 										CTableDescriptor *ptabdesc,
-										CColRefSet *pcrsStatExtra = nullptr);
+										CColRefSet *pcrsStatExtra = nullptr,
+										IMdIdArray *part_mdids = nullptr);
 
 	// conversion function
 	static CLogical *
@@ -66,8 +66,9 @@ protected:
 	// Child partitions
 	IMdIdArray *m_partition_mdids = nullptr;
 	// Map of Root colref -> col index in child tabledesc
-	// per child partition in m_partition_mdid
-	ColRefToUlongMapArray *m_root_col_mapping_per_part = nullptr;
+	// per child partition in m_partition_mdid; constructed on first use, as
+	// it needs the metadata of every child partition
+	mutable ColRefToUlongMapArray *m_root_col_mapping_per_part = nullptr;
 
 	// Construct a mapping from each column in root table to an index in each
 	// child partition's table descr by matching column names$
@@ -177,11 +178,7 @@ public:
 		return m_partition_mdids;
 	}
 
-	ColRefToUlongMapArray *
-	GetRootColMappingPerPart() const
-	{
-		return m_root_col_mapping_per_part;
-	}
+	ColRefToUlongMapArray *GetRootColMappingPerPart() const;
 };	// class CLogicalDynamicGetBase
 
 }  // namespace gpopt
@@ -38,6 +38,7 @@ class ICostModel;
 class COptimizerConfig;
 class CQueryContext;
 class CEnumeratorConfig;
+struct SEngineStats;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -55,7 +56,8 @@ private:
 
 	// optimize query in the given query context
 	static CExpression *PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
-									  CSearchStageArray *search_stage_array);
+									  CSearchStageArray *search_stage_array,
+									  SEngineStats *engine_stats);
 
 	// translate an optimizer expression into a DXL tree
 	static CDXLNode *CreateDXLNode(CMemoryPool *mp, CMDAccessor *md_accessor,
@@ -97,7 +99,9 @@ public:
 		CSearchStageArray *search_stage_array,	// search strategy
 		COptimizerConfig *optimizer_config,		// optimizer configurations
 		const CHAR *szMinidumpFileName =
-			nullptr	 // name of minidump file to be created
+			nullptr,  // name of minidump file to be created
+		SEngineStats *engine_stats =
+			nullptr	 // if given, receives the size of the search
 	);
 };	// class COptimizer
 }  // namespace gpopt
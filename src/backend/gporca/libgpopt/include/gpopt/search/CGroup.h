@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CFlatHashMap.h"
 #include "gpos/common/CSyncHashtable.h"
 #include "gpos/common/CSyncList.h"
 
@@ -44,9 +45,9 @@ class CExpression;
 typedef CDynamicPtrArray<CGroup, CleanupNULL> CGroupArray;
 
 // map required plan props to cost lower bound of corresponding plan
-typedef CHashMap<CReqdPropPlan, CCost, CReqdPropPlan::UlHashForCostBounding,
-				 CReqdPropPlan::FEqualForCostBounding,
-				 CleanupRelease<CReqdPropPlan>, CleanupDelete<CCost> >
+typedef CFlatHashMap<CReqdPropPlan, CCost, CReqdPropPlan::UlHashForCostBounding,
+					 CReqdPropPlan::FEqualForCostBounding,
+					 CleanupRelease<CReqdPropPlan>, CleanupDelete<CCost> >
 	ReqdPropPlanToCostMap;
 
 // optimization levels in ascending order,
@@ -152,13 +153,13 @@ private:
 	};	// struct SContextLink
 
 	// map of processed links in TreeMap structure
-	typedef CHashMap<SContextLink, BOOL, SContextLink::HashValue,
-					 SContextLink::Equals, CleanupDelete<SContextLink>,
-					 CleanupDelete<BOOL> >
+	typedef CFlatHashMap<SContextLink, BOOL, SContextLink::HashValue,
+						 SContextLink::Equals, CleanupDelete<SContextLink>,
+						 CleanupDelete<BOOL> >
 		LinkMap;
 
 	// map of computed stats objects during costing
-	typedef CHashMap<
+	typedef CFlatHashMap<
 		COptimizationContext, IStatistics, COptimizationContext::UlHashForStats,
 		COptimizationContext::FEqualForStats,
 		CleanupRelease<COptimizationContext>, CleanupRelease<IStatistics> >
@@ -26,6 +26,7 @@ class CDrvdProp;
 class CDrvdPropCtxtPlan;
 class CMemoProxy;
 class COptimizationContext;
+struct SSearchSpaceEstimate;
 
 // memo tree map definition
 typedef CTreeMap<CCostContext, CExpression, CDrvdPropCtxtPlan,
@@ -126,6 +127,10 @@ public:
 	// return number of duplicate groups
 	ULONG UlDuplicateGroups();
 
+	// estimate the size of the search space of the memo
+	void EstimateSearchSpace(CMemoryPool *mp,
+							 SSearchSpaceEstimate *estimate) const;
+
 	// mark groups as duplicates
 	static void MarkDuplicates(CGroup *pgroupFst, CGroup *pgroupSnd);
 
@@ -188,6 +188,13 @@ public:
 	// print statistics
 	void PrintStats() const;
 
+	// number of jobs queued so far
+	ULONG_PTR
+	UlpQueuedJobs() const
+	{
+		return m_ulpStatsQueued;
+	}
+
 #ifdef GPOS_DEBUG
 	// get flag for tracking jobs
 	BOOL
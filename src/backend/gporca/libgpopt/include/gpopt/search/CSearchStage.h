@@ -17,6 +17,16 @@
 
 #include "gpopt/xforms/CXform.h"
 
+// queries with at most this many joins and exploration xform candidates
+// are optimized in a single stage by the adaptive search strategy
+#define GPOPT_ADAPTIVE_SEARCH_TRIVIAL_JOINS 1
+#define GPOPT_ADAPTIVE_SEARCH_TRIVIAL_XFORMS 64
+
+// time budget, in milliseconds, of the exhaustive stage of the adaptive
+// search strategy, per exploration xform candidate, and its bounds
+#define GPOPT_ADAPTIVE_SEARCH_MS_PER_XFORM 10
+#define GPOPT_ADAPTIVE_SEARCH_MIN_BUDGET_MS 1000
+#define GPOPT_ADAPTIVE_SEARCH_MAX_BUDGET_MS 30000
 
 namespace gpopt
 {
@@ -29,6 +39,20 @@ class CExpression;
 // definition of array of search stages
 typedef CDynamicPtrArray<CSearchStage, CleanupDelete> CSearchStageArray;
 
+// estimate of the size of the search space of a query, taken from the memo
+// before exploration
+struct SSearchSpaceEstimate
+{
+	// number of logical groups
+	ULONG m_num_groups{0};
+
+	// number of joins
+	ULONG m_num_joins{0};
+
+	// number of exploration xforms applicable to logical group expressions
+	ULONG m_num_xform_candidates{0};
+};
+
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -67,12 +91,14 @@ public:
 	// dtor
 	virtual ~CSearchStage();
 
-	// restart timer if time threshold is not default indicating don't timeout
+	// restart timer if time threshold is not default indicating don't timeout,
+	// or if the time of the stage is to be printed
 	// Restart() is a costly method, so avoid calling unnecessarily
 	void
 	RestartTimer()
 	{
-		if (m_time_threshold != gpos::ulong_max)
+		if (m_time_threshold != gpos::ulong_max ||
+			GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 			m_timer.Restart();
 	}
 
@@ -143,6 +169,10 @@ public:
 
 	// generate default search strategy
 	static CSearchStageArray *PdrgpssDefault(CMemoryPool *mp);
+
+	// generate search strategy for the given estimate of the search space
+	static CSearchStageArray *PdrgpssAdaptive(
+		CMemoryPool *mp, const SSearchSpaceEstimate &estimate);
 };
 
 // shorthand for printing
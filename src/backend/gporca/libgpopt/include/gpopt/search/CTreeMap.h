@@ -18,8 +18,8 @@
 #define GPOPT_CTreeMap_H
 
 #include "gpos/base.h"
-#include "gpos/common/CHashMap.h"
-#include "gpos/common/CHashMapIter.h"
+#include "gpos/common/CFlatHashMap.h"
+#include "gpos/common/CFlatHashMapIter.h"
 
 
 namespace gpopt
@@ -402,16 +402,17 @@ private:
 	CTreeNode *m_ptnRoot;
 
 	// map of all nodes
-	typedef gpos::CHashMap<T, CTreeNode, HashFn, EqFn, CleanupNULL,
-						   CleanupDelete<CTreeNode> >
-		TMap;
-	typedef gpos::CHashMapIter<T, CTreeNode, HashFn, EqFn, CleanupNULL,
+	typedef gpos::CFlatHashMap<T, CTreeNode, HashFn, EqFn, CleanupNULL,
 							   CleanupDelete<CTreeNode> >
+		TMap;
+	typedef gpos::CFlatHashMapIter<T, CTreeNode, HashFn, EqFn, CleanupNULL,
+								   CleanupDelete<CTreeNode> >
 		TMapIter;
 
 	// map of created links
-	typedef CHashMap<STreeLink, BOOL, STreeLink::HashValue, STreeLink::Equals,
-					 CleanupDelete<STreeLink>, CleanupDelete<BOOL> >
+	typedef CFlatHashMap<STreeLink, BOOL, STreeLink::HashValue,
+						 STreeLink::Equals, CleanupDelete<STreeLink>,
+						 CleanupDelete<BOOL> >
 		LinkMap;
 
 	TMap *m_ptmap;
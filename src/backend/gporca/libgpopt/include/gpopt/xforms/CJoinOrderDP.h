@@ -14,6 +14,7 @@
 #include "gpos/base.h"
 #include "gpos/common/CBitSet.h"
 #include "gpos/common/CHashMap.h"
+#include "gpos/common/CHashMapIter.h"
 #include "gpos/common/DbgPrintMixin.h"
 #include "gpos/io/IOstream.h"
 
@@ -318,14 +318,20 @@ private:
 	{
 		// the set of atoms, this uniquely identifies the group
 		CBitSet *m_atoms;
+		// inner join edges that reference any of the atoms, only these can
+		// connect the group to another one
+		CBitSet *m_edges;
 		// infos of the best (lowest cost) expressions (so far, if at the current level)
 		// for each interesting property
 		SExpressionInfoArray *m_best_expr_info_array;
 		CDouble m_cardinality;
 		CDouble m_lowest_expr_cost;
 
-		SGroupInfo(CMemoryPool *mp, CBitSet *atoms)
-			: m_atoms(atoms), m_cardinality(-1.0), m_lowest_expr_cost(-1.0)
+		SGroupInfo(CMemoryPool *mp, CBitSet *atoms, CBitSet *edges)
+			: m_atoms(atoms),
+			  m_edges(edges),
+			  m_cardinality(-1.0),
+			  m_lowest_expr_cost(-1.0)
 		{
 			m_best_expr_info_array = GPOS_NEW(mp) SExpressionInfoArray(mp);
 		}
@@ -333,6 +339,7 @@ private:
 		~SGroupInfo() override
 		{
 			m_atoms->Release();
+			m_edges->Release();
 			m_best_expr_info_array->Release();
 		}
 
@@ -451,8 +458,12 @@ private:
 		return (*m_join_levels)[l];
 	}
 
+	// inner join edges that reference any of the given atoms
+	CBitSet *PbsInnerJoinEdges(CBitSet *atoms);
+
 	// build expression linking given groups
-	CExpression *PexprBuildInnerJoinPred(CBitSet *pbsFst, CBitSet *pbsSnd);
+	CExpression *PexprBuildInnerJoinPred(SGroupInfo *left_group_info,
+										 SGroupInfo *right_group_info);
 
 	// compute cost of a join expression in a group
 	void ComputeCost(SExpressionInfo *expr_info, CDouble join_cardinality);
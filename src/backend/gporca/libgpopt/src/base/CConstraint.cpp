@@ -131,7 +131,9 @@ CConstraint::PcnstrFromScalarArrayCmp(CMemoryPool *mp, CExpression *pexpr,
 		const ULONG arity = CUtils::UlScalarArrayArity(pexprArray);
 
 		// When array size exceeds the constraint derivation threshold,
-		// don't expand it into a DNF and don't derive constraints
+		// don't expand it into a DNF. An IN or NOT IN list still becomes a
+		// single interval of its sorted points, which is cheap to intersect
+		// and to check for containment; other comparisons derive nothing
 		COptimizerConfig *optimizer_config =
 			COptCtxt::PoctxtFromTLS()->GetOptimizerConfig();
 		ULONG array_expansion_threshold =
@@ -139,7 +141,8 @@ CConstraint::PcnstrFromScalarArrayCmp(CMemoryPool *mp, CExpression *pexpr,
 
 		if (arity > array_expansion_threshold)
 		{
-			return nullptr;
+			return CConstraintInterval::PcnstrIntervalFromScalarArrayCmp(
+				mp, pexpr, colref, infer_nulls_as);
 		}
 
 		if (arity == 0)
@@ -522,7 +525,8 @@ CConstraint::PcnstrFromScalarBoolOp(
 	// For instance constructs of the form:
 	// "(expression1, expression2) scalar op ANY/ALL ((const-x1,const-y1), ... (const-xn,const-yn))"
 	// Deriving constraints from this is quite expensive; hence don't
-	// bother when the arity of OR exceeds the threshold
+	// bother when the arity of OR exceeds the threshold. Disjunctions on a
+	// single column never get here, they are derived as intervals instead
 	COptimizerConfig *optimizer_config =
 		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig();
 	ULONG array_expansion_threshold =
@@ -1058,15 +1058,49 @@ CConstraintInterval::PciIntersect(CMemoryPool *mp, CConstraintInterval *pci)
 		CRange *prangeThis = (*m_pdrgprng)[ulFst];
 		CRange *prangeOther = (*pdrgprngOther)[ulSnd];
 
+		// skip the ranges of either interval that end before the current
+		// range of the other one starts; when one interval has many more
+		// ranges, like one from a large IN list intersected with the bounds
+		// of a partition, this only visits the ranges that overlap
+		if (prangeThis->FDisjointLeft(prangeOther))
+		{
+			ulFst = UlFirstRangeNotBefore(m_pdrgprng, ulFst, prangeOther);
+			continue;
+		}
+
+		if (prangeOther->FDisjointLeft(prangeThis))
+		{
+			ulSnd = UlFirstRangeNotBefore(pdrgprngOther, ulSnd, prangeThis);
+			continue;
+		}
+
+		// share a range that is contained in the other one instead of
+		// creating the same range again
 		CRange *prangeNew = nullptr;
 		if (prangeOther->FEndsAfter(prangeThis))
 		{
-			prangeNew = prangeThis->PrngIntersect(mp, prangeOther);
+			if (prangeOther->Contains(prangeThis))
+			{
+				prangeThis->AddRef();
+				prangeNew = prangeThis;
+			}
+			else
+			{
+				prangeNew = prangeThis->PrngIntersect(mp, prangeOther);
+			}
 			ulFst++;
 		}
 		else
 		{
-			prangeNew = prangeOther->PrngIntersect(mp, prangeThis);
+			if (prangeThis->Contains(prangeOther))
+			{
+				prangeOther->AddRef();
+				prangeNew = prangeOther;
+			}
+			else
+			{
+				prangeNew = prangeOther->PrngIntersect(mp, prangeThis);
+			}
 			ulSnd++;
 		}
 
@@ -1218,6 +1252,38 @@ CConstraintInterval::FContainsInterval(CMemoryPool *mp,
 		return false;
 	}
 
+	// look for a range of this interval that contains each range of the
+	// given one, instead of computing the difference of the intervals
+	CRangeArray *pdrgprngOther = pci->Pdrgprng();
+	const ULONG ulRanges = m_pdrgprng->Size();
+	const ULONG ulRangesOther = pdrgprngOther->Size();
+	ULONG ulPos = 0;
+	BOOL fContainedInOneRange = true;
+	for (ULONG ul = 0; fContainedInOneRange && ul < ulRangesOther; ul++)
+	{
+		CRange *prangeOther = (*pdrgprngOther)[ul];
+		ulPos = UlFirstRangeNotBefore(m_pdrgprng, ulPos, prangeOther);
+
+		// all ranges of this interval before the found one are to the left
+		// of the given range, so its start is not contained if the found
+		// range does not contain it
+		if (ulPos == ulRanges ||
+			!(*m_pdrgprng)[ulPos]->FStartsWithOrBefore(prangeOther))
+		{
+			return false;
+		}
+
+		fContainedInOneRange =
+			(*m_pdrgprng)[ulPos]->FEndsWithOrAfter(prangeOther);
+	}
+
+	if (fContainedInOneRange)
+	{
+		return true;
+	}
+
+	// a range of the given interval may still be covered by adjacent
+	// ranges of this interval
 	CConstraintInterval *pciDiff = pci->PciDifference(mp, this);
 
 	// if the difference is empty, then this interval contains the given one
@@ -1433,6 +1499,61 @@ CConstraintInterval::AppendOrExtend(CMemoryPool *mp, CRangeArray *pdrgprng,
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::UlFirstRangeNotBefore
+//
+//	@doc:
+//		Index of the first range in the given array, starting at the given
+//		index, that is not disjoint from the given range and to its left,
+//		or the size of the array if there is none. The ranges of an interval
+//		are sorted and disjoint, so the ranges before the given one form a
+//		prefix of the array, whose end is found by an exponential search
+//		followed by a binary search; skipping k ranges takes O(log k)
+//		comparisons
+//
+//---------------------------------------------------------------------------
+ULONG
+CConstraintInterval::UlFirstRangeNotBefore(CRangeArray *pdrgprng,
+										   ULONG ulStart, CRange *prange)
+{
+	GPOS_ASSERT(nullptr != pdrgprng);
+	GPOS_ASSERT(nullptr != prange);
+
+	const ULONG length = pdrgprng->Size();
+	if (ulStart >= length || !(*pdrgprng)[ulStart]->FDisjointLeft(prange))
+	{
+		return ulStart;
+	}
+
+	// the range at ulLow is before the given range; double the step until
+	// the range at ulHigh is not, or ulHigh is past the end
+	ULONG ulLow = ulStart;
+	ULONG ulStep = 1;
+	ULONG ulHigh = ulStart + 1;
+	while (ulHigh < length && (*pdrgprng)[ulHigh]->FDisjointLeft(prange))
+	{
+		ulLow = ulHigh;
+		ulStep *= 2;
+		ulHigh = ulLow + std::min(ulStep, length - ulLow);
+	}
+
+	while (ulLow + 1 < ulHigh)
+	{
+		const ULONG ulMid = ulLow + (ulHigh - ulLow) / 2;
+		if ((*pdrgprng)[ulMid]->FDisjointLeft(prange))
+		{
+			ulLow = ulMid;
+		}
+		else
+		{
+			ulHigh = ulMid;
+		}
+	}
+
+	return ulHigh;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintInterval::OsPrint
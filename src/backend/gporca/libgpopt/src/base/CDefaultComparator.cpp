@@ -24,6 +24,7 @@
 #include "gpopt/eval/IConstExprEvaluator.h"
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessor.h"
+#include "naucrates/base/CDatumGenericGPDB.h"
 #include "naucrates/base/IDatum.h"
 #include "naucrates/base/IDatumBool.h"
 #include "naucrates/md/IMDId.h"
@@ -33,6 +34,148 @@ using namespace gpopt;
 using namespace gpos;
 using gpnaucrates::IDatum;
 
+// size of uuid data
+#define GPDB_UUID_LEN 16
+
+//---------------------------------------------------------------------------
+//	@function:
+//		FInlineVarlenaPayload
+//
+//	@doc:
+//		Extract the payload of a varlena datum that is stored inline and
+//		uncompressed, following the header layout of little-endian machines;
+//		return false for any other representation
+//
+//---------------------------------------------------------------------------
+static BOOL
+FInlineVarlenaPayload(const IDatum *datum, const BYTE **payload,
+					  ULONG *length)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	const BYTE *bytes = datum->GetByteArrayValue();
+	const ULONG size = datum->Size();
+	if (nullptr == bytes || 0 == size)
+	{
+		return false;
+	}
+
+	ULONG header_len = 0;
+	ULONG total_len = 0;
+	if (0x01 == (bytes[0] & 0x01))
+	{
+		// short header, unless this is a TOAST pointer
+		if (0x01 == bytes[0])
+		{
+			return false;
+		}
+		header_len = 1;
+		total_len = bytes[0] >> 1;
+	}
+	else if (0x00 == (bytes[0] & 0x03) && GPDB_DATUM_HDRSZ <= size)
+	{
+		ULONG header = 0;
+		(void) clib::Memcpy(&header, bytes, GPDB_DATUM_HDRSZ);
+		header_len = GPDB_DATUM_HDRSZ;
+		total_len = header >> 2;
+	}
+	else
+	{
+		// compressed
+		return false;
+	}
+
+	if (total_len < header_len || total_len > size)
+	{
+		return false;
+	}
+
+	*payload = bytes + header_len;
+	*length = total_len - header_len;
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		ICompareBytes
+//
+//	@doc:
+//		Compare two byte strings bytewise, ordering a string before the
+//		longer strings it is a prefix of
+//
+//---------------------------------------------------------------------------
+static INT
+ICompareBytes(const BYTE *bytes1, ULONG length1, const BYTE *bytes2,
+			  ULONG length2)
+{
+	INT result = 0;
+	const ULONG length = std::min(length1, length2);
+	if (0 < length)
+	{
+		result = clib::Memcmp(bytes1, bytes2, length);
+	}
+
+	if (0 == result && length1 != length2)
+	{
+		result = (length1 < length2) ? -1 : 1;
+	}
+
+	return result;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::SComparison::~SComparison
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDefaultComparator::SComparison::~SComparison()
+{
+	CRefCount::SafeRelease(m_datum1);
+	CRefCount::SafeRelease(m_datum2);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::SComparison::HashValue
+//
+//	@doc:
+//		Hash function
+//
+//---------------------------------------------------------------------------
+ULONG
+CDefaultComparator::SComparison::HashValue(const SComparison *comparison)
+{
+	ULONG hash = gpos::CombineHashes(comparison->m_datum1->HashValue(),
+									 comparison->m_datum2->HashValue());
+
+	return gpos::CombineHashes(hash,
+							   gpos::HashValue<IMDType::ECmpType>(
+								   &comparison->m_cmp_type));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::SComparison::Equals
+//
+//	@doc:
+//		Equality function
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::SComparison::Equals(const SComparison *first,
+										const SComparison *second)
+{
+	return first->m_cmp_type == second->m_cmp_type &&
+		   first->m_datum1->Matches(second->m_datum1) &&
+		   first->m_datum2->Matches(second->m_datum2);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDefaultComparator::CDefaultComparator
@@ -42,10 +185,27 @@ using gpnaucrates::IDatum;
 //		Does not take ownership of the constant expression evaluator
 //
 //---------------------------------------------------------------------------
-CDefaultComparator::CDefaultComparator(IConstExprEvaluator *pceeval)
-	: m_pceeval(pceeval)
+CDefaultComparator::CDefaultComparator(CMemoryPool *mp,
+									   IConstExprEvaluator *pceeval)
+	: m_mp(mp), m_pceeval(pceeval), m_comparison_results(nullptr)
 {
+	GPOS_ASSERT(nullptr != mp);
 	GPOS_ASSERT(nullptr != pceeval);
+
+	m_comparison_results = GPOS_NEW(m_mp) ComparisonToResultMap(m_mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::~CDefaultComparator
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDefaultComparator::~CDefaultComparator()
+{
+	m_comparison_results->Release();
 }
 
 //---------------------------------------------------------------------------
@@ -86,6 +246,151 @@ CDefaultComparator::FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
 	return result;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::FNativeComparison
+//
+//	@doc:
+//		Compare two non-null data of the same byte-comparable type directly.
+//		The optimizer only sees deterministic collations, so text types are
+//		equal exactly when their bytes are, ignoring trailing blanks of
+//		bpchar; they are ordered bytewise only under the C collation. Uuids
+//		are always ordered bytewise.
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::FNativeComparison(const IDatum *datum1,
+									  const IDatum *datum2,
+									  IMDType::ECmpType cmp_type, BOOL *result)
+{
+	IMDId *mdid = datum1->MDId();
+	if (datum1->IsNull() || datum2->IsNull() || !mdid->Equals(datum2->MDId()))
+	{
+		return false;
+	}
+
+	INT cmp = 0;
+	if (CMDIdGPDB::m_mdid_uuid.Equals(mdid))
+	{
+		if (GPDB_UUID_LEN != datum1->Size() || GPDB_UUID_LEN != datum2->Size())
+		{
+			return false;
+		}
+		cmp = clib::Memcmp(datum1->GetByteArrayValue(),
+						   datum2->GetByteArrayValue(), GPDB_UUID_LEN);
+	}
+	else if (CMDIdGPDB::m_mdid_text.Equals(mdid) ||
+			 CMDIdGPDB::m_mdid_varchar.Equals(mdid) ||
+			 CMDIdGPDB::m_mdid_bpchar.Equals(mdid))
+	{
+		if (IMDType::EcmptEq != cmp_type && IMDType::EcmptNEq != cmp_type &&
+			!GPOS_FTRACE(EopttraceDefaultCollationIsC))
+		{
+			return false;
+		}
+
+		const BYTE *bytes1 = nullptr;
+		const BYTE *bytes2 = nullptr;
+		ULONG length1 = 0;
+		ULONG length2 = 0;
+		if (!FInlineVarlenaPayload(datum1, &bytes1, &length1) ||
+			!FInlineVarlenaPayload(datum2, &bytes2, &length2))
+		{
+			return false;
+		}
+
+		if (CMDIdGPDB::m_mdid_bpchar.Equals(mdid))
+		{
+			while (0 < length1 && ' ' == bytes1[length1 - 1])
+			{
+				length1--;
+			}
+			while (0 < length2 && ' ' == bytes2[length2 - 1])
+			{
+				length2--;
+			}
+		}
+
+		cmp = ICompareBytes(bytes1, length1, bytes2, length2);
+	}
+	else
+	{
+		return false;
+	}
+
+	switch (cmp_type)
+	{
+		case IMDType::EcmptEq:
+			*result = (0 == cmp);
+			break;
+		case IMDType::EcmptNEq:
+			*result = (0 != cmp);
+			break;
+		case IMDType::EcmptL:
+			*result = (0 > cmp);
+			break;
+		case IMDType::EcmptLEq:
+			*result = (0 >= cmp);
+			break;
+		case IMDType::EcmptG:
+			*result = (0 < cmp);
+			break;
+		case IMDType::EcmptGEq:
+			*result = (0 <= cmp);
+			break;
+		default:
+			return false;
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::FEvalComparisonMemo
+//
+//	@doc:
+//		Evaluate a comparison of two data; byte-comparable types are compared
+//		natively, other comparisons go to the constant expression evaluator
+//		once and their results are remembered for the rest of the query
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::FEvalComparisonMemo(const IDatum *datum1,
+										const IDatum *datum2,
+										IMDType::ECmpType cmp_type) const
+{
+	BOOL result = false;
+	if (FNativeComparison(datum1, datum2, cmp_type, &result))
+	{
+		return result;
+	}
+
+	// look up the comparison without copying the data
+	SComparison lookup_key(const_cast<IDatum *>(datum1),
+						   const_cast<IDatum *>(datum2), cmp_type);
+	const BOOL *memo_result = m_comparison_results->Find(&lookup_key);
+	lookup_key.m_datum1 = nullptr;
+	lookup_key.m_datum2 = nullptr;
+	if (nullptr != memo_result)
+	{
+		return *memo_result;
+	}
+
+	CAutoMemoryPool amp;
+	result = FEvalComparison(amp.Pmp(), datum1, datum2, cmp_type);
+
+	if (MaxMemoizedComparisons > m_comparison_results->Size())
+	{
+		SComparison *comparison = GPOS_NEW(m_mp) SComparison(
+			datum1->MakeCopy(m_mp), datum2->MakeCopy(m_mp), cmp_type);
+		(void) m_comparison_results->Insert(comparison,
+											GPOS_NEW(m_mp) BOOL(result));
+	}
+
+	return result;
+}
+
 BOOL
 CDefaultComparator::FUseInternalEvaluator(const IDatum *datum1,
 										  const IDatum *datum2,
@@ -124,6 +429,17 @@ CDefaultComparator::FUseInternalEvaluator(const IDatum *datum1,
 		return true;
 	}
 
+	// timestamptz maps to a double the same way, but like the native
+	// comparisons it is only compared internally where the external
+	// evaluator would have been used, so that comparisons without one,
+	// e.g. in minidump replays, are unaffected
+	if (*can_use_external_evaluator && mdid1->Equals(datum2->MDId()) &&
+		datum1->StatsAreComparable(datum2) &&
+		CMDIdGPDB::m_mdid_timestampTz.Equals(mdid1))
+	{
+		return true;
+	}
+
 	// GPDB_12_MERGE_FIXME: Throw an exception when result = false and can_use_external_evaluator = false
 
 	return false;
@@ -153,8 +469,6 @@ CDefaultComparator::Equals(const IDatum *datum1, const IDatum *datum2) const
 		return false;
 	}
 
-	CAutoMemoryPool amp;
-
 	// NULL datum is a special case and is being handled here. Assumptions made are
 	// NULL is less than everything else. NULL = NULL.
 	// Note : NULL is considered equal to NULL because we are using the comparator for
@@ -164,7 +478,7 @@ CDefaultComparator::Equals(const IDatum *datum1, const IDatum *datum2) const
 		return true;
 	}
 
-	return FEvalComparison(amp.Pmp(), datum1, datum2, IMDType::EcmptEq);
+	return FEvalComparisonMemo(datum1, datum2, IMDType::EcmptEq);
 }
 
 //---------------------------------------------------------------------------
@@ -190,8 +504,6 @@ CDefaultComparator::IsLessThan(const IDatum *datum1, const IDatum *datum2) const
 		return false;
 	}
 
-	CAutoMemoryPool amp;
-
 	// NULL datum is a special case and is being handled here. Assumptions made are
 	// NULL is less than everything else. NULL = NULL.
 	// Note : NULL is considered equal to NULL because we are using the comparator for
@@ -201,7 +513,7 @@ CDefaultComparator::IsLessThan(const IDatum *datum1, const IDatum *datum2) const
 		return true;
 	}
 
-	return FEvalComparison(amp.Pmp(), datum1, datum2, IMDType::EcmptL);
+	return FEvalComparisonMemo(datum1, datum2, IMDType::EcmptL);
 }
 
 //---------------------------------------------------------------------------
@@ -229,8 +541,6 @@ CDefaultComparator::IsLessThanOrEqual(const IDatum *datum1,
 		return false;
 	}
 
-	CAutoMemoryPool amp;
-
 	// NULL datum is a special case and is being handled here. Assumptions made are
 	// NULL is less than everything else. NULL = NULL.
 	// Note : NULL is considered equal to NULL because we are using the comparator for
@@ -247,7 +557,7 @@ CDefaultComparator::IsLessThanOrEqual(const IDatum *datum1,
 	}
 
 
-	return FEvalComparison(amp.Pmp(), datum1, datum2, IMDType::EcmptLEq);
+	return FEvalComparisonMemo(datum1, datum2, IMDType::EcmptLEq);
 }
 
 //---------------------------------------------------------------------------
@@ -274,8 +584,6 @@ CDefaultComparator::IsGreaterThan(const IDatum *datum1,
 		return false;
 	}
 
-	CAutoMemoryPool amp;
-
 	// NULL datum is a special case and is being handled here. Assumptions made are
 	// NULL is less than everything else. NULL = NULL.
 	// Note : NULL is considered equal to NULL because we are using the comparator for
@@ -285,7 +593,7 @@ CDefaultComparator::IsGreaterThan(const IDatum *datum1,
 		return true;
 	}
 
-	return FEvalComparison(amp.Pmp(), datum1, datum2, IMDType::EcmptG);
+	return FEvalComparisonMemo(datum1, datum2, IMDType::EcmptG);
 }
 
 //---------------------------------------------------------------------------
@@ -313,8 +621,6 @@ CDefaultComparator::IsGreaterThanOrEqual(const IDatum *datum1,
 		return false;
 	}
 
-	CAutoMemoryPool amp;
-
 	// NULL datum is a special case and is being handled here. Assumptions made are
 	// NULL is less than everything else. NULL = NULL.
 	// Note : NULL is considered equal to NULL because we are using the comparator for
@@ -329,7 +635,7 @@ CDefaultComparator::IsGreaterThanOrEqual(const IDatum *datum1,
 		return true;
 	}
 
-	return FEvalComparison(amp.Pmp(), datum1, datum2, IMDType::EcmptGEq);
+	return FEvalComparisonMemo(datum1, datum2, IMDType::EcmptGEq);
 }
 
 // EOF
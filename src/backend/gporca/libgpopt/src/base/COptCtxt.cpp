@@ -42,7 +42,7 @@ COptCtxt::COptCtxt(CMemoryPool *mp, CColumnFactory *col_factory,
 	  m_pcf(col_factory),
 	  m_pmda(md_accessor),
 	  m_pceeval(pceeval),
-	  m_pcomp(GPOS_NEW(m_mp) CDefaultComparator(pceeval)),
+	  m_pcomp(GPOS_NEW(m_mp) CDefaultComparator(m_mp, pceeval)),
 	  m_auPartId(m_ulFirstValidPartId),
 	  m_pcteinfo(nullptr),
 	  m_pdrgpcrSystemCols(nullptr),
@@ -87,7 +87,8 @@ CEngine::CEngine(CMemoryPool *mp)
 	  m_pdrgpulpXformCalls(nullptr),
 	  m_pdrgpulpXformTimes(nullptr),
 	  m_pdrgpulpXformBindings(nullptr),
-	  m_pdrgpulpXformResults(nullptr)
+	  m_pdrgpulpXformResults(nullptr),
+	  m_num_jobs(0)
 {
 	m_pmemo = GPOS_NEW(mp) CMemo(mp);
 	m_pexprEnforcerPattern =
@@ -162,10 +163,13 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 					0 == pqc->Prpp()->PcrsRequired()->Size() &&
 						"requiring columns from a zero column expression");
 
+	m_pqc = pqc;
+	InitLogicalExpression(m_pqc->Pexpr());
+
 	m_search_stage_array = search_stage_array;
 	if (nullptr == search_stage_array)
 	{
-		m_search_stage_array = CSearchStage::PdrgpssDefault(m_mp);
+		m_search_stage_array = PdrgpssForQuery();
 	}
 	GPOS_ASSERT(0 < m_search_stage_array->Size());
 
@@ -197,14 +201,49 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 		}
 	}
 
-	m_pqc = pqc;
-	InitLogicalExpression(m_pqc->Pexpr());
-
 	m_pqc->PdrgpcrSystemCols()->AddRef();
 	COptCtxt::PoctxtFromTLS()->SetReqdSystemCols(m_pqc->PdrgpcrSystemCols());
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::PdrgpssForQuery
+//
+//	@doc:
+//		Generate the search strategy of a query for which none was given;
+//		the adaptive strategy is picked from the size of the search space
+//		of the initial memo, the default strategy is used otherwise
+//
+//---------------------------------------------------------------------------
+CSearchStageArray *
+CEngine::PdrgpssForQuery() const
+{
+	if (!GPOS_FTRACE(EopttraceEnableAdaptiveSearch))
+	{
+		return CSearchStage::PdrgpssDefault(m_mp);
+	}
+
+	SSearchSpaceEstimate estimate;
+	m_pmemo->EstimateSearchSpace(m_mp, &estimate);
+
+	CSearchStageArray *search_stage_array =
+		CSearchStage::PdrgpssAdaptive(m_mp, estimate);
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace at(m_mp);
+		at.Os() << std::endl
+				<< "[OPT]: Search space estimate: [" << estimate.m_num_groups
+				<< " groups, " << estimate.m_num_joins << " joins, "
+				<< estimate.m_num_xform_candidates << " xform candidates], "
+				<< search_stage_array->Size() << " search stages";
+	}
+
+	return search_stage_array;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEngine::AddEnforcers
@@ -1643,7 +1682,12 @@ CEngine::ProcessTraceFlags()
 
 		at.Os() << std::endl
 				<< "[OPT]: stage " << m_ulCurrSearchStage << " completed in "
-				<< PssCurrent()->UlElapsedTime() << "ms, ";
+				<< PssCurrent()->UlElapsedTime() << "ms";
+		if (gpos::ulong_max != PssCurrent()->TimeThreshold())
+		{
+			at.Os() << " (budget " << PssCurrent()->TimeThreshold() << "ms)";
+		}
+		at.Os() << ", ";
 		if (nullptr == PssCurrent()->PexprBest())
 		{
 			at.Os() << " no plan was found";
@@ -1720,6 +1764,7 @@ CEngine::Optimize()
 		FinalizeSearchStage();
 	}
 
+	m_num_jobs = sched.UlpQueuedJobs();
 
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 	{
@@ -1737,6 +1782,25 @@ CEngine::Optimize()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::CollectStats
+//
+//	@doc:
+//		Collect the size of the search after optimization
+//
+//---------------------------------------------------------------------------
+void
+CEngine::CollectStats(SEngineStats *stats)
+{
+	GPOS_ASSERT(nullptr != stats);
+
+	stats->m_num_groups = (ULONG) m_pmemo->UlpGroups();
+	stats->m_num_group_exprs = m_pmemo->UlGrpExprs();
+	stats->m_num_jobs = m_num_jobs;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEngine::CEngine
@@ -27,6 +27,7 @@
 #include "naucrates/exception.h"
 #include "naucrates/md/CMDIdCast.h"
 #include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
 #include "naucrates/md/CMDIdRelStats.h"
 #include "naucrates/md/CMDIdScCmp.h"
 #include "naucrates/md/CMDProviderGeneric.h"
@@ -34,7 +35,11 @@
 #include "naucrates/md/IMDCacheObject.h"
 #include "naucrates/md/IMDCast.h"
 #include "naucrates/md/IMDCheckConstraint.h"
+#include "naucrates/md/CMDDependency.h"
+#include "naucrates/md/CMDMCVList.h"
+#include "naucrates/md/CMDNDistinct.h"
 #include "naucrates/md/IMDColStats.h"
+#include "naucrates/md/IMDExtStats.h"
 #include "naucrates/md/IMDFunction.h"
 #include "naucrates/md/IMDIndex.h"
 #include "naucrates/md/IMDProvider.h"
@@ -914,6 +919,29 @@ CMDAccessor::Pmdrelstats(IMDId *mdid)
 	return dynamic_cast<const IMDRelStats *>(pmdobj);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::Pmdextstats
+//
+//	@doc:
+//		Retrieves the extended statistics of a relation from the md cache,
+//		possibly retrieving them from the external metadata provider and
+//		storing them in the cache first.
+//
+//---------------------------------------------------------------------------
+const IMDExtStats *
+CMDAccessor::Pmdextstats(IMDId *mdid)
+{
+	const IMDCacheObject *pmdobj = GetImdObj(mdid);
+	if (IMDCacheObject::EmdtExtStats != pmdobj->MDType())
+	{
+		GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound,
+				   mdid->GetBuffer());
+	}
+
+	return dynamic_cast<const IMDExtStats *>(pmdobj);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessor::Pmdcast
@@ -996,14 +1024,16 @@ CMDAccessor::RecordColumnStats(CMemoryPool *mp, IMDId *rel_mdid, ULONG colid,
 							   ULONG ulPos, BOOL isSystemCol, BOOL isEmptyTable,
 							   UlongToHistogramMap *col_histogram_mapping,
 							   UlongToDoubleMap *colid_width_mapping,
-							   CStatisticsConfig *stats_config)
+							   CStatisticsConfig *stats_config,
+							   IMdIdArray *part_mdids)
 {
 	GPOS_ASSERT(nullptr != rel_mdid);
 	GPOS_ASSERT(nullptr != col_histogram_mapping);
 	GPOS_ASSERT(nullptr != colid_width_mapping);
 
-	// get the column statistics
-	const IMDColStats *pmdcolstats = Pmdcolstats(mp, rel_mdid, ulPos);
+	// get the column statistics; those of system columns are not merged
+	const IMDColStats *pmdcolstats =
+		Pmdcolstats(mp, rel_mdid, ulPos, isSystemCol ? nullptr : part_mdids);
 	GPOS_ASSERT(nullptr != pmdcolstats);
 
 	// fetch the column width and insert it into the hashmap
@@ -1035,11 +1065,22 @@ CMDAccessor::RecordColumnStats(CMemoryPool *mp, IMDId *rel_mdid, ULONG colid,
 
 // Return the column statistics meta data object for a given column of a table
 const IMDColStats *
-CMDAccessor::Pmdcolstats(CMemoryPool *mp, IMDId *rel_mdid, ULONG ulPos)
+CMDAccessor::Pmdcolstats(CMemoryPool *mp, IMDId *rel_mdid, ULONG ulPos,
+						 IMdIdArray *part_mdids)
 {
 	rel_mdid->AddRef();
-	CMDIdColStats *mdid_col_stats =
-		GPOS_NEW(mp) CMDIdColStats(CMDIdGPDB::CastMdid(rel_mdid), ulPos);
+	CMDIdColStats *mdid_col_stats = nullptr;
+	if (nullptr == part_mdids)
+	{
+		mdid_col_stats =
+			GPOS_NEW(mp) CMDIdColStats(CMDIdGPDB::CastMdid(rel_mdid), ulPos);
+	}
+	else
+	{
+		part_mdids->AddRef();
+		mdid_col_stats = GPOS_NEW(mp) CMDIdColStats(
+			mp, CMDIdGPDB::CastMdid(rel_mdid), ulPos, part_mdids);
+	}
 	const IMDColStats *pmdcolstats = Pmdcolstats(mdid_col_stats);
 	mdid_col_stats->Release();
 
@@ -1056,11 +1097,13 @@ CMDAccessor::Pmdcolstats(CMemoryPool *mp, IMDId *rel_mdid, ULONG ulPos)
 //---------------------------------------------------------------------------
 IStatistics *
 CMDAccessor::Pstats(CMemoryPool *mp, IMDId *rel_mdid, CColRefSet *pcrsHist,
-					CColRefSet *pcrsWidth, CStatisticsConfig *stats_config)
+					CColRefSet *pcrsWidth, CStatisticsConfig *stats_config,
+					IMdIdArray *part_mdids)
 {
 	GPOS_ASSERT(nullptr != rel_mdid);
 	GPOS_ASSERT(nullptr != pcrsHist);
 	GPOS_ASSERT(nullptr != pcrsWidth);
+	GPOS_ASSERT_IMP(nullptr != part_mdids, 0 < part_mdids->Size());
 
 	// retrieve MD relation and MD relation stats objects
 	rel_mdid->AddRef();
@@ -1070,6 +1113,34 @@ CMDAccessor::Pstats(CMemoryPool *mp, IMDId *rel_mdid, CColRefSet *pcrsHist,
 	rel_stats_mdid->Release();
 
 	BOOL fEmptyTable = pmdRelStats->IsEmpty();
+	CDouble rel_rows = pmdRelStats->Rows();
+	ULONG rel_pages = pmdRelStats->RelPages();
+	ULONG rel_all_visible = pmdRelStats->RelAllVisible();
+
+	// when the statistics are merged from those of some leaf partitions,
+	// so are the size of the relation
+	if (nullptr != part_mdids)
+	{
+		fEmptyTable = true;
+		rel_rows = 0.0;
+		rel_pages = 0;
+		rel_all_visible = 0;
+		for (ULONG ul = 0; ul < part_mdids->Size(); ul++)
+		{
+			IMDId *part_mdid = (*part_mdids)[ul];
+			part_mdid->AddRef();
+			CMDIdRelStats *part_stats_mdid =
+				GPOS_NEW(mp) CMDIdRelStats(CMDIdGPDB::CastMdid(part_mdid));
+			const IMDRelStats *part_rel_stats = Pmdrelstats(part_stats_mdid);
+			part_stats_mdid->Release();
+
+			fEmptyTable = fEmptyTable && part_rel_stats->IsEmpty();
+			rel_rows = rel_rows + part_rel_stats->Rows();
+			rel_pages += part_rel_stats->RelPages();
+			rel_all_visible += part_rel_stats->RelAllVisible();
+		}
+	}
+
 	const IMDRelation *pmdrel = RetrieveRel(rel_mdid);
 
 	UlongToHistogramMap *col_histogram_mapping =
@@ -1091,7 +1162,7 @@ CMDAccessor::Pstats(CMemoryPool *mp, IMDId *rel_mdid, CColRefSet *pcrsHist,
 
 		RecordColumnStats(mp, rel_mdid, colid, ulPos, pcrtable->IsSystemCol(),
 						  fEmptyTable, col_histogram_mapping,
-						  colid_width_mapping, stats_config);
+						  colid_width_mapping, stats_config, part_mdids);
 	}
 
 	// extract column widths
@@ -1113,11 +1184,183 @@ CMDAccessor::Pstats(CMemoryPool *mp, IMDId *rel_mdid, CColRefSet *pcrsHist,
 		colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid), width);
 	}
 
-	CDouble rows = std::max(DOUBLE(1.0), pmdRelStats->Rows().Get());
+	CDouble rows = std::max(DOUBLE(1.0), rel_rows.Get());
+
+	CStatistics *stats =
+		GPOS_NEW(mp) CStatistics(mp, col_histogram_mapping, colid_width_mapping,
+								 rows, fEmptyTable, rel_pages, rel_all_visible);
+
+	// multi-column statistics only matter for two columns or more
+	if (!fEmptyTable && 1 < pcrsHist->Size())
+	{
+		rel_mdid->AddRef();
+		CMDIdExtStats *ext_stats_mdid =
+			GPOS_NEW(mp) CMDIdExtStats(CMDIdGPDB::CastMdid(rel_mdid));
+		const IMDExtStats *pmdextstats = Pmdextstats(ext_stats_mdid);
+		ext_stats_mdid->Release();
+
+		CExtendedStats *ext_stats =
+			GetExtendedStats(mp, pmdextstats, pcrsHist);
+		if (nullptr != ext_stats)
+		{
+			stats->AddExtendedStats(ext_stats);
+		}
+	}
+
+	return stats;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::MapAttnosToColIds
+//
+//	@doc:
+//		Set of the column ids of the given attnos; null if an attno has no
+//		column id
+//
+//---------------------------------------------------------------------------
+CBitSet *
+CMDAccessor::MapAttnosToColIds(CMemoryPool *mp, const ULongPtrArray *attnos,
+							   IntToUlongMap *attno_colid_mapping)
+{
+	CBitSet *colids = GPOS_NEW(mp) CBitSet(mp);
+	for (ULONG ul = 0; ul < attnos->Size(); ul++)
+	{
+		INT attno = static_cast<INT>(*(*attnos)[ul]);
+		const ULONG *colid = attno_colid_mapping->Find(&attno);
+		if (nullptr == colid)
+		{
+			colids->Release();
+			return nullptr;
+		}
+		(void) colids->ExchangeSet(*colid);
+	}
+
+	return colids;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::GetExtendedStats
+//
+//	@doc:
+//		Construct the multi-column statistics of the given columns of a
+//		relation from its MD extended stats object; only the statistics all
+//		the columns of which are given are kept, except for most common
+//		values lists, which need two of them, and null is returned if none
+//		is
+//
+//---------------------------------------------------------------------------
+CExtendedStats *
+CMDAccessor::GetExtendedStats(CMemoryPool *mp, const IMDExtStats *pmdextstats,
+							  CColRefSet *pcrsHist)
+{
+	GPOS_ASSERT(nullptr != pmdextstats);
+
+	if (0 == pmdextstats->NDistinctCount() &&
+		0 == pmdextstats->DependencyCount() &&
+		0 == pmdextstats->MCVListCount())
+	{
+		return nullptr;
+	}
+
+	// map the attnos of the columns to their column ids
+	IntToUlongMap *attno_colid_mapping = GPOS_NEW(mp) IntToUlongMap(mp);
+	CColRefSetIter crsi(*pcrsHist);
+	while (crsi.Advance())
+	{
+		CColRefTable *pcrtable = CColRefTable::PcrConvert(crsi.Pcr());
+		attno_colid_mapping->Insert(GPOS_NEW(mp) INT(pcrtable->AttrNum()),
+									GPOS_NEW(mp) ULONG(pcrtable->Id()));
+	}
+
+	CExtendedStats *ext_stats = GPOS_NEW(mp) CExtendedStats(mp);
+
+	for (ULONG ul = 0; ul < pmdextstats->NDistinctCount(); ul++)
+	{
+		const CMDNDistinct *ndistinct = pmdextstats->GetNDistinctAt(ul);
+		CBitSet *colids =
+			MapAttnosToColIds(mp, ndistinct->GetAttnos(), attno_colid_mapping);
+		if (nullptr != colids)
+		{
+			ext_stats->AddNDistinct(colids, ndistinct->GetNDistinct());
+		}
+	}
+
+	for (ULONG ul = 0; ul < pmdextstats->DependencyCount(); ul++)
+	{
+		const CMDDependency *dependency = pmdextstats->GetDependencyAt(ul);
+		INT to_attno = (INT) dependency->GetToAttno();
+		const ULONG *to_colid = attno_colid_mapping->Find(&to_attno);
+		if (nullptr == to_colid)
+		{
+			continue;
+		}
+
+		CBitSet *from_colids = MapAttnosToColIds(
+			mp, dependency->GetFromAttnos(), attno_colid_mapping);
+		if (nullptr != from_colids)
+		{
+			ext_stats->AddDependency(from_colids, *to_colid,
+									 dependency->GetDegree());
+		}
+	}
+
+	// a column of a most common values list that is not given is ignored
+	// when matching the combinations
+	for (ULONG ul = 0; ul < pmdextstats->MCVListCount(); ul++)
+	{
+		const CMDMCVList *mcv_list = pmdextstats->GetMCVListAt(ul);
+		const ULongPtrArray *attnos = mcv_list->GetAttnos();
+		ULongPtrArray *colids = GPOS_NEW(mp) ULongPtrArray(mp);
+		ULONG mapped = 0;
+		for (ULONG ulCol = 0; ulCol < attnos->Size(); ulCol++)
+		{
+			INT attno = static_cast<INT>(*(*attnos)[ulCol]);
+			const ULONG *colid = attno_colid_mapping->Find(&attno);
+			if (nullptr == colid)
+			{
+				colids->Append(GPOS_NEW(mp) ULONG(gpos::ulong_max));
+				continue;
+			}
+			colids->Append(GPOS_NEW(mp) ULONG(*colid));
+			mapped++;
+		}
+
+		if (mapped < 2)
+		{
+			colids->Release();
+			continue;
+		}
+
+		CExtendedStats::SMCVItemArray *items =
+			GPOS_NEW(mp) CExtendedStats::SMCVItemArray(mp);
+		for (ULONG ulItem = 0; ulItem < mcv_list->ItemCount(); ulItem++)
+		{
+			const CMDMCVItem *mcv_item = mcv_list->GetItemAt(ulItem);
+			const CDXLDatumArray *dxl_values = mcv_item->GetValues();
+			IDatumArray *values = GPOS_NEW(mp) IDatumArray(mp);
+			for (ULONG ulVal = 0; ulVal < dxl_values->Size(); ulVal++)
+			{
+				const CDXLDatum *dxl_datum = (*dxl_values)[ulVal];
+				values->Append(GetDatum(mp, dxl_datum->MDId(), dxl_datum));
+			}
+			items->Append(GPOS_NEW(mp) CExtendedStats::SMCVItem(
+				values, mcv_item->GetFrequency(),
+				mcv_item->GetBaseFrequency()));
+		}
+		ext_stats->AddMCVList(colids, items);
+	}
+
+	attno_colid_mapping->Release();
 
-	return GPOS_NEW(mp) CStatistics(
-		mp, col_histogram_mapping, colid_width_mapping, rows, fEmptyTable,
-		pmdRelStats->RelPages(), pmdRelStats->RelAllVisible());
+	if (ext_stats->IsEmpty())
+	{
+		ext_stats->Release();
+		return nullptr;
+	}
+
+	return ext_stats;
 }
 
 
@@ -1251,6 +1494,48 @@ CMDAccessor::Serialize(COstream &oos)
 		oos << cacheEntries[ul]->GetStrRepr()->GetBuffer();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::GetAccessedMdIds
+//
+//	@doc:
+//		Return the ids of all objects accessed so far
+//
+//---------------------------------------------------------------------------
+IMdIdArray *
+CMDAccessor::GetAccessedMdIds(CMemoryPool *mp)
+{
+	ULONG nentries = m_shtCacheAccessors.Size();
+	IMDId **mdids;
+	CAutoRg<IMDId *> a_mdids;
+	ULONG ul;
+
+	// as in Serialize(), do not allocate memory while iterating
+	mdids = GPOS_NEW_ARRAY(m_mp, IMDId *, nentries);
+	a_mdids = mdids;
+	{
+		MDHTIter mdhtit(m_shtCacheAccessors);
+		ul = 0;
+		while (mdhtit.Advance())
+		{
+			MDHTIterAccessor mdhtitacc(mdhtit);
+			SMDAccessorElem *pmdaccelem = mdhtitacc.Value();
+			GPOS_ASSERT(nullptr != pmdaccelem);
+			mdids[ul++] = pmdaccelem->MDId();
+		}
+		GPOS_ASSERT(ul == nentries);
+	}
+
+	IMdIdArray *result = GPOS_NEW(mp) IMdIdArray(mp);
+	for (ul = 0; ul < nentries; ul++)
+	{
+		mdids[ul]->AddRef();
+		result->Append(mdids[ul]);
+	}
+
+	return result;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessor::SerializeSysid
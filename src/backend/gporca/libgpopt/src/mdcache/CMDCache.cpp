@@ -124,4 +124,21 @@ CMDCache::Reset()
 	Init();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::Invalidate
+//
+//	@doc:
+//		Remove the entries accepted by the given filter
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDCache::Invalidate(CMDAccessor::MDCache::EntryFilterFuncPtr filter_func,
+					 void *context)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Metadata cache was not created");
+
+	return m_pcache->InvalidateEntries(filter_func, context);
+}
+
 // EOF
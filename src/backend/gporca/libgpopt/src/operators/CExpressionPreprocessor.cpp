@@ -15,6 +15,8 @@
 #include "gpos/base.h"
 #include "gpos/common/CAutoRef.h"
 #include "gpos/common/CAutoTimer.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CAutoTrace.h"
 
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CColRefTable.h"
@@ -64,6 +66,115 @@ using namespace gpopt;
 // maximum number of equality predicates to be derived from existing equalities
 #define GPOPT_MAX_DERIVED_PREDS 50
 
+// maximum number of preprocessing passes whose statistics are recorded
+#define GPOPT_MAX_PREPROCESSING_PASSES 32
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPreprocessingPassStats
+//
+//	@doc:
+//		Time spent in each preprocessing pass, and whether the pass changed
+//		its input, printed with the optimization statistics
+//
+//---------------------------------------------------------------------------
+class CPreprocessingPassStats
+{
+private:
+	// is recording enabled
+	BOOL m_fEnabled;
+
+	// clock measuring the current pass
+	CWallClock m_clock;
+
+	// number of passes recorded
+	ULONG m_ulPasses;
+
+	// pass names, times in microseconds, and whether they changed the input
+	const CHAR *m_rgszPass[GPOPT_MAX_PREPROCESSING_PASSES];
+	ULONG m_rgulTimeUS[GPOPT_MAX_PREPROCESSING_PASSES];
+	BOOL m_rgfChanged[GPOPT_MAX_PREPROCESSING_PASSES];
+
+public:
+	CPreprocessingPassStats(const CPreprocessingPassStats &) = delete;
+
+	// ctor
+	explicit CPreprocessingPassStats(BOOL fEnabled)
+		: m_fEnabled(fEnabled), m_ulPasses(0)
+	{
+	}
+
+	// record the pass that just ran, and start timing the next one
+	void
+	Record(const CHAR *szPass, const CExpression *pexprInput,
+		   const CExpression *pexprOutput)
+	{
+		if (!m_fEnabled || GPOPT_MAX_PREPROCESSING_PASSES == m_ulPasses)
+		{
+			return;
+		}
+
+		m_rgszPass[m_ulPasses] = szPass;
+		m_rgulTimeUS[m_ulPasses] = m_clock.ElapsedUS();
+		m_rgfChanged[m_ulPasses] = (pexprInput != pexprOutput);
+		m_ulPasses++;
+
+		m_clock.Restart();
+	}
+
+	// print the recorded passes
+	void
+	Print(CMemoryPool *mp) const
+	{
+		if (!m_fEnabled)
+		{
+			return;
+		}
+
+		CAutoTrace at(mp);
+		for (ULONG ul = 0; ul < m_ulPasses; ul++)
+		{
+			at.Os() << "[OPT]: Preprocessing pass " << m_rgszPass[ul] << ": "
+					<< m_rgulTimeUS[ul] / 1000 << "."
+					<< (m_rgulTimeUS[ul] % 1000) / 100 << "ms"
+					<< (m_rgfChanged[ul] ? "" : " (unchanged)") << std::endl;
+		}
+	}
+};	// class CPreprocessingPassStats
+}  // namespace gpopt
+
+// return the given expression if the given children are its own, so that
+// passes that change nothing copy nothing; otherwise a new expression
+// with the same operator over the given children
+CExpression *
+CExpressionPreprocessor::PexprRebuildIfChanged(
+	CMemoryPool *mp, CExpression *pexpr, CExpressionArray *pdrgpexprChildren)
+{
+	GPOS_ASSERT(nullptr != pexpr);
+	GPOS_ASSERT(nullptr != pdrgpexprChildren);
+	GPOS_ASSERT(pexpr->Arity() == pdrgpexprChildren->Size());
+
+	const ULONG arity = pexpr->Arity();
+	BOOL fChanged = false;
+	for (ULONG ul = 0; !fChanged && ul < arity; ul++)
+	{
+		fChanged = ((*pexpr)[ul] != (*pdrgpexprChildren)[ul]);
+	}
+
+	if (!fChanged)
+	{
+		pdrgpexprChildren->Release();
+		pexpr->AddRef();
+		return pexpr;
+	}
+
+	COperator *pop = pexpr->Pop();
+	pop->AddRef();
+	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+}
+
 // eliminate self comparisons in the given expression
 CExpression *
 CExpressionPreprocessor::PexprEliminateSelfComparison(CMemoryPool *mp,
@@ -89,10 +200,7 @@ CExpressionPreprocessor::PexprEliminateSelfComparison(CMemoryPool *mp,
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return PexprRebuildIfChanged(mp, pexpr, pdrgpexprChildren);
 }
 
 // remove superfluous equality operations
@@ -120,9 +228,7 @@ CExpressionPreprocessor::PexprPruneSuperfluousEquality(CMemoryPool *mp,
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return PexprRebuildIfChanged(mp, pexpr, pdrgpexprChildren);
 }
 
 // an existential subquery whose inner expression is a GbAgg
@@ -180,8 +286,7 @@ CExpressionPreprocessor::PexprTrimExistentialSubqueries(CMemoryPool *mp,
 		return CPredicateUtils::PexprDisjunction(mp, pdrgpexprChildren);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return PexprRebuildIfChanged(mp, pexpr, pdrgpexprChildren);
 }
 
 
@@ -375,44 +480,24 @@ CExpressionPreprocessor::PexprUnnestScalarSubqueries(CMemoryPool *mp,
 }
 
 // an intermediate limit is removed if it has neither row count nor offset
-CExpression *
-CExpressionPreprocessor::PexprRemoveSuperfluousLimit(CMemoryPool *mp,
-													 CExpression *pexpr)
+BOOL
+CExpressionPreprocessor::FSuperfluousLimit(CExpression *pexpr)
 {
-	// protect against stack overflow during recursion
-	GPOS_CHECK_STACK_SIZE;
-	GPOS_ASSERT(nullptr != mp);
 	GPOS_ASSERT(nullptr != pexpr);
 
 	COperator *pop = pexpr->Pop();
-	// if current operator is a logical limit with zero offset, and no specified
-	// row count, skip to limit's logical child
+	// a logical limit with zero offset, and no specified row count, can be
+	// skipped in favor of its logical child
 	if (COperator::EopLogicalLimit == pop->Eopid() &&
 		CUtils::FHasZeroOffset(pexpr) &&
 		!CLogicalLimit::PopConvert(pop)->FHasCount())
 	{
 		CLogicalLimit *popLgLimit = CLogicalLimit::PopConvert(pop);
-		if (!popLgLimit->IsTopLimitUnderDMLorCTAS() ||
-			(popLgLimit->IsTopLimitUnderDMLorCTAS() &&
-			 GPOS_FTRACE(EopttraceRemoveOrderBelowDML)))
-		{
-			return PexprRemoveSuperfluousLimit(mp, (*pexpr)[0]);
-		}
-	}
-
-	// recursively process children
-	const ULONG arity = pexpr->Arity();
-	CExpressionArray *pdrgpexprChildren = GPOS_NEW(mp) CExpressionArray(mp);
-
-	for (ULONG ul = 0; ul < arity; ul++)
-	{
-		CExpression *pexprChild = PexprRemoveSuperfluousLimit(mp, (*pexpr)[ul]);
-
-		pdrgpexprChildren->Append(pexprChild);
+		return !popLgLimit->IsTopLimitUnderDMLorCTAS() ||
+			   GPOS_FTRACE(EopttraceRemoveOrderBelowDML);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return false;
 }
 
 // distinct is removed from a DQA if it has a max or min agg
@@ -1095,10 +1180,7 @@ CExpressionPreprocessor::PexprCollapseProjects(CMemoryPool *mp,
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-
-	CExpression *pexprNew = GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	CExpression *pexprNew = PexprRebuildIfChanged(mp, pexpr, pdrgpexpr);
 	CExpression *pexprCollapsed = CUtils::PexprCollapseProjects(mp, pexprNew);
 
 	if (nullptr == pexprCollapsed)
@@ -1216,8 +1298,7 @@ CExpressionPreprocessor::PexprProjBelowSubquery(CMemoryPool *mp,
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return PexprRebuildIfChanged(mp, pexpr, pdrgpexpr);
 }
 
 // collapse cascaded union/union all into an NAry union/union all operator
@@ -1880,14 +1961,12 @@ CExpressionPreprocessor::PexprPruneEmptySubtrees(CMemoryPool *mp,
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return PexprRebuildIfChanged(mp, pexpr, pdrgpexpr);
 }
 
-// eliminate CTE Anchors for CTEs that have zero consumers
-CExpression *
-CExpressionPreprocessor::PexprRemoveUnusedCTEs(CMemoryPool *mp,
-											   CExpression *pexpr)
+// an anchor is removed if its CTE has zero consumers
+BOOL
+CExpressionPreprocessor::FUnusedCTEAnchor(CExpression *pexpr)
 {
 	GPOS_ASSERT(nullptr != pexpr);
 
@@ -1895,11 +1974,27 @@ CExpressionPreprocessor::PexprRemoveUnusedCTEs(CMemoryPool *mp,
 	if (COperator::EopLogicalCTEAnchor == pop->Eopid())
 	{
 		ULONG id = CLogicalCTEAnchor::PopConvert(pop)->Id();
-		if (!COptCtxt::PoctxtFromTLS()->Pcteinfo()->FUsed(id))
-		{
-			GPOS_ASSERT(1 == pexpr->Arity());
-			return PexprRemoveUnusedCTEs(mp, (*pexpr)[0]);
-		}
+		GPOS_ASSERT(1 == pexpr->Arity());
+		return !COptCtxt::PoctxtFromTLS()->Pcteinfo()->FUsed(id);
+	}
+
+	return false;
+}
+
+// eliminate CTE Anchors for CTEs that have zero consumers, and superfluous
+// limits; both only skip nodes, so they are done in the same traversal
+CExpression *
+CExpressionPreprocessor::PexprRemoveUnusedCTEsAndSuperfluousLimits(
+	CMemoryPool *mp, CExpression *pexpr)
+{
+	// protect against stack overflow during recursion
+	GPOS_CHECK_STACK_SIZE;
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != pexpr);
+
+	if (FUnusedCTEAnchor(pexpr) || FSuperfluousLimit(pexpr))
+	{
+		return PexprRemoveUnusedCTEsAndSuperfluousLimits(mp, (*pexpr)[0]);
 	}
 
 	// process children
@@ -1908,12 +2003,12 @@ CExpressionPreprocessor::PexprRemoveUnusedCTEs(CMemoryPool *mp,
 	const ULONG ulChildren = pexpr->Arity();
 	for (ULONG ul = 0; ul < ulChildren; ul++)
 	{
-		CExpression *pexprChild = PexprRemoveUnusedCTEs(mp, (*pexpr)[ul]);
+		CExpression *pexprChild =
+			PexprRemoveUnusedCTEsAndSuperfluousLimits(mp, (*pexpr)[ul]);
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return PexprRebuildIfChanged(mp, pexpr, pdrgpexpr);
 }
 
 // for all consumers of the same CTE, collect all selection predicates
@@ -2353,8 +2448,7 @@ CExpressionPreprocessor::PexprReorderScalarCmpChildren(CMemoryPool *mp,
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return PexprRebuildIfChanged(mp, pexpr, pdrgpexpr);
 }
 
 // converts IN subquery to a predicate AND an EXISTS subquery
@@ -2480,7 +2574,6 @@ CExpressionPreprocessor::PexprExistWithPredFromINSubq(CMemoryPool *mp,
 
 	// recursively process children
 	const ULONG arity = pexpr->Arity();
-	pop->AddRef();
 
 	CExpressionArray *pdrgpexprChildren = GPOS_NEW(mp) CExpressionArray(mp);
 	for (ULONG ul = 0; ul < arity; ul++)
@@ -2491,7 +2584,7 @@ CExpressionPreprocessor::PexprExistWithPredFromINSubq(CMemoryPool *mp,
 	}
 
 	CExpression *pexprNew =
-		GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+		PexprRebuildIfChanged(mp, pexpr, pdrgpexprChildren);
 	//Check if the inner is a SubqueryAny
 	if (CUtils::FAnySubquery(pop))
 	{
@@ -2553,19 +2646,89 @@ CExpressionPreprocessor::PrunePartitions(CMemoryPool *mp, CExpression *expr)
 			CConstraint::PcnstrFromScalarExpr(mp, filter_pred, &pdrgpcrsChild);
 		CRefCount::SafeRelease(pdrgpcrsChild);
 
-		// GPDB_12_MERGE_FIXME: skip all this if pred_cnstr = NULL
-
 		IMdIdArray *selected_partition_mdids = GPOS_NEW(mp) IMdIdArray(mp);
 
 		IMdIdArray *all_partition_mdids = dyn_get->GetPartitionMdids();
+
+		// bounds of the partitions of the root table, if available, in the
+		// order of its partitions; the partitions of the dynamic get are in
+		// the same order, with some possibly eliminated already
+		const IMDRelation *rootrel =
+			mda->RetrieveRel(dyn_get->Ptabdesc()->MDId());
+		IMdIdArray *root_partition_mdids = rootrel->ChildPartitionMdids();
+		CDXLNodeArray *partition_bounds = rootrel->ChildPartitionBounds();
+		ULONG root_pos = 0;
+
+		// with sorted range bounds, the partitions are selected by binary
+		// search instead of examining the bound of each one
+		CBitSet *range_selected = nullptr;
+		if (nullptr != pred_cnstr && nullptr != rootrel->PartRangeBounds())
+		{
+			CColRef *part_key = (*(*dyn_get->PdrgpdrgpcrPart())[0])[0];
+			CConstraint *key_cnstr = pred_cnstr->Pcnstr(mp, part_key);
+			if (nullptr == key_cnstr)
+			{
+				// without a predicate on the key, no partition is eliminated
+				pred_cnstr->Release();
+				pred_cnstr = nullptr;
+			}
+			else
+			{
+				range_selected =
+					PbsRangePartitions(mp, rootrel, part_key, key_cnstr);
+				key_cnstr->Release();
+			}
+		}
+
 		for (ULONG ul = 0; ul < all_partition_mdids->Size(); ++ul)
 		{
 			IMDId *part_mdid = (*all_partition_mdids)[ul];
-			const IMDRelation *partrel = mda->RetrieveRel(part_mdid);
 
-			CConstraint *rel_cnstr = PcnstrFromChildPartition(
-				partrel, dyn_get->PdrgpcrOutput(),
-				(*dyn_get->GetRootColMappingPerPart())[ul]);
+			// a partition cannot be eliminated without a predicate that
+			// contradicts its constraint, so skip translating the constraint
+			if (nullptr == pred_cnstr)
+			{
+				part_mdid->AddRef();
+				selected_partition_mdids->Append(part_mdid);
+				continue;
+			}
+
+			while ((nullptr != partition_bounds || nullptr != range_selected) &&
+				   root_pos < root_partition_mdids->Size() &&
+				   !(*root_partition_mdids)[root_pos]->Equals(part_mdid))
+			{
+				root_pos++;
+			}
+
+			if (nullptr != range_selected)
+			{
+				// the partition is selected by the search of the range bounds
+				if (root_pos == root_partition_mdids->Size() ||
+					range_selected->Get(root_pos))
+				{
+					part_mdid->AddRef();
+					selected_partition_mdids->Append(part_mdid);
+				}
+				continue;
+			}
+
+			CConstraint *rel_cnstr = nullptr;
+			if (nullptr != partition_bounds &&
+				root_pos < root_partition_mdids->Size())
+			{
+				// the bound is in terms of the columns of the root table, so
+				// the partition itself need not be retrieved
+				rel_cnstr = PcnstrFromPartConstraint(
+					(*partition_bounds)[root_pos], dyn_get->PdrgpcrOutput(),
+					nullptr /* mapped_colids */);
+			}
+			else
+			{
+				const IMDRelation *partrel = mda->RetrieveRel(part_mdid);
+				rel_cnstr = PcnstrFromChildPartition(
+					partrel, dyn_get->PdrgpcrOutput(),
+					(*dyn_get->GetRootColMappingPerPart())[ul]);
+			}
 
 			CConstraint *pcnstr = nullptr;
 			{
@@ -2591,6 +2754,7 @@ CExpressionPreprocessor::PrunePartitions(CMemoryPool *mp, CExpression *expr)
 			}
 			CRefCount::SafeRelease(pcnstr);
 		}
+		CRefCount::SafeRelease(range_selected);
 		CRefCount::SafeRelease(pred_cnstr);
 
 		if (selected_partition_mdids->Size() == 0)
@@ -2637,6 +2801,120 @@ CExpressionPreprocessor::PrunePartitions(CMemoryPool *mp, CExpression *expr)
 	return GPOS_NEW(mp) CExpression(mp, pop, children);
 }
 
+// Select the partitions of a relation range partitioned on one column whose
+// ranges overlap the given constraint on the partition key. Each range of the
+// constraint is located among the sorted range bounds by binary search, so
+// only the bounds probed and the partitions selected are examined. Returns
+// nullptr if the constraint cannot be searched with this way.
+CBitSet *
+CExpressionPreprocessor::PbsRangePartitions(CMemoryPool *mp,
+											const IMDRelation *rootrel,
+											const CColRef *part_key,
+											CConstraint *key_cnstr)
+{
+	CDXLDatumArray *bounds = rootrel->PartRangeBounds();
+	IntPtrArray *slots = rootrel->PartRangeSlots();
+	GPOS_ASSERT(nullptr != bounds && slots->Size() == bounds->Size() + 1);
+
+	if (CConstraint::EctInterval != key_cnstr->Ect())
+	{
+		return nullptr;
+	}
+
+	// nulls go to the default partition, which has no range to search for
+	CConstraintInterval *pci = dynamic_cast<CConstraintInterval *>(key_cnstr);
+	if (pci->FIncludesNull())
+	{
+		return nullptr;
+	}
+
+	// the bounds are of the type of the key, and compared as such
+	CRangeArray *ranges = pci->Pdrgprng();
+	IMDId *key_type = part_key->RetrieveType()->MDId();
+	for (ULONG ul = 0; ul < ranges->Size(); ++ul)
+	{
+		IDatum *left = (*ranges)[ul]->PdatumLeft();
+		IDatum *right = (*ranges)[ul]->PdatumRight();
+		if ((nullptr != left && !left->MDId()->Equals(key_type)) ||
+			(nullptr != right && !right->MDId()->Equals(key_type)))
+		{
+			return nullptr;
+		}
+	}
+
+	CBitSet *selected =
+		GPOS_NEW(mp) CBitSet(mp, rootrel->ChildPartitionMdids()->Size());
+	for (ULONG ul = 0; ul < ranges->Size(); ++ul)
+	{
+		CRange *range = (*ranges)[ul];
+
+		// the slots from the one holding the left end of the range to the
+		// one holding its right end; a right end excluded from the range is
+		// not in the slot it starts, if it is a bound
+		ULONG first_slot = 0;
+		if (nullptr != range->PdatumLeft())
+		{
+			first_slot = UlRangeSlot(mp, bounds, range->PdatumLeft(),
+									 true /* count_equal_bounds */);
+		}
+		ULONG last_slot = bounds->Size();
+		if (nullptr != range->PdatumRight())
+		{
+			last_slot = UlRangeSlot(
+				mp, bounds, range->PdatumRight(),
+				CRange::EriIncluded == range->EriRight());
+		}
+
+		for (ULONG slot = first_slot; slot <= last_slot; ++slot)
+		{
+			INT part_pos = *(*slots)[slot];
+			if (0 <= part_pos)
+			{
+				(void) selected->ExchangeSet(part_pos);
+			}
+		}
+	}
+
+	return selected;
+}
+
+// Return the position of the slot between the sorted range bounds that holds
+// the given value, which is the number of bounds not greater than it. Bounds
+// equal to the value are not counted if count_equal_bounds is false.
+ULONG
+CExpressionPreprocessor::UlRangeSlot(CMemoryPool *mp, CDXLDatumArray *bounds,
+									 const IDatum *datum,
+									 BOOL count_equal_bounds)
+{
+	CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
+	const IComparator *pcomp = COptCtxt::PoctxtFromTLS()->Pcomp();
+
+	ULONG low = 0;
+	ULONG high = bounds->Size();
+	while (low < high)
+	{
+		ULONG mid = low + (high - low) / 2;
+		CDXLDatum *dxl_bound = (*bounds)[mid];
+		IDatum *bound = md_accessor->RetrieveType(dxl_bound->MDId())
+							->GetDatumForDXLDatum(mp, dxl_bound);
+		BOOL is_counted = count_equal_bounds
+							  ? pcomp->IsLessThanOrEqual(bound, datum)
+							  : pcomp->IsLessThan(bound, datum);
+		bound->Release();
+
+		if (is_counted)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
 // Translate the part constraint of a child partition into an ORCA expr using
 // corresponding colrefs of the root table, instead of those from the child
 // partition.
@@ -2645,11 +2923,8 @@ CExpressionPreprocessor::PcnstrFromChildPartition(
 	const IMDRelation *partrel, CColRefArray *pdrgpcrOutput,
 	ColRefToUlongMap *root_col_mapping)
 {
-	CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
 	CMemoryPool *mp = COptCtxt::PoctxtFromTLS()->Pmp();
 
-	CExpression *part_constraint_expr = nullptr;
-
 	CDXLNode *dxlnode = partrel->MDPartConstraint();
 
 	if (nullptr == dxlnode)
@@ -2673,11 +2948,29 @@ CExpressionPreprocessor::PcnstrFromChildPartition(
 		mapped_colids->Append(GPOS_NEW(mp) ULONG(*colid));
 	}
 
-	CTranslatorDXLToExpr dxltr(mp, md_accessor);
-	part_constraint_expr =
-		dxltr.PexprTranslateScalar(dxlnode, pdrgpcrOutput, mapped_colids);
+	CConstraint *cnstr =
+		PcnstrFromPartConstraint(dxlnode, pdrgpcrOutput, mapped_colids);
 	mapped_colids->Release();
 
+	GPOS_ASSERT(cnstr);
+	return cnstr;
+}
+
+// Translate a part constraint into a constraint on the given colrefs of the
+// root table. The column ids of the part constraint are mapped to the colrefs
+// by the given indexes, or by their positions if there are none.
+CConstraint *
+CExpressionPreprocessor::PcnstrFromPartConstraint(CDXLNode *part_constraint,
+												  CColRefArray *pdrgpcrOutput,
+												  ULongPtrArray *mapped_colids)
+{
+	CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
+	CMemoryPool *mp = COptCtxt::PoctxtFromTLS()->Pmp();
+
+	CTranslatorDXLToExpr dxltr(mp, md_accessor);
+	CExpression *part_constraint_expr = dxltr.PexprTranslateScalar(
+		part_constraint, pdrgpcrOutput, mapped_colids);
+
 	GPOS_ASSERT(CUtils::FPredicate(part_constraint_expr));
 
 	CColRefSetArray *pdrgpcrsChild = nullptr;
@@ -2686,50 +2979,50 @@ CExpressionPreprocessor::PcnstrFromChildPartition(
 
 	CRefCount::SafeRelease(part_constraint_expr);
 	CRefCount::SafeRelease(pdrgpcrsChild);
-	GPOS_ASSERT(cnstr);
 	return cnstr;
 }
 
-// main driver, pre-processing of input logical expression
+// run the preprocessing passes over the given expression, recording the
+// time of each pass in the given statistics
 CExpression *
-CExpressionPreprocessor::PexprPreprocess(
-	CMemoryPool *mp, CExpression *pexpr,
-	CColRefSet *
-		pcrsOutputAndOrderCols	// query output cols and cols used in the order specs
-)
+CExpressionPreprocessor::PexprPreprocessPasses(
+	CMemoryPool *mp, CExpression *pexpr, CColRefSet *pcrsOutputAndOrderCols,
+	CPreprocessingPassStats *pstats)
 {
 	GPOS_ASSERT(nullptr != mp);
 	GPOS_ASSERT(nullptr != pexpr);
+	GPOS_ASSERT(nullptr != pstats);
 
-	CAutoTimer at("\n[OPT]: Expression Preprocessing Time",
-				  GPOS_FTRACE(EopttracePrintOptimizationStatistics));
-
-	// (1) remove unused CTE anchors
-	CExpression *pexprNoUnusedCTEs = PexprRemoveUnusedCTEs(mp, pexpr);
-	GPOS_CHECK_ABORT;
-
-	// (2.a) remove intermediate superfluous limit
+	// (1) remove unused CTE anchors and (2.a) intermediate superfluous
+	// limits, both only skip nodes and are done in one traversal
 	CExpression *pexprSimplifiedLimit =
-		PexprRemoveSuperfluousLimit(mp, pexprNoUnusedCTEs);
+		PexprRemoveUnusedCTEsAndSuperfluousLimits(mp, pexpr);
 	GPOS_CHECK_ABORT;
-	pexprNoUnusedCTEs->Release();
+	pstats->Record("(1, 2.a) remove unused CTEs and superfluous limits", pexpr,
+				   pexprSimplifiedLimit);
 
 	// (2.b) remove intermediate superfluous distinct
 	CExpression *pexprSimplifiedDistinct =
 		PexprRemoveSuperfluousDistinctInDQA(mp, pexprSimplifiedLimit);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(2.b) remove superfluous distinct", pexprSimplifiedLimit,
+				   pexprSimplifiedDistinct);
 	pexprSimplifiedLimit->Release();
 
 	// (3) trim unnecessary existential subqueries
 	CExpression *pexprTrimmed =
 		PexprTrimExistentialSubqueries(mp, pexprSimplifiedDistinct);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(3) trim existential subqueries", pexprSimplifiedDistinct,
+				   pexprTrimmed);
 	pexprSimplifiedDistinct->Release();
 
 	// (4) collapse cascaded union / union all
 	CExpression *pexprNaryUnionUnionAll =
 		PexprCollapseUnionUnionAll(mp, pexprTrimmed);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(4) collapse union / union all", pexprTrimmed,
+				   pexprNaryUnionUnionAll);
 	pexprTrimmed->Release();
 
 	// (5) remove superfluous outer references from the order spec in limits, grouping columns in GbAgg, and
@@ -2737,30 +3030,40 @@ CExpressionPreprocessor::PexprPreprocess(
 	CExpression *pexprOuterRefsEleminated =
 		PexprRemoveSuperfluousOuterRefs(mp, pexprNaryUnionUnionAll);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(5) remove superfluous outer references",
+				   pexprNaryUnionUnionAll, pexprOuterRefsEleminated);
 	pexprNaryUnionUnionAll->Release();
 
 	// (6) remove superfluous equality
 	CExpression *pexprTrimmed2 =
 		PexprPruneSuperfluousEquality(mp, pexprOuterRefsEleminated);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(6) prune superfluous equality", pexprOuterRefsEleminated,
+				   pexprTrimmed2);
 	pexprOuterRefsEleminated->Release();
 
 	// (7) simplify quantified subqueries
 	CExpression *pexprSubqSimplified =
 		PexprSimplifyQuantifiedSubqueries(mp, pexprTrimmed2);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(7) simplify quantified subqueries", pexprTrimmed2,
+				   pexprSubqSimplified);
 	pexprTrimmed2->Release();
 
 	// (8) do preliminary unnesting of scalar subqueries
 	CExpression *pexprSubqUnnested =
 		PexprUnnestScalarSubqueries(mp, pexprSubqSimplified);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(8) unnest scalar subqueries", pexprSubqSimplified,
+				   pexprSubqUnnested);
 	pexprSubqSimplified->Release();
 
 	// (9) unnest AND/OR/NOT predicates
 	CExpression *pexprUnnested =
 		CExpressionUtils::PexprUnnest(mp, pexprSubqUnnested);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(9) unnest AND/OR/NOT predicates", pexprSubqUnnested,
+				   pexprUnnested);
 	pexprSubqUnnested->Release();
 
 	CExpression *pexprConvert2In = pexprUnnested;
@@ -2773,114 +3076,173 @@ CExpressionPreprocessor::PexprPreprocess(
 		// (9.5) ensure predicates are array IN or NOT IN where applicable
 		pexprConvert2In = PexprConvert2In(mp, pexprUnnested);
 		GPOS_CHECK_ABORT;
+		pstats->Record("(9.5) convert to array IN / NOT IN", pexprUnnested,
+					 pexprConvert2In);
 		pexprUnnested->Release();
 	}
 
 	// (10) infer predicates from constraints
 	CExpression *pexprInferredPreds = PexprInferPredicates(mp, pexprConvert2In);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(10) infer predicates", pexprConvert2In,
+				   pexprInferredPreds);
 	pexprConvert2In->Release();
 
 	// (11) eliminate self comparisons
 	CExpression *pexprSelfCompEliminated =
 		PexprEliminateSelfComparison(mp, pexprInferredPreds);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(11) eliminate self comparisons", pexprInferredPreds,
+				   pexprSelfCompEliminated);
 	pexprInferredPreds->Release();
 
 	// (12) remove duplicate AND/OR children
 	CExpression *pexprDeduped =
 		CExpressionUtils::PexprDedupChildren(mp, pexprSelfCompEliminated);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(12) dedup AND/OR children", pexprSelfCompEliminated,
+				   pexprDeduped);
 	pexprSelfCompEliminated->Release();
 
 	// (13) factorize common expressions
 	CExpression *pexprFactorized =
 		CExpressionFactorizer::PexprFactorize(mp, pexprDeduped);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(13) factorize", pexprDeduped, pexprFactorized);
 	pexprDeduped->Release();
 
 	// (14) infer filters out of components of disjunctive filters
 	CExpression *pexprPrefiltersExtracted =
 		CExpressionFactorizer::PexprExtractInferredFilters(mp, pexprFactorized);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(14) extract inferred filters", pexprFactorized,
+				   pexprPrefiltersExtracted);
 	pexprFactorized->Release();
 
 	// (15) pre-process window functions
 	CExpression *pexprWindowPreprocessed =
 		CWindowPreprocessor::PexprPreprocess(mp, pexprPrefiltersExtracted);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(15) preprocess window functions", pexprPrefiltersExtracted,
+				   pexprWindowPreprocessed);
 	pexprPrefiltersExtracted->Release();
 
 	// (16) eliminate unused computed columns
 	CExpression *pexprNoUnusedPrEl = PexprPruneUnusedComputedCols(
 		mp, pexprWindowPreprocessed, pcrsOutputAndOrderCols);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(16) prune unused computed columns",
+				   pexprWindowPreprocessed, pexprNoUnusedPrEl);
 	pexprWindowPreprocessed->Release();
 
 	// (17) normalize expression
 	CExpression *pexprNormalized1 =
 		CNormalizer::PexprNormalize(mp, pexprNoUnusedPrEl);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(17) normalize", pexprNoUnusedPrEl, pexprNormalized1);
 	pexprNoUnusedPrEl->Release();
 
 	// (18) transform outer join into inner join whenever possible
 	CExpression *pexprLOJToIJ = PexprOuterJoinToInnerJoin(mp, pexprNormalized1);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(18) outer join to inner join", pexprNormalized1,
+				   pexprLOJToIJ);
 	pexprNormalized1->Release();
 
 	// (19) collapse cascaded inner and left outer joins
 	CExpression *pexprCollapsed = PexprCollapseJoins(mp, pexprLOJToIJ);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(19) collapse joins", pexprLOJToIJ, pexprCollapsed);
 	pexprLOJToIJ->Release();
 
 	// (20) after transforming outer joins to inner joins, we may be able to generate more predicates from constraints
 	CExpression *pexprWithPreds =
 		PexprAddPredicatesFromConstraints(mp, pexprCollapsed);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(20) add predicates from constraints", pexprCollapsed,
+				   pexprWithPreds);
 	pexprCollapsed->Release();
 
 	// (21) eliminate empty subtrees
 	CExpression *pexprPruned = PexprPruneEmptySubtrees(mp, pexprWithPreds);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(21) prune empty subtrees", pexprWithPreds, pexprPruned);
 	pexprWithPreds->Release();
 
 	// (22) collapse cascade of projects
 	CExpression *pexprCollapsedProjects =
 		PexprCollapseProjects(mp, pexprPruned);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(22) collapse projects", pexprPruned,
+				   pexprCollapsedProjects);
 	pexprPruned->Release();
 
 	// (23) insert dummy project when the scalar subquery is under a project and returns an outer reference
 	CExpression *pexprSubquery = PexprProjBelowSubquery(
 		mp, pexprCollapsedProjects, false /* fUnderPrList */);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(23) project below subqueries", pexprCollapsedProjects,
+				   pexprSubquery);
 	pexprCollapsedProjects->Release();
 
 	// (24) reorder the children of scalar cmp operator to ensure that left child is scalar ident and right child is scalar const
 	CExpression *pexrReorderedScalarCmpChildren =
 		PexprReorderScalarCmpChildren(mp, pexprSubquery);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(24) reorder scalar comparisons", pexprSubquery,
+				   pexrReorderedScalarCmpChildren);
 	pexprSubquery->Release();
 
 	// (25) rewrite IN subquery to EXIST subquery with a predicate
 	CExpression *pexprExistWithPredFromINSubq =
 		PexprExistWithPredFromINSubq(mp, pexrReorderedScalarCmpChildren);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(25) IN subqueries to EXISTS",
+				   pexrReorderedScalarCmpChildren, pexprExistWithPredFromINSubq);
 	pexrReorderedScalarCmpChildren->Release();
 
 	// (26) prune partitions
 	CExpression *pexprPrunedPartitions =
 		PrunePartitions(mp, pexprExistWithPredFromINSubq);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(26) prune partitions", pexprExistWithPredFromINSubq,
+				   pexprPrunedPartitions);
 	pexprExistWithPredFromINSubq->Release();
 
 	// (27) normalize expression again
 	CExpression *pexprNormalized2 =
 		CNormalizer::PexprNormalize(mp, pexprPrunedPartitions);
 	GPOS_CHECK_ABORT;
+	pstats->Record("(27) normalize again", pexprPrunedPartitions,
+				   pexprNormalized2);
 	pexprPrunedPartitions->Release();
 
 	return pexprNormalized2;
 }
 
+// main driver, pre-processing of input logical expression
+CExpression *
+CExpressionPreprocessor::PexprPreprocess(
+	CMemoryPool *mp, CExpression *pexpr,
+	CColRefSet *
+		pcrsOutputAndOrderCols	// query output cols and cols used in the order specs
+)
+{
+	CPreprocessingPassStats stats(
+		GPOS_FTRACE(EopttracePrintOptimizationStatistics));
+
+	CExpression *pexprPreprocessed = nullptr;
+	{
+		CAutoTimer at("\n[OPT]: Expression Preprocessing Time",
+					  GPOS_FTRACE(EopttracePrintOptimizationStatistics));
+		pexprPreprocessed =
+			PexprPreprocessPasses(mp, pexpr, pcrsOutputAndOrderCols, &stats);
+	}
+
+	// the time of each pass is printed after the total
+	stats.Print(mp);
+
+	return pexprPreprocessed;
+}
+
 // EOF
@@ -1158,7 +1158,8 @@ IStatistics *
 CLogical::PstatsBaseTable(
 	CMemoryPool *mp, CExpressionHandle &exprhdl, CTableDescriptor *ptabdesc,
 	CColRefSet *
-		pcrsHistExtra  // additional columns required for stats, not required by parent
+		pcrsHistExtra,	// additional columns required for stats, not required by parent
+	IMdIdArray *part_mdids	// leaf partitions to merge the statistics of
 )
 {
 	CReqdPropRelational *prprel =
@@ -1180,8 +1181,8 @@ CLogical::PstatsBaseTable(
 	CStatisticsConfig *stats_config =
 		poctxt->GetOptimizerConfig()->GetStatsConf();
 
-	IStatistics *stats = md_accessor->Pstats(mp, ptabdesc->MDId(), pcrsHist,
-											 pcrsWidth, stats_config);
+	IStatistics *stats = md_accessor->Pstats(
+		mp, ptabdesc->MDId(), pcrsHist, pcrsWidth, stats_config, part_mdids);
 
 	// clean up
 	pcrsWidth->Release();
@@ -19,6 +19,7 @@
 #include "gpopt/base/CConstraintInterval.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CUtils.h"
+#include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/metadata/CName.h"
 #include "gpopt/metadata/CPartConstraint.h"
 #include "gpopt/metadata/CTableDescriptor.h"
@@ -28,6 +29,7 @@
 #include "naucrates/statistics/CFilterStatsProcessor.h"
 #include "naucrates/statistics/CStatistics.h"
 #include "naucrates/statistics/CStatsPredUtils.h"
+#include "naucrates/traceflags/traceflags.h"
 
 using namespace gpopt;
 
@@ -81,8 +83,6 @@ CLogicalDynamicGetBase::CLogicalDynamicGetBase(
 	GPOS_ASSERT(nullptr != pdrgpdrgpcrPart);
 
 	m_pcrsDist = CLogical::PcrsDist(mp, m_ptabdesc, m_pdrgpcrOutput);
-	m_root_col_mapping_per_part =
-		ConstructRootColMappingPerPart(mp, m_pdrgpcrOutput, m_partition_mdids);
 }
 
 
@@ -116,9 +116,6 @@ CLogicalDynamicGetBase::CLogicalDynamicGetBase(CMemoryPool *mp,
 	m_pdrgpdrgpcrPart = PdrgpdrgpcrCreatePartCols(mp, m_pdrgpcrOutput,
 												  m_ptabdesc->PdrgpulPart());
 	m_pcrsDist = CLogical::PcrsDist(mp, m_ptabdesc, m_pdrgpcrOutput);
-
-	m_root_col_mapping_per_part =
-		ConstructRootColMappingPerPart(mp, m_pdrgpcrOutput, m_partition_mdids);
 }
 
 //---------------------------------------------------------------------------
@@ -255,8 +252,24 @@ CLogicalDynamicGetBase::PstatsDeriveFilter(CMemoryPool *mp,
 	}
 
 
+	// when static partition elimination leaves only some of the leaf
+	// partitions, merge their statistics rather than use the root's
+	IMdIdArray *part_mdids = nullptr;
+	if (GPOS_FTRACE(EopttraceMergeLeafPartitionStats) &&
+		nullptr != m_partition_mdids && 0 < m_partition_mdids->Size())
+	{
+		CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
+		const IMDRelation *pmdrel = md_accessor->RetrieveRel(m_ptabdesc->MDId());
+		IMdIdArray *all_part_mdids = pmdrel->ChildPartitionMdids();
+		if (nullptr != all_part_mdids &&
+			m_partition_mdids->Size() < all_part_mdids->Size())
+		{
+			part_mdids = m_partition_mdids;
+		}
+	}
+
 	CStatistics *pstatsFullTable = dynamic_cast<CStatistics *>(
-		PstatsBaseTable(mp, exprhdl, m_ptabdesc, pcrsStat));
+		PstatsBaseTable(mp, exprhdl, m_ptabdesc, pcrsStat, part_mdids));
 
 	pcrsStat->Release();
 
@@ -278,6 +291,28 @@ CLogicalDynamicGetBase::PstatsDeriveFilter(CMemoryPool *mp,
 	return result_stats;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CLogicalDynamicGetBase::GetRootColMappingPerPart
+//
+//	@doc:
+//		Mapping of root columns to child partition columns, per child
+//		partition; constructed on first use, so that only the partitions
+//		that survive partition elimination are retrieved
+//
+//---------------------------------------------------------------------------
+ColRefToUlongMapArray *
+CLogicalDynamicGetBase::GetRootColMappingPerPart() const
+{
+	if (nullptr == m_root_col_mapping_per_part)
+	{
+		m_root_col_mapping_per_part = ConstructRootColMappingPerPart(
+			m_mp, m_pdrgpcrOutput, m_partition_mdids);
+	}
+
+	return m_root_col_mapping_per_part;
+}
+
 // Construct a mapping from each column in root table to an index in each child
 // partition's table descr by matching column names
 ColRefToUlongMapArray *
@@ -234,7 +234,8 @@ COptimizer::PdxlnOptimize(
 	ULONG ulHosts,	// actual number of data nodes in the system
 	ULONG ulSessionId, ULONG ulCmdId, CSearchStageArray *search_stage_array,
 	COptimizerConfig *optimizer_config,
-	const CHAR *szMinidumpFileName	// name of minidump file to be created
+	const CHAR *szMinidumpFileName,	 // name of minidump file to be created
+	SEngineStats *engine_stats		 // if given, receives size of search
 )
 {
 	GPOS_ASSERT(nullptr != md_accessor);
@@ -315,7 +316,8 @@ COptimizer::PdxlnOptimize(
 
 			GPOS_CHECK_ABORT;
 			// optimize logical expression tree into physical expression tree.
-			CExpression *pexprPlan = PexprOptimize(mp, pqc, search_stage_array);
+			CExpression *pexprPlan =
+				PexprOptimize(mp, pqc, search_stage_array, engine_stats);
 			GPOS_CHECK_ABORT;
 
 			// translate plan into DXL
@@ -415,12 +417,18 @@ COptimizer::CheckCTEConsistency(CMemoryPool *mp, CExpression *pexpr)
 //---------------------------------------------------------------------------
 CExpression *
 COptimizer::PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
-						  CSearchStageArray *search_stage_array)
+						  CSearchStageArray *search_stage_array,
+						  SEngineStats *engine_stats)
 {
 	CEngine eng(mp);
 	eng.Init(pqc, search_stage_array);
 	eng.Optimize();
 
+	if (nullptr != engine_stats)
+	{
+		eng.CollectStats(engine_stats);
+	}
+
 	GPOS_CHECK_ABORT;
 
 	CExpression *pexprPlan = eng.PexprExtractPlan();
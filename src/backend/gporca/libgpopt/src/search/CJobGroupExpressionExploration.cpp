@@ -21,6 +21,7 @@
 #include "gpopt/search/CScheduler.h"
 #include "gpopt/search/CSchedulerContext.h"
 #include "gpopt/xforms/CXformFactory.h"
+#include "naucrates/traceflags/traceflags.h"
 
 
 using namespace gpopt;
@@ -168,6 +169,15 @@ CJobGroupExpressionExploration::ScheduleApplicableTransformations(
 {
 	GPOS_ASSERT(!FXformsScheduled());
 
+	// once a stage of the adaptive search strategy is out of time, explore
+	// no further
+	if (GPOS_FTRACE(EopttraceEnableAdaptiveSearch) &&
+		psc->Peng()->PssCurrent()->FTimedOut())
+	{
+		SetXformsScheduled();
+		return;
+	}
+
 	// get all applicable xforms
 	COperator *pop = m_pgexpr->Pop();
 	CXformSet *xform_set =
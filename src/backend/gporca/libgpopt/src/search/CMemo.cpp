@@ -23,12 +23,15 @@
 #include "gpopt/base/CDrvdPropCtxtPlan.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/COptimizationContext.h"
+#include "gpopt/base/CUtils.h"
 #include "gpopt/base/CReqdPropPlan.h"
 #include "gpopt/engine/CEngine.h"
 #include "gpopt/exception.h"
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CLogicalCTEProducer.h"
 #include "gpopt/search/CGroupProxy.h"
+#include "gpopt/search/CSearchStage.h"
+#include "gpopt/xforms/CXformFactory.h"
 
 using namespace gpopt;
 
@@ -820,3 +823,59 @@ CMemo::UlGrpExprs()
 
 	return ulGExprs;
 }
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemo::EstimateSearchSpace
+//
+//	@doc:
+//		Estimate the size of the search space of the memo before exploration;
+//		count the logical groups, the joins, where an n-ary join counts as
+//		n-1 joins, and the exploration xforms that are candidates for the
+//		logical group expressions
+//
+//---------------------------------------------------------------------------
+void
+CMemo::EstimateSearchSpace(CMemoryPool *mp,
+						   SSearchSpaceEstimate *estimate) const
+{
+	GPOS_ASSERT(nullptr != estimate);
+
+	CXformSet *xform_set_exploration = CXformFactory::Pxff()->PxfsExploration();
+	CGroup *pgroup = m_listGroups.PtFirst();
+	while (nullptr != pgroup)
+	{
+		if (!pgroup->FScalar())
+		{
+			estimate->m_num_groups++;
+
+			CGroupProxy gp(pgroup);
+			CGroupExpression *pgexpr = gp.PgexprFirst();
+			while (nullptr != pgexpr)
+			{
+				COperator *pop = pgexpr->Pop();
+				if (pop->FLogical())
+				{
+					if (COperator::EopLogicalNAryJoin == pop->Eopid())
+					{
+						// the last child of an n-ary join is its scalar
+						estimate->m_num_joins += pgexpr->Arity() - 2;
+					}
+					else if (CUtils::FLogicalJoin(pop))
+					{
+						estimate->m_num_joins++;
+					}
+
+					CXformSet *xform_set =
+						CLogical::PopConvert(pop)->PxfsCandidates(mp);
+					xform_set->Intersection(xform_set_exploration);
+					estimate->m_num_xform_candidates += xform_set->Size();
+					xform_set->Release();
+				}
+				pgexpr = gp.PgexprNext(pgexpr);
+			}
+		}
+		pgroup = m_listGroups.Next(pgroup);
+	}
+}
@@ -128,4 +128,64 @@ CSearchStage::PdrgpssDefault(CMemoryPool *mp)
 	return search_stage_array;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSearchStage::PdrgpssAdaptive
+//
+//	@doc:
+//		Generate search strategy for the given estimate of the search space;
+//		trivial queries get the default strategy, others get a greedy stage
+//		without a time threshold, so that a plan exists before the costly
+//		xforms run, followed by a stage with all xforms and a time threshold
+//		that grows with the number of xform candidates
+//
+//---------------------------------------------------------------------------
+CSearchStageArray *
+CSearchStage::PdrgpssAdaptive(CMemoryPool *mp,
+							  const SSearchSpaceEstimate &estimate)
+{
+	if (GPOPT_ADAPTIVE_SEARCH_TRIVIAL_JOINS >= estimate.m_num_joins &&
+		GPOPT_ADAPTIVE_SEARCH_TRIVIAL_XFORMS >= estimate.m_num_xform_candidates)
+	{
+		return PdrgpssDefault(mp);
+	}
+
+	// greedy stage: leave out the xforms enumerating join orders and
+	// pushing aggregates below joins
+	CXformSet *xform_set_greedy = GPOS_NEW(mp) CXformSet(mp);
+	xform_set_greedy->Union(CXformFactory::Pxff()->PxfsExploration());
+	(void) xform_set_greedy->ExchangeClear(CXform::ExfExpandNAryJoinDP);
+	(void) xform_set_greedy->ExchangeClear(CXform::ExfJoinCommutativity);
+	(void) xform_set_greedy->ExchangeClear(CXform::ExfJoinAssociativity);
+	(void) xform_set_greedy->ExchangeClear(CXform::ExfPushGbBelowJoin);
+	(void) xform_set_greedy->ExchangeClear(CXform::ExfPushGbDedupBelowJoin);
+	(void) xform_set_greedy->ExchangeClear(
+		CXform::ExfPushGbWithHavingBelowJoin);
+
+	// n-ary joins are only expanded by DPv2 when the other expansions are
+	// disabled, in which case it is kept to get a plan at all
+	if (GPOPT_FENABLED_XFORM(CXform::ExfExpandNAryJoin) ||
+		GPOPT_FENABLED_XFORM(CXform::ExfExpandNAryJoinMinCard) ||
+		GPOPT_FENABLED_XFORM(CXform::ExfExpandNAryJoinGreedy))
+	{
+		(void) xform_set_greedy->ExchangeClear(CXform::ExfExpandNAryJoinDPv2);
+	}
+
+	CXformSet *xform_set_all = GPOS_NEW(mp) CXformSet(mp);
+	xform_set_all->Union(CXformFactory::Pxff()->PxfsExploration());
+
+	ULLONG budget = (ULLONG) estimate.m_num_xform_candidates *
+					GPOPT_ADAPTIVE_SEARCH_MS_PER_XFORM;
+	budget = std::max(budget, (ULLONG) GPOPT_ADAPTIVE_SEARCH_MIN_BUDGET_MS);
+	budget = std::min(budget, (ULLONG) GPOPT_ADAPTIVE_SEARCH_MAX_BUDGET_MS);
+
+	CSearchStageArray *search_stage_array = GPOS_NEW(mp) CSearchStageArray(mp);
+	search_stage_array->Append(GPOS_NEW(mp) CSearchStage(xform_set_greedy));
+	search_stage_array->Append(
+		GPOS_NEW(mp) CSearchStage(xform_set_all, (ULONG) budget));
+
+	return search_stage_array;
+}
+
 // EOF
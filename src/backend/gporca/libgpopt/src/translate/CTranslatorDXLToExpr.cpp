@@ -588,19 +588,10 @@ CTranslatorDXLToExpr::PexprLogicalGet(const CDXLNode *dxlnode)
 	{
 		GPOS_ASSERT(EdxlopLogicalGet == edxlopid);
 
+		// the metadata of the child partitions is not retrieved here, but
+		// only for those that survive partition elimination; multi-level
+		// partitioned tables are rejected when the root is retrieved
 		IMdIdArray *partition_mdids = pmdrel->ChildPartitionMdids();
-		for (ULONG ul = 0; ul < partition_mdids->Size(); ++ul)
-		{
-			IMDId *part_mdid = (*partition_mdids)[ul];
-			const IMDRelation *partrel = m_pmda->RetrieveRel(part_mdid);
-
-			if (partrel->IsPartitioned())
-			{
-				// Multi-level partitioned tables are unsupported - fall back
-				GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
-						   GPOS_WSZ_LIT("Multi-level partitioned tables"));
-			}
-		}
 
 		// generate a part index id
 		ULONG part_idx_id = COptCtxt::PoctxtFromTLS()->UlPartIndexNextVal();
@@ -206,56 +206,88 @@ CJoinOrderDPv2::ComputeCost(SExpressionInfo *expr_info,
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CJoinOrderDPv2::PexprBuildInnerJoinPred
+//		CJoinOrderDPv2::PbsInnerJoinEdges
 //
 //	@doc:
-//		Build predicate connecting the two given sets
+//		Collect the inner join edges that reference any of the given atoms;
+//		computed once per group, so that building the predicate for a pair
+//		of groups only looks at the edges both groups reference
 //
 //---------------------------------------------------------------------------
-CExpression *
-CJoinOrderDPv2::PexprBuildInnerJoinPred(CBitSet *pbsFst, CBitSet *pbsSnd)
+CBitSet *
+CJoinOrderDPv2::PbsInnerJoinEdges(CBitSet *atoms)
 {
-	GPOS_ASSERT(pbsFst->IsDisjoint(pbsSnd));
-	// collect edges connecting the given sets
 	CBitSet *pbsEdges = GPOS_NEW(m_mp) CBitSet(m_mp);
-	CBitSet *pbs = GPOS_NEW(m_mp) CBitSet(m_mp, *pbsFst);
-	pbs->Union(pbsSnd);
 
 	for (ULONG ul = 0; ul < m_ulEdges; ul++)
 	{
 		SEdge *pedge = m_rgpedge[ul];
-		if (
-			// edge represents an inner join pred
-			0 == pedge->m_loj_num &&
-			// all columns referenced in the edge pred are provided
-			pbs->ContainsAll(pedge->m_pbs) &&
-			// the edge represents a true join predicate between the two components
-			!pbsFst->IsDisjoint(pedge->m_pbs) &&
-			!pbsSnd->IsDisjoint(pedge->m_pbs))
+		if (0 == pedge->m_loj_num && !atoms->IsDisjoint(pedge->m_pbs))
 		{
-			BOOL fSet GPOS_ASSERTS_ONLY = pbsEdges->ExchangeSet(ul);
-			GPOS_ASSERT(!fSet);
+			(void) pbsEdges->ExchangeSet(ul);
 		}
 	}
-	pbs->Release();
 
-	CExpression *pexprPred = nullptr;
-	if (0 < pbsEdges->Size())
+	return pbsEdges;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPv2::PexprBuildInnerJoinPred
+//
+//	@doc:
+//		Build predicate connecting the two given groups
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinOrderDPv2::PexprBuildInnerJoinPred(SGroupInfo *left_group_info,
+										SGroupInfo *right_group_info)
+{
+	CBitSet *pbsFst = left_group_info->m_atoms;
+	CBitSet *pbsSnd = right_group_info->m_atoms;
+	GPOS_ASSERT(pbsFst->IsDisjoint(pbsSnd));
+
+	// a true join predicate between the two groups references atoms of
+	// both, most pairs of groups that are not joined by any predicate,
+	// like the bushy pairs of a star join, are rejected here
+	if (left_group_info->m_edges->IsDisjoint(right_group_info->m_edges))
+	{
+		return nullptr;
+	}
+
+	// collect edges connecting the given sets
+	CBitSet *pbsEdges = GPOS_NEW(m_mp) CBitSet(m_mp, *left_group_info->m_edges);
+	pbsEdges->Intersection(right_group_info->m_edges);
+	CBitSet *pbs = GPOS_NEW(m_mp) CBitSet(m_mp, *pbsFst);
+	pbs->Union(pbsSnd);
+
+	CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+	CBitSetIter bsi(*pbsEdges);
+	while (bsi.Advance())
 	{
-		CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
-		CBitSetIter bsi(*pbsEdges);
-		while (bsi.Advance())
+		SEdge *pedge = m_rgpedge[bsi.Bit()];
+
+		// all columns referenced in the edge pred are provided
+		if (pbs->ContainsAll(pedge->m_pbs))
 		{
-			ULONG ul = bsi.Bit();
-			SEdge *pedge = m_rgpedge[ul];
 			pedge->m_pexpr->AddRef();
 			pdrgpexpr->Append(pedge->m_pexpr);
 		}
+	}
+	pbs->Release();
+	pbsEdges->Release();
 
+	CExpression *pexprPred = nullptr;
+	if (0 < pdrgpexpr->Size())
+	{
 		pexprPred = CPredicateUtils::PexprConjunction(m_mp, pdrgpexpr);
 	}
+	else
+	{
+		pdrgpexpr->Release();
+	}
 
-	pbsEdges->Release();
 	return pexprPred;
 }
 
@@ -342,8 +374,8 @@ CJoinOrderDPv2::GetJoinExpr(const SGroupAndExpression &left_child_expr,
 	{
 		// inner join, compute the predicate from the join graph
 		GPOS_ASSERT(nullptr == scalar_expr);
-		scalar_expr = PexprBuildInnerJoinPred(left_group_info->m_atoms,
-											  right_group_info->m_atoms);
+		scalar_expr =
+			PexprBuildInnerJoinPred(left_group_info, right_group_info);
 	}
 	else
 	{
@@ -1199,7 +1231,8 @@ CJoinOrderDPv2::LookupOrCreateGroupInfo(SLevelInfo *levelInfo, CBitSet *atoms,
 	if (nullptr == group_info)
 	{
 		// this is a group we haven't seen yet, create a new group info and derive stats, if needed
-		group_info = GPOS_NEW(m_mp) SGroupInfo(m_mp, atoms);
+		group_info = GPOS_NEW(m_mp)
+			SGroupInfo(m_mp, atoms, PbsInnerJoinEdges(atoms));
 		if (!stats_expr_info->m_properties.Satisfies(EJoinOrderStats))
 		{
 			SExpressionProperties stats_props(EJoinOrderStats);
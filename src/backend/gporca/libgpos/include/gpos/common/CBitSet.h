@@ -6,15 +6,13 @@
 //		CBitSet.h
 //
 //	@doc:
-//		Implementation of bitset as linked list of bitvectors
+//		Implementation of bitset as a contiguous array of words
 //---------------------------------------------------------------------------
 #ifndef GPOS_CBitSet_H
 #define GPOS_CBitSet_H
 
 #include "gpos/base.h"
-#include "gpos/common/CBitVector.h"
 #include "gpos/common/CDynamicPtrArray.h"
-#include "gpos/common/CList.h"
 #include "gpos/common/DbgPrintMixin.h"
 
 
@@ -25,7 +23,10 @@ namespace gpos
 //		CBitSet
 //
 //	@doc:
-//		Linked list of CBitSetLink's
+//		Bit set stored as a contiguous array of 64-bit words covering the
+//		range between its lowest and highest bits. Sets spanning up to
+//		256 bits need no allocation beyond the set itself; larger ones grow
+//		the array as needed. Set operations combine whole words.
 //
 //---------------------------------------------------------------------------
 class CBitSet : public CRefCount, public DbgPrintMixin<CBitSet>
@@ -34,61 +35,24 @@ class CBitSet : public CRefCount, public DbgPrintMixin<CBitSet>
 	friend class CBitSetIter;
 
 protected:
-	//---------------------------------------------------------------------------
-	//	@class:
-	//		CBitSetLink
-	//
-	//	@doc:
-	//		bit vector + offset + link
-	//
-	//---------------------------------------------------------------------------
-	class CBitSetLink
-	{
-	private:
-		// offset
-		ULONG m_offset;
-
-		// bitvector
-		CBitVector *m_vec;
-
-	public:
-		CBitSetLink(const CBitSetLink &) = delete;
-
-		// ctor
-		explicit CBitSetLink(CMemoryPool *, ULONG offset, ULONG vector_size);
-
-		explicit CBitSetLink(CMemoryPool *, const CBitSetLink &);
-
-		// dtor
-		~CBitSetLink();
-
-		// accessor
-		ULONG
-		GetOffset() const
-		{
-			return m_offset;
-		}
+	// number of words stored inline
+	static const ULONG InlineWords = 4;
 
-		// accessor
-		CBitVector *
-		GetVec() const
-		{
-			return m_vec;
-		}
-
-		// list link
-		SLink m_link;
+	// pool to allocate words from
+	CMemoryPool *m_mp;
 
-	};	// class CBitSetLink
+	// inline storage, used until the set outgrows it
+	ULLONG m_inline_words[InlineWords];
 
-	// list of bit set links
-	CList<CBitSetLink> m_bsllist;
+	// words of the set, either the inline words or an allocated array
+	ULLONG *m_words;
 
-	// pool to allocate links from
-	CMemoryPool *m_mp;
+	// index of the first word, relative to bit zero
+	ULONG m_first_word;
 
-	// size of individual bitvectors
-	ULONG m_vector_size;
+	// number of words in use, and number of words available
+	ULONG m_num_words;
+	ULONG m_capacity;
 
 	// number of elements
 	ULONG m_size;
@@ -96,20 +60,27 @@ protected:
 	// private copy ctor
 	CBitSet(const CBitSet &);
 
-	// find link with offset less or equal to given value
-	CBitSetLink *FindLinkByOffset(ULONG, CBitSetLink * = nullptr) const;
+	// word with the given index, relative to bit zero; zero if not stored
+	ULLONG
+	GetWord(ULONG word_idx) const
+	{
+		if (word_idx < m_first_word || word_idx - m_first_word >= m_num_words)
+		{
+			return 0;
+		}
 
-	// reset set
-	void Clear();
+		return m_words[word_idx - m_first_word];
+	}
 
-	// compute target offset
-	ULONG ComputeOffset(ULONG) const;
+	// make sure the words with the given indexes are stored
+	void EnsureWords(ULONG first_word, ULONG end_word);
 
 	// re-compute size of set
 	void RecomputeSize();
 
 public:
-	// ctor
+	// ctor; the vector size is kept for compatibility, the set grows as
+	// needed
 	CBitSet(CMemoryPool *mp, ULONG vector_size = 256);
 	CBitSet(CMemoryPool *mp, const CBitSet &);
 
@@ -22,7 +22,7 @@ namespace gpos
 //
 //	@doc:
 //		Iterator for bitset's; defined as friend, ie can access bitset's
-//		internal links
+//		internal words
 //
 //---------------------------------------------------------------------------
 class CBitSetIter
@@ -31,11 +31,14 @@ private:
 	// bitset
 	const CBitSet &m_bs;
 
-	// current cursor position (in current link)
+	// current cursor position
 	ULONG m_cursor;
 
-	// current cursor link
-	CBitSet::CBitSetLink *m_bsl;
+	// index of the current word among the set's words
+	ULONG m_word_idx;
+
+	// bits of the current word that were not visited yet
+	ULLONG m_pending_bits;
 
 	// is iterator active or exhausted
 	BOOL m_active;
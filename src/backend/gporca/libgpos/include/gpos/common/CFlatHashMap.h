@@ -0,0 +1,326 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CFlatHashMap.h
+//
+//	@doc:
+//		Open-addressing hash map
+//		* same interface and ownership rules as CHashMap
+//		* entries are stored contiguously in insertion order, and found
+//		  through a linearly probed index that grows with the map
+//		* iteration visits entries in insertion order, like CHashMap
+//---------------------------------------------------------------------------
+#ifndef GPOS_CFlatHashMap_H
+#define GPOS_CFlatHashMap_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CRefCount.h"
+
+namespace gpos
+{
+// fwd declaration
+template <class K, class T, ULONG (*HashFn)(const K *),
+		  BOOL (*EqFn)(const K *, const K *), void (*DestroyKFn)(K *),
+		  void (*DestroyTFn)(T *)>
+class CFlatHashMapIter;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CFlatHashMap
+//
+//	@doc:
+//		Open-addressing hash map, a drop-in replacement for CHashMap in maps
+//		that hold many entries. Lookups probe a compact array of hash values
+//		and entry positions, and only call the equality function on entries
+//		whose hash value matches.
+//
+//---------------------------------------------------------------------------
+template <class K, class T, ULONG (*HashFn)(const K *),
+		  BOOL (*EqFn)(const K *, const K *), void (*DestroyKFn)(K *),
+		  void (*DestroyTFn)(T *)>
+class CFlatHashMap : public CRefCount
+{
+	// fwd declaration
+	friend class CFlatHashMapIter<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>;
+
+private:
+	// key/value pair, the key is nullptr once the entry is deleted
+	struct SEntry
+	{
+		K *m_key;
+		T *m_value;
+		ULONG m_hash;
+	};
+
+	// slot of the index, refers to an entry by position
+	struct SSlot
+	{
+		ULONG m_hash;
+		ULONG m_pos;
+	};
+
+	// positions marking unused and deleted slots
+	static const ULONG EmptySlot = gpos::ulong_max;
+	static const ULONG DeletedSlot = gpos::ulong_max - 1;
+
+	// smallest number of slots allocated, 2^3
+	static const ULONG MinSlots = 8;
+
+	// memory pool
+	CMemoryPool *const m_mp;
+
+	// entries in insertion order, including deleted ones
+	SEntry *m_entries;
+
+	// number of used positions in, and capacity of, the entries array
+	ULONG m_num_entries;
+	ULONG m_entries_capacity;
+
+	// number of live entries
+	ULONG m_size;
+
+	// index of entries; the number of slots is a power of two, and exceeds
+	// the capacity of the entries array, so that probing always ends
+	SSlot *m_slots;
+	ULONG m_num_slots;
+
+	// shift selecting the top bits of a scrambled hash value as slot
+	ULONG m_shift;
+
+	// number of entries expected, used to size the first allocation
+	ULONG m_expected_size;
+
+	// first slot to probe for a hash value
+	ULONG
+	InitialSlot(ULONG hash) const
+	{
+		// multiplicative hashing, so that hash functions that only vary in
+		// some bits still spread over all slots
+		return (ULONG)(hash * 2654435769U) >> m_shift;
+	}
+
+	// find the slot of the entry with the given key, or gpos::ulong_max
+	ULONG
+	LookupSlot(const K *key, ULONG hash) const
+	{
+		if (0 == m_num_slots)
+		{
+			return gpos::ulong_max;
+		}
+
+		const ULONG mask = m_num_slots - 1;
+		for (ULONG slot = InitialSlot(hash);; slot = (slot + 1) & mask)
+		{
+			const SSlot &s = m_slots[slot];
+			if (EmptySlot == s.m_pos)
+			{
+				return gpos::ulong_max;
+			}
+
+			if (DeletedSlot != s.m_pos && hash == s.m_hash &&
+				EqFn(m_entries[s.m_pos].m_key, key))
+			{
+				return slot;
+			}
+		}
+	}
+
+	// record the entry at the given position in a free slot of the index
+	void
+	InsertSlot(ULONG hash, ULONG pos)
+	{
+		const ULONG mask = m_num_slots - 1;
+		ULONG slot = InitialSlot(hash);
+		while (EmptySlot != m_slots[slot].m_pos)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		m_slots[slot].m_hash = hash;
+		m_slots[slot].m_pos = pos;
+	}
+
+	// resize index and entries to hold the given number of entries,
+	// dropping deleted entries
+	void
+	Resize(ULONG num_entries)
+	{
+		ULONG num_slots = MinSlots;
+		ULONG shift = 32 - 3;
+		while (num_slots / 4 * 3 < num_entries)
+		{
+			num_slots *= 2;
+			shift--;
+		}
+
+		SEntry *entries = GPOS_NEW_ARRAY(m_mp, SEntry, num_slots / 4 * 3);
+		ULONG live = 0;
+		for (ULONG ul = 0; ul < m_num_entries; ul++)
+		{
+			if (nullptr != m_entries[ul].m_key)
+			{
+				entries[live++] = m_entries[ul];
+			}
+		}
+		GPOS_ASSERT(live == m_size);
+
+		GPOS_DELETE_ARRAY(m_entries);
+		GPOS_DELETE_ARRAY(m_slots);
+
+		m_entries = entries;
+		m_num_entries = live;
+		m_entries_capacity = num_slots / 4 * 3;
+		m_slots = GPOS_NEW_ARRAY(m_mp, SSlot, num_slots);
+		m_num_slots = num_slots;
+		m_shift = shift;
+		for (ULONG ul = 0; ul < num_slots; ul++)
+		{
+			m_slots[ul].m_pos = EmptySlot;
+		}
+
+		for (ULONG ul = 0; ul < live; ul++)
+		{
+			InsertSlot(m_entries[ul].m_hash, ul);
+		}
+	}
+
+public:
+	CFlatHashMap(
+		const CFlatHashMap<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn> &) =
+		delete;
+
+	// ctor; the size is the number of entries expected, the map grows
+	// beyond it as needed, and allocates nothing until the first insert
+	CFlatHashMap<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>(CMemoryPool *mp,
+															 ULONG size = 0)
+		: m_mp(mp),
+		  m_entries(nullptr),
+		  m_num_entries(0),
+		  m_entries_capacity(0),
+		  m_size(0),
+		  m_slots(nullptr),
+		  m_num_slots(0),
+		  m_shift(0),
+		  m_expected_size(size)
+	{
+	}
+
+	// dtor
+	~CFlatHashMap<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>() override
+	{
+		for (ULONG ul = 0; ul < m_num_entries; ul++)
+		{
+			if (nullptr != m_entries[ul].m_key)
+			{
+				DestroyKFn(m_entries[ul].m_key);
+				DestroyTFn(m_entries[ul].m_value);
+			}
+		}
+
+		GPOS_DELETE_ARRAY(m_entries);
+		GPOS_DELETE_ARRAY(m_slots);
+	}
+
+	// insert an element if key is not yet present
+	BOOL
+	Insert(K *key, T *value)
+	{
+		GPOS_ASSERT(nullptr != key);
+
+		const ULONG hash = HashFn(key);
+		if (gpos::ulong_max != LookupSlot(key, hash))
+		{
+			return false;
+		}
+
+		if (m_num_entries == m_entries_capacity)
+		{
+			// grow unless most of the entries were deleted, in which case
+			// compacting them is enough
+			Resize(std::max(std::max(m_size + 1, m_expected_size),
+							2 * m_size));
+		}
+
+		m_entries[m_num_entries].m_key = key;
+		m_entries[m_num_entries].m_value = value;
+		m_entries[m_num_entries].m_hash = hash;
+		InsertSlot(hash, m_num_entries);
+		m_num_entries++;
+		m_size++;
+
+		return true;
+	}
+
+	// lookup a value by its key
+	T *
+	Find(const K *key) const
+	{
+		const ULONG slot = LookupSlot(key, HashFn(key));
+		if (gpos::ulong_max != slot)
+		{
+			return m_entries[m_slots[slot].m_pos].m_value;
+		}
+
+		return nullptr;
+	}
+
+	// replace the value in a map entry with a new given value
+	BOOL
+	Replace(const K *key, T *ptNew)
+	{
+		GPOS_ASSERT(nullptr != key);
+
+		const ULONG slot = LookupSlot(key, HashFn(key));
+		if (gpos::ulong_max == slot)
+		{
+			return false;
+		}
+
+		SEntry &entry = m_entries[m_slots[slot].m_pos];
+		DestroyTFn(entry.m_value);
+		entry.m_value = ptNew;
+
+		return true;
+	}
+
+	// delete the entry with the given key, destroying its key and value
+	BOOL
+	Delete(const K *key)
+	{
+		const ULONG slot = LookupSlot(key, HashFn(key));
+		if (gpos::ulong_max == slot)
+		{
+			return false;
+		}
+
+		SEntry &entry = m_entries[m_slots[slot].m_pos];
+		K *deleted_key = entry.m_key;
+		T *deleted_value = entry.m_value;
+		entry.m_key = nullptr;
+		entry.m_value = nullptr;
+		m_slots[slot].m_pos = DeletedSlot;
+		m_size--;
+
+		DestroyKFn(deleted_key);
+		DestroyTFn(deleted_value);
+
+		return true;
+	}
+
+	// return number of map entries
+	ULONG
+	Size() const
+	{
+		return m_size;
+	}
+
+};	// class CFlatHashMap
+
+}  // namespace gpos
+
+#endif	// !GPOS_CFlatHashMap_H
+
+// EOF
@@ -0,0 +1,96 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CFlatHashMapIter.h
+//
+//	@doc:
+//		Open-addressing hash map iterator
+//---------------------------------------------------------------------------
+#ifndef GPOS_CFlatHashMapIter_H
+#define GPOS_CFlatHashMapIter_H
+
+#include "gpos/base.h"
+#include "gpos/common/CFlatHashMap.h"
+#include "gpos/common/CStackObject.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CFlatHashMapIter
+//
+//	@doc:
+//		Open-addressing hash map iterator, visits entries in insertion order
+//
+//---------------------------------------------------------------------------
+template <class K, class T, ULONG (*HashFn)(const K *),
+		  BOOL (*EqFn)(const K *, const K *), void (*DestroyKFn)(K *),
+		  void (*DestroyTFn)(T *)>
+class CFlatHashMapIter : public CStackObject
+{
+	// short hand for hashmap type
+	typedef CFlatHashMap<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn> TMap;
+
+private:
+	// map to iterate
+	const TMap *m_map;
+
+	// position of the current entry plus one, zero before the first one
+	ULONG m_pos;
+
+public:
+	CFlatHashMapIter(const CFlatHashMapIter<K, T, HashFn, EqFn, DestroyKFn,
+											DestroyTFn> &) = delete;
+
+	// ctor
+	CFlatHashMapIter<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>(TMap *ptm)
+		: m_map(ptm), m_pos(0)
+	{
+		GPOS_ASSERT(nullptr != ptm);
+	}
+
+	// dtor
+	virtual ~CFlatHashMapIter<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>() =
+		default;
+
+	// advance iterator to next element, skipping deleted entries
+	BOOL
+	Advance()
+	{
+		while (m_pos < m_map->m_num_entries)
+		{
+			m_pos++;
+			if (nullptr != m_map->m_entries[m_pos - 1].m_key)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// current key
+	const K *
+	Key() const
+	{
+		GPOS_ASSERT(0 < m_pos);
+		return m_map->m_entries[m_pos - 1].m_key;
+	}
+
+	// current value
+	const T *
+	Value() const
+	{
+		GPOS_ASSERT(0 < m_pos);
+		return m_map->m_entries[m_pos - 1].m_value;
+	}
+
+};	// class CFlatHashMapIter
+
+}  // namespace gpos
+
+#endif	// !GPOS_CFlatHashMapIter_H
+
+// EOF
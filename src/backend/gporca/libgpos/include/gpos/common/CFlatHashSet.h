@@ -0,0 +1,242 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CFlatHashSet.h
+//
+//	@doc:
+//		Open-addressing hash set
+//		* same interface and ownership rules as CHashSet
+//		* elements are stored contiguously in insertion order, and found
+//		  through a linearly probed index that grows with the set
+//---------------------------------------------------------------------------
+#ifndef GPOS_CFlatHashSet_H
+#define GPOS_CFlatHashSet_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CRefCount.h"
+
+namespace gpos
+{
+// fwd declaration
+template <class T, ULONG (*HashFn)(const T *),
+		  BOOL (*EqFn)(const T *, const T *), void (*CleanupFn)(T *)>
+class CFlatHashSetIter;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CFlatHashSet
+//
+//	@doc:
+//		Open-addressing hash set, a drop-in replacement for CHashSet in sets
+//		that hold many elements; see CFlatHashMap
+//
+//---------------------------------------------------------------------------
+template <class T, ULONG (*HashFn)(const T *),
+		  BOOL (*EqFn)(const T *, const T *), void (*CleanupFn)(T *)>
+class CFlatHashSet : public CRefCount
+{
+	// fwd declaration
+	friend class CFlatHashSetIter<T, HashFn, EqFn, CleanupFn>;
+
+private:
+	// slot of the index, refers to an element by position
+	struct SSlot
+	{
+		ULONG m_hash;
+		ULONG m_pos;
+	};
+
+	// position marking unused slots
+	static const ULONG EmptySlot = gpos::ulong_max;
+
+	// smallest number of slots allocated, 2^3
+	static const ULONG MinSlots = 8;
+
+	// memory pool
+	CMemoryPool *const m_mp;
+
+	// elements in insertion order
+	T **m_elements;
+
+	// number of elements, and capacity of the elements array
+	ULONG m_size;
+	ULONG m_capacity;
+
+	// index of elements; the number of slots is a power of two, and exceeds
+	// the capacity of the elements array, so that probing always ends
+	SSlot *m_slots;
+	ULONG m_num_slots;
+
+	// shift selecting the top bits of a scrambled hash value as slot
+	ULONG m_shift;
+
+	// number of elements expected, used to size the first allocation
+	ULONG m_expected_size;
+
+	// first slot to probe for a hash value
+	ULONG
+	InitialSlot(ULONG hash) const
+	{
+		return (ULONG)(hash * 2654435769U) >> m_shift;
+	}
+
+	// find the slot of the given element, or gpos::ulong_max
+	ULONG
+	LookupSlot(const T *value, ULONG hash) const
+	{
+		if (0 == m_num_slots)
+		{
+			return gpos::ulong_max;
+		}
+
+		const ULONG mask = m_num_slots - 1;
+		for (ULONG slot = InitialSlot(hash);; slot = (slot + 1) & mask)
+		{
+			const SSlot &s = m_slots[slot];
+			if (EmptySlot == s.m_pos)
+			{
+				return gpos::ulong_max;
+			}
+
+			if (hash == s.m_hash && EqFn(m_elements[s.m_pos], value))
+			{
+				return slot;
+			}
+		}
+	}
+
+	// record the element at the given position in a free slot of the index
+	void
+	InsertSlot(ULONG hash, ULONG pos)
+	{
+		const ULONG mask = m_num_slots - 1;
+		ULONG slot = InitialSlot(hash);
+		while (EmptySlot != m_slots[slot].m_pos)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		m_slots[slot].m_hash = hash;
+		m_slots[slot].m_pos = pos;
+	}
+
+	// resize index and elements to hold the given number of elements
+	void
+	Resize(ULONG size)
+	{
+		ULONG num_slots = MinSlots;
+		ULONG shift = 32 - 3;
+		while (num_slots / 4 * 3 < size)
+		{
+			num_slots *= 2;
+			shift--;
+		}
+
+		// keep the hash values, so that elements are not hashed again
+		SSlot *old_slots = m_slots;
+		const ULONG old_num_slots = m_num_slots;
+
+		T **elements = GPOS_NEW_ARRAY(m_mp, T *, num_slots / 4 * 3);
+		for (ULONG ul = 0; ul < m_size; ul++)
+		{
+			elements[ul] = m_elements[ul];
+		}
+		GPOS_DELETE_ARRAY(m_elements);
+
+		m_elements = elements;
+		m_capacity = num_slots / 4 * 3;
+		m_slots = GPOS_NEW_ARRAY(m_mp, SSlot, num_slots);
+		m_num_slots = num_slots;
+		m_shift = shift;
+		for (ULONG ul = 0; ul < num_slots; ul++)
+		{
+			m_slots[ul].m_pos = EmptySlot;
+		}
+
+		for (ULONG ul = 0; ul < old_num_slots; ul++)
+		{
+			if (EmptySlot != old_slots[ul].m_pos)
+			{
+				InsertSlot(old_slots[ul].m_hash, old_slots[ul].m_pos);
+			}
+		}
+		GPOS_DELETE_ARRAY(old_slots);
+	}
+
+public:
+	CFlatHashSet(const CFlatHashSet<T, HashFn, EqFn, CleanupFn> &) = delete;
+
+	// ctor; the size is the number of elements expected, the set grows
+	// beyond it as needed, and allocates nothing until the first insert
+	CFlatHashSet<T, HashFn, EqFn, CleanupFn>(CMemoryPool *mp, ULONG size = 0)
+		: m_mp(mp),
+		  m_elements(nullptr),
+		  m_size(0),
+		  m_capacity(0),
+		  m_slots(nullptr),
+		  m_num_slots(0),
+		  m_shift(0),
+		  m_expected_size(size)
+	{
+	}
+
+	// dtor
+	~CFlatHashSet<T, HashFn, EqFn, CleanupFn>() override
+	{
+		for (ULONG ul = 0; ul < m_size; ul++)
+		{
+			CleanupFn(m_elements[ul]);
+		}
+
+		GPOS_DELETE_ARRAY(m_elements);
+		GPOS_DELETE_ARRAY(m_slots);
+	}
+
+	// insert an element if not present
+	BOOL
+	Insert(T *value)
+	{
+		GPOS_ASSERT(nullptr != value);
+
+		const ULONG hash = HashFn(value);
+		if (gpos::ulong_max != LookupSlot(value, hash))
+		{
+			return false;
+		}
+
+		if (m_size == m_capacity)
+		{
+			Resize(std::max(m_expected_size, 2 * m_size + 1));
+		}
+
+		m_elements[m_size] = value;
+		InsertSlot(hash, m_size);
+		m_size++;
+
+		return true;
+	}
+
+	// lookup element
+	BOOL
+	Contains(const T *value) const
+	{
+		return gpos::ulong_max != LookupSlot(value, HashFn(value));
+	}
+
+	// return number of set elements
+	ULONG
+	Size() const
+	{
+		return m_size;
+	}
+
+};	// class CFlatHashSet
+
+}  // namespace gpos
+
+#endif	// !GPOS_CFlatHashSet_H
+
+// EOF
@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CFlatHashSetIter.h
+//
+//	@doc:
+//		Open-addressing hash set iterator
+//---------------------------------------------------------------------------
+#ifndef GPOS_CFlatHashSetIter_H
+#define GPOS_CFlatHashSetIter_H
+
+#include "gpos/base.h"
+#include "gpos/common/CFlatHashSet.h"
+#include "gpos/common/CStackObject.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CFlatHashSetIter
+//
+//	@doc:
+//		Open-addressing hash set iterator, visits elements in insertion order
+//
+//---------------------------------------------------------------------------
+template <class T, ULONG (*HashFn)(const T *),
+		  BOOL (*EqFn)(const T *, const T *), void (*CleanupFn)(T *)>
+class CFlatHashSetIter : public CStackObject
+{
+	// short hand for hashset type
+	typedef CFlatHashSet<T, HashFn, EqFn, CleanupFn> TSet;
+
+private:
+	// set to iterate
+	const TSet *m_set;
+
+	// position of the current element plus one, zero before the first one
+	ULONG m_pos;
+
+public:
+	CFlatHashSetIter(const CFlatHashSetIter<T, HashFn, EqFn, CleanupFn> &) =
+		delete;
+
+	// ctor
+	CFlatHashSetIter<T, HashFn, EqFn, CleanupFn>(TSet *set)
+		: m_set(set), m_pos(0)
+	{
+		GPOS_ASSERT(nullptr != set);
+	}
+
+	// dtor
+	virtual ~CFlatHashSetIter<T, HashFn, EqFn, CleanupFn>() = default;
+
+	// advance iterator to next element
+	BOOL
+	Advance()
+	{
+		if (m_pos < m_set->m_size)
+		{
+			m_pos++;
+			return true;
+		}
+
+		return false;
+	}
+
+	// current element
+	const T *
+	Get() const
+	{
+		GPOS_ASSERT(0 < m_pos);
+		return m_set->m_elements[m_pos - 1];
+	}
+
+};	// class CFlatHashSetIter
+
+}  // namespace gpos
+
+#endif	// !GPOS_CFlatHashSetIter_H
+
+// EOF
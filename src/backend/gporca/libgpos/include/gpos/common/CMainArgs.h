@@ -55,6 +55,13 @@ public:
 	// getopt functionality
 	BOOL Getopt(CHAR *ch);
 
+	// number of arguments that follow the options; valid once Getopt
+	// returned false
+	ULONG UlOperands() const;
+
+	// argument following the options at the given position
+	const CHAR *SzOperand(ULONG ul) const;
+
 };	// class CMainArgs
 }  // namespace gpos
 
@@ -61,7 +61,8 @@ public:
 	CAutoMemoryPool(const CAutoMemoryPool &) = delete;
 
 	// ctor
-	CAutoMemoryPool(ELeakCheck leak_check_type = ElcExc);
+	CAutoMemoryPool(ELeakCheck leak_check_type = ElcExc,
+					CMemoryPool::EPoolKind kind = CMemoryPool::EpkGeneral);
 
 	// FIXME: should mark this noexcept in non-assert builds
 	// dtor
@@ -77,6 +77,9 @@ public:
 	typedef ULONG (*HashFuncPtr)(const K &);
 	typedef BOOL (*EqualFuncPtr)(const K &, const K &);
 
+	// type definition of entry filter used for targeted invalidation
+	typedef BOOL (*EntryFilterFuncPtr)(const K &, T, void *);
+
 private:
 	typedef CCacheEntry<T, K> CCacheHashTableEntry;
 
@@ -507,6 +510,60 @@ public:
 		}
 	}
 
+	// remove all entries accepted by the given filter; entries that are
+	// still referenced are marked for deletion and removed on release;
+	// returns the number of invalidated entries
+	ULONG
+	InvalidateEntries(EntryFilterFuncPtr filter_func, void *context)
+	{
+		GPOS_ASSERT(nullptr != filter_func);
+
+		ULONG num_invalidated = 0;
+		CCacheHashtableIter iter(m_hash_table);
+
+		// removing an entry moves the iterator to the next entry
+		BOOL advanced = false;
+		while (advanced || iter.Advance())
+		{
+			advanced = false;
+			CCacheHashTableEntry *entry = nullptr;
+			BOOL deleted = false;
+
+			// scope for CCacheHashtableIterAccessor
+			{
+				CCacheHashtableIterAccessor acc(iter);
+
+				entry = acc.Value();
+				if (nullptr == entry || entry->IsMarkedForDeletion() ||
+					!filter_func(entry->Key(), entry->Val(), context))
+				{
+					continue;
+				}
+
+				num_invalidated++;
+				m_cache_size -= entry->Pmp()->TotalAllocatedSize();
+
+				if (EXPECTED_REF_COUNT_FOR_DELETE == entry->RefCount())
+				{
+					acc.Remove(entry);
+					deleted = true;
+					advanced = true;
+				}
+				else
+				{
+					entry->MarkForDeletion();
+				}
+			}
+
+			if (deleted)
+			{
+				DestroyCacheEntry(entry);
+			}
+		}
+
+		return num_invalidated;
+	}
+
 	// return eviction factor (what percentage of cache size to evict)
 	float
 	GetEvictionFactor()
@@ -98,6 +98,15 @@ public:
 		EatArray = 0x7e
 	};
 
+	// how long the allocations of a pool live; managers may implement
+	// arena pools, whose allocations mostly live as long as the pool,
+	// with cheaper allocation at the expense of reusing freed memory
+	enum EPoolKind
+	{
+		EpkGeneral = 0,
+		EpkArena
+	};
+
 	// dtor
 	virtual ~CMemoryPool() = default;
 
@@ -152,6 +161,14 @@ public:
 		return 0;
 	}
 
+	// return highest total allocated size so far
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		GPOS_ASSERT(!"not supported");
+		return 0;
+	}
+
 	// requested size of allocation
 	static ULONG UserSizeOfAlloc(const void *ptr);
 
@@ -59,8 +59,8 @@ private:
 	// global instance
 	static CMemoryPoolManager *m_memory_pool_mgr;
 
-	// create new pool of given type
-	virtual CMemoryPool *NewMemoryPool();
+	// create new pool of given kind
+	virtual CMemoryPool *NewMemoryPool(CMemoryPool::EPoolKind kind);
 
 	// clean-up memory pools
 	void Cleanup();
@@ -124,7 +124,8 @@ public:
 	CMemoryPoolManager(const CMemoryPoolManager &) = delete;
 
 	// create new memory pool
-	CMemoryPool *CreateMemoryPool();
+	CMemoryPool *CreateMemoryPool(
+		CMemoryPool::EPoolKind kind = CMemoryPool::EpkGeneral);
 
 	// release memory pool
 	void Destroy(CMemoryPool *);
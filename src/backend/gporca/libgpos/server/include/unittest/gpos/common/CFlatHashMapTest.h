@@ -0,0 +1,42 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CFlatHashMapTest.h
+//
+//	@doc:
+//		Test for CFlatHashMap
+//---------------------------------------------------------------------------
+#ifndef GPOS_CFlatHashMapTest_H
+#define GPOS_CFlatHashMapTest_H
+
+#include "gpos/base.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CFlatHashMapTest
+//
+//	@doc:
+//		Static unit tests
+//
+//---------------------------------------------------------------------------
+class CFlatHashMapTest
+{
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_Basic();
+	static GPOS_RESULT EresUnittest_Ownership();
+	static GPOS_RESULT EresUnittest_Delete();
+	static GPOS_RESULT EresUnittest_Iterator();
+	static GPOS_RESULT EresUnittest_Benchmark();
+
+};	// class CFlatHashMapTest
+}  // namespace gpos
+
+#endif	// !GPOS_CFlatHashMapTest_H
+
+// EOF
@@ -0,0 +1,40 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CFlatHashSetTest.h
+//
+//	@doc:
+//		Test for CFlatHashSet
+//---------------------------------------------------------------------------
+#ifndef GPOS_CFlatHashSetTest_H
+#define GPOS_CFlatHashSetTest_H
+
+#include "gpos/base.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CFlatHashSetTest
+//
+//	@doc:
+//		Static unit tests
+//
+//---------------------------------------------------------------------------
+class CFlatHashSetTest
+{
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_Basic();
+	static GPOS_RESULT EresUnittest_Ownership();
+	static GPOS_RESULT EresUnittest_Iterator();
+
+};	// class CFlatHashSetTest
+}  // namespace gpos
+
+#endif	// !GPOS_CFlatHashSetTest_H
+
+// EOF
@@ -0,0 +1,54 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2021 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CSyncPoolTest.h
+//
+//	@doc:
+//		Tests for CSyncPool
+//---------------------------------------------------------------------------
+#ifndef GPOS_CSyncPoolTest_H
+#define GPOS_CSyncPoolTest_H
+
+#include "gpos/common/CSyncPool.h"
+#include "gpos/types.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CSyncPoolTest
+//
+//	@doc:
+//		Static unit tests for object pool
+//
+//---------------------------------------------------------------------------
+class CSyncPoolTest
+{
+private:
+	// pool element
+	struct SElem
+	{
+		// object id, set by the pool
+		ULONG m_id{0};
+
+		// payload
+		ULONG m_ulData{0};
+
+		// ctor
+		SElem() = default;
+	};
+
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_Basics();
+	static GPOS_RESULT EresUnittest_Overflow();
+
+};	// class CSyncPoolTest
+}  // namespace gpos
+
+#endif	// !GPOS_CSyncPoolTest_H
+
+// EOF
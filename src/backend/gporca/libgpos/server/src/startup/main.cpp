@@ -26,6 +26,8 @@
 #include "unittest/gpos/common/CDoubleTest.h"
 #include "unittest/gpos/common/CDynamicPtrArrayTest.h"
 #include "unittest/gpos/common/CEnumSetTest.h"
+#include "unittest/gpos/common/CFlatHashMapTest.h"
+#include "unittest/gpos/common/CFlatHashSetTest.h"
 #include "unittest/gpos/common/CHashMapIterTest.h"
 #include "unittest/gpos/common/CHashMapTest.h"
 #include "unittest/gpos/common/CHashSetIterTest.h"
@@ -35,6 +37,7 @@
 #include "unittest/gpos/common/CStackTest.h"
 #include "unittest/gpos/common/CSyncHashtableTest.h"
 #include "unittest/gpos/common/CSyncListTest.h"
+#include "unittest/gpos/common/CSyncPoolTest.h"
 #include "unittest/gpos/error/CErrorHandlerTest.h"
 #include "unittest/gpos/error/CExceptionTest.h"
 #include "unittest/gpos/error/CLoggerTest.h"
@@ -71,11 +74,14 @@ static gpos::CUnittest rgut[] = {
 	GPOS_UNITTEST_STD(CHashMapIterTest),
 	GPOS_UNITTEST_STD(CHashSetTest),
 	GPOS_UNITTEST_STD(CHashSetIterTest),
+	GPOS_UNITTEST_STD(CFlatHashMapTest),
+	GPOS_UNITTEST_STD(CFlatHashSetTest),
 	GPOS_UNITTEST_STD(CRefCountTest),
 	GPOS_UNITTEST_STD(CListTest),
 	GPOS_UNITTEST_STD(CStackTest),
 	GPOS_UNITTEST_STD(CSyncHashtableTest),
 	GPOS_UNITTEST_STD(CSyncListTest),
+	GPOS_UNITTEST_STD(CSyncPoolTest),
 
 	// error
 	GPOS_UNITTEST_STD(CErrorHandlerTest),
@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/string/CWStringDynamic.h"
@@ -35,7 +36,9 @@ CBitSetTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Basics),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Removal),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_SetOps),
-		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Performance)};
+		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Sparse),
+		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Performance),
+		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_SetOpsPerformance)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
 }
@@ -249,4 +252,145 @@ CBitSetTest::EresUnittest_Performance()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CBitSetTest::EresUnittest_Sparse
+//
+//	@doc:
+//		Set operations on sets whose bits are far apart, or far from zero
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CBitSetTest::EresUnittest_Sparse()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG rgulHigh[] = {100000, 100063, 100064, 100500};
+	ULONG rgulLow[] = {0, 63, 64, 1000};
+
+	CBitSet *pbsHigh = GPOS_NEW(mp) CBitSet(mp);
+	CBitSet *pbsLow = GPOS_NEW(mp) CBitSet(mp);
+	for (ULONG i = 0; i < GPOS_ARRAY_SIZE(rgulHigh); i++)
+	{
+		GPOS_ASSERT(!pbsHigh->ExchangeSet(rgulHigh[i]));
+		GPOS_ASSERT(pbsHigh->ExchangeSet(rgulHigh[i]));
+		(void) pbsLow->ExchangeSet(rgulLow[i]);
+	}
+	GPOS_ASSERT(pbsLow->IsDisjoint(pbsHigh));
+	GPOS_ASSERT(!pbsLow->Get(100000) && !pbsHigh->Get(0));
+
+	// a set growing below its lowest bit
+	CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, *pbsHigh);
+	pbs->Union(pbsLow);
+	GPOS_ASSERT(GPOS_ARRAY_SIZE(rgulHigh) + GPOS_ARRAY_SIZE(rgulLow) ==
+				pbs->Size());
+	GPOS_ASSERT(pbs->ContainsAll(pbsHigh) && pbs->ContainsAll(pbsLow));
+	GPOS_ASSERT(!pbsHigh->ContainsAll(pbs));
+
+	// bits are visited in ascending order
+	ULONG ulPrev = 0;
+	ULONG ulCount = 0;
+	CBitSetIter bsi(*pbs);
+	while (bsi.Advance())
+	{
+		GPOS_ASSERT(0 == ulCount || ulPrev < bsi.Bit());
+		ulPrev = bsi.Bit();
+		ulCount++;
+	}
+	GPOS_ASSERT(pbs->Size() == ulCount);
+
+	// equal sets have equal hash values, however they were built
+	CBitSet *pbsCopy = GPOS_NEW(mp) CBitSet(mp, *pbs);
+	pbsCopy->Difference(pbsLow);
+	GPOS_ASSERT(pbsCopy->Equals(pbsHigh) && pbsHigh->Equals(pbsCopy));
+	GPOS_ASSERT(pbsCopy->HashValue() == pbsHigh->HashValue());
+
+	pbs->Intersection(pbsLow);
+	GPOS_ASSERT(pbs->Equals(pbsLow));
+	GPOS_ASSERT(pbs->HashValue() == pbsLow->HashValue());
+
+	for (ULONG i = 0; i < GPOS_ARRAY_SIZE(rgulLow); i++)
+	{
+		GPOS_ASSERT(pbs->ExchangeClear(rgulLow[i]));
+	}
+	GPOS_ASSERT(0 == pbs->Size());
+
+	CBitSet *pbsEmpty = GPOS_NEW(mp) CBitSet(mp);
+	GPOS_ASSERT(pbs->Equals(pbsEmpty));
+	GPOS_ASSERT(pbs->HashValue() == pbsEmpty->HashValue());
+
+	pbsEmpty->Release();
+	pbsCopy->Release();
+	pbs->Release();
+	pbsLow->Release();
+	pbsHigh->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBitSetTest::EresUnittest_SetOpsPerformance
+//
+//	@doc:
+//		Simple perf test -- simulates column reference sets compared and
+//		combined by the join order enumerators
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CBitSetTest::EresUnittest_SetOpsPerformance()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG ulSets = 64;
+	const ULONG ulColsPerSet = 40;
+
+	CBitSet *rgpbs[ulSets];
+	for (ULONG i = 0; i < ulSets; i++)
+	{
+		rgpbs[i] = GPOS_NEW(mp) CBitSet(mp);
+		for (ULONG j = 0; j < ulColsPerSet; j++)
+		{
+			(void) rgpbs[i]->ExchangeSet(i * 16 + j * 3);
+		}
+	}
+
+	ULONG ulMatches = 0;
+	for (ULONG ulRound = 0; ulRound < 20; ulRound++)
+	{
+		for (ULONG i = 0; i < ulSets; i++)
+		{
+			for (ULONG j = 0; j < ulSets; j++)
+			{
+				CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, *rgpbs[i]);
+				pbs->Union(rgpbs[j]);
+				if (pbs->ContainsAll(rgpbs[j]) && !pbs->IsDisjoint(rgpbs[i]))
+				{
+					ulMatches++;
+				}
+				if (pbs->Equals(rgpbs[i]))
+				{
+					ulMatches++;
+				}
+				pbs->Intersection(rgpbs[j]);
+				ulMatches += pbs->Size() + (pbs->HashValue() & 1);
+				pbs->Release();
+			}
+		}
+	}
+	GPOS_ASSERT(0 < ulMatches);
+
+	for (ULONG i = 0; i < ulSets; i++)
+	{
+		rgpbs[i]->Release();
+	}
+
+	return GPOS_OK;
+}
+
 // EOF
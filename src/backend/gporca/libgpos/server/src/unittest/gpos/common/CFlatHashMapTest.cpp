@@ -0,0 +1,371 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CFlatHashMapTest.cpp
+//
+//	@doc:
+//		Test for CFlatHashMap
+//---------------------------------------------------------------------------
+
+#include "unittest/gpos/common/CFlatHashMapTest.h"
+
+#include "gpos/base.h"
+#include "gpos/common/CAutoTimer.h"
+#include "gpos/common/CFlatHashMap.h"
+#include "gpos/common/CFlatHashMapIter.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+using namespace gpos;
+
+// number of keys used by the microbenchmark
+#define GPOS_FLAT_HASH_MAP_BENCHMARK_KEYS 50000
+
+// number of lookups of each key done by the microbenchmark
+#define GPOS_FLAT_HASH_MAP_BENCHMARK_ROUNDS 4
+
+// map types used in the tests
+typedef CFlatHashMap<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+					 CleanupDelete<ULONG>, CleanupDelete<ULONG> >
+	UlongToUlongFlatMap;
+
+typedef CFlatHashMapIter<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+						 CleanupDelete<ULONG>, CleanupDelete<ULONG> >
+	UlongToUlongFlatMapIter;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashMapTest::EresUnittest
+//
+//	@doc:
+//		Unittest for open-addressing hash map
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashMapTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(CFlatHashMapTest::EresUnittest_Basic),
+		GPOS_UNITTEST_FUNC(CFlatHashMapTest::EresUnittest_Ownership),
+		GPOS_UNITTEST_FUNC(CFlatHashMapTest::EresUnittest_Delete),
+		GPOS_UNITTEST_FUNC(CFlatHashMapTest::EresUnittest_Iterator),
+		GPOS_UNITTEST_FUNC(CFlatHashMapTest::EresUnittest_Benchmark),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashMapTest::EresUnittest_Basic
+//
+//	@doc:
+//		Basic insertion/lookup/replacement
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashMapTest::EresUnittest_Basic()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// test with CHAR array
+	ULONG_PTR rgul[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+	CHAR rgsz[][5] = {"abc",  "def", "ghi", "qwe", "wer",
+					  "wert", "dfg", "xcv", "zxc"};
+
+	GPOS_ASSERT(GPOS_ARRAY_SIZE(rgul) == GPOS_ARRAY_SIZE(rgsz));
+	const ULONG ulCnt = GPOS_ARRAY_SIZE(rgul);
+
+	typedef CFlatHashMap<ULONG_PTR, CHAR, HashPtr<ULONG_PTR>,
+						 gpos::Equals<ULONG_PTR>, CleanupNULL<ULONG_PTR>,
+						 CleanupNULL<CHAR> >
+		UlongPtrToCharMap;
+
+	// start small, so that inserting grows the map several times
+	UlongPtrToCharMap *phm = GPOS_NEW(mp) UlongPtrToCharMap(mp);
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		BOOL fSuccess GPOS_ASSERTS_ONLY =
+			phm->Insert(&rgul[i], (CHAR *) rgsz[i]);
+		GPOS_ASSERT(fSuccess);
+
+		for (ULONG j = 0; j <= i; ++j)
+		{
+			GPOS_ASSERT(rgsz[j] == phm->Find(&rgul[j]));
+		}
+	}
+	GPOS_ASSERT(ulCnt == phm->Size());
+
+	// test replacing entry values of existing keys
+	CHAR rgszNew[][10] = {"abc_",  "def_", "ghi_", "qwe_", "wer_",
+						  "wert_", "dfg_", "xcv_", "zxc_"};
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		BOOL fSuccess GPOS_ASSERTS_ONLY = phm->Replace(&rgul[i], rgszNew[i]);
+		GPOS_ASSERT(fSuccess);
+		GPOS_ASSERT(rgszNew[i] == phm->Find(&rgul[i]));
+	}
+	GPOS_ASSERT(ulCnt == phm->Size());
+
+	// test replacing entry value of a non-existing key
+	ULONG_PTR ulp = 0;
+	BOOL fSuccess GPOS_ASSERTS_ONLY = phm->Replace(&ulp, rgsz[0]);
+	GPOS_ASSERT(!fSuccess);
+	GPOS_ASSERT(nullptr == phm->Find(&ulp));
+
+	phm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashMapTest::EresUnittest_Ownership
+//
+//	@doc:
+//		Hash map test with ownership; the memory pool checks that keys and
+//		values are destroyed
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashMapTest::EresUnittest_Ownership()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG ulCnt = 256;
+
+	UlongToUlongFlatMap *phm = GPOS_NEW(mp) UlongToUlongFlatMap(mp, 32);
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		ULONG *pulKey = GPOS_NEW(mp) ULONG(i);
+		ULONG *pulVal = GPOS_NEW(mp) ULONG(i);
+
+		BOOL fSuccess GPOS_ASSERTS_ONLY = phm->Insert(pulKey, pulVal);
+
+		GPOS_ASSERT(fSuccess);
+		GPOS_ASSERT(pulVal == phm->Find(pulKey));
+
+		// can't insert existing keys
+		GPOS_ASSERT(!phm->Insert(pulKey, pulVal));
+	}
+
+	// replaced values are destroyed
+	for (ULONG i = 0; i < ulCnt; i += 2)
+	{
+		BOOL fSuccess GPOS_ASSERTS_ONLY =
+			phm->Replace(&i, GPOS_NEW(mp) ULONG(i + 1));
+		GPOS_ASSERT(fSuccess);
+		GPOS_ASSERT(i + 1 == *phm->Find(&i));
+	}
+
+	phm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashMapTest::EresUnittest_Delete
+//
+//	@doc:
+//		Deleting entries, and reusing their space
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashMapTest::EresUnittest_Delete()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG ulCnt = 1000;
+
+	UlongToUlongFlatMap *phm = GPOS_NEW(mp) UlongToUlongFlatMap(mp);
+
+	// repeatedly fill the map and delete all but a few entries, so that
+	// deleted entries are dropped when the map is resized
+	for (ULONG ulRound = 0; ulRound < 4; ulRound++)
+	{
+		// the entries kept by the previous round are not inserted again
+		for (ULONG i = 0; i < ulCnt; ++i)
+		{
+			if (nullptr == phm->Find(&i))
+			{
+				(void) phm->Insert(GPOS_NEW(mp) ULONG(i),
+								   GPOS_NEW(mp) ULONG(i));
+			}
+		}
+		GPOS_ASSERT(ulCnt == phm->Size());
+
+		for (ULONG i = 0; i < ulCnt; ++i)
+		{
+			if (0 != i % 10)
+			{
+				BOOL fSuccess GPOS_ASSERTS_ONLY = phm->Delete(&i);
+				GPOS_ASSERT(fSuccess);
+				GPOS_ASSERT(!phm->Delete(&i));
+			}
+		}
+		GPOS_ASSERT(ulCnt / 10 == phm->Size());
+
+		for (ULONG i = 0; i < ulCnt; ++i)
+		{
+			GPOS_ASSERT_IMP(0 == i % 10, i == *phm->Find(&i));
+			GPOS_ASSERT_IMP(0 != i % 10, nullptr == phm->Find(&i));
+		}
+	}
+
+	phm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashMapTest::EresUnittest_Iterator
+//
+//	@doc:
+//		Iteration visits live entries in insertion order
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashMapTest::EresUnittest_Iterator()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG ulCnt = 100;
+
+	UlongToUlongFlatMap *phm = GPOS_NEW(mp) UlongToUlongFlatMap(mp);
+
+#ifdef GPOS_DEBUG
+	// iteration over empty map
+	UlongToUlongFlatMapIter miEmpty(phm);
+	GPOS_ASSERT(!miEmpty.Advance());
+#endif	// GPOS_DEBUG
+
+	// insert keys in descending order, then delete odd keys
+	for (ULONG i = ulCnt; i > 0; --i)
+	{
+		(void) phm->Insert(GPOS_NEW(mp) ULONG(i), GPOS_NEW(mp) ULONG(2 * i));
+	}
+	for (ULONG i = 1; i <= ulCnt; i += 2)
+	{
+		(void) phm->Delete(&i);
+	}
+
+	ULONG ulExpected = ulCnt;
+	UlongToUlongFlatMapIter mi(phm);
+	while (mi.Advance())
+	{
+		if (ulExpected != *mi.Key() || 2 * ulExpected != *mi.Value())
+		{
+			phm->Release();
+			return GPOS_FAILED;
+		}
+		ulExpected -= 2;
+	}
+	GPOS_ASSERT(0 == ulExpected);
+
+	phm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashMapTest::EresUnittest_Benchmark
+//
+//	@doc:
+//		Microbenchmark comparing insertion and lookup times of CHashMap and
+//		CFlatHashMap with a number of keys typical of large memos; timings
+//		are printed, and the test fails only if the maps disagree
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashMapTest::EresUnittest_Benchmark()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG ulCnt = GPOS_FLAT_HASH_MAP_BENCHMARK_KEYS;
+
+	// scatter the keys, as pointer and column id hashes would be
+	ULONG *rgulKeys = GPOS_NEW_ARRAY(mp, ULONG, ulCnt);
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		rgulKeys[i] = i * 7919;
+	}
+
+	typedef CHashMap<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+					 CleanupNULL<ULONG>, CleanupNULL<ULONG> >
+		ChainedMap;
+	typedef CFlatHashMap<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+						 CleanupNULL<ULONG>, CleanupNULL<ULONG> >
+		FlatMap;
+
+	ULLONG ullSumChained = 0;
+	{
+		CAutoTimer at("CHashMap insert and lookup", true /*fPrint*/);
+
+		ChainedMap *phm = GPOS_NEW(mp) ChainedMap(mp);
+		for (ULONG i = 0; i < ulCnt; ++i)
+		{
+			(void) phm->Insert(&rgulKeys[i], &rgulKeys[i]);
+		}
+		for (ULONG ulRound = 0; ulRound < GPOS_FLAT_HASH_MAP_BENCHMARK_ROUNDS;
+			 ulRound++)
+		{
+			for (ULONG i = 0; i < ulCnt; ++i)
+			{
+				ullSumChained += *phm->Find(&rgulKeys[i]);
+			}
+		}
+		phm->Release();
+	}
+
+	ULLONG ullSumFlat = 0;
+	{
+		CAutoTimer at("CFlatHashMap insert and lookup", true /*fPrint*/);
+
+		FlatMap *phm = GPOS_NEW(mp) FlatMap(mp);
+		for (ULONG i = 0; i < ulCnt; ++i)
+		{
+			(void) phm->Insert(&rgulKeys[i], &rgulKeys[i]);
+		}
+		for (ULONG ulRound = 0; ulRound < GPOS_FLAT_HASH_MAP_BENCHMARK_ROUNDS;
+			 ulRound++)
+		{
+			for (ULONG i = 0; i < ulCnt; ++i)
+			{
+				ullSumFlat += *phm->Find(&rgulKeys[i]);
+			}
+		}
+		phm->Release();
+	}
+
+	GPOS_DELETE_ARRAY(rgulKeys);
+
+	if (ullSumChained != ullSumFlat)
+	{
+		return GPOS_FAILED;
+	}
+
+	return GPOS_OK;
+}
+
+// EOF
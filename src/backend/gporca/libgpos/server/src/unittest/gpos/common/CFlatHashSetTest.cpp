@@ -0,0 +1,188 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CFlatHashSetTest.cpp
+//
+//	@doc:
+//		Test for CFlatHashSet
+//---------------------------------------------------------------------------
+
+#include "unittest/gpos/common/CFlatHashSetTest.h"
+
+#include "gpos/base.h"
+#include "gpos/common/CFlatHashSet.h"
+#include "gpos/common/CFlatHashSetIter.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashSetTest::EresUnittest
+//
+//	@doc:
+//		Unittest for open-addressing hash set
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashSetTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(CFlatHashSetTest::EresUnittest_Basic),
+		GPOS_UNITTEST_FUNC(CFlatHashSetTest::EresUnittest_Ownership),
+		GPOS_UNITTEST_FUNC(CFlatHashSetTest::EresUnittest_Iterator),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashSetTest::EresUnittest_Basic
+//
+//	@doc:
+//		Basic insertion/lookup test
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashSetTest::EresUnittest_Basic()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// test with ULONG array
+	ULONG_PTR rgul[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	ULONG_PTR rgulMissing[] = {10, 11, 12};
+
+	const ULONG ulCnt = GPOS_ARRAY_SIZE(rgul);
+
+	typedef CFlatHashSet<ULONG_PTR, HashPtr<ULONG_PTR>, Equals<ULONG_PTR>,
+						 CleanupNULL<ULONG_PTR> >
+		UlongPtrHashSet;
+
+	UlongPtrHashSet *phs = GPOS_NEW(mp) UlongPtrHashSet(mp);
+	for (ULONG ul = 0; ul < ulCnt; ul++)
+	{
+		BOOL fSuccess GPOS_ASSERTS_ONLY = phs->Insert(&rgul[ul]);
+		GPOS_ASSERT(fSuccess);
+		GPOS_ASSERT(!phs->Insert(&rgul[ul]));
+	}
+	GPOS_ASSERT(ulCnt == phs->Size());
+
+	for (ULONG ul = 0; ul < ulCnt; ul++)
+	{
+		GPOS_ASSERT(phs->Contains(&rgul[ul]));
+	}
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgulMissing); ul++)
+	{
+		GPOS_ASSERT(!phs->Contains(&rgulMissing[ul]));
+	}
+
+	phs->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashSetTest::EresUnittest_Ownership
+//
+//	@doc:
+//		Hash set test with ownership
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashSetTest::EresUnittest_Ownership()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG ulCnt = 256;
+
+	typedef CFlatHashSet<ULONG, HashValue<ULONG>, Equals<ULONG>,
+						 CleanupDelete<ULONG> >
+		UlongHashSet;
+
+	UlongHashSet *phs = GPOS_NEW(mp) UlongHashSet(mp, 32);
+	for (ULONG ul = 0; ul < ulCnt; ul++)
+	{
+		ULONG *pul = GPOS_NEW(mp) ULONG(ul);
+
+		BOOL fSuccess GPOS_ASSERTS_ONLY = phs->Insert(pul);
+
+		GPOS_ASSERT(fSuccess);
+		GPOS_ASSERT(phs->Contains(pul));
+	}
+	GPOS_ASSERT(ulCnt == phs->Size());
+
+	phs->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFlatHashSetTest::EresUnittest_Iterator
+//
+//	@doc:
+//		Iteration visits elements in insertion order
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CFlatHashSetTest::EresUnittest_Iterator()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG rgul[] = {9, 3, 7, 1, 8, 2, 6, 4, 5, 0};
+	const ULONG ulCnt = GPOS_ARRAY_SIZE(rgul);
+
+	typedef CFlatHashSet<ULONG, HashValue<ULONG>, Equals<ULONG>,
+						 CleanupNULL<ULONG> >
+		UlongHashSet;
+	typedef CFlatHashSetIter<ULONG, HashValue<ULONG>, Equals<ULONG>,
+							 CleanupNULL<ULONG> >
+		UlongHashSetIter;
+
+	UlongHashSet *phs = GPOS_NEW(mp) UlongHashSet(mp);
+
+#ifdef GPOS_DEBUG
+	// iteration over empty set
+	UlongHashSetIter hsiEmpty(phs);
+	GPOS_ASSERT(!hsiEmpty.Advance());
+#endif	// GPOS_DEBUG
+
+	for (ULONG ul = 0; ul < ulCnt; ul++)
+	{
+		(void) phs->Insert(&rgul[ul]);
+	}
+
+	ULONG ulPos = 0;
+	UlongHashSetIter hsi(phs);
+	while (hsi.Advance())
+	{
+		if (ulPos == ulCnt || &rgul[ulPos] != hsi.Get())
+		{
+			phs->Release();
+			return GPOS_FAILED;
+		}
+		ulPos++;
+	}
+	GPOS_ASSERT(ulCnt == ulPos);
+
+	phs->Release();
+
+	return GPOS_OK;
+}
+
+// EOF
@@ -0,0 +1,138 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2021 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CSyncPoolTest.cpp
+//
+//	@doc:
+//		Tests for CSyncPool
+//---------------------------------------------------------------------------
+
+#include "unittest/gpos/common/CSyncPoolTest.h"
+
+#include "gpos/base.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+#define GPOS_SPOOL_SIZE 10
+
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSyncPoolTest::EresUnittest
+//
+//	@doc:
+//		Unittest for object pool
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSyncPoolTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(CSyncPoolTest::EresUnittest_Basics),
+		GPOS_UNITTEST_FUNC(CSyncPoolTest::EresUnittest_Overflow),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSyncPoolTest::EresUnittest_Basics
+//
+//	@doc:
+//		Retrieve and recycle preallocated objects
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSyncPoolTest::EresUnittest_Basics()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CSyncPool<SElem> spool(mp, GPOS_SPOOL_SIZE);
+	spool.Init(GPOS_OFFSET(SElem, m_id));
+
+	SElem *rgpelem[GPOS_SPOOL_SIZE];
+
+	// objects are handed out in array order
+	for (ULONG i = 0; i < GPOS_SPOOL_SIZE; i++)
+	{
+		rgpelem[i] = spool.PtRetrieve();
+		GPOS_RTL_ASSERT(i == rgpelem[i]->m_id);
+
+		rgpelem[i]->m_ulData = i;
+	}
+
+	// recycled objects are reused in LIFO order
+	spool.Recycle(rgpelem[3]);
+	spool.Recycle(rgpelem[7]);
+	GPOS_RTL_ASSERT(rgpelem[7] == spool.PtRetrieve());
+	GPOS_RTL_ASSERT(rgpelem[3] == spool.PtRetrieve());
+
+	for (ULONG i = 0; i < GPOS_SPOOL_SIZE; i++)
+	{
+		GPOS_RTL_ASSERT(i == rgpelem[i]->m_ulData);
+		spool.Recycle(rgpelem[i]);
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSyncPoolTest::EresUnittest_Overflow
+//
+//	@doc:
+//		Retrieve more objects than preallocated
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSyncPoolTest::EresUnittest_Overflow()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CSyncPool<SElem> spool(mp, GPOS_SPOOL_SIZE);
+	spool.Init(GPOS_OFFSET(SElem, m_id));
+
+	const ULONG ulElems = 2 * GPOS_SPOOL_SIZE;
+	SElem *rgpelem[ulElems];
+
+	for (ULONG i = 0; i < ulElems; i++)
+	{
+		rgpelem[i] = spool.PtRetrieve();
+		GPOS_RTL_ASSERT(nullptr != rgpelem[i]);
+
+		// objects beyond the preallocated array have no id
+		GPOS_RTL_ASSERT(GPOS_SPOOL_SIZE > i ||
+						gpos::ulong_max == rgpelem[i]->m_id);
+	}
+
+	// recycling overflow objects releases them
+	for (ULONG i = 0; i < ulElems; i++)
+	{
+		spool.Recycle(rgpelem[ulElems - i - 1]);
+	}
+
+	// preallocated objects are available again
+	for (ULONG i = 0; i < GPOS_SPOOL_SIZE; i++)
+	{
+		rgpelem[i] = spool.PtRetrieve();
+		GPOS_RTL_ASSERT(i == rgpelem[i]->m_id);
+	}
+
+	for (ULONG i = 0; i < GPOS_SPOOL_SIZE; i++)
+	{
+		spool.Recycle(rgpelem[i]);
+	}
+
+	return GPOS_OK;
+}
+
+
+// EOF
@@ -47,7 +47,8 @@ CCacheTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Eviction),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Iteration),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_DeepObject),
-		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion)};
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion),
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Invalidation)};
 
 	fUnique = true;
 	GPOS_RESULT eres = CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -62,6 +63,25 @@ CCacheTest::EresUnittest()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::SSimpleObject::FEvenKey
+//
+//	@doc:
+//		Entry filter accepting objects with even keys
+//
+//---------------------------------------------------------------------------
+BOOL
+CCacheTest::SSimpleObject::FEvenKey(ULONG *const &pvKey, SSimpleObject *pso,
+									void *  // pvContext
+)
+{
+	GPOS_ASSERT(*pvKey == pso->m_ulKey);
+
+	return 0 == *pvKey % 2;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCacheTest::SSimpleObject::FMyEqual
@@ -985,4 +1005,66 @@ CCacheTest::EresUnittest_IterativeDeletion()
 	return GPOS_OK;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::EresUnittest_Invalidation
+//
+//	@doc:
+//		Targeted invalidation of cache entries
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CCacheTest::EresUnittest_Invalidation()
+{
+	CAutoP<CCache<SSimpleObject *, ULONG *> > apcache;
+	apcache = CCacheFactory::CreateCache<SSimpleObject *, ULONG *>(
+		fUnique, UNLIMITED_CACHE_QUOTA, SSimpleObject::UlMyHash,
+		SSimpleObject::FMyEqual);
+
+	CCache<SSimpleObject *, ULONG *> *pcache = apcache.Value();
+
+	CCacheTest::EresInsertDuplicates(pcache);
+
+	ULONG ulDuplicates = 1;
+	if (!pcache->AllowsDuplicateKeys())
+	{
+		ulDuplicates = GPOS_CACHE_DUPLICATES;
+	}
+
+	ULLONG ullSizeBefore GPOS_ASSERTS_ONLY = pcache->TotalAllocatedSize();
+
+	// invalidate all entries with even keys
+	ULONG ulInvalidated =
+		pcache->InvalidateEntries(SSimpleObject::FEvenKey, nullptr);
+
+	GPOS_RTL_ASSERT(ulInvalidated == ulDuplicates * GPOS_CACHE_ELEMENTS / 2);
+	GPOS_RTL_ASSERT(pcache->Size() == ulDuplicates * GPOS_CACHE_ELEMENTS / 2);
+	GPOS_ASSERT(pcache->TotalAllocatedSize() < ullSizeBefore);
+
+	for (ULONG i = 0; i < GPOS_CACHE_ELEMENTS; i++)
+	{
+		GPOS_CHECK_ABORT;
+
+		CSimpleObjectCacheAccessor ca(pcache);
+		ca.Lookup(&i);
+		SSimpleObject *pso = ca.Val();
+
+		GPOS_RTL_ASSERT((0 == i % 2) == (nullptr == pso));
+
+		if (nullptr != pso)
+		{
+			// release object since there is no customer to release it after lookup and before CCache's cleanup
+			pso->Release();
+		}
+	}
+
+	// nothing left to invalidate
+	GPOS_RTL_ASSERT(0 ==
+					pcache->InvalidateEntries(SSimpleObject::FEvenKey, nullptr));
+
+	return GPOS_OK;
+}
+
+
 // EOF
@@ -8,14 +8,16 @@
 //	@doc:
 //		Implementation of bit sets
 //
-//		Underlying assumption: a set contains only a few links of bitvectors
-//		hence, keeping them in a linked list is efficient;
+//		Underlying assumption: the bits of a set are clustered, as column
+//		ids of a few tables or atoms of a join are, hence storing the range
+//		between the lowest and the highest bit as contiguous words is both
+//		compact and fast to combine; the word loops below are kept simple
+//		so that compilers can vectorize them
 //---------------------------------------------------------------------------
 
 #include "gpos/common/CBitSet.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 #include "gpos/common/CBitSetIter.h"
 
 #ifdef GPOS_DEBUG
@@ -26,204 +28,162 @@ using namespace gpos;
 
 FORCE_GENERATE_DBGSTR(CBitSet);
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSetLink
-//
-//	@doc:
-//		ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, ULONG offset,
-								  ULONG vector_size)
-	: m_offset(offset)
-{
-	m_vec = GPOS_NEW(mp) CBitVector(mp, vector_size);
-}
+// number of bits in a word
+#define GPOS_BITSET_WORD_BITS 64
 
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSetLink
-//
-//	@doc:
-//		copy ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, const CBitSetLink &bsl)
-	: m_offset(bsl.m_offset)
+// number of set bits in a word
+static inline ULONG
+CountBits(ULLONG word)
 {
-	m_vec = GPOS_NEW(mp) CBitVector(mp, *bsl.GetVec());
+#if defined(__GNUC__)
+	return (ULONG) __builtin_popcountll(word);
+#else
+	ULONG count = 0;
+	for (; 0 != word; count++)
+	{
+		word &= (word - 1);
+	}
+	return count;
+#endif
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		~CBitSetLink
+//		CBitSet::CBitSet
 //
 //	@doc:
 //		ctor
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSetLink::~CBitSetLink()
+CBitSet::CBitSet(CMemoryPool *mp, ULONG)
+	: m_mp(mp),
+	  m_words(m_inline_words),
+	  m_first_word(0),
+	  m_num_words(0),
+	  m_capacity(InlineWords),
+	  m_size(0)
 {
-	GPOS_DELETE(m_vec);
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::FindLinkByOffset
+//		CBitSet::CBitSet
 //
 //	@doc:
-//		Find bit set link for a given offset; if non-existent return previous
-//		link (may be NULL);
-//		By providing a starting link we can implement a number of operations
-//		in one sweep, ie O(N)
+//		copy ctor;
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSetLink *
-CBitSet::FindLinkByOffset(ULONG offset, CBitSetLink *bsl) const
+CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs)
+	: m_mp(mp),
+	  m_words(m_inline_words),
+	  m_first_word(0),
+	  m_num_words(0),
+	  m_capacity(InlineWords),
+	  m_size(0)
 {
-	CBitSetLink *found = nullptr;
-	CBitSetLink *cursor = bsl;
-
-	if (nullptr == bsl)
-	{
-		// if no cursor provided start with first element
-		cursor = m_bsllist.First();
-	}
-	else
-	{
-		GPOS_ASSERT(bsl->GetOffset() <= offset && "invalid start cursor");
-		found = bsl;
-	}
-
-	GPOS_ASSERT_IMP(nullptr != cursor,
-					GPOS_OK == m_bsllist.Find(cursor) && "cursor not in list");
-
-	while (1)
-	{
-		// no more links or we've overshot the target
-		if (nullptr == cursor || cursor->GetOffset() > offset)
-		{
-			break;
-		}
-
-		found = cursor;
-		cursor = m_bsllist.Next(cursor);
-	}
-
-	GPOS_ASSERT_IMP(found, found->GetOffset() <= offset);
-	return found;
+	Union(&bs);
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::RecomputeSize
+//		CBitSet::~CBitSet
 //
 //	@doc:
-//		Compute size of set by adding up sizes of links
+//		dtor
 //
 //---------------------------------------------------------------------------
-void
-CBitSet::RecomputeSize()
+CBitSet::~CBitSet()
 {
-	m_size = 0;
-	CBitSetLink *bsl = nullptr;
-
-	for (bsl = m_bsllist.First(); bsl != nullptr; bsl = m_bsllist.Next(bsl))
+	if (m_words != m_inline_words)
 	{
-		m_size += bsl->GetVec()->CountSetBits();
+		GPOS_DELETE_ARRAY(m_words);
 	}
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::Clear
+//		CBitSet::EnsureWords
 //
 //	@doc:
-//		release all links
+//		Extend the stored range of words to include the given range, moving
+//		the words to a larger array if they do not fit
 //
 //---------------------------------------------------------------------------
 void
-CBitSet::Clear()
+CBitSet::EnsureWords(ULONG first_word, ULONG end_word)
 {
-	CBitSetLink *bsl = nullptr;
+	GPOS_ASSERT(first_word < end_word);
 
-	while (nullptr != (bsl = m_bsllist.First()))
+	if (0 == m_num_words)
 	{
-		CBitSetLink *bsl_to_remove = bsl;
-		bsl = m_bsllist.Next(bsl);
-
-		m_bsllist.Remove(bsl_to_remove);
-		GPOS_DELETE(bsl_to_remove);
+		m_first_word = first_word;
 	}
 
-	RecomputeSize();
-}
-
+	const ULONG new_first = std::min(m_first_word, first_word);
+	const ULONG new_end = std::max(m_first_word + m_num_words, end_word);
+	if (new_first == m_first_word && new_end == m_first_word + m_num_words)
+	{
+		return;
+	}
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::GetOffset
-//
-//	@doc:
-//		Compute offset
-//
-//---------------------------------------------------------------------------
-ULONG
-CBitSet::ComputeOffset(ULONG ul) const
-{
-	return (ul / m_vector_size) * m_vector_size;
-}
+	const ULONG new_num_words = new_end - new_first;
+	const ULONG shift = m_first_word - new_first;
+	ULLONG *words = m_words;
+	if (new_num_words > m_capacity)
+	{
+		m_capacity = std::max(new_num_words, 2 * m_capacity);
+		words = GPOS_NEW_ARRAY(m_mp, ULLONG, m_capacity);
+	}
 
+	// move the current words into place, copying backwards since they may
+	// only move up within the same array, then clear the words before and
+	// after them
+	for (ULONG ul = m_num_words; ul > 0; ul--)
+	{
+		words[shift + ul - 1] = m_words[ul - 1];
+	}
+	for (ULONG ul = 0; ul < shift; ul++)
+	{
+		words[ul] = 0;
+	}
+	for (ULONG ul = shift + m_num_words; ul < new_num_words; ul++)
+	{
+		words[ul] = 0;
+	}
 
+	if (words != m_words && m_words != m_inline_words)
+	{
+		GPOS_DELETE_ARRAY(m_words);
+	}
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::CBitSet
-//
-//	@doc:
-//		ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSet(CMemoryPool *mp, ULONG vector_size)
-	: m_mp(mp), m_vector_size(vector_size), m_size(0)
-{
-	m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
+	m_words = words;
+	m_first_word = new_first;
+	m_num_words = new_num_words;
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::CBitSet
+//		CBitSet::RecomputeSize
 //
 //	@doc:
-//		copy ctor;
+//		Compute size of set by counting the bits of its words
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs)
-	: m_mp(mp), m_vector_size(bs.m_vector_size), m_size(0)
+void
+CBitSet::RecomputeSize()
 {
-	m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
-	Union(&bs);
-}
-
+	ULONG size = 0;
+	for (ULONG ul = 0; ul < m_num_words; ul++)
+	{
+		size += CountBits(m_words[ul]);
+	}
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::~CBitSet
-//
-//	@doc:
-//		dtor
-//
-//---------------------------------------------------------------------------
-CBitSet::~CBitSet()
-{
-	Clear();
+	m_size = size;
 }
 
 
@@ -238,15 +198,9 @@ CBitSet::~CBitSet()
 BOOL
 CBitSet::Get(ULONG pos) const
 {
-	ULONG offset = ComputeOffset(pos);
-
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr != bsl && bsl->GetOffset() == offset)
-	{
-		return bsl->GetVec()->Get(pos - offset);
-	}
+	const ULLONG word = GetWord(pos / GPOS_BITSET_WORD_BITS);
 
-	return false;
+	return 0 != (word & ((ULLONG) 1 << (pos % GPOS_BITSET_WORD_BITS)));
 }
 
 
@@ -255,37 +209,21 @@ CBitSet::Get(ULONG pos) const
 //		CBitSet::ExchangeSet
 //
 //	@doc:
-//		Set given bit; return previous value; allocate new link if necessary
+//		Set given bit; return previous value; extend words if necessary
 //
 //---------------------------------------------------------------------------
 BOOL
 CBitSet::ExchangeSet(ULONG pos)
 {
-	ULONG offset = ComputeOffset(pos);
-
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr == bsl || bsl->GetOffset() != offset)
-	{
-		CBitSetLink *pbsl_new =
-			GPOS_NEW(m_mp) CBitSetLink(m_mp, offset, m_vector_size);
-		if (nullptr == bsl)
-		{
-			m_bsllist.Prepend(pbsl_new);
-		}
-		else
-		{
-			// insert after found link
-			m_bsllist.Append(pbsl_new, bsl);
-		}
-
-		bsl = pbsl_new;
-	}
-
-	GPOS_ASSERT(bsl->GetOffset() == offset);
+	const ULONG word_idx = pos / GPOS_BITSET_WORD_BITS;
+	EnsureWords(word_idx, word_idx + 1);
 
-	BOOL bit = bsl->GetVec()->ExchangeSet(pos - offset);
+	ULLONG &word = m_words[word_idx - m_first_word];
+	const ULLONG mask = (ULLONG) 1 << (pos % GPOS_BITSET_WORD_BITS);
+	const BOOL bit = (0 != (word & mask));
 	if (!bit)
 	{
+		word |= mask;
 		m_size++;
 	}
 
@@ -304,29 +242,25 @@ CBitSet::ExchangeSet(ULONG pos)
 BOOL
 CBitSet::ExchangeClear(ULONG pos)
 {
-	ULONG offset = ComputeOffset(pos);
-
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr != bsl && bsl->GetOffset() == offset)
+	const ULONG word_idx = pos / GPOS_BITSET_WORD_BITS;
+	if (0 == (GetWord(word_idx) &
+			  ((ULLONG) 1 << (pos % GPOS_BITSET_WORD_BITS))))
 	{
-		BOOL bit = bsl->GetVec()->ExchangeClear(pos - offset);
-
-		// remove empty link
-		if (bsl->GetVec()->IsEmpty())
-		{
-			m_bsllist.Remove(bsl);
-			GPOS_DELETE(bsl);
-		}
+		return false;
+	}
 
-		if (bit)
-		{
-			m_size--;
-		}
+	m_words[word_idx - m_first_word] &=
+		~((ULLONG) 1 << (pos % GPOS_BITSET_WORD_BITS));
+	m_size--;
 
-		return bit;
+	if (0 == m_size)
+	{
+		// start over, so that the next bit set is not stored with the
+		// words of the bits removed
+		m_num_words = 0;
 	}
 
-	return false;
+	return true;
 }
 
 
@@ -335,74 +269,27 @@ CBitSet::ExchangeClear(ULONG pos)
 //		CBitSet::Union
 //
 //	@doc:
-//		Union with given other set;
-//		(1) determine which links need to be allocated before(!) modifying
-//			the set allocate and copy missing links aside
-//		(2) insert the new links into the list
-//		(3) union all links, old and new, on a per-bitvector basis
-//
-//		For clarity step (2) and (3) are separated;
+//		Union with given other set; extends the stored range of words to
+//		cover the other set's words, then ors them in
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Union(const CBitSet *pbsOther)
 {
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
-
-	// dynamic array of CBitSetLink
-	typedef CDynamicPtrArray<CBitSetLink, CleanupNULL> CBitSetLinkArray;
-
-	CAutoRef<CBitSetLinkArray> a_drgpbsl;
-	a_drgpbsl = GPOS_NEW(m_mp) CBitSetLinkArray(m_mp);
-
-	// iterate through other's links and copy missing links to array
-	for (bsl_other = pbsOther->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = pbsOther->m_bsllist.Next(bsl_other))
+	if (0 == pbsOther->m_size)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-		if (nullptr == bsl || bsl->GetOffset() != bsl_other->GetOffset())
-		{
-			// need to copy this link
-			CAutoP<CBitSetLink> a_pbsl;
-			a_pbsl = GPOS_NEW(m_mp) CBitSetLink(m_mp, *bsl_other);
-			a_drgpbsl->Append(a_pbsl.Value());
-
-			a_pbsl.Reset();
-		}
+		return;
 	}
 
-	// insert all new links
-	bsl = nullptr;
-	for (ULONG i = 0; i < a_drgpbsl->Size(); i++)
-	{
-		CBitSetLink *pbslInsert = (*a_drgpbsl)[i];
-		bsl = FindLinkByOffset(pbslInsert->GetOffset(), bsl);
-
-		GPOS_ASSERT_IMP(nullptr != bsl,
-						bsl->GetOffset() < pbslInsert->GetOffset());
-		if (nullptr == bsl)
-		{
-			m_bsllist.Prepend(pbslInsert);
-		}
-		else
-		{
-			m_bsllist.Append(pbslInsert, bsl);
-		}
-	}
+	EnsureWords(pbsOther->m_first_word,
+				pbsOther->m_first_word + pbsOther->m_num_words);
 
-	// iterate through all links and union them up
-	bsl_other = nullptr;
-	bsl = m_bsllist.First();
-	while (nullptr != bsl)
+	ULLONG *words = m_words + (pbsOther->m_first_word - m_first_word);
+	const ULLONG *other_words = pbsOther->m_words;
+	const ULONG num_words = pbsOther->m_num_words;
+	for (ULONG ul = 0; ul < num_words; ul++)
 	{
-		bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-		if (nullptr != bsl_other && bsl_other->GetOffset() == bsl->GetOffset())
-		{
-			bsl->GetVec()->Or(bsl_other->GetVec());
-		}
-
-		bsl = m_bsllist.Next(bsl);
+		words[ul] |= other_words[ul];
 	}
 
 	RecomputeSize();
@@ -414,7 +301,7 @@ CBitSet::Union(const CBitSet *pbsOther)
 //		CBitSet::Intersection
 //
 //	@doc:
-//		Iterate through all links and intersect them; release unused links
+//		Intersect all words with the other set's words
 //
 //---------------------------------------------------------------------------
 void
@@ -425,30 +312,16 @@ CBitSet::Intersection(const CBitSet *pbsOther)
 		return;
 	}
 
-	CBitSetLink *bsl_other = nullptr;
-	CBitSetLink *bsl = m_bsllist.First();
-
-	while (nullptr != bsl)
+	for (ULONG ul = 0; ul < m_num_words; ul++)
 	{
-		CBitSetLink *bsl_to_remove = nullptr;
-
-		bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-		if (nullptr != bsl_other && bsl_other->GetOffset() == bsl->GetOffset())
-		{
-			bsl->GetVec()->And(bsl_other->GetVec());
-			bsl = m_bsllist.Next(bsl);
-		}
-		else
-		{
-			bsl_to_remove = bsl;
-			bsl = m_bsllist.Next(bsl);
-
-			m_bsllist.Remove(bsl_to_remove);
-			GPOS_DELETE(bsl_to_remove);
-		}
+		m_words[ul] &= pbsOther->GetWord(m_first_word + ul);
 	}
 
 	RecomputeSize();
+	if (0 == m_size)
+	{
+		m_num_words = 0;
+	}
 }
 
 
@@ -457,22 +330,21 @@ CBitSet::Intersection(const CBitSet *pbsOther)
 //		CBitSet::Difference
 //
 //	@doc:
-//		Substract other set from this by iterating through other set and
-//		explicit removal of elements;
+//		Substract other set from this
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Difference(const CBitSet *pbs)
 {
-	if (IsDisjoint(pbs))
+	for (ULONG ul = 0; ul < m_num_words; ul++)
 	{
-		return;
+		m_words[ul] &= ~pbs->GetWord(m_first_word + ul);
 	}
 
-	CBitSetIter bsiter(*pbs);
-	while (bsiter.Advance())
+	RecomputeSize();
+	if (0 == m_size)
 	{
-		(void) ExchangeClear(bsiter.Bit());
+		m_num_words = 0;
 	}
 }
 
@@ -494,17 +366,9 @@ CBitSet::ContainsAll(const CBitSet *bs) const
 		return false;
 	}
 
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
-
-	// iterate through other's links and check for subsets
-	for (bsl_other = bs->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = bs->m_bsllist.Next(bsl_other))
+	for (ULONG ul = 0; ul < bs->m_num_words; ul++)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-
-		if (nullptr == bsl || bsl->GetOffset() != bsl_other->GetOffset() ||
-			!bsl->GetVec()->ContainsAll(bsl_other->GetVec()))
+		if (0 != (bs->m_words[ul] & ~GetWord(bs->m_first_word + ul)))
 		{
 			return false;
 		}
@@ -519,7 +383,8 @@ CBitSet::ContainsAll(const CBitSet *bs) const
 //		CBitSet::Equals
 //
 //	@doc:
-//		Determine if equal
+//		Determine if equal; with equal sizes, it suffices that the words
+//		stored by this set match
 //
 //---------------------------------------------------------------------------
 BOOL
@@ -537,24 +402,15 @@ CBitSet::Equals(const CBitSet *bs) const
 		return false;
 	}
 
-	CBitSetLink *bsl = m_bsllist.First();
-	CBitSetLink *bsl_other = bs->m_bsllist.First();
-
-	while (nullptr != bsl)
+	for (ULONG ul = 0; ul < m_num_words; ul++)
 	{
-		if (nullptr == bsl_other ||
-			bsl->GetOffset() != bsl_other->GetOffset() ||
-			!bsl->GetVec()->Equals(bsl_other->GetVec()))
+		if (m_words[ul] != bs->GetWord(m_first_word + ul))
 		{
 			return false;
 		}
-
-		bsl = m_bsllist.Next(bsl);
-		bsl_other = bs->m_bsllist.Next(bsl_other);
 	}
 
-	// same length implies bsl_other must have reached end as well
-	return bsl_other == nullptr;
+	return true;
 }
 
 
@@ -570,17 +426,19 @@ CBitSet::Equals(const CBitSet *bs) const
 BOOL
 CBitSet::IsDisjoint(const CBitSet *bs) const
 {
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
-
-	// iterate through other's links an check if disjoint
-	for (bsl_other = bs->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = bs->m_bsllist.Next(bsl_other))
+	if (0 == m_size || 0 == bs->m_size)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
+		return true;
+	}
 
-		if (nullptr != bsl && bsl->GetOffset() == bsl_other->GetOffset() &&
-			!bsl->GetVec()->IsDisjoint(bsl_other->GetVec()))
+	// only the words stored by both sets may overlap
+	const ULONG first = std::max(m_first_word, bs->m_first_word);
+	const ULONG end = std::min(m_first_word + m_num_words,
+							   bs->m_first_word + bs->m_num_words);
+	for (ULONG ul = first; ul < end; ul++)
+	{
+		if (0 != (m_words[ul - m_first_word] &
+				  bs->m_words[ul - bs->m_first_word]))
 		{
 			return false;
 		}
@@ -595,7 +453,8 @@ CBitSet::IsDisjoint(const CBitSet *bs) const
 //		CBitSet::HashValue
 //
 //	@doc:
-//		Compute hash value for set
+//		Compute hash value for set from its non-empty words and their
+//		positions, so that equal sets hash alike however they were built
 //
 //---------------------------------------------------------------------------
 ULONG
@@ -603,11 +462,17 @@ CBitSet::HashValue() const
 {
 	ULONG ulHash = 0;
 
-	CBitSetLink *bsl = m_bsllist.First();
-	while (nullptr != bsl)
+	for (ULONG ul = 0; ul < m_num_words; ul++)
 	{
-		ulHash = gpos::CombineHashes(ulHash, bsl->GetVec()->HashValue());
-		bsl = m_bsllist.Next(bsl);
+		if (0 != m_words[ul])
+		{
+			const ULONG word_idx = m_first_word + ul;
+			ulHash = gpos::CombineHashes(
+				ulHash, gpos::CombineHashes(
+							gpos::HashValue<ULONG>(&word_idx),
+							gpos::HashByteArray((const BYTE *) &m_words[ul],
+												GPOS_SIZEOF(ULLONG))));
+		}
 	}
 
 	return ulHash;
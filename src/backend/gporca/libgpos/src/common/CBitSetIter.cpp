@@ -12,7 +12,6 @@
 #include "gpos/common/CBitSetIter.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 
 using namespace gpos;
 
@@ -26,7 +25,11 @@ using namespace gpos;
 //
 //---------------------------------------------------------------------------
 CBitSetIter::CBitSetIter(const CBitSet &bs)
-	: m_bs(bs), m_cursor((ULONG) -1), m_bsl(nullptr), m_active(true)
+	: m_bs(bs),
+	  m_cursor((ULONG) -1),
+	  m_word_idx(0),
+	  m_pending_bits(0 < bs.m_num_words ? bs.m_words[0] : 0),
+	  m_active(true)
 {
 }
 
@@ -44,25 +47,33 @@ CBitSetIter::Advance()
 {
 	GPOS_ASSERT(m_active && "called advance on exhausted iterator");
 
-	if (nullptr == m_bsl)
+	while (0 == m_pending_bits)
 	{
-		m_bsl = m_bs.m_bsllist.First();
-	}
-
-	while (nullptr != m_bsl)
-	{
-		if (m_cursor + 1 <= m_bs.m_vector_size &&
-			m_bsl->GetVec()->GetNextSetBit(m_cursor + 1, m_cursor))
+		m_word_idx++;
+		if (m_word_idx >= m_bs.m_num_words)
 		{
-			break;
+			m_active = false;
+			return false;
 		}
 
-		m_bsl = m_bs.m_bsllist.Next(m_bsl);
-		m_cursor = (ULONG) -1;
+		m_pending_bits = m_bs.m_words[m_word_idx];
 	}
 
-	m_active = (nullptr != m_bsl);
-	return m_active;
+	// find and consume the lowest pending bit
+	ULONG bit = 0;
+#if defined(__GNUC__)
+	bit = (ULONG) __builtin_ctzll(m_pending_bits);
+#else
+	while (0 == (m_pending_bits & ((ULLONG) 1 << bit)))
+	{
+		bit++;
+	}
+#endif
+	m_pending_bits &= (m_pending_bits - 1);
+
+	m_cursor = (m_bs.m_first_word + m_word_idx) * 64 + bit;
+
+	return true;
 }
 
 
@@ -77,10 +88,11 @@ CBitSetIter::Advance()
 ULONG
 CBitSetIter::Bit() const
 {
-	GPOS_ASSERT(m_active && nullptr != m_bsl && "iterator uninitialized");
-	GPOS_ASSERT(m_bsl->GetVec()->Get(m_cursor));
+	GPOS_ASSERT(m_active && (ULONG) -1 != m_cursor &&
+				"iterator uninitialized");
+	GPOS_ASSERT(m_bs.Get(m_cursor));
 
-	return m_bsl->GetOffset() + m_cursor;
+	return m_cursor;
 }
 
 // EOF
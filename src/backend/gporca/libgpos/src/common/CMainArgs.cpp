@@ -93,4 +93,39 @@ CMainArgs::Getopt(CHAR *pch)
 	return false;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMainArgs::UlOperands
+//
+//	@doc:
+//		Number of arguments following the options; getopt moves them past
+//		the options, where its index points once all options are parsed
+//
+//---------------------------------------------------------------------------
+ULONG
+CMainArgs::UlOperands() const
+{
+	GPOS_ASSERT(0 < optind);
+
+	return ((ULONG) optind < m_argc) ? m_argc - (ULONG) optind : 0;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMainArgs::SzOperand
+//
+//	@doc:
+//		Argument following the options at the given position
+//
+//---------------------------------------------------------------------------
+const CHAR *
+CMainArgs::SzOperand(ULONG ul) const
+{
+	GPOS_ASSERT(ul < UlOperands());
+
+	return m_argv[optind + ul];
+}
+
 // EOF
@@ -35,16 +35,17 @@ using namespace gpos;
 //		CAutoMemoryPool::CAutoMemoryPool
 //
 //	@doc:
-//		Create an auto-managed pool; the managed pool is allocated from
-//  	the CMemoryPoolManager global instance
+//		Create an auto-managed pool of the given kind; the managed pool is
+//  	allocated from the CMemoryPoolManager global instance
 //
 //---------------------------------------------------------------------------
-CAutoMemoryPool::CAutoMemoryPool(ELeakCheck leak_check_type GPOS_ASSERTS_ONLY)
+CAutoMemoryPool::CAutoMemoryPool(ELeakCheck leak_check_type GPOS_ASSERTS_ONLY,
+								 CMemoryPool::EPoolKind kind)
 #ifdef GPOS_DEBUG
 	: m_leak_check_type(leak_check_type)
 #endif
 {
-	m_mp = CMemoryPoolManager::GetMemoryPoolMgr()->CreateMemoryPool();
+	m_mp = CMemoryPoolManager::GetMemoryPoolMgr()->CreateMemoryPool(kind);
 }
 
 
@@ -78,9 +78,9 @@ CMemoryPoolManager::Init()
 
 
 CMemoryPool *
-CMemoryPoolManager::CreateMemoryPool()
+CMemoryPoolManager::CreateMemoryPool(CMemoryPool::EPoolKind kind)
 {
-	CMemoryPool *mp = NewMemoryPool();
+	CMemoryPool *mp = NewMemoryPool(kind);
 
 	// accessor scope
 	{
@@ -95,9 +95,9 @@ CMemoryPoolManager::CreateMemoryPool()
 }
 
 
-// Allocate a new NewMemoryPool
+// Allocate a new NewMemoryPool; tracker pools serve all kinds of pools
 CMemoryPool *
-CMemoryPoolManager::NewMemoryPool()
+CMemoryPoolManager::NewMemoryPool(CMemoryPool::EPoolKind)
 {
 	return GPOS_NEW(m_internal_memory_pool) CMemoryPoolTracker();
 }
@@ -69,7 +69,12 @@ private:
 		CMemoryPool *, const CWStringBase *dxl_string,
 		const CHAR *xsd_file_path);
 
+	// decode the given binary DXL document and return the top-level parser
+	static CParseHandlerDXL *GetParseHandlerForBinaryDXL(
+		CMemoryPool *, const CHAR *binary_dxl);
 
+	// does the given file hold a binary DXL document
+	static BOOL IsBinaryDXLFile(const CHAR *dxl_filename);
 
 public:
 	// helper functions for serializing DXL document header and footer, respectively
@@ -85,6 +90,20 @@ public:
 	static CParseHandlerDXL *GetParseHandlerForDXLFile(
 		CMemoryPool *, const CHAR *dxl_filename, const CHAR *xsd_file_path);
 
+	// does the given DXL string hold a binary DXL document; any function
+	// that parses a DXL string or file accepts binary DXL as well as XML
+	static BOOL IsBinaryDXL(const CHAR *dxl_string);
+
+	// encode the given XML DXL document as binary DXL; the result is
+	// null-terminated and free of other null bytes
+	static CHAR *EncodeBinaryDXL(CMemoryPool *, const CHAR *dxl_string,
+								 ULONG *size);
+
+	// write the given binary DXL document as XML
+	static CWStringDynamic *DecodeBinaryDXL(CMemoryPool *,
+											const CHAR *binary_dxl,
+											BOOL indentation);
+
 	// parse a DXL document containing a DXL plan
 	static CDXLNode *GetPlanDXLNode(CMemoryPool *, const CHAR *dxl_string,
 									const CHAR *xsd_file_path, ULLONG *plan_id,
@@ -49,6 +49,7 @@ namespace gpmd
 class CMDIdGPDB;
 class CMDIdColStats;
 class CMDIdRelStats;
+class CMDIdExtStats;
 class CMDIdCast;
 class CMDIdScCmp;
 }  // namespace gpmd
@@ -493,6 +494,12 @@ public:
 										  Edxltoken target_attr,
 										  Edxltoken target_elem);
 
+	// parse an extended stats mdid object from an array of its components
+	static CMDIdExtStats *GetExtStatsMdId(CDXLMemoryManager *dxl_memory_manager,
+										  XMLChArray *remaining_tokens,
+										  Edxltoken target_attr,
+										  Edxltoken target_elem);
+
 	// parse a cast func mdid from the array of its components
 	static CMDIdCast *GetCastFuncMdId(CDXLMemoryManager *dxl_memory_manager,
 									  XMLChArray *remaining_tokens,
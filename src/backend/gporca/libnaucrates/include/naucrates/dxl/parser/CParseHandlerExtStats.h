@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CParseHandlerExtStats.h
+//
+//	@doc:
+//		SAX parse handler class for parsing extended stats objects
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CParseHandlerExtStats_H
+#define GPDXL_CParseHandlerExtStats_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/parser/CParseHandlerMetadataObject.h"
+#include "naucrates/md/CMDDependency.h"
+#include "naucrates/md/CMDMCVList.h"
+#include "naucrates/md/CMDNDistinct.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+using namespace gpmd;
+using namespace gpnaucrates;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CParseHandlerExtStats
+//
+//	@doc:
+//		Parse handler class for the extended stats of a relation
+//
+//---------------------------------------------------------------------------
+class CParseHandlerExtStats : public CParseHandlerMetadataObject
+{
+private:
+	// metadata id of the object
+	IMDId *m_mdid;
+
+	// relation name
+	CMDName *m_mdname;
+
+	// multi-column distinct values parsed so far
+	CMDNDistinctArray *m_ndistincts;
+
+	// functional dependencies parsed so far
+	CMDDependencyArray *m_dependencies;
+
+	// multi-column MCV lists parsed so far
+	CMDMCVListArray *m_mcv_lists;
+
+	// attnos of the MCV list being parsed
+	ULongPtrArray *m_mcv_attnos;
+
+	// items of the MCV list being parsed
+	CMDMCVItemArray *m_mcv_items;
+
+	// values of the MCV item being parsed
+	CDXLDatumArray *m_mcv_values;
+
+	// frequency of the MCV item being parsed
+	CDouble m_mcv_frequency;
+
+	// base frequency of the MCV item being parsed
+	CDouble m_mcv_base_frequency;
+
+	// process the start of an element
+	void StartElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname,		// element's qname
+		const Attributes &attr					// element's attributes
+		) override;
+
+	// process the end of an element
+	void EndElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname		// element's qname
+		) override;
+
+public:
+	CParseHandlerExtStats(const CParseHandlerExtStats &) = delete;
+
+	// ctor
+	CParseHandlerExtStats(CMemoryPool *mp,
+						  CParseHandlerManager *parse_handler_mgr,
+						  CParseHandlerBase *parse_handler_root);
+
+	// dtor
+	~CParseHandlerExtStats() override;
+};
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CParseHandlerExtStats_H
+
+// EOF
@@ -79,6 +79,15 @@ protected:
 	// part constraint
 	CDXLNode *m_part_constraint;
 
+	// bound constraints of the child partitions
+	CDXLNodeArray *m_partition_bounds;
+
+	// sorted range bounds of the child partitions
+	CDXLDatumArray *m_part_range_bounds;
+
+	// child partition of each slot between the range bounds
+	IntPtrArray *m_part_range_slots;
+
 	// distribution opfamilies parse handler
 	CParseHandlerBase *m_opfamilies_parse_handler;
 
@@ -48,7 +48,9 @@ private:
 	// the memory manager used for parsing the current document
 	CDXLMemoryManager *m_dxl_memory_manager;
 
-	// parser object responsible for parsing the current XML document
+	// parser object responsible for parsing the current XML document, null
+	// when the elements are passed to the parse handlers by the decoder of
+	// a binary DXL document
 	SAX2XMLReader *m_xml_reader;
 
 	// current parse handler
@@ -63,6 +65,9 @@ private:
 	// check for aborts at regular intervals
 	void CheckForAborts();
 
+	// make the XML parser, if any, send its events to the given handler
+	void SetReaderHandler(CParseHandlerBase *parse_handler_base);
+
 
 public:
 	CParseHandlerManager(const CParseHandlerManager &) = delete;
@@ -95,8 +100,8 @@ public:
 	// Deactivates current handler and returns control to the previously active one.
 	void DeactivateHandler();
 
-	// Returns the current parse handler if one exists; used for debugging purposes
-	const CParseHandlerBase *GetCurrentParseHandler();
+	// Returns the current parse handler if one exists
+	CParseHandlerBase *GetCurrentParseHandler();
 };
 }  // namespace gpdxl
 #endif	// !GPDXL_CParseHandlerManager_H
@@ -0,0 +1,251 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryReader.h
+//
+//	@doc:
+//		Streaming decoder of binary DXL documents
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryReader_H
+#define GPDXL_CDXLBinaryReader_H
+
+#include <xercesc/sax2/Attributes.hpp>
+
+#include "gpos/base.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+// fwd decl
+class CDXLMemoryManager;
+class CParseHandlerManager;
+class CXMLSerializer;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryAttributes
+//
+//	@doc:
+//		Attributes of an element of a binary DXL document, as passed to
+//		the parse handlers; names are ids of the names of the reader, and
+//		values are offsets into its buffer of decoded values
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryAttributes : public Attributes
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of attributes, and number of attributes there is room for
+	ULONG m_size;
+	ULONG m_capacity;
+
+	// ids of the namespace URI, local name and qname of each attribute
+	ULONG *m_name_ids;
+
+	// offsets of the values of attributes
+	ULONG *m_value_offsets;
+
+	// names of the reader, indexed by id
+	const XMLCh *const *m_names;
+
+	// decoded values
+	const XMLCh *m_values;
+
+public:
+	CDXLBinaryAttributes(const CDXLBinaryAttributes &) = delete;
+
+	// ctor
+	explicit CDXLBinaryAttributes(CMemoryPool *mp);
+
+	// dtor
+	~CDXLBinaryAttributes() override;
+
+	// remove all attributes
+	void
+	Clear()
+	{
+		m_size = 0;
+	}
+
+	// add an attribute whose value starts at the given offset
+	void Append(ULONG uri_id, ULONG local_name_id, ULONG qname_id,
+				ULONG value_offset);
+
+	// set the names and the decoded values, once all attributes are added
+	void
+	SetNamesAndValues(const XMLCh *const *names, const XMLCh *values)
+	{
+		m_names = names;
+		m_values = values;
+	}
+
+	// id of the qname of an attribute
+	ULONG
+	GetQNameId(ULONG index) const
+	{
+		GPOS_ASSERT(index < m_size);
+		return m_name_ids[3 * index + 2];
+	}
+
+	// number of attributes
+	XMLSize_t
+	getLength() const override
+	{
+		return m_size;
+	}
+
+	// names of an attribute
+	const XMLCh *getURI(const XMLSize_t index) const override;
+	const XMLCh *getLocalName(const XMLSize_t index) const override;
+	const XMLCh *getQName(const XMLSize_t index) const override;
+
+	// type of an attribute; DXL attributes are always CDATA
+	const XMLCh *getType(const XMLSize_t index) const override;
+
+	// value of an attribute
+	const XMLCh *getValue(const XMLSize_t index) const override;
+
+	// index of an attribute by namespace and local name
+	bool getIndex(const XMLCh *const uri, const XMLCh *const local_part,
+				  XMLSize_t &index) const override;
+	int getIndex(const XMLCh *const uri,
+				 const XMLCh *const local_part) const override;
+
+	// index of an attribute by qname
+	bool getIndex(const XMLCh *const qname, XMLSize_t &index) const override;
+	int getIndex(const XMLCh *const qname) const override;
+
+	// type of an attribute by name
+	const XMLCh *getType(const XMLCh *const uri,
+						 const XMLCh *const local_part) const override;
+	const XMLCh *getType(const XMLCh *const qname) const override;
+
+	// value of an attribute by name
+	const XMLCh *getValue(const XMLCh *const uri,
+						  const XMLCh *const local_part) const override;
+	const XMLCh *getValue(const XMLCh *const qname) const override;
+
+};	// class CDXLBinaryAttributes
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryReader
+//
+//	@doc:
+//		Decodes a binary DXL document, as written by CDXLBinaryWriter, one
+//		record at a time, and either passes the elements to the active
+//		parse handler, like the XML parser does, or writes them as XML.
+//
+//		Namespace declarations are recorded as attributes so that the
+//		document can be written back as XML; like the XML parser, the
+//		reader does not pass them to the parse handlers.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryReader
+{
+private:
+	// memory manager
+	CDXLMemoryManager *m_memory_manager;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// encoded document, null-terminated
+	const BYTE *m_buffer;
+
+	// size of the document, excluding the terminating null
+	ULONG m_size;
+
+	// position of the next byte to decode
+	ULONG m_pos;
+
+	// names defined so far, indexed by id, and the room there is for them
+	XMLCh **m_names;
+	ULONG m_num_names;
+	ULONG m_names_capacity;
+
+	// names as wide strings, when writing XML
+	CWStringDynamic **m_wide_names;
+
+	// ids of the namespace URI, local name and qname of each open element
+	ULONG *m_open_elements;
+	ULONG m_num_open_elements;
+	ULONG m_open_elements_capacity;
+
+	// decoded values of the attributes of the current element
+	XMLCh *m_values;
+	ULONG m_values_capacity;
+
+	// attributes of the current element
+	CDXLBinaryAttributes m_attrs;
+
+	// raise an error for a malformed document
+	void RaiseMalformed() const;
+
+	// decode a varint
+	ULLONG ReadNumber();
+
+	// decode a name id
+	ULONG ReadNameId();
+
+	// decode the length of a string, checked against the bytes left
+	ULONG ReadStringLength();
+
+	// decode the code units of a string into the given array
+	void ReadCodeUnits(XMLCh *str, ULONG length);
+
+	// decode a string into the given buffer, at the given offset, growing
+	// the buffer as needed; return the offset past the decoded string
+	ULONG ReadString(XMLCh **buffer, ULONG *capacity, ULONG offset);
+
+	// decode the definition of a name
+	void ReadName(BOOL write_xml);
+
+	// decode the start of an element, push it on the open elements and
+	// decode its attributes; namespace declarations are skipped unless
+	// asked for
+	void ReadStartElement(BOOL include_namespace_decls);
+
+	// check the magic bytes and the format version
+	void ReadHeader();
+
+	// decode the document, writing it to the serializer if one is given,
+	// and passing it to the parse handlers otherwise
+	void Read(CParseHandlerManager *parse_handler_mgr,
+			  CXMLSerializer *xml_serializer);
+
+public:
+	CDXLBinaryReader(const CDXLBinaryReader &) = delete;
+
+	// ctor
+	CDXLBinaryReader(CDXLMemoryManager *memory_manager, const CHAR *buffer);
+
+	// dtor
+	~CDXLBinaryReader();
+
+	// pass the elements of the document to the active parse handler of the
+	// given manager
+	void Parse(CParseHandlerManager *parse_handler_mgr);
+
+	// write the document as XML
+	void Serialize(CXMLSerializer *xml_serializer);
+
+	// does the given buffer start with the magic bytes of binary DXL
+	static BOOL IsBinary(const CHAR *buffer);
+
+};	// class CDXLBinaryReader
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryReader_H
+
+// EOF
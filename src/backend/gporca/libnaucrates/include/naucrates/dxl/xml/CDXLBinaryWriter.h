@@ -0,0 +1,136 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryWriter.h
+//
+//	@doc:
+//		SAX handler that encodes a DXL document in the binary DXL format
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryWriter_H
+#define GPDXL_CDXLBinaryWriter_H
+
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+
+// magic bytes that start a binary DXL document
+#define GPDXL_BINARY_MAGIC "DXLB"
+
+// version of the binary DXL format
+#define GPDXL_BINARY_VERSION 1
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+// records of a binary DXL document
+enum EDxlBinaryRecord
+{
+	EdxlbrName = 1,		 // definition of the next name id
+	EdxlbrStartElement,	 // start of an element and its attributes
+	EdxlbrEndElement,	 // end of the innermost open element
+	EdxlbrEnd,			 // end of the document
+
+	EdxlbrSentinel
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryWriter
+//
+//	@doc:
+//		Records the SAX events of a parsed DXL document in the binary DXL
+//		format.
+//
+//		A binary DXL document is the magic bytes and the format version,
+//		followed by a sequence of records, each starting with its type.
+//		Element and attribute names are interned: a name record defines
+//		the next name id the first time a name is seen, and elements and
+//		attributes refer to their namespace URI, local name and qname by
+//		id. Attribute values are stored as their length followed by their
+//		UTF-16 code units. End of element records carry no names, as the
+//		reader keeps the stack of open elements.
+//
+//		All numbers are written as varints of the number plus one, which
+//		makes every byte of the document non-zero; binary DXL can then be
+//		passed wherever a null-terminated DXL string is expected. DXL keeps
+//		all content in attributes, so character data is not recorded.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryWriter : public DefaultHandler
+{
+private:
+	// hash of a name
+	static ULONG HashName(const XMLCh *name);
+
+	// equality of names
+	static BOOL EqualNames(const XMLCh *name, const XMLCh *other_name);
+
+	// map of names to their ids
+	typedef CHashMap<XMLCh, ULONG, HashName, EqualNames,
+					 CleanupDeleteArray<XMLCh>, CleanupDelete<ULONG> >
+		NameToIdMap;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// encoded document
+	BYTE *m_buffer;
+
+	// number of bytes written and allocated
+	ULONG m_size;
+	ULONG m_capacity;
+
+	// ids of names defined so far
+	NameToIdMap *m_name_to_id_map;
+
+	// make room for the given number of bytes
+	void Reserve(ULONG size);
+
+	// write a varint
+	void WriteNumber(ULLONG value);
+
+	// write a string
+	void WriteString(const XMLCh *str);
+
+	// id of the given name; a new name is defined first
+	ULONG GetNameId(const XMLCh *name);
+
+public:
+	CDXLBinaryWriter(const CDXLBinaryWriter &) = delete;
+
+	// ctor
+	explicit CDXLBinaryWriter(CMemoryPool *mp);
+
+	// dtor
+	~CDXLBinaryWriter() override;
+
+	// record the start of an element
+	void startElement(const XMLCh *const element_uri,
+					  const XMLCh *const element_local_name,
+					  const XMLCh *const element_qname,
+					  const Attributes &attrs) override;
+
+	// record the end of an element
+	void endElement(const XMLCh *const element_uri,
+					const XMLCh *const element_local_name,
+					const XMLCh *const element_qname) override;
+
+	// record the end of the document
+	void endDocument() override;
+
+	// return the encoded document, null-terminated, and its size; the
+	// caller owns the returned buffer
+	CHAR *DetachBuffer(ULONG *size);
+
+};	// class CDXLBinaryWriter
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryWriter_H
+
+// EOF
@@ -447,6 +447,13 @@ enum Edxltoken
 	EdxltokenRelationStats,
 	EdxltokenColumnStats,
 	EdxltokenColumnStatsBucket,
+	EdxltokenExtStats,
+	EdxltokenMVNDistinct,
+	EdxltokenMVDependency,
+	EdxltokenMVDependencyDegree,
+	EdxltokenMVMCVList,
+	EdxltokenMVMCVItem,
+	EdxltokenMVMCVBaseFrequency,
 	EdxltokenEmptyRelation,
 	EdxltokenIsNull,
 	EdxltokenLintValue,
@@ -522,6 +529,10 @@ enum Edxltoken
 	EdxltokenCheckConstraints,
 	EdxltokenCheckConstraint,
 	EdxltokenPartConstraint,
+	EdxltokenPartBounds,
+	EdxltokenPartBound,
+	EdxltokenPartRangeBounds,
+	EdxltokenPartRangeBound,
 	EdxltokenDefaultPartition,
 	EdxltokenPartConstraintUnbounded,
 
@@ -41,6 +41,7 @@ enum ExMinor
 	ExmiDXLValidationError,
 	ExmiDXLXercesParseError,
 	ExmiDXLIncorrectNumberOfChildren,
+	ExmiDXLMalformedBinary,
 	ExmiPlStmt2DXLConversion,
 	ExmiDXL2PlStmtConversion,
 	ExmiDXL2PlStmtExternalScanError,
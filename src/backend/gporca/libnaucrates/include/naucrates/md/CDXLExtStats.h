@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLExtStats.h
+//
+//	@doc:
+//		Class representing the extended statistics of a relation
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CDXLExtStats_H
+#define GPMD_CDXLExtStats_H
+
+#include "gpos/base.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/md/CMDDependency.h"
+#include "naucrates/md/CMDIdExtStats.h"
+#include "naucrates/md/CMDMCVList.h"
+#include "naucrates/md/CMDNDistinct.h"
+#include "naucrates/md/IMDExtStats.h"
+
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLExtStats
+//
+//	@doc:
+//		Class representing the extended statistics of a relation
+//
+//---------------------------------------------------------------------------
+class CDXLExtStats : public IMDExtStats
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// metadata id of the object
+	CMDIdExtStats *m_ext_stats_mdid;
+
+	// relation name
+	CMDName *m_mdname;
+
+	// multi-column distinct values
+	CMDNDistinctArray *m_ndistincts;
+
+	// functional dependencies
+	CMDDependencyArray *m_dependencies;
+
+	// multi-column MCV lists
+	CMDMCVListArray *m_mcv_lists;
+
+	// DXL string for object
+	CWStringDynamic *m_dxl_str;
+
+public:
+	CDXLExtStats(const CDXLExtStats &) = delete;
+
+	CDXLExtStats(CMemoryPool *mp, CMDIdExtStats *ext_stats_mdid,
+				 CMDName *mdname, CMDNDistinctArray *ndistincts,
+				 CMDDependencyArray *dependencies,
+				 CMDMCVListArray *mcv_lists);
+
+	~CDXLExtStats() override;
+
+	// the metadata id
+	IMDId *MDId() const override;
+
+	// relation name
+	CMDName Mdname() const override;
+
+	// DXL string representation of cache object
+	const CWStringDynamic *GetStrRepr() const override;
+
+	// number of multi-column distinct values
+	ULONG
+	NDistinctCount() const override
+	{
+		return m_ndistincts->Size();
+	}
+
+	// multi-column distinct values at the given position
+	const CMDNDistinct *
+	GetNDistinctAt(ULONG pos) const override
+	{
+		return (*m_ndistincts)[pos];
+	}
+
+	// number of functional dependencies
+	ULONG
+	DependencyCount() const override
+	{
+		return m_dependencies->Size();
+	}
+
+	// functional dependency at the given position
+	const CMDDependency *
+	GetDependencyAt(ULONG pos) const override
+	{
+		return (*m_dependencies)[pos];
+	}
+
+	// number of multi-column MCV lists
+	ULONG
+	MCVListCount() const override
+	{
+		return m_mcv_lists->Size();
+	}
+
+	// multi-column MCV list at the given position
+	const CMDMCVList *
+	GetMCVListAt(ULONG pos) const override
+	{
+		return (*m_mcv_lists)[pos];
+	}
+
+	// serialize extended stats in DXL format given a serializer object
+	void Serialize(gpdxl::CXMLSerializer *) const override;
+
+#ifdef GPOS_DEBUG
+	// debug print of the extended stats
+	void DebugPrint(IOstream &os) const override;
+#endif
+
+	// dummy extended stats, with no statistics objects
+	static CDXLExtStats *CreateDXLDummyExtStats(CMemoryPool *mp, IMDId *mdid);
+};
+
+}  // namespace gpmd
+
+#endif	// !GPMD_CDXLExtStats_H
+
+// EOF
@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDDependency.h
+//
+//	@doc:
+//		Functional dependency between columns, as collected by extended
+//		statistics
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CMDDependency_H
+#define GPMD_CMDDependency_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/common/CDynamicPtrArray.h"
+
+#include "naucrates/md/IMDInterface.h"
+
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+// class for a functional dependency (a, b, ...) => c between columns; the
+// degree is the fraction of rows for which the dependency holds
+class CMDDependency : public IMDInterface
+{
+private:
+	// attnos of the determining columns
+	ULongPtrArray *m_from_attnos;
+
+	// attno of the dependent column
+	ULONG m_to_attno;
+
+	// degree of validity, between 0 and 1
+	CDouble m_degree;
+
+public:
+	CMDDependency(const CMDDependency &) = delete;
+
+	// ctor
+	CMDDependency(ULongPtrArray *from_attnos, ULONG to_attno, CDouble degree);
+
+	// dtor
+	~CMDDependency() override;
+
+	// attnos of the determining columns
+	const ULongPtrArray *
+	GetFromAttnos() const
+	{
+		return m_from_attnos;
+	}
+
+	// attno of the dependent column
+	ULONG
+	GetToAttno() const
+	{
+		return m_to_attno;
+	}
+
+	// degree of validity
+	CDouble
+	GetDegree() const
+	{
+		return m_degree;
+	}
+
+	// serialize in DXL format given a serializer object
+	virtual void Serialize(CXMLSerializer *) const;
+
+#ifdef GPOS_DEBUG
+	// debug print
+	virtual void DebugPrint(IOstream &os) const;
+#endif
+};
+
+// array of functional dependencies
+typedef CDynamicPtrArray<CMDDependency, CleanupRelease> CMDDependencyArray;
+
+}  // namespace gpmd
+
+#endif	// !GPMD_CMDDependency_H
+
+// EOF
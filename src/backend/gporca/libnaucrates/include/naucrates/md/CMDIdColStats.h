@@ -17,6 +17,7 @@
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
 #include "gpos/string/CWStringConst.h"
+#include "gpos/string/CWStringDynamic.h"
 
 #include "naucrates/dxl/gpdb_types.h"
 #include "naucrates/md/CMDIdGPDB.h"
@@ -44,12 +45,20 @@ private:
 	// position of the attribute in the base relation
 	ULONG m_attr_pos;
 
+	// leaf partitions whose statistics are merged into those of the
+	// column, or null for the statistics of the relation itself
+	IMdIdArray *m_part_mdids;
+
 	// buffer for the serialized mdid
 	WCHAR m_mdid_buffer[GPDXL_MDID_LENGTH];
 
 	// string representation of the mdid
 	CWStringStatic m_str;
 
+	// string representation of the mdid when it lists leaf partitions,
+	// which may not fit into the static buffer
+	CWStringDynamic *m_str_parts;
+
 	// serialize mdid
 	void Serialize();
 
@@ -59,6 +68,11 @@ public:
 	// ctor
 	CMDIdColStats(CMDIdGPDB *rel_mdid, ULONG attno);
 
+	// ctor for the statistics merged from those of the given leaf
+	// partitions of a partitioned relation
+	CMDIdColStats(CMemoryPool *mp, CMDIdGPDB *rel_mdid, ULONG attno,
+				  IMdIdArray *part_mdids);
+
 	// dtor
 	~CMDIdColStats() override;
 
@@ -82,16 +96,18 @@ public:
 	IMDId *GetRelMdId() const;
 	ULONG Position() const;
 
+	// leaf partitions whose statistics are merged, if any
+	IMdIdArray *
+	GetPartMdIds() const
+	{
+		return m_part_mdids;
+	}
+
 	// equality check
 	BOOL Equals(const IMDId *mdid) const override;
 
 	// computes the hash value for the metadata id
-	ULONG
-	HashValue() const override
-	{
-		return gpos::CombineHashes(m_rel_mdid->HashValue(),
-								   gpos::HashValue(&m_attr_pos));
-	}
+	ULONG HashValue() const override;
 
 	// is the mdid valid
 	BOOL
@@ -130,7 +146,18 @@ public:
 	Copy(CMemoryPool *mp) const override
 	{
 		CMDIdGPDB *mdid_rel = CMDIdGPDB::CastMdid(m_rel_mdid->Copy(mp));
-		return GPOS_NEW(mp) CMDIdColStats(mdid_rel, m_attr_pos);
+		if (nullptr == m_part_mdids)
+		{
+			return GPOS_NEW(mp) CMDIdColStats(mdid_rel, m_attr_pos);
+		}
+
+		IMdIdArray *part_mdids = GPOS_NEW(mp) IMdIdArray(mp);
+		for (ULONG ul = 0; ul < m_part_mdids->Size(); ul++)
+		{
+			part_mdids->Append((*m_part_mdids)[ul]->Copy(mp));
+		}
+		return GPOS_NEW(mp)
+			CMDIdColStats(mp, mdid_rel, m_attr_pos, part_mdids);
 	}
 };
 
@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDMCVList.h
+//
+//	@doc:
+//		Most common combinations of values of a group of columns, as
+//		collected by extended statistics
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CMDMCVList_H
+#define GPMD_CMDMCVList_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/common/CDynamicPtrArray.h"
+
+#include "naucrates/dxl/operators/CDXLDatum.h"
+#include "naucrates/md/IMDInterface.h"
+
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+// class for one combination of values of a multi-column MCV list; the
+// base frequency is the frequency the combination would have if the
+// columns were independent
+class CMDMCVItem : public IMDInterface
+{
+private:
+	// values of the combination, one per column of the list
+	CDXLDatumArray *m_values;
+
+	// fraction of rows with the combination
+	CDouble m_frequency;
+
+	// product of the frequencies of the values of the combination
+	CDouble m_base_frequency;
+
+public:
+	CMDMCVItem(const CMDMCVItem &) = delete;
+
+	// ctor
+	CMDMCVItem(CDXLDatumArray *values, CDouble frequency,
+			   CDouble base_frequency);
+
+	// dtor
+	~CMDMCVItem() override;
+
+	// values of the combination
+	const CDXLDatumArray *
+	GetValues() const
+	{
+		return m_values;
+	}
+
+	// fraction of rows with the combination
+	CDouble
+	GetFrequency() const
+	{
+		return m_frequency;
+	}
+
+	// frequency of the combination if the columns were independent
+	CDouble
+	GetBaseFrequency() const
+	{
+		return m_base_frequency;
+	}
+
+	// serialize in DXL format given a serializer object
+	virtual void Serialize(CXMLSerializer *) const;
+};
+
+// array of MCV items
+typedef CDynamicPtrArray<CMDMCVItem, CleanupRelease> CMDMCVItemArray;
+
+// class for the most common combinations of values of a group of columns
+class CMDMCVList : public IMDInterface
+{
+private:
+	// attnos of the columns, in the order of the values of the items
+	ULongPtrArray *m_attnos;
+
+	// most common combinations
+	CMDMCVItemArray *m_items;
+
+public:
+	CMDMCVList(const CMDMCVList &) = delete;
+
+	// ctor
+	CMDMCVList(ULongPtrArray *attnos, CMDMCVItemArray *items);
+
+	// dtor
+	~CMDMCVList() override;
+
+	// attnos of the columns
+	const ULongPtrArray *
+	GetAttnos() const
+	{
+		return m_attnos;
+	}
+
+	// number of most common combinations
+	ULONG
+	ItemCount() const
+	{
+		return m_items->Size();
+	}
+
+	// most common combination at the given position
+	const CMDMCVItem *
+	GetItemAt(ULONG pos) const
+	{
+		return (*m_items)[pos];
+	}
+
+	// serialize in DXL format given a serializer object
+	virtual void Serialize(CXMLSerializer *) const;
+
+#ifdef GPOS_DEBUG
+	// debug print
+	virtual void DebugPrint(IOstream &os) const;
+#endif
+};
+
+// array of multi-column MCV lists
+typedef CDynamicPtrArray<CMDMCVList, CleanupRelease> CMDMCVListArray;
+
+}  // namespace gpmd
+
+#endif	// !GPMD_CMDMCVList_H
+
+// EOF
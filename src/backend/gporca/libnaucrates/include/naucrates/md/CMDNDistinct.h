@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDNDistinct.h
+//
+//	@doc:
+//		Number of distinct values of a combination of columns, as collected
+//		by extended statistics
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CMDNDistinct_H
+#define GPMD_CMDNDistinct_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/common/CDynamicPtrArray.h"
+
+#include "naucrates/md/IMDInterface.h"
+
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+// class for the number of distinct values of a combination of columns
+class CMDNDistinct : public IMDInterface
+{
+private:
+	// attnos of the columns of the combination
+	ULongPtrArray *m_attnos;
+
+	// number of distinct values of the combination
+	CDouble m_ndistinct;
+
+public:
+	CMDNDistinct(const CMDNDistinct &) = delete;
+
+	// ctor
+	CMDNDistinct(ULongPtrArray *attnos, CDouble ndistinct);
+
+	// dtor
+	~CMDNDistinct() override;
+
+	// attnos of the columns of the combination
+	const ULongPtrArray *
+	GetAttnos() const
+	{
+		return m_attnos;
+	}
+
+	// number of distinct values of the combination
+	CDouble
+	GetNDistinct() const
+	{
+		return m_ndistinct;
+	}
+
+	// serialize in DXL format given a serializer object
+	virtual void Serialize(CXMLSerializer *) const;
+
+#ifdef GPOS_DEBUG
+	// debug print
+	virtual void DebugPrint(IOstream &os) const;
+#endif
+};
+
+// array of multi-column distinct values
+typedef CDynamicPtrArray<CMDNDistinct, CleanupRelease> CMDNDistinctArray;
+
+}  // namespace gpmd
+
+#endif	// !GPMD_CMDNDistinct_H
+
+// EOF
@@ -91,6 +91,15 @@ private:
 	// Child partition oids
 	IMdIdArray *m_partition_oids;
 
+	// bound constraints of the child partitions, in root column terms
+	CDXLNodeArray *m_partition_bounds;
+
+	// sorted bounds of a range partitioned relation, and the child partition
+	// of each slot between them
+	CDXLDatumArray *m_part_range_bounds;
+
+	IntPtrArray *m_part_range_slots;
+
 	// array of key sets
 	ULongPtr2dArray *m_keyset_array;
 
@@ -136,7 +145,11 @@ public:
 					IMdIdArray *distr_opfamilies,
 					ULongPtrArray *partition_cols_array,
 					CharPtrArray *str_part_types_array, ULONG num_of_partitions,
-					IMdIdArray *partition_oids, BOOL convert_hash_to_random,
+					IMdIdArray *partition_oids,
+					CDXLNodeArray *partition_bounds,
+					CDXLDatumArray *part_range_bounds,
+					IntPtrArray *part_range_slots,
+					BOOL convert_hash_to_random,
 					ULongPtr2dArray *keyset_array,
 					CMDIndexInfoArray *md_index_info_array,
 					IMdIdArray *mdid_triggers_array,
@@ -260,6 +273,15 @@ public:
 	// child partition oids
 	IMdIdArray *ChildPartitionMdids() const override;
 
+	// bound constraints of the child partitions
+	CDXLNodeArray *ChildPartitionBounds() const override;
+
+	// sorted range bounds of the child partitions
+	CDXLDatumArray *PartRangeBounds() const override;
+
+	// child partition of each slot between the range bounds
+	IntPtrArray *PartRangeSlots() const override;
+
 #ifdef GPOS_DEBUG
 	// debug print of the metadata relation
 	void DebugPrint(IOstream &os) const override;
@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		IMDExtStats.h
+//
+//	@doc:
+//		Interface for the extended statistics of a relation
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_IMDExtStats_H
+#define GPMD_IMDExtStats_H
+
+#include "gpos/base.h"
+
+#include "naucrates/md/IMDCacheObject.h"
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+class CMDNDistinct;
+class CMDDependency;
+class CMDMCVList;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		IMDExtStats
+//
+//	@doc:
+//		Interface for the extended statistics of a relation: the multi-column
+//		distinct values, functional dependencies and MCV lists of all the
+//		statistics objects defined on the relation (CREATE STATISTICS)
+//
+//---------------------------------------------------------------------------
+class IMDExtStats : public IMDCacheObject
+{
+public:
+	// object type
+	Emdtype
+	MDType() const override
+	{
+		return EmdtExtStats;
+	}
+
+	// number of multi-column distinct values
+	virtual ULONG NDistinctCount() const = 0;
+
+	// multi-column distinct values at the given position
+	virtual const CMDNDistinct *GetNDistinctAt(ULONG pos) const = 0;
+
+	// number of functional dependencies
+	virtual ULONG DependencyCount() const = 0;
+
+	// functional dependency at the given position
+	virtual const CMDDependency *GetDependencyAt(ULONG pos) const = 0;
+
+	// number of multi-column MCV lists
+	virtual ULONG MCVListCount() const = 0;
+
+	// multi-column MCV list at the given position
+	virtual const CMDMCVList *GetMCVListAt(ULONG pos) const = 0;
+};
+}  // namespace gpmd
+
+#endif	// !GPMD_IMDExtStats_H
+
+// EOF
@@ -14,6 +14,8 @@
 
 #include "gpos/base.h"
 
+#include "naucrates/dxl/operators/CDXLDatum.h"
+#include "naucrates/dxl/operators/CDXLNode.h"
 #include "naucrates/md/CMDIndexInfo.h"
 #include "naucrates/md/IMDCacheObject.h"
 #include "naucrates/md/IMDColumn.h"
@@ -190,6 +192,34 @@ public:
 		return nullptr;
 	}
 
+	// bound constraints of the child partitions, in terms of the columns of
+	// this relation and in the order of the child partition oids; lets
+	// partitions be eliminated without retrieving their metadata
+	virtual CDXLNodeArray *
+	ChildPartitionBounds() const
+	{
+		return nullptr;
+	}
+
+	// for a relation range partitioned on one column, its finite partition
+	// bounds in ascending order; lets partitions be eliminated by binary
+	// search instead of examining the bound of each one
+	virtual CDXLDatumArray *
+	PartRangeBounds() const
+	{
+		return nullptr;
+	}
+
+	// for each slot between consecutive range bounds, the position of the
+	// child partition holding its values, or -1 if there is none; slot i
+	// holds the values below range bound i and not below range bound i-1,
+	// so there is one slot more than there are bounds
+	virtual IntPtrArray *
+	PartRangeSlots() const
+	{
+		return nullptr;
+	}
+
 	// relation distribution policy as a string value
 	static const CWStringConst *GetDistrPolicyStr(
 		Ereldistrpolicy rel_distr_policy);
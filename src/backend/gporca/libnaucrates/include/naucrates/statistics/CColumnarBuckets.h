@@ -0,0 +1,140 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CColumnarBuckets.h
+//
+//	@doc:
+//		Columnar copy of the buckets of a histogram, for lookups that do
+//		not go through the bucket and datum objects
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CColumnarBuckets_H
+#define GPNAUCRATES_CColumnarBuckets_H
+
+#include "gpos/base.h"
+
+#include "naucrates/statistics/CBucket.h"
+
+namespace gpnaucrates
+{
+using namespace gpos;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CColumnarBuckets
+//
+//	@doc:
+//		Parallel arrays of the mapped bounds, frequencies, NDVs and bound
+//		closedness of the buckets of a histogram.
+//
+//		It is only created when comparing the mapped values of the bounds
+//		is the same as comparing the points of the buckets: either all
+//		bounds map to LINTs that doubles represent exactly, or all bounds
+//		map to doubles at least twice CStatistics::Epsilon apart, so that
+//		a value is within Epsilon of at most one bound; the buckets must
+//		also be ordered and disjoint. A point is mapped to the bound it is
+//		equal to, if any, after which all comparisons are exact.
+//
+//---------------------------------------------------------------------------
+class CColumnarBuckets
+{
+private:
+	// number of buckets
+	const ULONG m_size;
+
+	// are bounds compared by their LINT mapping
+	const BOOL m_lint_mapped;
+
+	// datum of the first lower bound, owned by the buckets of the histogram
+	const IDatum *m_datum;
+
+	// mapped bounds
+	DOUBLE *m_lower;
+	DOUBLE *m_upper;
+
+	// frequencies and number of distinct values
+	DOUBLE *m_frequency;
+	DOUBLE *m_distinct;
+
+	// bits of the buckets with open upper bounds
+	ULLONG *m_upper_open;
+
+	// ctor
+	CColumnarBuckets(CMemoryPool *mp, ULONG size, BOOL lint_mapped,
+					 const IDatum *datum);
+
+	// map a datum like the bounds of the buckets
+	BOOL FMapDatum(const IDatum *datum, DOUBLE *value) const;
+
+	// is the upper bound of the given bucket open
+	BOOL
+	IsUpperOpen(ULONG pos) const
+	{
+		return 0 != ((m_upper_open[pos / 64] >> (pos % 64)) & 1);
+	}
+
+	// does the given bucket end before the given value; unless strict, a
+	// bucket whose open upper bound equals the value also ends before it
+	BOOL
+	IsBefore(ULONG pos, DOUBLE value, BOOL strict) const
+	{
+		return m_upper[pos] < value ||
+			   (!strict && m_upper[pos] == value && IsUpperOpen(pos));
+	}
+
+	// first bucket from the given one that does not end before the value
+	ULONG FirstBucketNotBefore(DOUBLE value, BOOL strict, ULONG start) const;
+
+public:
+	CColumnarBuckets(const CColumnarBuckets &) = delete;
+
+	// dtor
+	~CColumnarBuckets();
+
+	// create columnar buckets, or return null if the buckets do not allow it
+	static CColumnarBuckets *PcbCreate(CMemoryPool *mp,
+									   const CBucketArray *buckets);
+
+	// map a point to a value that compares to the bounds of the buckets as
+	// the point does; false if the point cannot be mapped
+	BOOL FMapPoint(const CPoint *point, DOUBLE *value) const;
+
+	// map the lower bound of the bucket of another histogram; false if it
+	// cannot be mapped
+	BOOL
+	FMapLowerBound(const CBucket *bucket, DOUBLE *value) const
+	{
+		return FMapPoint(bucket->GetLowerBound(), value);
+	}
+
+	// first bucket that the point with the given value is not after; only
+	// that bucket can contain the point
+	ULONG
+	LookupPoint(DOUBLE value) const
+	{
+		return FirstBucketNotBefore(value, false /*strict*/, 0);
+	}
+
+	// first bucket from the given one whose upper bound is not less than
+	// the given value; the buckets skipped end before the value
+	ULONG
+	SkipBucketsBefore(DOUBLE value, ULONG start) const
+	{
+		return FirstBucketNotBefore(value, true /*strict*/, start);
+	}
+
+	// sum of frequencies of buckets
+	CDouble GetFrequency() const;
+
+	// sum of number of distinct values of buckets
+	CDouble GetNumDistinct() const;
+
+};	// class CColumnarBuckets
+
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CColumnarBuckets_H
+
+// EOF
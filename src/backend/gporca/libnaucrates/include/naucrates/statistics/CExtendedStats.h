@@ -0,0 +1,234 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CExtendedStats.h
+//
+//	@doc:
+//		Multi-column statistics of a source relation, from its extended
+//		statistics, keyed on column ids
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CExtendedStats_H
+#define GPNAUCRATES_CExtendedStats_H
+
+#include "gpos/base.h"
+#include "gpos/common/CBitSet.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CRefCount.h"
+
+#include "gpopt/base/CColRef.h"
+#include "naucrates/base/IDatum.h"
+
+namespace gpnaucrates
+{
+using namespace gpos;
+using namespace gpopt;
+
+// forward decl
+class CExtendedStats;
+
+// dynamic array of extended stats
+typedef CDynamicPtrArray<CExtendedStats, CleanupRelease> CExtendedStatsArray;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CExtendedStats
+//
+//	@doc:
+//		Multi-column distinct values, functional dependencies and most
+//		common combinations of values of the columns of one source
+//		relation, as collected by the extended statistics (CREATE
+//		STATISTICS) of the relation. Columns are identified by their column
+//		ids, so the object is shared by all the statistics objects derived
+//		from the source, and copied only when the column ids are remapped.
+//
+//---------------------------------------------------------------------------
+class CExtendedStats : public CRefCount
+{
+public:
+	// number of distinct values of a combination of columns
+	struct SNDistinct
+	{
+		// column ids of the combination
+		CBitSet *m_colids;
+
+		// number of distinct values of the combination
+		CDouble m_ndistinct;
+
+		// ctor
+		SNDistinct(CBitSet *colids, CDouble ndistinct)
+			: m_colids(colids), m_ndistinct(ndistinct)
+		{
+			GPOS_ASSERT(1 < colids->Size());
+		}
+
+		// dtor
+		~SNDistinct()
+		{
+			m_colids->Release();
+		}
+	};
+
+	// functional dependency of a column on a set of columns; the degree is
+	// the fraction of rows for which the dependency holds
+	struct SDependency
+	{
+		// column ids of the determining columns
+		CBitSet *m_from_colids;
+
+		// column id of the dependent column
+		ULONG m_to_colid;
+
+		// degree of validity, between 0 and 1
+		CDouble m_degree;
+
+		// ctor
+		SDependency(CBitSet *from_colids, ULONG to_colid, CDouble degree)
+			: m_from_colids(from_colids),
+			  m_to_colid(to_colid),
+			  m_degree(degree)
+		{
+			GPOS_ASSERT(!from_colids->Get(to_colid));
+		}
+
+		// dtor
+		~SDependency()
+		{
+			m_from_colids->Release();
+		}
+	};
+
+	// one of the most common combinations of values of a group of columns
+	struct SMCVItem
+	{
+		// values of the combination, one per column of the list
+		IDatumArray *m_values;
+
+		// fraction of rows with the combination
+		CDouble m_frequency;
+
+		// fraction of rows with the combination if the columns were
+		// independent, the product of the frequencies of each value
+		CDouble m_base_frequency;
+
+		// ctor
+		SMCVItem(IDatumArray *values, CDouble frequency,
+				 CDouble base_frequency)
+			: m_values(values),
+			  m_frequency(frequency),
+			  m_base_frequency(base_frequency)
+		{
+		}
+
+		// dtor
+		~SMCVItem()
+		{
+			m_values->Release();
+		}
+	};
+
+	typedef CDynamicPtrArray<SMCVItem, CleanupDelete> SMCVItemArray;
+
+	// most common combinations of values of a group of columns
+	struct SMCVList
+	{
+		// column id of each value of the items, or gpos::ulong_max for
+		// a column that is not mapped
+		ULongPtrArray *m_colids;
+
+		// the combinations, shared by the copies of the list
+		SMCVItemArray *m_items;
+
+		// ctor
+		SMCVList(ULongPtrArray *colids, SMCVItemArray *items)
+			: m_colids(colids), m_items(items)
+		{
+		}
+
+		// dtor
+		~SMCVList()
+		{
+			m_colids->Release();
+			m_items->Release();
+		}
+	};
+
+	typedef CDynamicPtrArray<SNDistinct, CleanupDelete> SNDistinctArray;
+	typedef CDynamicPtrArray<SDependency, CleanupDelete> SDependencyArray;
+	typedef CDynamicPtrArray<SMCVList, CleanupDelete> SMCVListArray;
+
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// multi-column distinct values
+	SNDistinctArray *m_ndistincts;
+
+	// functional dependencies
+	SDependencyArray *m_dependencies;
+
+	// multi-column most common values
+	SMCVListArray *m_mcv_lists;
+
+	// remap the column ids of a set; return null if a column is not mapped
+	static CBitSet *RemapColIds(CMemoryPool *mp, const CBitSet *colids,
+								UlongToColRefMap *colref_mapping);
+
+public:
+	CExtendedStats(const CExtendedStats &) = delete;
+
+	// ctor
+	explicit CExtendedStats(CMemoryPool *mp);
+
+	// dtor
+	~CExtendedStats() override;
+
+	// add the number of distinct values of a combination of columns
+	void AddNDistinct(CBitSet *colids, CDouble ndistinct);
+
+	// add a functional dependency
+	void AddDependency(CBitSet *from_colids, ULONG to_colid, CDouble degree);
+
+	// add the most common combinations of values of a group of columns
+	void AddMCVList(ULongPtrArray *colids, SMCVItemArray *items);
+
+	// is there any multi-column statistic
+	BOOL
+	IsEmpty() const
+	{
+		return 0 == m_ndistincts->Size() && 0 == m_dependencies->Size() &&
+			   0 == m_mcv_lists->Size();
+	}
+
+	// copy with remapped column ids; statistics on a column that is not
+	// mapped are dropped, and null is returned if none is left
+	CExtendedStats *CopyWithRemap(CMemoryPool *mp,
+								  UlongToColRefMap *colref_mapping) const;
+
+	// print function
+	IOstream &OsPrint(IOstream &os) const;
+
+	// the multi-column distinct values over the most columns, all of which
+	// are in the given set, among those of the given sources; null if there
+	// is none
+	static const SNDistinct *FindNDistinct(
+		const CExtendedStatsArray *ext_stats_array, const CBitSet *colids);
+
+	// the strongest dependency between columns of the given set, among
+	// those of the given sources; null if there is none
+	static const SDependency *FindDependency(
+		const CExtendedStatsArray *ext_stats_array, const CBitSet *colids);
+
+	// the multi-column most common values with the most of their columns,
+	// at least two, in the given set, among those of the given sources;
+	// null if there is none
+	static const SMCVList *FindMCVList(
+		const CExtendedStatsArray *ext_stats_array, const CBitSet *colids);
+};
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CExtendedStats_H
+
+// EOF
@@ -60,17 +60,52 @@ private:
 												 CDouble *last_scale_factor,
 												 ULONG *target_last_colid);
 
+	// create a new histogram after applying a pred <> ALL(ARRAY[...]) filter
+	static CHistogram *MakeHistArrayCmpAllFilter(CMemoryPool *mp,
+												 CStatsPredArrayCmp *pred_stats,
+												 CBitSet *filter_colids,
+												 CHistogram *hist_before,
+												 CDouble *last_scale_factor,
+												 ULONG *target_last_colid);
+
+	// sorted and deduplicated non-null points of an array comparison
+	static CPointArray *MakeSortedDistinctPoints(CMemoryPool *mp,
+												 CStatsPredArrayCmp *pred_stats);
+
 	// create a new hash map of histograms after applying a conjunctive or disjunctive filter
 	static UlongToHistogramMap *MakeHistHashMapConjOrDisjFilter(
 		CMemoryPool *mp, const CStatisticsConfig *stats_config,
 		UlongToHistogramMap *input_histograms, CDouble input_rows,
-		CStatsPred *pred_stats, CDouble *scale_factor);
+		CStatsPred *pred_stats, CDouble *scale_factor,
+		const CExtendedStatsArray *ext_stats);
 
 	// create new hash map of histograms after applying the conjunction predicate
 	static UlongToHistogramMap *MakeHistHashMapConjFilter(
 		CMemoryPool *mp, const CStatisticsConfig *stats_config,
 		UlongToHistogramMap *intermediate_histograms, CDouble input_rows,
-		CStatsPredConj *conjunctive_pred_stats, CDouble *scale_factor);
+		CStatsPredConj *conjunctive_pred_stats, CDouble *scale_factor,
+		const CExtendedStatsArray *ext_stats);
+
+	// correct the scale factors of equality predicates on columns for the
+	// most common combinations of values of the columns
+	static void ApplyMCVLists(CMemoryPool *mp,
+							  const CExtendedStatsArray *ext_stats,
+							  CStatsPredConj *conjunctive_pred_stats,
+							  const ULongPtrArray *scale_factor_colids,
+							  CBitSet *eq_colids, CDoubleArray *scale_factors);
+
+	// does the value of a column in a most common combination satisfy the
+	// equality predicates on the column
+	static BOOL IsMCVValueMatch(CStatsPredConj *conjunctive_pred_stats,
+								ULONG colid, const IDatum *value,
+								BOOL *is_comparable);
+
+	// correct the scale factors of equality predicates on columns that
+	// functionally depend on other such columns
+	static void ApplyDependencies(const CExtendedStatsArray *ext_stats,
+								  const ULongPtrArray *scale_factor_colids,
+								  CBitSet *eq_colids,
+								  CDoubleArray *scale_factors);
 
 	// create new hash map of histograms after applying the disjunctive predicate
 	static UlongToHistogramMap *MakeHistHashMapDisjFilter(
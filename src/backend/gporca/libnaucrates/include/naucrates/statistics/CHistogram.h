@@ -12,10 +12,13 @@
 #define GPNAUCRATES_CHistogram_H
 
 #include "gpos/base.h"
+#include "gpos/common/CFlatHashMapIter.h"
+#include "gpos/common/CRefCount.h"
 #include "gpos/common/DbgPrintMixin.h"
 
 #include "gpopt/base/CKHeap.h"
 #include "naucrates/statistics/CBucket.h"
+#include "naucrates/statistics/CColumnarBuckets.h"
 #include "naucrates/statistics/CStatsPred.h"
 
 namespace gpopt
@@ -36,20 +39,24 @@ typedef CDynamicPtrArray<CDouble, CleanupDelete> CDoubleArray;
 //		CHistogram
 //
 //	@doc:
+//		Histogram of a column; histograms are ref-counted and are not
+//		modified once they are added to a map of histograms, so that the
+//		statistics of an operator share the histograms of the columns it
+//		leaves untouched with the statistics of its children
 //
 //---------------------------------------------------------------------------
-class CHistogram : public gpos::DbgPrintMixin<CHistogram>
+class CHistogram : public CRefCount, public gpos::DbgPrintMixin<CHistogram>
 {
 	// hash map from column id to a histogram
-	typedef CHashMap<ULONG, CHistogram, gpos::HashValue<ULONG>,
-					 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
-					 CleanupDelete<CHistogram> >
+	typedef CFlatHashMap<ULONG, CHistogram, gpos::HashValue<ULONG>,
+						 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
+						 CleanupRelease<CHistogram> >
 		UlongToHistogramMap;
 
 	// iterator
-	typedef CHashMapIter<ULONG, CHistogram, gpos::HashValue<ULONG>,
-						 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
-						 CleanupDelete<CHistogram> >
+	typedef CFlatHashMapIter<ULONG, CHistogram, gpos::HashValue<ULONG>,
+							 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
+							 CleanupRelease<CHistogram> >
 		UlongToHistogramMapIter;
 
 	// hash map from column ULONG to CDouble
@@ -97,6 +104,24 @@ private:
 	// is column statistics missing in the database
 	BOOL m_is_col_stats_missing;
 
+	// columnar copy of the buckets, built once the histogram is looked up
+	// more than once, so that histograms used once do not pay for it
+	mutable CColumnarBuckets *m_columnar_buckets;
+
+	// number of lookups of the buckets, until the columnar copy is built
+	mutable ULONG m_num_lookups;
+
+	// columnar copy of the buckets, or null if there is none yet or the
+	// buckets do not allow it
+	const CColumnarBuckets *GetColumnarBuckets() const;
+
+	// drop the columnar copy, when the buckets are replaced
+	void ResetColumnarBuckets();
+
+	// index of the only bucket that may contain the point; all buckets
+	// before it end before the point
+	ULONG FindBucketForPoint(const CPoint *point) const;
+
 	// return an array buckets after applying equality filter on the histogram buckets
 	CBucketArray *MakeBucketsWithEqualityFilter(CPoint *point) const;
 
@@ -355,13 +380,25 @@ public:
 	// is histogram well formed
 	BOOL IsValid() const;
 
-	// return copy of histogram
+	// return copy of histogram, to be modified by the caller
 	CHistogram *CopyHistogram() const;
 
+	// return histogram itself with an added reference, for a map of
+	// histograms that does not modify it
+	CHistogram *
+	ShareHistogram() const
+	{
+		CHistogram *histogram = const_cast<CHistogram *>(this);
+		histogram->AddRef();
+
+		return histogram;
+	}
+
 	// destructor
-	virtual ~CHistogram()
+	~CHistogram() override
 	{
 		m_histogram_buckets->Release();
+		GPOS_DELETE(m_columnar_buckets);
 	}
 
 	// normalize histogram and return scaling factor
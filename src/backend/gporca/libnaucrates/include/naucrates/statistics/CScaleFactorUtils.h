@@ -12,6 +12,7 @@
 #define GPOPT_CScaleFactorUtils_H
 
 #include "gpos/base.h"
+#include "gpos/common/CHashMapIter.h"
 
 #include "gpopt/engine/CStatisticsConfig.h"
 #include "naucrates/statistics/CHistogram.h"
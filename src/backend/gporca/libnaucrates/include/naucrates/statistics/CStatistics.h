@@ -13,8 +13,10 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CBitSet.h"
+#include "gpos/common/CHashMapIter.h"
 #include "gpos/string/CWStringDynamic.h"
 
+#include "naucrates/statistics/CExtendedStats.h"
 #include "naucrates/statistics/CHistogram.h"
 #include "naucrates/statistics/CStatsPredArrayCmp.h"
 #include "naucrates/statistics/CStatsPredConj.h"
@@ -114,6 +116,9 @@ private:
 	// source can be one of the following operators: like Get, Group By, and Project
 	CUpperBoundNDVPtrArray *m_src_upper_bound_NDVs;
 
+	// multi-column statistics of the sources, from their extended statistics
+	CExtendedStatsArray *m_ext_stats;
+
 	// the default value for operators that have no cardinality estimation risk
 	static const ULONG no_card_est_risk_default_val;
 
@@ -288,6 +293,9 @@ public:
 	// add upper bound of source cardinality
 	virtual void AddCardUpperBound(CUpperBoundNDVs *upper_bound_NDVs);
 
+	// add multi-column statistics of a source
+	virtual void AddExtendedStats(CExtendedStats *ext_stats);
+
 	// return the upper bound of the number of distinct values for a given column
 	virtual CDouble GetColUpperBoundNDVs(const CColRef *colref);
 
@@ -314,6 +322,13 @@ public:
 	{
 		return m_src_upper_bound_NDVs;
 	}
+
+	CExtendedStatsArray *
+	GetExtendedStats() const
+	{
+		return m_ext_stats;
+	}
+
 	// create an empty statistics object
 	static CStatistics *
 	MakeEmptyStats(CMemoryPool *mp)
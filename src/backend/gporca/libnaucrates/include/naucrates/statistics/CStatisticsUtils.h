@@ -112,6 +112,14 @@ private:
 		CDoubleArray *output_ndvs  // output array of NDV
 	);
 
+	// add the multi-column NDVs of the extended statistics that cover the
+	// grouping columns, and return the grouping columns left uncovered
+	static ULongPtrArray *AddMultiColumnNdvs(
+		CMemoryPool *mp, const CStatistics *input_stats,
+		const ULongPtrArray *grouping_columns,
+		CDoubleArray *output_ndvs  // output array of NDV
+	);
+
 	// compute max number of groups when grouping on columns from the given source
 	static CDouble MaxNumGroupsForGivenSrcGprCols(
 		CMemoryPool *mp, const CStatisticsConfig *stats_config,
@@ -13,7 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CBitSet.h"
-#include "gpos/common/CHashMapIter.h"
+#include "gpos/common/CFlatHashMapIter.h"
 
 #include "gpopt/base/CColRef.h"
 #include "naucrates/md/CDXLStatsDerivedRelation.h"
@@ -39,14 +39,15 @@ using namespace gpopt;
 class IStatistics;
 
 // hash map from column id to a histogram
-typedef CHashMap<ULONG, CHistogram, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
-				 CleanupDelete<ULONG>, CleanupDelete<CHistogram> >
+typedef CFlatHashMap<ULONG, CHistogram, gpos::HashValue<ULONG>,
+					 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
+					 CleanupRelease<CHistogram> >
 	UlongToHistogramMap;
 
 // iterator
-typedef CHashMapIter<ULONG, CHistogram, gpos::HashValue<ULONG>,
-					 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
-					 CleanupDelete<CHistogram> >
+typedef CFlatHashMapIter<ULONG, CHistogram, gpos::HashValue<ULONG>,
+						 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
+						 CleanupRelease<CHistogram> >
 	UlongToHistogramMapIter;
 
 // hash map from column ULONG to CDouble
@@ -210,6 +210,10 @@ enum EOptTraceFlag
 	// Use legacy (cdbhash) opfamilies for compatibility
 	EopttraceUseLegacyOpfamilies = 103039,
 
+	// Pick the search stages and their time thresholds from the estimated
+	// size of the search space
+	EopttraceEnableAdaptiveSearch = 103040,
+
 	///////////////////////////////////////////////////////
 	///////////////////// statistics flags ////////////////
 	//////////////////////////////////////////////////////
@@ -240,6 +244,11 @@ enum EOptTraceFlag
 
 	// Use experimental cost model
 	EopttraceExperimentalCostModel = 104009,
+
+	// derive the statistics of a partitioned table by merging those of the
+	// leaf partitions that survive static partition elimination
+	EopttraceMergeLeafPartitionStats = 104010,
+
 	///////////////////////////////////////////////////////
 	/////////// constant expression evaluator flags ///////
 	///////////////////////////////////////////////////////
@@ -249,6 +258,10 @@ enum EOptTraceFlag
 	// do not use the built-in evaluators for integers in constraint derivation
 	EopttraceUseExternalConstantExpressionEvaluationForInts = 105001,
 
+	// the default collation orders text types bytewise, so that they can be
+	// compared without the constant expression evaluator
+	EopttraceDefaultCollationIsC = 105002,
+
 	// is nestloop params enabled, it is only enabled in GPDB 6.x onwards.
 	EopttraceIndexedNLJOuterRefAsParams = 106000,
 
@@ -39,6 +39,8 @@
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
 #include "naucrates/dxl/parser/CParseHandlerPlan.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "naucrates/md/CDXLStatsDerivedRelation.h"
@@ -62,6 +64,7 @@ XERCES_CPP_NAMESPACE_USE
 //		Start the parsing of the given DXL string and return the top-level parser.
 //		If a non-empty XSD schema location is provided, the DXL is validated against
 //		that schema, and an exception is thrown if the DXL does not conform.
+//		Binary DXL is decoded without validation.
 //
 //---------------------------------------------------------------------------
 CParseHandlerDXL *
@@ -70,6 +73,11 @@ CDXLUtils::GetParseHandlerForDXLString(CMemoryPool *mp, const CHAR *dxl_string,
 {
 	GPOS_ASSERT(nullptr != mp);
 
+	if (IsBinaryDXL(dxl_string))
+	{
+		return GetParseHandlerForBinaryDXL(mp, dxl_string);
+	}
+
 	// setup own memory manager
 	CDXLMemoryManager *memory_manager = GPOS_NEW(mp) CDXLMemoryManager(mp);
 	SAX2XMLReader *sax_2_xml_reader =
@@ -148,6 +156,7 @@ CDXLUtils::GetParseHandlerForDXLString(CMemoryPool *mp, const CHAR *dxl_string,
 //		Start the parsing of the given DXL string and return the top-level parser.
 //		If a non-empty XSD schema location is provided, the DXL is validated against
 //		that schema, and an exception is thrown if the DXL does not conform.
+//		Binary DXL is decoded without validation.
 //
 //---------------------------------------------------------------------------
 CParseHandlerDXL *
@@ -156,6 +165,14 @@ CDXLUtils::GetParseHandlerForDXLFile(CMemoryPool *mp, const CHAR *dxl_filename,
 {
 	GPOS_ASSERT(nullptr != mp);
 
+	if (IsBinaryDXLFile(dxl_filename))
+	{
+		CAutoRg<CHAR> binary_dxl;
+		binary_dxl = Read(mp, dxl_filename);
+
+		return GetParseHandlerForBinaryDXL(mp, binary_dxl.Rgt());
+	}
+
 	// setup own memory manager
 	CDXLMemoryManager mm(mp);
 	SAX2XMLReader *sax_2_xml_reader = nullptr;
@@ -257,6 +274,176 @@ CDXLUtils::GetParseHandlerForDXLString(CMemoryPool *mp,
 
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::GetParseHandlerForBinaryDXL
+//
+//	@doc:
+//		Decode the given binary DXL document, passing its elements to the
+//		parse handlers as the XML parser would, and return the top-level
+//		parser
+//
+//---------------------------------------------------------------------------
+CParseHandlerDXL *
+CDXLUtils::GetParseHandlerForBinaryDXL(CMemoryPool *mp, const CHAR *binary_dxl)
+{
+	GPOS_ASSERT(nullptr != mp);
+
+	CDXLMemoryManager mm(mp);
+	CParseHandlerManager parse_handler_mgr(&mm, nullptr /*xml_reader*/);
+	CParseHandlerDXL *parse_handler_dxl =
+		CParseHandlerFactory::GetParseHandlerDXL(mp, &parse_handler_mgr);
+	parse_handler_mgr.ActivateParseHandler(parse_handler_dxl);
+
+	GPOS_TRY
+	{
+		CDXLBinaryReader binary_reader(&mm, binary_dxl);
+		binary_reader.Parse(&parse_handler_mgr);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		GPOS_DELETE(parse_handler_dxl);
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+
+	GPOS_CHECK_ABORT;
+
+	return parse_handler_dxl;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::IsBinaryDXL
+//
+//	@doc:
+//		Does the given DXL string hold a binary DXL document
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLUtils::IsBinaryDXL(const CHAR *dxl_string)
+{
+	return CDXLBinaryReader::IsBinary(dxl_string);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::IsBinaryDXLFile
+//
+//	@doc:
+//		Does the given file start with the magic bytes of binary DXL; a file
+//		that cannot be read is left for the XML parser to report
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLUtils::IsBinaryDXLFile(const CHAR *dxl_filename)
+{
+	const ULONG magic_size = GPOS_ARRAY_SIZE(GPDXL_BINARY_MAGIC) - 1;
+	CHAR magic[GPOS_ARRAY_SIZE(GPDXL_BINARY_MAGIC)];
+	ULONG_PTR read_bytes = 0;
+
+	GPOS_TRY
+	{
+		CFileReader fr;
+		fr.Open(dxl_filename);
+		if (magic_size <= fr.FileSize())
+		{
+			read_bytes = fr.ReadBytesToBuffer((BYTE *) magic, magic_size);
+		}
+		fr.Close();
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		GPOS_RESET_EX;
+	}
+	GPOS_CATCH_END;
+
+	magic[read_bytes] = '\0';
+
+	return magic_size == read_bytes && IsBinaryDXL(magic);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::EncodeBinaryDXL
+//
+//	@doc:
+//		Parse the given XML DXL document and encode it as binary DXL. The
+//		function allocates the result from the provided memory pool, and it
+//		is the responsibility of the caller to deallocate it.
+//
+//---------------------------------------------------------------------------
+CHAR *
+CDXLUtils::EncodeBinaryDXL(CMemoryPool *mp, const CHAR *dxl_string,
+						   ULONG *size)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != dxl_string);
+	GPOS_ASSERT(!IsBinaryDXL(dxl_string));
+
+	CDXLMemoryManager mm(mp);
+	SAX2XMLReader *sax_2_xml_reader = XMLReaderFactory::createXMLReader(&mm);
+
+	// namespace declarations are needed to write the document back as XML
+	sax_2_xml_reader->setFeature(XMLUni::fgSAX2CoreNameSpacePrefixes, true);
+
+	CDXLBinaryWriter binary_writer(mp);
+	sax_2_xml_reader->setContentHandler(&binary_writer);
+	sax_2_xml_reader->setErrorHandler(&binary_writer);
+
+	MemBufInputSource input_src_memory_buffer(
+		(const XMLByte *) dxl_string, strlen(dxl_string), "dxl binary", false,
+		&mm);
+
+	try
+	{
+		sax_2_xml_reader->parse(input_src_memory_buffer);
+	}
+	catch (const XMLException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+	catch (const SAXException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+
+	delete sax_2_xml_reader;
+
+	return binary_writer.DetachBuffer(size);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::DecodeBinaryDXL
+//
+//	@doc:
+//		Write the given binary DXL document as XML
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+CDXLUtils::DecodeBinaryDXL(CMemoryPool *mp, const CHAR *binary_dxl,
+						   BOOL indentation)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != binary_dxl);
+
+	CAutoP<CWStringDynamic> string_var(GPOS_NEW(mp) CWStringDynamic(mp));
+
+	// create a string stream to hold the result of serialization
+	COstreamString oss(string_var.Value());
+
+	CXMLSerializer xml_serializer(mp, oss, indentation);
+	CDXLMemoryManager mm(mp);
+	CDXLBinaryReader binary_reader(&mm, binary_dxl);
+	binary_reader.Serialize(&xml_serializer);
+
+	GPOS_CHECK_ABORT;
+	return string_var.Reset();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::GetPlanDXLNode
@@ -94,6 +94,12 @@ gpdxl::EresExceptionInit(CMemoryPool *mp)
 			0,	//
 			GPOS_WSZ_WSZLEN("Incorrect Number of children")),
 
+		CMessage(CException(gpdxl::ExmaDXL, gpdxl::ExmiDXLMalformedBinary),
+				 CException::ExsevError,
+				 GPOS_WSZ_WSZLEN("Malformed binary DXL document at byte %d"),
+				 1,	 // position
+				 GPOS_WSZ_WSZLEN("Malformed binary DXL document")),
+
 		CMessage(
 			CException(gpdxl::ExmaDXL, gpdxl::ExmiPlStmt2DXLConversion),
 			CException::ExsevError,
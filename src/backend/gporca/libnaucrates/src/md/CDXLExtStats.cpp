@@ -0,0 +1,196 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLExtStats.cpp
+//
+//	@doc:
+//		Implementation of the class for representing the extended statistics
+//		of a relation in DXL
+//---------------------------------------------------------------------------
+
+#include "naucrates/md/CDXLExtStats.h"
+
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRef.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::CDXLExtStats
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLExtStats::CDXLExtStats(CMemoryPool *mp, CMDIdExtStats *ext_stats_mdid,
+						   CMDName *mdname, CMDNDistinctArray *ndistincts,
+						   CMDDependencyArray *dependencies,
+						   CMDMCVListArray *mcv_lists)
+	: m_mp(mp),
+	  m_ext_stats_mdid(ext_stats_mdid),
+	  m_mdname(mdname),
+	  m_ndistincts(ndistincts),
+	  m_dependencies(dependencies),
+	  m_mcv_lists(mcv_lists)
+{
+	GPOS_ASSERT(ext_stats_mdid->IsValid());
+	GPOS_ASSERT(nullptr != ndistincts);
+	GPOS_ASSERT(nullptr != dependencies);
+	GPOS_ASSERT(nullptr != mcv_lists);
+
+	m_dxl_str = CDXLUtils::SerializeMDObj(
+		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::~CDXLExtStats
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLExtStats::~CDXLExtStats()
+{
+	GPOS_DELETE(m_mdname);
+	GPOS_DELETE(m_dxl_str);
+	m_ext_stats_mdid->Release();
+	m_ndistincts->Release();
+	m_dependencies->Release();
+	m_mcv_lists->Release();
+}
+
+// metadata id of the extended stats
+IMDId *
+CDXLExtStats::MDId() const
+{
+	return m_ext_stats_mdid;
+}
+
+// name of the relation
+CMDName
+CDXLExtStats::Mdname() const
+{
+	return *m_mdname;
+}
+
+// DXL string for this object
+const CWStringDynamic *
+CDXLExtStats::GetStrRepr() const
+{
+	return m_dxl_str;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::Serialize
+//
+//	@doc:
+//		Serialize extended stats in DXL format
+//
+//---------------------------------------------------------------------------
+void
+CDXLExtStats::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenExtStats));
+
+	m_ext_stats_mdid->Serialize(xml_serializer,
+								CDXLTokens::GetDXLTokenStr(EdxltokenMdid));
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenName),
+								 m_mdname->GetMDName());
+
+	for (ULONG ul = 0; ul < m_ndistincts->Size(); ul++)
+	{
+		(*m_ndistincts)[ul]->Serialize(xml_serializer);
+		GPOS_CHECK_ABORT;
+	}
+
+	for (ULONG ul = 0; ul < m_dependencies->Size(); ul++)
+	{
+		(*m_dependencies)[ul]->Serialize(xml_serializer);
+		GPOS_CHECK_ABORT;
+	}
+
+	for (ULONG ul = 0; ul < m_mcv_lists->Size(); ul++)
+	{
+		(*m_mcv_lists)[ul]->Serialize(xml_serializer);
+		GPOS_CHECK_ABORT;
+	}
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenExtStats));
+}
+
+#ifdef GPOS_DEBUG
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::DebugPrint
+//
+//	@doc:
+//		Prints the extended stats to the provided output
+//
+//---------------------------------------------------------------------------
+void
+CDXLExtStats::DebugPrint(IOstream &os) const
+{
+	os << "Extended stats id: ";
+	MDId()->OsPrint(os);
+	os << std::endl;
+
+	os << "Relation name: " << (Mdname()).GetMDName()->GetBuffer() << std::endl;
+
+	for (ULONG ul = 0; ul < m_ndistincts->Size(); ul++)
+	{
+		(*m_ndistincts)[ul]->DebugPrint(os);
+	}
+
+	for (ULONG ul = 0; ul < m_dependencies->Size(); ul++)
+	{
+		(*m_dependencies)[ul]->DebugPrint(os);
+	}
+
+	for (ULONG ul = 0; ul < m_mcv_lists->Size(); ul++)
+	{
+		(*m_mcv_lists)[ul]->DebugPrint(os);
+	}
+}
+
+#endif	// GPOS_DEBUG
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::CreateDXLDummyExtStats
+//
+//	@doc:
+//		Dummy extended stats, for relations with no statistics objects
+//
+//---------------------------------------------------------------------------
+CDXLExtStats *
+CDXLExtStats::CreateDXLDummyExtStats(CMemoryPool *mp, IMDId *mdid)
+{
+	CMDIdExtStats *ext_stats_mdid = CMDIdExtStats::CastMdid(mdid);
+	CAutoP<CWStringDynamic> str;
+	str = GPOS_NEW(mp) CWStringDynamic(mp, ext_stats_mdid->GetBuffer());
+	CAutoP<CMDName> mdname;
+	mdname = GPOS_NEW(mp) CMDName(mp, str.Value());
+	CAutoRef<CDXLExtStats> ext_stats_dxl;
+	ext_stats_dxl = GPOS_NEW(mp)
+		CDXLExtStats(mp, ext_stats_mdid, mdname.Value(),
+					 GPOS_NEW(mp) CMDNDistinctArray(mp),
+					 GPOS_NEW(mp) CMDDependencyArray(mp),
+					 GPOS_NEW(mp) CMDMCVListArray(mp));
+	mdname.Reset();
+	return ext_stats_dxl.Reset();
+}
+
+// EOF
@@ -0,0 +1,79 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDDependency.cpp
+//
+//	@doc:
+//		Implementation of the class for representing functional dependencies
+//		between columns
+//---------------------------------------------------------------------------
+
+#include "naucrates/md/CMDDependency.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+// ctor
+CMDDependency::CMDDependency(ULongPtrArray *from_attnos, ULONG to_attno,
+							 CDouble degree)
+	: m_from_attnos(from_attnos), m_to_attno(to_attno), m_degree(degree)
+{
+	GPOS_ASSERT(nullptr != from_attnos);
+	GPOS_ASSERT(0 < from_attnos->Size());
+	GPOS_ASSERT(CDouble(0.0) <= degree && CDouble(1.0) >= degree);
+}
+
+// dtor
+CMDDependency::~CMDDependency()
+{
+	m_from_attnos->Release();
+}
+
+// serialize in DXL format
+void
+CMDDependency::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVDependency));
+
+	CWStringDynamic *from_attnos_str =
+		CDXLUtils::Serialize(xml_serializer->Pmp(), m_from_attnos);
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenKeys),
+								 from_attnos_str);
+	GPOS_DELETE(from_attnos_str);
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenAttno),
+								 m_to_attno);
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVDependencyDegree), m_degree);
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVDependency));
+}
+
+#ifdef GPOS_DEBUG
+// prints the dependency to the provided output
+void
+CMDDependency::DebugPrint(IOstream &os) const
+{
+	os << "Dependency (";
+	for (ULONG ul = 0; ul < m_from_attnos->Size(); ul++)
+	{
+		if (0 < ul)
+		{
+			os << ", ";
+		}
+		os << *(*m_from_attnos)[ul];
+	}
+	os << ") => " << m_to_attno << ": " << m_degree << std::endl;
+}
+
+#endif	// GPOS_DEBUG
+
+// EOF
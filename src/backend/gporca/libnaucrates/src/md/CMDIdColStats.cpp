@@ -28,7 +28,9 @@ using namespace gpmd;
 CMDIdColStats::CMDIdColStats(CMDIdGPDB *rel_mdid, ULONG pos)
 	: m_rel_mdid(rel_mdid),
 	  m_attr_pos(pos),
-	  m_str(m_mdid_buffer, GPOS_ARRAY_SIZE(m_mdid_buffer))
+	  m_part_mdids(nullptr),
+	  m_str(m_mdid_buffer, GPOS_ARRAY_SIZE(m_mdid_buffer)),
+	  m_str_parts(nullptr)
 {
 	GPOS_ASSERT(rel_mdid->IsValid());
 
@@ -36,6 +38,29 @@ CMDIdColStats::CMDIdColStats(CMDIdGPDB *rel_mdid, ULONG pos)
 	Serialize();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDIdColStats::CMDIdColStats
+//
+//	@doc:
+//		Ctor for the statistics of a column of a partitioned relation,
+//		merged from those of the given leaf partitions
+//
+//---------------------------------------------------------------------------
+CMDIdColStats::CMDIdColStats(CMemoryPool *mp, CMDIdGPDB *rel_mdid, ULONG pos,
+							 IMdIdArray *part_mdids)
+	: m_rel_mdid(rel_mdid),
+	  m_attr_pos(pos),
+	  m_part_mdids(part_mdids),
+	  m_str(m_mdid_buffer, GPOS_ARRAY_SIZE(m_mdid_buffer)),
+	  m_str_parts(GPOS_NEW(mp) CWStringDynamic(mp))
+{
+	GPOS_ASSERT(rel_mdid->IsValid());
+	GPOS_ASSERT(nullptr != part_mdids && 0 < part_mdids->Size());
+
+	Serialize();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDIdColStats::~CMDIdColStats
@@ -47,6 +72,8 @@ CMDIdColStats::CMDIdColStats(CMDIdGPDB *rel_mdid, ULONG pos)
 CMDIdColStats::~CMDIdColStats()
 {
 	m_rel_mdid->Release();
+	CRefCount::SafeRelease(m_part_mdids);
+	GPOS_DELETE(m_str_parts);
 }
 
 //---------------------------------------------------------------------------
@@ -54,16 +81,33 @@ CMDIdColStats::~CMDIdColStats()
 //		CMDIdColStats::Serialize
 //
 //	@doc:
-//		Serialize mdid into static string
+//		Serialize mdid into string
 //
 //---------------------------------------------------------------------------
 void
 CMDIdColStats::Serialize()
 {
-	// serialize mdid as SystemType.Oid.Major.Minor.Attno
-	m_str.AppendFormat(GPOS_WSZ_LIT("%d.%d.%d.%d.%d"), MdidType(),
-					   m_rel_mdid->Oid(), m_rel_mdid->VersionMajor(),
-					   m_rel_mdid->VersionMinor(), m_attr_pos);
+	if (nullptr == m_part_mdids)
+	{
+		// serialize mdid as SystemType.Oid.Major.Minor.Attno
+		m_str.AppendFormat(GPOS_WSZ_LIT("%d.%d.%d.%d.%d"), MdidType(),
+						   m_rel_mdid->Oid(), m_rel_mdid->VersionMajor(),
+						   m_rel_mdid->VersionMinor(), m_attr_pos);
+		return;
+	}
+
+	// serialize mdid as SystemType.Oid.Major.Minor.Attno, followed by
+	// Oid.Major.Minor of each leaf partition
+	m_str_parts->AppendFormat(GPOS_WSZ_LIT("%d.%d.%d.%d.%d"), MdidType(),
+							  m_rel_mdid->Oid(), m_rel_mdid->VersionMajor(),
+							  m_rel_mdid->VersionMinor(), m_attr_pos);
+	for (ULONG ul = 0; ul < m_part_mdids->Size(); ul++)
+	{
+		CMDIdGPDB *part_mdid = CMDIdGPDB::CastMdid((*m_part_mdids)[ul]);
+		m_str_parts->AppendFormat(GPOS_WSZ_LIT(".%d.%d.%d"), part_mdid->Oid(),
+								  part_mdid->VersionMajor(),
+								  part_mdid->VersionMinor());
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -77,6 +121,11 @@ CMDIdColStats::Serialize()
 const WCHAR *
 CMDIdColStats::GetBuffer() const
 {
+	if (nullptr != m_str_parts)
+	{
+		return m_str_parts->GetBuffer();
+	}
+
 	return m_str.GetBuffer();
 }
 
@@ -126,8 +175,57 @@ CMDIdColStats::Equals(const IMDId *mdid) const
 
 	const CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(mdid);
 
-	return m_rel_mdid->Equals(mdid_col_stats->GetRelMdId()) &&
-		   m_attr_pos == mdid_col_stats->Position();
+	if (!m_rel_mdid->Equals(mdid_col_stats->GetRelMdId()) ||
+		m_attr_pos != mdid_col_stats->Position())
+	{
+		return false;
+	}
+
+	IMdIdArray *part_mdids = mdid_col_stats->GetPartMdIds();
+	if (nullptr == m_part_mdids || nullptr == part_mdids)
+	{
+		return m_part_mdids == part_mdids;
+	}
+
+	const ULONG size = m_part_mdids->Size();
+	if (size != part_mdids->Size())
+	{
+		return false;
+	}
+
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (!(*m_part_mdids)[ul]->Equals((*part_mdids)[ul]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDIdColStats::HashValue
+//
+//	@doc:
+//		Computes the hash value for the metadata id
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDIdColStats::HashValue() const
+{
+	ULONG hash = gpos::CombineHashes(m_rel_mdid->HashValue(),
+									 gpos::HashValue(&m_attr_pos));
+	if (nullptr != m_part_mdids)
+	{
+		for (ULONG ul = 0; ul < m_part_mdids->Size(); ul++)
+		{
+			hash = gpos::CombineHashes(hash, (*m_part_mdids)[ul]->HashValue());
+		}
+	}
+
+	return hash;
 }
 
 //---------------------------------------------------------------------------
@@ -142,6 +240,12 @@ void
 CMDIdColStats::Serialize(CXMLSerializer *xml_serializer,
 						 const CWStringConst *attribute_str) const
 {
+	if (nullptr != m_str_parts)
+	{
+		xml_serializer->AddAttribute(attribute_str, m_str_parts);
+		return;
+	}
+
 	xml_serializer->AddAttribute(attribute_str, &m_str);
 }
 
@@ -156,7 +260,7 @@ CMDIdColStats::Serialize(CXMLSerializer *xml_serializer,
 IOstream &
 CMDIdColStats::OsPrint(IOstream &os) const
 {
-	os << "(" << m_str.GetBuffer() << ")";
+	os << "(" << GetBuffer() << ")";
 	return os;
 }
 
@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDMCVList.cpp
+//
+//	@doc:
+//		Implementation of the class for representing the most common
+//		combinations of values of a group of columns
+//---------------------------------------------------------------------------
+
+#include "naucrates/md/CMDMCVList.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+// ctor
+CMDMCVItem::CMDMCVItem(CDXLDatumArray *values, CDouble frequency,
+					   CDouble base_frequency)
+	: m_values(values),
+	  m_frequency(frequency),
+	  m_base_frequency(base_frequency)
+{
+	GPOS_ASSERT(nullptr != values);
+	GPOS_ASSERT(CDouble(0.0) <= frequency && CDouble(1.0) >= frequency);
+}
+
+// dtor
+CMDMCVItem::~CMDMCVItem()
+{
+	m_values->Release();
+}
+
+// serialize in DXL format
+void
+CMDMCVItem::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVItem));
+
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenStatsFrequency), m_frequency);
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVBaseFrequency),
+		m_base_frequency);
+
+	for (ULONG ul = 0; ul < m_values->Size(); ul++)
+	{
+		xml_serializer->OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenDatum));
+		(*m_values)[ul]->Serialize(xml_serializer);
+		xml_serializer->CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenDatum));
+	}
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVItem));
+}
+
+// ctor
+CMDMCVList::CMDMCVList(ULongPtrArray *attnos, CMDMCVItemArray *items)
+	: m_attnos(attnos), m_items(items)
+{
+	GPOS_ASSERT(nullptr != attnos);
+	GPOS_ASSERT(1 < attnos->Size());
+	GPOS_ASSERT(nullptr != items);
+}
+
+// dtor
+CMDMCVList::~CMDMCVList()
+{
+	m_attnos->Release();
+	m_items->Release();
+}
+
+// serialize in DXL format
+void
+CMDMCVList::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVList));
+
+	CWStringDynamic *attnos_str =
+		CDXLUtils::Serialize(xml_serializer->Pmp(), m_attnos);
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenKeys),
+								 attnos_str);
+	GPOS_DELETE(attnos_str);
+
+	for (ULONG ul = 0; ul < m_items->Size(); ul++)
+	{
+		(*m_items)[ul]->Serialize(xml_serializer);
+		GPOS_CHECK_ABORT;
+	}
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVList));
+}
+
+#ifdef GPOS_DEBUG
+// prints the MCV list to the provided output
+void
+CMDMCVList::DebugPrint(IOstream &os) const
+{
+	os << "MCV list of (";
+	for (ULONG ul = 0; ul < m_attnos->Size(); ul++)
+	{
+		if (0 < ul)
+		{
+			os << ", ";
+		}
+		os << *(*m_attnos)[ul];
+	}
+	os << "): " << m_items->Size() << " items, frequencies";
+	for (ULONG ul = 0; ul < m_items->Size(); ul++)
+	{
+		os << " " << (*m_items)[ul]->GetFrequency();
+	}
+	os << std::endl;
+}
+
+#endif	// GPOS_DEBUG
+
+// EOF
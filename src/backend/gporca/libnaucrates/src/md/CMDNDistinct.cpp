@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDNDistinct.cpp
+//
+//	@doc:
+//		Implementation of the class for representing the number of distinct
+//		values of a combination of columns
+//---------------------------------------------------------------------------
+
+#include "naucrates/md/CMDNDistinct.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+// ctor
+CMDNDistinct::CMDNDistinct(ULongPtrArray *attnos, CDouble ndistinct)
+	: m_attnos(attnos), m_ndistinct(ndistinct)
+{
+	GPOS_ASSERT(nullptr != attnos);
+	GPOS_ASSERT(1 < attnos->Size());
+}
+
+// dtor
+CMDNDistinct::~CMDNDistinct()
+{
+	m_attnos->Release();
+}
+
+// serialize in DXL format
+void
+CMDNDistinct::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVNDistinct));
+
+	CWStringDynamic *attnos_str =
+		CDXLUtils::Serialize(xml_serializer->Pmp(), m_attnos);
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenKeys),
+								 attnos_str);
+	GPOS_DELETE(attnos_str);
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenStatsDistinct), m_ndistinct);
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMVNDistinct));
+}
+
+#ifdef GPOS_DEBUG
+// prints the distinct values to the provided output
+void
+CMDNDistinct::DebugPrint(IOstream &os) const
+{
+	os << "NDistinct of (";
+	for (ULONG ul = 0; ul < m_attnos->Size(); ul++)
+	{
+		if (0 < ul)
+		{
+			os << ", ";
+		}
+		os << *(*m_attnos)[ul];
+	}
+	os << "): " << m_ndistinct << std::endl;
+}
+
+#endif	// GPOS_DEBUG
+
+// EOF
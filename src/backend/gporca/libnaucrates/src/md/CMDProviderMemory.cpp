@@ -23,6 +23,7 @@
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/exception.h"
 #include "naucrates/md/CDXLColStats.h"
+#include "naucrates/md/CDXLExtStats.h"
 #include "naucrates/md/CDXLRelStats.h"
 #include "naucrates/md/CMDTypeBoolGPDB.h"
 #include "naucrates/md/CMDTypeInt4GPDB.h"
@@ -45,7 +46,7 @@ CMDProviderMemory::CMDProviderMemory(CMemoryPool *mp, const CHAR *file_name)
 {
 	GPOS_ASSERT(nullptr != file_name);
 
-	// read DXL file
+	// read DXL file, in XML or binary DXL
 	CAutoRg<CHAR> dxl_file;
 	dxl_file = CDXLUtils::Read(mp, file_name);
 
@@ -159,9 +160,9 @@ CMDProviderMemory::GetMDObjDXLStr(CMemoryPool *mp,
 
 	if (nullptr == pstrObj)
 	{
-		// Relstats and colstats are special as they may not
-		// exist in the metadata file. Provider must return dummy objects
-		// in this case.
+		// Relstats, colstats and extended stats are special as they may
+		// not exist in the metadata file. Provider must return dummy
+		// objects in this case.
 		switch (mdid->MdidType())
 		{
 			case IMDId::EmdidRelStats:
@@ -191,6 +192,16 @@ CMDProviderMemory::GetMDObjDXLStr(CMemoryPool *mp,
 					false /*findent*/);
 				break;
 			}
+			case IMDId::EmdidExtStats:
+			{
+				mdid->AddRef();
+				CAutoRef<CDXLExtStats> a_pdxlextstats;
+				a_pdxlextstats = CDXLExtStats::CreateDXLDummyExtStats(mp, mdid);
+				a_pstrResult = CDXLUtils::SerializeMDObj(
+					mp, a_pdxlextstats.Value(), true /*fSerializeHeaders*/,
+					false /*findent*/);
+				break;
+			}
 			default:
 			{
 				GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound,
@@ -35,10 +35,12 @@ CMDRelationGPDB::CMDRelationGPDB(
 	CMDColumnArray *mdcol_array, ULongPtrArray *distr_col_array,
 	IMdIdArray *distr_opfamilies, ULongPtrArray *partition_cols_array,
 	CharPtrArray *str_part_types_array, ULONG num_of_partitions,
-	IMdIdArray *partition_oids, BOOL convert_hash_to_random,
-	ULongPtr2dArray *keyset_array, CMDIndexInfoArray *md_index_info_array,
-	IMdIdArray *mdid_triggers_array, IMdIdArray *mdid_check_constraint_array,
-	CDXLNode *mdpart_constraint, BOOL has_oids)
+	IMdIdArray *partition_oids, CDXLNodeArray *partition_bounds,
+	CDXLDatumArray *part_range_bounds, IntPtrArray *part_range_slots,
+	BOOL convert_hash_to_random, ULongPtr2dArray *keyset_array,
+	CMDIndexInfoArray *md_index_info_array, IMdIdArray *mdid_triggers_array,
+	IMdIdArray *mdid_check_constraint_array, CDXLNode *mdpart_constraint,
+	BOOL has_oids)
 	: m_mp(mp),
 	  m_mdid(mdid),
 	  m_mdname(mdname),
@@ -54,6 +56,9 @@ CMDRelationGPDB::CMDRelationGPDB(
 	  m_str_part_types_array(str_part_types_array),
 	  m_num_of_partitions(num_of_partitions),
 	  m_partition_oids(partition_oids),
+	  m_partition_bounds(partition_bounds),
+	  m_part_range_bounds(part_range_bounds),
+	  m_part_range_slots(part_range_slots),
 	  m_keyset_array(keyset_array),
 	  m_mdindex_info_array(md_index_info_array),
 	  m_mdid_trigger_array(mdid_triggers_array),
@@ -76,6 +81,13 @@ CMDRelationGPDB::CMDRelationGPDB(
 			"Converting hash distributed table to random only possible for hash distributed tables");
 	GPOS_ASSERT(nullptr == distr_opfamilies ||
 				distr_opfamilies->Size() == m_distr_col_array->Size());
+	GPOS_ASSERT_IMP(nullptr != partition_bounds,
+					nullptr != partition_oids &&
+						partition_bounds->Size() == partition_oids->Size());
+	GPOS_ASSERT((nullptr == part_range_bounds) ==
+				(nullptr == part_range_slots));
+	GPOS_ASSERT_IMP(nullptr != part_range_bounds,
+					part_range_slots->Size() == part_range_bounds->Size() + 1);
 
 	m_colpos_nondrop_colpos_map = GPOS_NEW(m_mp) UlongToUlongMap(m_mp);
 	m_attrno_nondrop_col_pos_map = GPOS_NEW(m_mp) IntToUlongMap(m_mp);
@@ -135,6 +147,9 @@ CMDRelationGPDB::~CMDRelationGPDB()
 	CRefCount::SafeRelease(m_distr_col_array);
 	CRefCount::SafeRelease(m_distr_opfamilies);
 	CRefCount::SafeRelease(m_partition_oids);
+	CRefCount::SafeRelease(m_partition_bounds);
+	CRefCount::SafeRelease(m_part_range_bounds);
+	CRefCount::SafeRelease(m_part_range_slots);
 	CRefCount::SafeRelease(m_partition_cols_array);
 	CRefCount::SafeRelease(m_str_part_types_array);
 	CRefCount::SafeRelease(m_keyset_array);
@@ -800,6 +815,60 @@ CMDRelationGPDB::Serialize(CXMLSerializer *xml_serializer) const
 						  CDXLTokens::GetDXLTokenStr(EdxltokenPartition));
 	}
 
+	// serialize the bound constraints of the child partitions
+	if (nullptr != m_partition_bounds)
+	{
+		xml_serializer->OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenPartBounds));
+
+		for (ULONG ul = 0; ul < m_partition_bounds->Size(); ul++)
+		{
+			xml_serializer->OpenElement(
+				CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+				CDXLTokens::GetDXLTokenStr(EdxltokenPartBound));
+			(*m_partition_bounds)[ul]->SerializeToDXL(xml_serializer);
+			xml_serializer->CloseElement(
+				CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+				CDXLTokens::GetDXLTokenStr(EdxltokenPartBound));
+
+			GPOS_CHECK_ABORT;
+		}
+
+		xml_serializer->CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenPartBounds));
+	}
+
+	// serialize the sorted range bounds and the partition of each slot
+	if (nullptr != m_part_range_bounds)
+	{
+		xml_serializer->OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenPartRangeBounds));
+
+		CWStringDynamic *slots_str =
+			CDXLUtils::Serialize(m_mp, m_part_range_slots);
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenPartitions), slots_str);
+		GPOS_DELETE(slots_str);
+
+		for (ULONG ul = 0; ul < m_part_range_bounds->Size(); ul++)
+		{
+			xml_serializer->OpenElement(
+				CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+				CDXLTokens::GetDXLTokenStr(EdxltokenPartRangeBound));
+			(*m_part_range_bounds)[ul]->Serialize(xml_serializer);
+			xml_serializer->CloseElement(
+				CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+				CDXLTokens::GetDXLTokenStr(EdxltokenPartRangeBound));
+		}
+
+		xml_serializer->CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenPartRangeBounds));
+	}
+
 	xml_serializer->CloseElement(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
 		CDXLTokens::GetDXLTokenStr(EdxltokenRelation));
@@ -813,6 +882,24 @@ CMDRelationGPDB::ChildPartitionMdids() const
 	return m_partition_oids;
 }
 
+CDXLNodeArray *
+CMDRelationGPDB::ChildPartitionBounds() const
+{
+	return m_partition_bounds;
+}
+
+CDXLDatumArray *
+CMDRelationGPDB::PartRangeBounds() const
+{
+	return m_part_range_bounds;
+}
+
+IntPtrArray *
+CMDRelationGPDB::PartRangeSlots() const
+{
+	return m_part_range_slots;
+}
+
 #ifdef GPOS_DEBUG
 //---------------------------------------------------------------------------
 //	@function:
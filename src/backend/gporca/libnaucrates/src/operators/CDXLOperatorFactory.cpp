@@ -66,6 +66,7 @@
 #include "naucrates/exception.h"
 #include "naucrates/md/CMDIdCast.h"
 #include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
 #include "naucrates/md/CMDIdGPDB.h"
 #include "naucrates/md/CMDIdGPDBCtas.h"
 #include "naucrates/md/CMDIdRelStats.h"
@@ -2262,6 +2263,11 @@ CDXLOperatorFactory::MakeMdIdFromStr(CDXLMemoryManager *dxl_memory_manager,
 								   target_attr, target_elem);
 			break;
 
+		case IMDId::EmdidExtStats:
+			mdid = GetExtStatsMdId(dxl_memory_manager, remaining_tokens,
+								   target_attr, target_elem);
+			break;
+
 		case IMDId::EmdidCastFunc:
 			mdid = GetCastFuncMdId(dxl_memory_manager, remaining_tokens,
 								   target_attr, target_elem);
@@ -2352,7 +2358,15 @@ CDXLOperatorFactory::GetColStatsMdId(CDXLMemoryManager *dxl_memory_manager,
 									 Edxltoken target_attr,
 									 Edxltoken target_elem)
 {
-	GPOS_ASSERT(GPDXL_GPDB_MDID_COMPONENTS + 1 == remaining_tokens->Size());
+	// the mdid of the relation and the attno may be followed by the mdids
+	// of the leaf partitions whose statistics are merged
+	const ULONG num_tokens = remaining_tokens->Size();
+	GPOS_ASSERT(GPDXL_GPDB_MDID_COMPONENTS + 1 <= num_tokens);
+	GPOS_ASSERT(0 ==
+				(num_tokens - GPDXL_GPDB_MDID_COMPONENTS - 1) %
+					GPDXL_GPDB_MDID_COMPONENTS);
+
+	CMemoryPool *mp = dxl_memory_manager->Pmp();
 
 	CMDIdGPDB *rel_mdid = GetGPDBMdId(dxl_memory_manager, remaining_tokens,
 									  target_attr, target_elem);
@@ -2361,8 +2375,31 @@ CDXLOperatorFactory::GetColStatsMdId(CDXLMemoryManager *dxl_memory_manager,
 	ULONG attno = ConvertAttrValueToUlong(dxl_memory_manager, attno_xml,
 										  target_attr, target_elem);
 
-	// construct metadata id object
-	return GPOS_NEW(dxl_memory_manager->Pmp()) CMDIdColStats(rel_mdid, attno);
+	if (GPDXL_GPDB_MDID_COMPONENTS + 1 == num_tokens)
+	{
+		// construct metadata id object
+		return GPOS_NEW(mp) CMDIdColStats(rel_mdid, attno);
+	}
+
+	IMdIdArray *part_mdids = GPOS_NEW(mp) IMdIdArray(mp);
+	for (ULONG ul = GPDXL_GPDB_MDID_COMPONENTS + 1;
+		 ul + GPDXL_GPDB_MDID_COMPONENTS <= num_tokens;
+		 ul += GPDXL_GPDB_MDID_COMPONENTS)
+	{
+		ULONG oid = ConvertAttrValueToUlong(
+			dxl_memory_manager, (*remaining_tokens)[ul], target_attr,
+			target_elem);
+		ULONG version_major = ConvertAttrValueToUlong(
+			dxl_memory_manager, (*remaining_tokens)[ul + 1], target_attr,
+			target_elem);
+		ULONG version_minor = ConvertAttrValueToUlong(
+			dxl_memory_manager, (*remaining_tokens)[ul + 2], target_attr,
+			target_elem);
+		part_mdids->Append(GPOS_NEW(mp)
+							   CMDIdGPDB(oid, version_major, version_minor));
+	}
+
+	return GPOS_NEW(mp) CMDIdColStats(mp, rel_mdid, attno, part_mdids);
 }
 
 //---------------------------------------------------------------------------
@@ -2388,6 +2425,30 @@ CDXLOperatorFactory::GetRelStatsMdId(CDXLMemoryManager *dxl_memory_manager,
 	return GPOS_NEW(dxl_memory_manager->Pmp()) CMDIdRelStats(rel_mdid);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLOperatorFactory::GetExtStatsMdId
+//
+//	@doc:
+//		Construct an extended stats mdid from an array of XML string
+//		components.
+//
+//---------------------------------------------------------------------------
+CMDIdExtStats *
+CDXLOperatorFactory::GetExtStatsMdId(CDXLMemoryManager *dxl_memory_manager,
+									 XMLChArray *remaining_tokens,
+									 Edxltoken target_attr,
+									 Edxltoken target_elem)
+{
+	GPOS_ASSERT(GPDXL_GPDB_MDID_COMPONENTS == remaining_tokens->Size());
+
+	CMDIdGPDB *rel_mdid = GetGPDBMdId(dxl_memory_manager, remaining_tokens,
+									  target_attr, target_elem);
+
+	// construct metadata id object
+	return GPOS_NEW(dxl_memory_manager->Pmp()) CMDIdExtStats(rel_mdid);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLOperatorFactory::GetCastFuncMdId
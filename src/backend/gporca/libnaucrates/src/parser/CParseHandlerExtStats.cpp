@@ -0,0 +1,280 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CParseHandlerExtStats.cpp
+//
+//	@doc:
+//		Implementation of the SAX parse handler class for parsing the
+//		extended statistics of a relation.
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/parser/CParseHandlerExtStats.h"
+
+#include "naucrates/dxl/operators/CDXLOperatorFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/md/CDXLExtStats.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+using namespace gpnaucrates;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStats::CParseHandlerExtStats
+//
+//	@doc:
+//		Constructor
+//
+//---------------------------------------------------------------------------
+CParseHandlerExtStats::CParseHandlerExtStats(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+	: CParseHandlerMetadataObject(mp, parse_handler_mgr, parse_handler_root),
+	  m_mdid(nullptr),
+	  m_mdname(nullptr),
+	  m_ndistincts(nullptr),
+	  m_dependencies(nullptr),
+	  m_mcv_lists(nullptr),
+	  m_mcv_attnos(nullptr),
+	  m_mcv_items(nullptr),
+	  m_mcv_values(nullptr),
+	  m_mcv_frequency(0.0),
+	  m_mcv_base_frequency(0.0)
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStats::~CParseHandlerExtStats
+//
+//	@doc:
+//		Destructor; releases what was parsed if the object was not built
+//
+//---------------------------------------------------------------------------
+CParseHandlerExtStats::~CParseHandlerExtStats()
+{
+	CRefCount::SafeRelease(m_mdid);
+	GPOS_DELETE(m_mdname);
+	CRefCount::SafeRelease(m_ndistincts);
+	CRefCount::SafeRelease(m_dependencies);
+	CRefCount::SafeRelease(m_mcv_lists);
+	CRefCount::SafeRelease(m_mcv_attnos);
+	CRefCount::SafeRelease(m_mcv_items);
+	CRefCount::SafeRelease(m_mcv_values);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStats::StartElement
+//
+//	@doc:
+//		Invoked by Xerces to process an opening tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerExtStats::StartElement(const XMLCh *const,	 // element_uri,
+									const XMLCh *const element_local_name,
+									const XMLCh *const,	 // element_qname,
+									const Attributes &attrs)
+{
+	CDXLMemoryManager *dxl_memory_manager =
+		m_parse_handler_mgr->GetDXLMemoryManager();
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenExtStats),
+				 element_local_name))
+	{
+		GPOS_ASSERT(nullptr == m_mdid);
+
+		// parse relation name
+		const XMLCh *xml_str_table_name = CDXLOperatorFactory::ExtractAttrValue(
+			attrs, EdxltokenName, EdxltokenExtStats);
+		CWStringDynamic *str_table_name =
+			CDXLUtils::CreateDynamicStringFromXMLChArray(dxl_memory_manager,
+														 xml_str_table_name);
+
+		// create a copy of the string in the CMDName constructor
+		m_mdname = GPOS_NEW(m_mp) CMDName(m_mp, str_table_name);
+		GPOS_DELETE(str_table_name);
+
+		// parse metadata id info
+		m_mdid = CDXLOperatorFactory::ExtractConvertAttrValueToMdId(
+			dxl_memory_manager, attrs, EdxltokenMdid, EdxltokenExtStats);
+
+		m_ndistincts = GPOS_NEW(m_mp) CMDNDistinctArray(m_mp);
+		m_dependencies = GPOS_NEW(m_mp) CMDDependencyArray(m_mp);
+		m_mcv_lists = GPOS_NEW(m_mp) CMDMCVListArray(m_mp);
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenMVNDistinct),
+					  element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_ndistincts);
+
+		const XMLCh *xml_str_attnos = CDXLOperatorFactory::ExtractAttrValue(
+			attrs, EdxltokenKeys, EdxltokenMVNDistinct);
+		ULongPtrArray *attnos = CDXLOperatorFactory::ExtractIntsToUlongArray(
+			dxl_memory_manager, xml_str_attnos, EdxltokenKeys,
+			EdxltokenMVNDistinct);
+		CDouble ndistinct =
+			CDXLOperatorFactory::ExtractConvertAttrValueToDouble(
+				dxl_memory_manager, attrs, EdxltokenStatsDistinct,
+				EdxltokenMVNDistinct);
+
+		m_ndistincts->Append(GPOS_NEW(m_mp) CMDNDistinct(attnos, ndistinct));
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenMVDependency),
+					  element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_dependencies);
+
+		const XMLCh *xml_str_attnos = CDXLOperatorFactory::ExtractAttrValue(
+			attrs, EdxltokenKeys, EdxltokenMVDependency);
+		ULongPtrArray *from_attnos =
+			CDXLOperatorFactory::ExtractIntsToUlongArray(
+				dxl_memory_manager, xml_str_attnos, EdxltokenKeys,
+				EdxltokenMVDependency);
+		ULONG to_attno = CDXLOperatorFactory::ExtractConvertAttrValueToUlong(
+			dxl_memory_manager, attrs, EdxltokenAttno, EdxltokenMVDependency);
+		CDouble degree = CDXLOperatorFactory::ExtractConvertAttrValueToDouble(
+			dxl_memory_manager, attrs, EdxltokenMVDependencyDegree,
+			EdxltokenMVDependency);
+
+		m_dependencies->Append(
+			GPOS_NEW(m_mp) CMDDependency(from_attnos, to_attno, degree));
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenMVMCVList),
+					  element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_mcv_lists);
+		GPOS_ASSERT(nullptr == m_mcv_attnos);
+
+		const XMLCh *xml_str_attnos = CDXLOperatorFactory::ExtractAttrValue(
+			attrs, EdxltokenKeys, EdxltokenMVMCVList);
+		m_mcv_attnos = CDXLOperatorFactory::ExtractIntsToUlongArray(
+			dxl_memory_manager, xml_str_attnos, EdxltokenKeys,
+			EdxltokenMVMCVList);
+		m_mcv_items = GPOS_NEW(m_mp) CMDMCVItemArray(m_mp);
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenMVMCVItem),
+					  element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_mcv_items);
+		GPOS_ASSERT(nullptr == m_mcv_values);
+
+		m_mcv_frequency = CDXLOperatorFactory::ExtractConvertAttrValueToDouble(
+			dxl_memory_manager, attrs, EdxltokenStatsFrequency,
+			EdxltokenMVMCVItem);
+		m_mcv_base_frequency =
+			CDXLOperatorFactory::ExtractConvertAttrValueToDouble(
+				dxl_memory_manager, attrs, EdxltokenMVMCVBaseFrequency,
+				EdxltokenMVMCVItem);
+		m_mcv_values = GPOS_NEW(m_mp) CDXLDatumArray(m_mp);
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenDatum),
+					  element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_mcv_values);
+
+		m_mcv_values->Append(CDXLOperatorFactory::GetDatumVal(
+			dxl_memory_manager, attrs, EdxltokenMVMCVItem));
+	}
+	else
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			dxl_memory_manager, element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStats::EndElement
+//
+//	@doc:
+//		Invoked by Xerces to process a closing tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerExtStats::EndElement(const XMLCh *const,  // element_uri,
+								  const XMLCh *const element_local_name,
+								  const XMLCh *const  // element_qname
+)
+{
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMVNDistinct),
+				 element_local_name) ||
+		0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMVDependency),
+				 element_local_name) ||
+		0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenDatum),
+									  element_local_name))
+	{
+		// entries are built when their element starts
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMVMCVItem),
+				 element_local_name))
+	{
+		// an item has one value per column of its list
+		if (m_mcv_values->Size() != m_mcv_attnos->Size())
+		{
+			GPOS_RAISE(
+				gpdxl::ExmaDXL, gpdxl::ExmiDXLInvalidAttributeValue,
+				CDXLTokens::GetDXLTokenStr(EdxltokenKeys)->GetBuffer(),
+				CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVList)->GetBuffer());
+		}
+
+		m_mcv_items->Append(GPOS_NEW(m_mp) CMDMCVItem(
+			m_mcv_values, m_mcv_frequency, m_mcv_base_frequency));
+		m_mcv_values = nullptr;
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMVMCVList),
+				 element_local_name))
+	{
+		m_mcv_lists->Append(
+			GPOS_NEW(m_mp) CMDMCVList(m_mcv_attnos, m_mcv_items));
+		m_mcv_attnos = nullptr;
+		m_mcv_items = nullptr;
+		return;
+	}
+
+	if (0 != XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenExtStats),
+				 element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+
+	m_imd_obj = GPOS_NEW(m_mp)
+		CDXLExtStats(m_mp, CMDIdExtStats::CastMdid(m_mdid), m_mdname,
+					 m_ndistincts, m_dependencies, m_mcv_lists);
+	m_mdid = nullptr;
+	m_mdname = nullptr;
+	m_ndistincts = nullptr;
+	m_dependencies = nullptr;
+	m_mcv_lists = nullptr;
+
+	// deactivate handler
+	m_parse_handler_mgr->DeactivateHandler();
+}
+
+// EOF
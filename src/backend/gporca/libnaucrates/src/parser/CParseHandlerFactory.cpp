@@ -74,6 +74,7 @@ CParseHandlerFactory::Init(CMemoryPool *mp)
 		{EdxltokenCheckConstraint, &CreateMDChkConstraintParseHandler},
 		{EdxltokenRelationStats, &CreateRelStatsParseHandler},
 		{EdxltokenColumnStats, &CreateColStatsParseHandler},
+		{EdxltokenExtStats, &CreateExtStatsParseHandler},
 		{EdxltokenMetadataIdList, &CreateMDIdListParseHandler},
 		{EdxltokenIndexInfoList, &CreateMDIndexInfoListParseHandler},
 		{EdxltokenMetadataColumns, &CreateMDColsParseHandler},
@@ -503,6 +504,16 @@ CParseHandlerFactory::CreateColStatsParseHandler(
 		CParseHandlerColStats(mp, parse_handler_mgr, parse_handler_root);
 }
 
+// creates a parse handler for parsing extended stats
+CParseHandlerBase *
+CParseHandlerFactory::CreateExtStatsParseHandler(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+{
+	return GPOS_NEW(mp)
+		CParseHandlerExtStats(mp, parse_handler_mgr, parse_handler_root);
+}
+
 // creates a parse handler for parsing column stats bucket
 CParseHandlerBase *
 CParseHandlerFactory::CreateColStatsBucketParseHandler(
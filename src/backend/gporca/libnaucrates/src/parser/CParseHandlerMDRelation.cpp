@@ -50,6 +50,9 @@ CParseHandlerMDRelation::CParseHandlerMDRelation(
 	  m_num_of_partitions(0),
 	  m_key_sets_arrays(nullptr),
 	  m_part_constraint(nullptr),
+	  m_partition_bounds(nullptr),
+	  m_part_range_bounds(nullptr),
+	  m_part_range_slots(nullptr),
 	  m_opfamilies_parse_handler(nullptr),
 	  m_child_partitions_parse_handler(nullptr)
 {
@@ -86,6 +89,63 @@ CParseHandlerMDRelation::StartElement(const XMLCh *const element_uri,
 		return;
 	}
 
+	if (0 ==
+		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenPartBounds),
+								 element_local_name))
+	{
+		GPOS_ASSERT(nullptr == m_partition_bounds);
+
+		m_partition_bounds = GPOS_NEW(m_mp) CDXLNodeArray(m_mp);
+
+		return;
+	}
+
+	if (0 ==
+		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenPartBound),
+								 element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_partition_bounds);
+
+		// parse handler for the bound constraint of a child partition
+		CParseHandlerBase *part_bound_parse_handler =
+			CParseHandlerFactory::GetParseHandler(
+				m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar),
+				m_parse_handler_mgr, this);
+		m_parse_handler_mgr->ActivateParseHandler(part_bound_parse_handler);
+		this->Append(part_bound_parse_handler);
+
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenPartRangeBounds),
+				 element_local_name))
+	{
+		GPOS_ASSERT(nullptr == m_part_range_bounds);
+
+		const XMLCh *slots_xml = CDXLOperatorFactory::ExtractAttrValue(
+			attrs, EdxltokenPartitions, EdxltokenPartRangeBounds);
+		m_part_range_slots = CDXLOperatorFactory::ExtractIntsToIntArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), slots_xml,
+			EdxltokenPartitions, EdxltokenPartRangeBounds);
+		m_part_range_bounds = GPOS_NEW(m_mp) CDXLDatumArray(m_mp);
+
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenPartRangeBound),
+				 element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_part_range_bounds);
+
+		m_part_range_bounds->Append(CDXLOperatorFactory::GetDatumVal(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenPartRangeBound));
+
+		return;
+	}
+
 	if (0 == XMLString::compareString(
 				 CDXLTokens::XmlstrToken(EdxltokenRelDistrOpfamilies),
 				 element_local_name))
@@ -228,6 +288,47 @@ CParseHandlerMDRelation::EndElement(const XMLCh *const,	 // element_uri,
 		return;
 	}
 
+	if (0 ==
+		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenPartBound),
+								 element_local_name))
+	{
+		CParseHandlerScalarOp *part_bound_parse_handler =
+			dynamic_cast<CParseHandlerScalarOp *>((*this)[Length() - 1]);
+		CDXLNode *part_bound = part_bound_parse_handler->CreateDXLNode();
+		part_bound->AddRef();
+		m_partition_bounds->Append(part_bound);
+		return;
+	}
+
+	if (0 ==
+		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenPartBounds),
+								 element_local_name))
+	{
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenPartRangeBound),
+				 element_local_name))
+	{
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenPartRangeBounds),
+				 element_local_name))
+	{
+		if (m_part_range_slots->Size() != m_part_range_bounds->Size() + 1)
+		{
+			GPOS_RAISE(
+				gpdxl::ExmaDXL, gpdxl::ExmiDXLInvalidAttributeValue,
+				CDXLTokens::GetDXLTokenStr(EdxltokenPartitions)->GetBuffer(),
+				CDXLTokens::GetDXLTokenStr(EdxltokenPartRangeBounds)
+					->GetBuffer());
+		}
+		return;
+	}
+
 	if (0 !=
 		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenRelation),
 								 element_local_name))
@@ -286,7 +387,8 @@ CParseHandlerMDRelation::EndElement(const XMLCh *const,	 // element_uri,
 		m_mp, m_mdid, m_mdname, m_is_temp_table, m_rel_storage_type,
 		m_rel_distr_policy, md_col_array, m_distr_col_array, distr_opfamilies,
 		m_partition_cols_array, m_str_part_types_array, m_num_of_partitions,
-		child_partitions, m_convert_hash_to_random, m_key_sets_arrays,
+		child_partitions, m_partition_bounds, m_part_range_bounds,
+		m_part_range_slots, m_convert_hash_to_random, m_key_sets_arrays,
 		md_index_info_array, mdid_triggers_array, mdid_check_constraint_array,
 		m_part_constraint, m_has_oids);
 
@@ -75,8 +75,7 @@ CParseHandlerManager::ActivateParseHandler(
 	GPOS_ASSERT(nullptr != parse_handler_base);
 
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	SetReaderHandler(parse_handler_base);
 }
 
 //---------------------------------------------------------------------------
@@ -103,8 +102,7 @@ CParseHandlerManager::ReplaceHandler(CParseHandlerBase *parse_handler_base,
 	}
 
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	SetReaderHandler(parse_handler_base);
 }
 
 
@@ -133,8 +131,7 @@ CParseHandlerManager::DeactivateHandler()
 		m_curr_parse_handler = nullptr;
 	}
 
-	m_xml_reader->setContentHandler(m_curr_parse_handler);
-	m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	SetReaderHandler(m_curr_parse_handler);
 }
 
 //---------------------------------------------------------------------------
@@ -145,12 +142,30 @@ CParseHandlerManager::DeactivateHandler()
 //		Returns the current handler
 //
 //---------------------------------------------------------------------------
-const CParseHandlerBase *
+CParseHandlerBase *
 CParseHandlerManager::GetCurrentParseHandler()
 {
 	return m_curr_parse_handler;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerManager::SetReaderHandler
+//
+//	@doc:
+//		Make the XML parser, if any, send its events to the given handler
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerManager::SetReaderHandler(CParseHandlerBase *parse_handler_base)
+{
+	if (nullptr != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(parse_handler_base);
+		m_xml_reader->setErrorHandler(parse_handler_base);
+	}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CParseHandlerManager::CheckForAborts
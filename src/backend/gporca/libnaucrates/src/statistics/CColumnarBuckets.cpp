@@ -0,0 +1,289 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CColumnarBuckets.cpp
+//
+//	@doc:
+//		Implementation of columnar histogram buckets
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CColumnarBuckets.h"
+
+#include <math.h>
+
+#include "naucrates/statistics/CStatistics.h"
+
+using namespace gpnaucrates;
+
+// largest magnitude of a LINT that doubles represent exactly, 2^53
+#define GPNAUCRATES_MAX_EXACT_LINT (LINT(1) << 53)
+
+// number of buckets below which a search stops halving and counts
+#define GPNAUCRATES_COLUMNAR_SCAN_SIZE 8
+
+// ctor
+CColumnarBuckets::CColumnarBuckets(CMemoryPool *mp, ULONG size,
+								   BOOL lint_mapped, const IDatum *datum)
+	: m_size(size),
+	  m_lint_mapped(lint_mapped),
+	  m_datum(datum),
+	  m_lower(GPOS_NEW_ARRAY(mp, DOUBLE, size)),
+	  m_upper(GPOS_NEW_ARRAY(mp, DOUBLE, size)),
+	  m_frequency(GPOS_NEW_ARRAY(mp, DOUBLE, size)),
+	  m_distinct(GPOS_NEW_ARRAY(mp, DOUBLE, size)),
+	  m_upper_open(GPOS_NEW_ARRAY(mp, ULLONG, (size + 63) / 64))
+{
+	for (ULONG ul = 0; ul < (size + 63) / 64; ul++)
+	{
+		m_upper_open[ul] = 0;
+	}
+}
+
+// dtor
+CColumnarBuckets::~CColumnarBuckets()
+{
+	GPOS_DELETE_ARRAY(m_lower);
+	GPOS_DELETE_ARRAY(m_upper);
+	GPOS_DELETE_ARRAY(m_frequency);
+	GPOS_DELETE_ARRAY(m_distinct);
+	GPOS_DELETE_ARRAY(m_upper_open);
+}
+
+// map a datum like the bounds of the buckets
+BOOL
+CColumnarBuckets::FMapDatum(const IDatum *datum, DOUBLE *value) const
+{
+	if (datum->IsNull())
+	{
+		return false;
+	}
+
+	if (m_lint_mapped)
+	{
+		if (!datum->IsDatumMappableToLINT())
+		{
+			return false;
+		}
+
+		LINT lint_value = datum->GetLINTMapping();
+		if (GPNAUCRATES_MAX_EXACT_LINT < lint_value ||
+			-GPNAUCRATES_MAX_EXACT_LINT > lint_value)
+		{
+			return false;
+		}
+
+		*value = (DOUBLE) lint_value;
+		return true;
+	}
+
+	if (!datum->IsDatumMappableToDouble())
+	{
+		return false;
+	}
+
+	*value = datum->GetDoubleMapping().Get();
+	return !isnan(*value);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColumnarBuckets::PcbCreate
+//
+//	@doc:
+//		Create columnar buckets from the given buckets; return null if the
+//		bounds cannot be compared by their mapped values alone
+//
+//---------------------------------------------------------------------------
+CColumnarBuckets *
+CColumnarBuckets::PcbCreate(CMemoryPool *mp, const CBucketArray *buckets)
+{
+	const ULONG size = buckets->Size();
+	if (0 == size)
+	{
+		return nullptr;
+	}
+
+	const IDatum *datum = (*buckets)[0]->GetLowerBound()->GetDatum();
+	const BOOL lint_mapped = datum->IsDatumMappableToLINT();
+	if (!lint_mapped && !datum->IsDatumMappableToDouble())
+	{
+		return nullptr;
+	}
+
+	// bounds mapped to doubles are compared with a tolerance, keep distinct
+	// bounds far enough apart that a value is equal to at most one of them
+	const DOUBLE min_gap = lint_mapped ? 0.0 : 2 * CStatistics::Epsilon.Get();
+
+	CColumnarBuckets *pcb =
+		GPOS_NEW(mp) CColumnarBuckets(mp, size, lint_mapped, datum);
+
+	BOOL is_valid = true;
+	for (ULONG ul = 0; is_valid && ul < size; ul++)
+	{
+		const CBucket *bucket = (*buckets)[ul];
+		const IDatum *lower_datum = bucket->GetLowerBound()->GetDatum();
+		const IDatum *upper_datum = bucket->GetUpperBound()->GetDatum();
+
+		// all bounds must be compared the same way
+		is_valid = lower_datum->MDId()->Equals(datum->MDId()) &&
+				   upper_datum->MDId()->Equals(datum->MDId()) &&
+				   lint_mapped == lower_datum->IsDatumMappableToLINT() &&
+				   lint_mapped == upper_datum->IsDatumMappableToLINT() &&
+				   pcb->FMapDatum(lower_datum, &pcb->m_lower[ul]) &&
+				   pcb->FMapDatum(upper_datum, &pcb->m_upper[ul]);
+		if (!is_valid)
+		{
+			break;
+		}
+
+		const DOUBLE lower = pcb->m_lower[ul];
+		const DOUBLE upper = pcb->m_upper[ul];
+		if (lower == upper)
+		{
+			// singleton buckets contain their bound
+			is_valid = bucket->IsLowerClosed() && bucket->IsUpperClosed();
+		}
+		else
+		{
+			is_valid = min_gap < upper - lower && lower < upper;
+		}
+
+		if (0 < ul)
+		{
+			// buckets must be ordered and disjoint
+			const DOUBLE previous_upper = pcb->m_upper[ul - 1];
+			if (previous_upper == lower)
+			{
+				is_valid = is_valid && !(!pcb->IsUpperOpen(ul - 1) &&
+										 bucket->IsLowerClosed());
+			}
+			else
+			{
+				is_valid = is_valid && min_gap < lower - previous_upper &&
+						   previous_upper < lower;
+			}
+		}
+
+		if (!bucket->IsUpperClosed())
+		{
+			pcb->m_upper_open[ul / 64] |= (ULLONG) 1 << (ul % 64);
+		}
+		pcb->m_frequency[ul] = bucket->GetFrequency().Get();
+		pcb->m_distinct[ul] = bucket->GetNumDistinct().Get();
+	}
+
+	if (!is_valid)
+	{
+		GPOS_DELETE(pcb);
+		return nullptr;
+	}
+
+	return pcb;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColumnarBuckets::FMapPoint
+//
+//	@doc:
+//		Map a point to a value that compares to the bounds of the buckets
+//		as the point does; a point mapped to a double is replaced by the
+//		bound it is equal to, so that comparisons need no tolerance
+//
+//---------------------------------------------------------------------------
+BOOL
+CColumnarBuckets::FMapPoint(const CPoint *point, DOUBLE *value) const
+{
+	const IDatum *datum = point->GetDatum();
+	if (!datum->StatsAreComparable(m_datum) || !FMapDatum(datum, value))
+	{
+		return false;
+	}
+
+	if (!m_lint_mapped)
+	{
+		const DOUBLE epsilon = CStatistics::Epsilon.Get();
+		const ULONG pos =
+			FirstBucketNotBefore(*value - epsilon, true /*strict*/, 0);
+		if (pos < m_size)
+		{
+			if (fabs(m_lower[pos] - *value) <= epsilon)
+			{
+				*value = m_lower[pos];
+			}
+			else if (fabs(m_upper[pos] - *value) <= epsilon)
+			{
+				*value = m_upper[pos];
+			}
+		}
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColumnarBuckets::FirstBucketNotBefore
+//
+//	@doc:
+//		First bucket from the given one that does not end before the value;
+//		as the buckets are ordered, the ones that end before the value come
+//		first. The search halves the range without branching until it is
+//		small, then counts the buckets before the value in a loop that
+//		compilers vectorize
+//
+//---------------------------------------------------------------------------
+ULONG
+CColumnarBuckets::FirstBucketNotBefore(DOUBLE value, BOOL strict,
+									   ULONG start) const
+{
+	GPOS_ASSERT(start <= m_size);
+
+	ULONG pos = start;
+	ULONG length = m_size - start;
+	while (GPNAUCRATES_COLUMNAR_SCAN_SIZE < length)
+	{
+		const ULONG half = length / 2;
+		pos += IsBefore(pos + half - 1, value, strict) ? half : 0;
+		length -= half;
+	}
+
+	ULONG num_before = 0;
+	for (ULONG ul = pos; ul < pos + length; ul++)
+	{
+		num_before += IsBefore(ul, value, strict) ? 1 : 0;
+	}
+
+	return pos + num_before;
+}
+
+// sum of frequencies of buckets, in the order CHistogram sums them
+CDouble
+CColumnarBuckets::GetFrequency() const
+{
+	CDouble frequency(0.0);
+	for (ULONG ul = 0; ul < m_size; ul++)
+	{
+		frequency = frequency + CDouble(m_frequency[ul]);
+	}
+
+	return frequency;
+}
+
+// sum of number of distinct values of buckets, in the order CHistogram
+// sums them
+CDouble
+CColumnarBuckets::GetNumDistinct() const
+{
+	CDouble distinct(0.0);
+	for (ULONG ul = 0; ul < m_size; ul++)
+	{
+		distinct = distinct + CDouble(m_distinct[ul]);
+	}
+
+	return distinct;
+}
+
+// EOF
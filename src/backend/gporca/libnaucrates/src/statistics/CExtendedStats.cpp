@@ -0,0 +1,348 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CExtendedStats.cpp
+//
+//	@doc:
+//		Implementation of the multi-column statistics of a source relation
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CExtendedStats.h"
+
+#include "gpos/common/CBitSetIter.h"
+
+using namespace gpnaucrates;
+using namespace gpopt;
+
+// ctor
+CExtendedStats::CExtendedStats(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_ndistincts(GPOS_NEW(mp) SNDistinctArray(mp)),
+	  m_dependencies(GPOS_NEW(mp) SDependencyArray(mp)),
+	  m_mcv_lists(GPOS_NEW(mp) SMCVListArray(mp))
+{
+}
+
+// dtor
+CExtendedStats::~CExtendedStats()
+{
+	m_ndistincts->Release();
+	m_dependencies->Release();
+	m_mcv_lists->Release();
+}
+
+// remap the column ids of a set; return null if a column is not mapped,
+// or if two columns are mapped to the same one
+CBitSet *
+CExtendedStats::RemapColIds(CMemoryPool *mp, const CBitSet *colids,
+							UlongToColRefMap *colref_mapping)
+{
+	CBitSet *colids_new = GPOS_NEW(mp) CBitSet(mp);
+	CBitSetIter bsi(*colids);
+	while (bsi.Advance())
+	{
+		ULONG colid = bsi.Bit();
+		CColRef *colref = colref_mapping->Find(&colid);
+		if (nullptr == colref)
+		{
+			colids_new->Release();
+			return nullptr;
+		}
+		colids_new->ExchangeSet(colref->Id());
+	}
+
+	if (colids_new->Size() < colids->Size())
+	{
+		// columns were mapped to the same column
+		colids_new->Release();
+		return nullptr;
+	}
+
+	return colids_new;
+}
+
+// add the number of distinct values of a combination of columns
+void
+CExtendedStats::AddNDistinct(CBitSet *colids, CDouble ndistinct)
+{
+	m_ndistincts->Append(GPOS_NEW(m_mp) SNDistinct(colids, ndistinct));
+}
+
+// add a functional dependency
+void
+CExtendedStats::AddDependency(CBitSet *from_colids, ULONG to_colid,
+							  CDouble degree)
+{
+	m_dependencies->Append(
+		GPOS_NEW(m_mp) SDependency(from_colids, to_colid, degree));
+}
+
+// add the most common combinations of values of a group of columns
+void
+CExtendedStats::AddMCVList(ULongPtrArray *colids, SMCVItemArray *items)
+{
+	m_mcv_lists->Append(GPOS_NEW(m_mp) SMCVList(colids, items));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExtendedStats::FindNDistinct
+//
+//	@doc:
+//		The multi-column distinct values over the most columns, all of which
+//		are in the given set, among those of all the given sources; among
+//		those over as many columns, the one with the fewest distinct values
+//		is the tightest
+//
+//---------------------------------------------------------------------------
+const CExtendedStats::SNDistinct *
+CExtendedStats::FindNDistinct(const CExtendedStatsArray *ext_stats_array,
+							  const CBitSet *colids)
+{
+	const SNDistinct *best = nullptr;
+	for (ULONG ul = 0; ul < ext_stats_array->Size(); ul++)
+	{
+		const SNDistinctArray *ndistincts =
+			(*ext_stats_array)[ul]->m_ndistincts;
+		for (ULONG ulNDV = 0; ulNDV < ndistincts->Size(); ulNDV++)
+		{
+			const SNDistinct *ndistinct = (*ndistincts)[ulNDV];
+			if (!colids->ContainsAll(ndistinct->m_colids))
+			{
+				continue;
+			}
+
+			if (nullptr == best ||
+				best->m_colids->Size() < ndistinct->m_colids->Size() ||
+				(best->m_colids->Size() == ndistinct->m_colids->Size() &&
+				 ndistinct->m_ndistinct < best->m_ndistinct))
+			{
+				best = ndistinct;
+			}
+		}
+	}
+
+	return best;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExtendedStats::FindDependency
+//
+//	@doc:
+//		The strongest dependency between columns of the given set, among
+//		those of all the given sources; ties are broken in favor of the
+//		dependency on the fewest columns
+//
+//---------------------------------------------------------------------------
+const CExtendedStats::SDependency *
+CExtendedStats::FindDependency(const CExtendedStatsArray *ext_stats_array,
+							   const CBitSet *colids)
+{
+	const SDependency *best = nullptr;
+	for (ULONG ul = 0; ul < ext_stats_array->Size(); ul++)
+	{
+		const SDependencyArray *dependencies =
+			(*ext_stats_array)[ul]->m_dependencies;
+		for (ULONG ulDep = 0; ulDep < dependencies->Size(); ulDep++)
+		{
+			const SDependency *dependency = (*dependencies)[ulDep];
+			if (!colids->Get(dependency->m_to_colid) ||
+				!colids->ContainsAll(dependency->m_from_colids))
+			{
+				continue;
+			}
+
+			if (nullptr == best || best->m_degree < dependency->m_degree ||
+				(best->m_degree == dependency->m_degree &&
+				 dependency->m_from_colids->Size() <
+					 best->m_from_colids->Size()))
+			{
+				best = dependency;
+			}
+		}
+	}
+
+	return best;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExtendedStats::FindMCVList
+//
+//	@doc:
+//		The multi-column most common values with the most of their columns
+//		in the given set, among those of all the given sources; a list is
+//		only of use if at least two of its columns are in the set
+//
+//---------------------------------------------------------------------------
+const CExtendedStats::SMCVList *
+CExtendedStats::FindMCVList(const CExtendedStatsArray *ext_stats_array,
+							const CBitSet *colids)
+{
+	const SMCVList *best = nullptr;
+	ULONG best_covered = 1;
+	for (ULONG ul = 0; ul < ext_stats_array->Size(); ul++)
+	{
+		const SMCVListArray *mcv_lists = (*ext_stats_array)[ul]->m_mcv_lists;
+		for (ULONG ulMCV = 0; ulMCV < mcv_lists->Size(); ulMCV++)
+		{
+			const SMCVList *mcv_list = (*mcv_lists)[ulMCV];
+			const ULongPtrArray *mcv_colids = mcv_list->m_colids;
+			ULONG covered = 0;
+			for (ULONG ulCol = 0; ulCol < mcv_colids->Size(); ulCol++)
+			{
+				ULONG colid = *(*mcv_colids)[ulCol];
+				if (gpos::ulong_max != colid && colids->Get(colid))
+				{
+					covered++;
+				}
+			}
+
+			if (best_covered < covered)
+			{
+				best = mcv_list;
+				best_covered = covered;
+			}
+		}
+	}
+
+	return best;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExtendedStats::CopyWithRemap
+//
+//	@doc:
+//		Copy with remapped column ids; statistics on a column that is not
+//		mapped are dropped, and null is returned if none is left
+//
+//---------------------------------------------------------------------------
+CExtendedStats *
+CExtendedStats::CopyWithRemap(CMemoryPool *mp,
+							  UlongToColRefMap *colref_mapping) const
+{
+	CExtendedStats *ext_stats_copy = GPOS_NEW(mp) CExtendedStats(mp);
+
+	for (ULONG ul = 0; ul < m_ndistincts->Size(); ul++)
+	{
+		const SNDistinct *ndistinct = (*m_ndistincts)[ul];
+		CBitSet *colids =
+			RemapColIds(mp, ndistinct->m_colids, colref_mapping);
+		if (nullptr != colids)
+		{
+			ext_stats_copy->AddNDistinct(colids, ndistinct->m_ndistinct);
+		}
+	}
+
+	for (ULONG ul = 0; ul < m_dependencies->Size(); ul++)
+	{
+		const SDependency *dependency = (*m_dependencies)[ul];
+		CColRef *to_colref = colref_mapping->Find(&dependency->m_to_colid);
+		CBitSet *from_colids =
+			RemapColIds(mp, dependency->m_from_colids, colref_mapping);
+		if (nullptr == to_colref || nullptr == from_colids ||
+			from_colids->Get(to_colref->Id()))
+		{
+			CRefCount::SafeRelease(from_colids);
+			continue;
+		}
+
+		ext_stats_copy->AddDependency(from_colids, to_colref->Id(),
+									  dependency->m_degree);
+	}
+
+	// a column of a most common values list that is not mapped is ignored
+	// when matching the combinations, which then give the frequencies of
+	// the values of the other columns
+	for (ULONG ul = 0; ul < m_mcv_lists->Size(); ul++)
+	{
+		const SMCVList *mcv_list = (*m_mcv_lists)[ul];
+		ULongPtrArray *colids = GPOS_NEW(mp) ULongPtrArray(mp);
+		CBitSet *mapped_colids = GPOS_NEW(mp) CBitSet(mp);
+		for (ULONG ulCol = 0; ulCol < mcv_list->m_colids->Size(); ulCol++)
+		{
+			ULONG colid = *(*mcv_list->m_colids)[ulCol];
+			CColRef *colref = nullptr;
+			if (gpos::ulong_max != colid)
+			{
+				colref = colref_mapping->Find(&colid);
+			}
+
+			if (nullptr == colref || mapped_colids->ExchangeSet(colref->Id()))
+			{
+				colids->Append(GPOS_NEW(mp) ULONG(gpos::ulong_max));
+				continue;
+			}
+			colids->Append(GPOS_NEW(mp) ULONG(colref->Id()));
+		}
+
+		if (1 < mapped_colids->Size())
+		{
+			mcv_list->m_items->AddRef();
+			ext_stats_copy->AddMCVList(colids, mcv_list->m_items);
+		}
+		else
+		{
+			colids->Release();
+		}
+		mapped_colids->Release();
+	}
+
+	if (ext_stats_copy->IsEmpty())
+	{
+		ext_stats_copy->Release();
+		return nullptr;
+	}
+
+	return ext_stats_copy;
+}
+
+// print function
+IOstream &
+CExtendedStats::OsPrint(IOstream &os) const
+{
+	os << "{" << std::endl;
+	for (ULONG ul = 0; ul < m_ndistincts->Size(); ul++)
+	{
+		const SNDistinct *ndistinct = (*m_ndistincts)[ul];
+		os << " NDVs of ";
+		ndistinct->m_colids->OsPrint(os);
+		os << ": " << ndistinct->m_ndistinct << std::endl;
+	}
+	for (ULONG ul = 0; ul < m_dependencies->Size(); ul++)
+	{
+		const SDependency *dependency = (*m_dependencies)[ul];
+		os << " Dependency ";
+		dependency->m_from_colids->OsPrint(os);
+		os << " => " << dependency->m_to_colid << ": "
+		   << dependency->m_degree << std::endl;
+	}
+	for (ULONG ul = 0; ul < m_mcv_lists->Size(); ul++)
+	{
+		const SMCVList *mcv_list = (*m_mcv_lists)[ul];
+		os << " MCVs of (";
+		for (ULONG ulCol = 0; ulCol < mcv_list->m_colids->Size(); ulCol++)
+		{
+			ULONG colid = *(*mcv_list->m_colids)[ulCol];
+			os << (0 == ulCol ? "" : ", ");
+			if (gpos::ulong_max == colid)
+			{
+				os << "-";
+			}
+			else
+			{
+				os << colid;
+			}
+		}
+		os << "): " << mcv_list->m_items->Size() << " items" << std::endl;
+	}
+	os << "}" << std::endl;
+
+	return os;
+}
+
+// EOF
@@ -231,7 +231,7 @@ CFilterStatsProcessor::MakeStatsFilter(CMemoryPool *mp,
 	{
 		histograms_new = MakeHistHashMapConjOrDisjFilter(
 			mp, stats_config, histograms_copy, input_rows, base_pred_stats,
-			&scale_factor);
+			&scale_factor, input_stats->GetExtendedStats());
 
 		GPOS_ASSERT(CStatistics::MinRows.Get() <= scale_factor.Get());
 		rows_filter = input_rows / scale_factor;
@@ -268,7 +268,8 @@ UlongToHistogramMap *
 CFilterStatsProcessor::MakeHistHashMapConjOrDisjFilter(
 	CMemoryPool *mp, const CStatisticsConfig *stats_config,
 	UlongToHistogramMap *input_histograms, CDouble input_rows,
-	CStatsPred *pred_stats, CDouble *scale_factor)
+	CStatsPred *pred_stats, CDouble *scale_factor,
+	const CExtendedStatsArray *ext_stats)
 {
 	GPOS_ASSERT(nullptr != pred_stats);
 	GPOS_ASSERT(nullptr != stats_config);
@@ -282,7 +283,7 @@ CFilterStatsProcessor::MakeHistHashMapConjOrDisjFilter(
 			CStatsPredConj::ConvertPredStats(pred_stats);
 		return MakeHistHashMapConjFilter(mp, stats_config, input_histograms,
 										 input_rows, conjunctive_pred_stats,
-										 scale_factor);
+										 scale_factor, ext_stats);
 	}
 
 	CStatsPredDisj *disjunctive_pred_stats =
@@ -301,7 +302,8 @@ UlongToHistogramMap *
 CFilterStatsProcessor::MakeHistHashMapConjFilter(
 	CMemoryPool *mp, const CStatisticsConfig *stats_config,
 	UlongToHistogramMap *input_histograms, CDouble input_rows,
-	CStatsPredConj *conjunctive_pred_stats, CDouble *scale_factor)
+	CStatsPredConj *conjunctive_pred_stats, CDouble *scale_factor,
+	const CExtendedStatsArray *ext_stats)
 {
 	GPOS_ASSERT(nullptr != stats_config);
 	GPOS_ASSERT(nullptr != input_histograms);
@@ -312,6 +314,11 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 	CBitSet *filter_colids = GPOS_NEW(mp) CBitSet(mp);
 	CDoubleArray *scale_factors = GPOS_NEW(mp) CDoubleArray(mp);
 
+	// column of each scale factor, if it is for a single column, and the
+	// columns filtered by anything else than an equality with a constant
+	ULongPtrArray *scale_factor_colids = GPOS_NEW(mp) ULongPtrArray(mp);
+	CBitSet *non_eq_colids = GPOS_NEW(mp) CBitSet(mp);
+
 	// create copy of the original hash map of colid -> histogram
 	UlongToHistogramMap *result_histograms =
 		CStatisticsUtils::CopyHistHashMap(mp, input_histograms);
@@ -339,6 +346,7 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 				CStatsPredUnsupported::ConvertPredStats(child_pred_stats);
 			scale_factors->Append(
 				GPOS_NEW(mp) CDouble(unsupported_pred_stats->ScaleFactor()));
+			scale_factor_colids->Append(GPOS_NEW(mp) ULONG(gpos::ulong_max));
 
 			continue;
 		}
@@ -348,20 +356,30 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 		if (IsNewStatsColumn(colid, last_colid))
 		{
 			scale_factors->Append(GPOS_NEW(mp) CDouble(last_scale_factor));
+			scale_factor_colids->Append(GPOS_NEW(mp) ULONG(last_colid));
 			last_scale_factor = CDouble(1.0);
 		}
 
+		if (gpos::ulong_max != colid &&
+			(CStatsPred::EsptPoint != child_pred_stats->GetPredStatsType() ||
+			 CStatsPred::EstatscmptEq !=
+				 CStatsPredPoint::ConvertPredStats(child_pred_stats)
+					 ->GetCmpType()))
+		{
+			(void) non_eq_colids->ExchangeSet(colid);
+		}
+
 		if (CStatsPred::EsptDisj != child_pred_stats->GetPredStatsType())
 		{
 			GPOS_ASSERT(gpos::ulong_max != colid);
-			hist_before = result_histograms->Find(&colid)->CopyHistogram();
+			hist_before = result_histograms->Find(&colid)->ShareHistogram();
 			GPOS_ASSERT(nullptr != hist_before);
 
 			CHistogram *result_histogram = nullptr;
 			result_histogram = MakeHistSimpleFilter(
 				mp, child_pred_stats, filter_colids, hist_before,
 				&last_scale_factor, &last_colid);
-			GPOS_DELETE(hist_before);
+			hist_before->Release();
 
 			GPOS_ASSERT(nullptr != result_histogram);
 
@@ -377,7 +395,7 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 			CStatisticsUtils::AddHistogram(mp, colid, result_histogram,
 										   result_histograms,
 										   true /* fReplaceOld */);
-			GPOS_DELETE(result_histogram);
+			result_histogram->Release();
 		}
 		else
 		{
@@ -438,6 +456,27 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 
 	// scaling factor of the last predicate
 	scale_factors->Append(GPOS_NEW(mp) CDouble(last_scale_factor));
+	scale_factor_colids->Append(GPOS_NEW(mp) ULONG(last_colid));
+
+	if (nullptr != ext_stats && 0 < ext_stats->Size())
+	{
+		// columns filtered only by equalities with constants
+		CBitSet *eq_colids = GPOS_NEW(mp) CBitSet(mp);
+		for (ULONG ul = 0; ul < scale_factor_colids->Size(); ul++)
+		{
+			ULONG colid = *(*scale_factor_colids)[ul];
+			if (gpos::ulong_max != colid && !non_eq_colids->Get(colid))
+			{
+				(void) eq_colids->ExchangeSet(colid);
+			}
+		}
+
+		ApplyMCVLists(mp, ext_stats, conjunctive_pred_stats,
+					  scale_factor_colids, eq_colids, scale_factors);
+		ApplyDependencies(ext_stats, scale_factor_colids, eq_colids,
+						  scale_factors);
+		eq_colids->Release();
+	}
 
 	GPOS_ASSERT(nullptr != scale_factors);
 	CScaleFactorUtils::SortScalingFactor(scale_factors, true /* fDescending */);
@@ -447,11 +486,236 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 
 	// clean up
 	scale_factors->Release();
+	scale_factor_colids->Release();
+	non_eq_colids->Release();
 	filter_colids->Release();
 
 	return result_histograms;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CFilterStatsProcessor::ApplyMCVLists
+//
+//	@doc:
+//		Correct the scale factors of a conjunction of equality predicates
+//		for the most common combinations of values of their columns, as in
+//		the planner. The combinations that satisfy the predicates on the
+//		columns of a list have together the frequency mcv_sel, and would
+//		have mcv_basesel if the columns were independent. The other rows,
+//		a fraction 1 - mcv_totalsel of the relation, are estimated from
+//		the selectivity of the predicates taken independently, simple_sel,
+//		so that the selectivity of the predicates on the columns of the
+//		list is mcv_sel + min(max(simple_sel - mcv_basesel, 0),
+//		1 - mcv_totalsel). The list over the most columns is applied first,
+//		and a column is used at most once; the columns used are removed
+//		from the given set.
+//
+//---------------------------------------------------------------------------
+void
+CFilterStatsProcessor::ApplyMCVLists(CMemoryPool *mp,
+									 const CExtendedStatsArray *ext_stats,
+									 CStatsPredConj *conjunctive_pred_stats,
+									 const ULongPtrArray *scale_factor_colids,
+									 CBitSet *eq_colids,
+									 CDoubleArray *scale_factors)
+{
+	GPOS_ASSERT(scale_factors->Size() == scale_factor_colids->Size());
+
+	const ULONG size = scale_factor_colids->Size();
+	while (1 < eq_colids->Size())
+	{
+		const CExtendedStats::SMCVList *mcv_list =
+			CExtendedStats::FindMCVList(ext_stats, eq_colids);
+		if (nullptr == mcv_list)
+		{
+			break;
+		}
+
+		const ULongPtrArray *mcv_colids = mcv_list->m_colids;
+		CBitSet *covered_colids = GPOS_NEW(mp) CBitSet(mp);
+		for (ULONG ul = 0; ul < mcv_colids->Size(); ul++)
+		{
+			ULONG colid = *(*mcv_colids)[ul];
+			if (gpos::ulong_max != colid && eq_colids->Get(colid))
+			{
+				(void) covered_colids->ExchangeSet(colid);
+			}
+		}
+
+		CDouble mcv_sel(0.0);
+		CDouble mcv_basesel(0.0);
+		CDouble mcv_totalsel(0.0);
+		BOOL is_comparable = true;
+		const CExtendedStats::SMCVItemArray *items = mcv_list->m_items;
+		for (ULONG ulItem = 0; ulItem < items->Size() && is_comparable;
+			 ulItem++)
+		{
+			const CExtendedStats::SMCVItem *item = (*items)[ulItem];
+			BOOL is_match = true;
+			for (ULONG ul = 0; ul < mcv_colids->Size() && is_match; ul++)
+			{
+				ULONG colid = *(*mcv_colids)[ul];
+				if (gpos::ulong_max != colid && covered_colids->Get(colid))
+				{
+					is_match = IsMCVValueMatch(conjunctive_pred_stats, colid,
+											   (*item->m_values)[ul],
+											   &is_comparable);
+				}
+			}
+
+			if (is_match && is_comparable)
+			{
+				mcv_sel = mcv_sel + item->m_frequency;
+				mcv_basesel = mcv_basesel + item->m_base_frequency;
+			}
+			mcv_totalsel = mcv_totalsel + item->m_frequency;
+		}
+
+		// the list cannot be used if a value cannot be compared with the
+		// constants of the predicates, but its columns are not used either
+		if (is_comparable)
+		{
+			CDouble simple_sel(1.0);
+			for (ULONG ul = 0; ul < size; ul++)
+			{
+				ULONG colid = *(*scale_factor_colids)[ul];
+				if (gpos::ulong_max != colid && covered_colids->Get(colid))
+				{
+					simple_sel = simple_sel / *(*scale_factors)[ul];
+				}
+			}
+
+			CDouble other_sel = std::min(
+				std::max(simple_sel - mcv_basesel, CDouble(0.0)),
+				std::max(CDouble(1.0) - mcv_totalsel, CDouble(0.0)));
+			CDouble sel = std::min(mcv_sel + other_sel, CDouble(1.0));
+			sel = std::max(sel, CStatistics::Epsilon);
+
+			// the selectivity of the columns of the list is carried by the
+			// scale factor of one of them
+			BOOL is_first = true;
+			for (ULONG ul = 0; ul < size; ul++)
+			{
+				ULONG colid = *(*scale_factor_colids)[ul];
+				if (gpos::ulong_max != colid && covered_colids->Get(colid))
+				{
+					*(*scale_factors)[ul] =
+						is_first ? CDouble(1.0) / sel : CDouble(1.0);
+					is_first = false;
+				}
+			}
+		}
+
+		eq_colids->Difference(covered_colids);
+		covered_colids->Release();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFilterStatsProcessor::IsMCVValueMatch
+//
+//	@doc:
+//		Does the value of a column in a most common combination satisfy
+//		all the equality predicates on the column; nulls only satisfy the
+//		IS NULL predicates. The flag is reset if the value cannot be
+//		compared with a constant
+//
+//---------------------------------------------------------------------------
+BOOL
+CFilterStatsProcessor::IsMCVValueMatch(CStatsPredConj *conjunctive_pred_stats,
+									   ULONG colid, const IDatum *value,
+									   BOOL *is_comparable)
+{
+	const ULONG num_preds = conjunctive_pred_stats->GetNumPreds();
+	for (ULONG ul = 0; ul < num_preds; ul++)
+	{
+		CStatsPred *pred_stats = conjunctive_pred_stats->GetPredStats(ul);
+		if (colid != pred_stats->GetColId() ||
+			CStatsPred::EsptPoint != pred_stats->GetPredStatsType())
+		{
+			continue;
+		}
+
+		const IDatum *datum = CStatsPredPoint::ConvertPredStats(pred_stats)
+								  ->GetPredPoint()
+								  ->GetDatum();
+		if (datum->IsNull() || value->IsNull())
+		{
+			if (datum->IsNull() != value->IsNull())
+			{
+				return false;
+			}
+			continue;
+		}
+
+		if (!datum->StatsAreComparable(value))
+		{
+			*is_comparable = false;
+			return false;
+		}
+
+		if (!datum->StatsAreEqual(value))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CFilterStatsProcessor::ApplyDependencies
+//
+//	@doc:
+//		Correct the scale factors of a conjunction of equality predicates
+//		for the functional dependencies between their columns. If column c
+//		depends on column a with degree d, the rows with a given value of
+//		a have, for a fraction d of them, the value of c that goes with
+//		it, and the selectivity of (a = x AND c = y) is estimated as
+//		sel(a = x) * (d + (1 - d) * sel(c = y)), as in the planner. The
+//		strongest dependency is applied first, and a dependent column is
+//		used at most once. The scale factors are the inverse of the
+//		selectivities, and are given in the order of their columns. The
+//		dependent columns are removed from the given set.
+//
+//---------------------------------------------------------------------------
+void
+CFilterStatsProcessor::ApplyDependencies(
+	const CExtendedStatsArray *ext_stats,
+	const ULongPtrArray *scale_factor_colids, CBitSet *eq_colids,
+	CDoubleArray *scale_factors)
+{
+	GPOS_ASSERT(scale_factors->Size() == scale_factor_colids->Size());
+
+	const ULONG size = scale_factor_colids->Size();
+	while (1 < eq_colids->Size())
+	{
+		const CExtendedStats::SDependency *dependency =
+			CExtendedStats::FindDependency(ext_stats, eq_colids);
+		if (nullptr == dependency)
+		{
+			break;
+		}
+
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			if (dependency->m_to_colid == *(*scale_factor_colids)[ul])
+			{
+				CDouble *scale_factor = (*scale_factors)[ul];
+				CDouble degree = dependency->m_degree;
+				*scale_factor =
+					CDouble(1.0) /
+					(degree + (CDouble(1.0) - degree) / *scale_factor);
+			}
+		}
+
+		(void) eq_colids->ExchangeClear(dependency->m_to_colid);
+	}
+}
+
 // create new hash map of histograms after applying disjunctive predicates
 UlongToHistogramMap *
 CFilterStatsProcessor::MakeHistHashMapDisjFilter(
@@ -540,9 +804,12 @@ CFilterStatsProcessor::MakeHistHashMapDisjFilter(
 		}
 		else
 		{
+			// the rows of a disjunct are not the rows the dependencies
+			// were collected on, so they are not applied there
 			child_histograms = MakeHistHashMapConjOrDisjFilter(
 				mp, stats_config, input_histograms, input_rows,
-				child_pred_stats, &child_scale_factor);
+				child_pred_stats, &child_scale_factor,
+				nullptr /* ext_stats */);
 
 			GPOS_ASSERT_IMP(
 				CStatsPred::EsptDisj == child_pred_stats->GetPredStatsType(),
@@ -552,7 +819,7 @@ CFilterStatsProcessor::MakeHistHashMapDisjFilter(
 			{
 				// conjunction or disjunction uses only a single column
 				disjunctive_child_col_histogram =
-					child_histograms->Find(&colid)->CopyHistogram();
+					child_histograms->Find(&colid)->ShareHistogram();
 			}
 		}
 
@@ -591,8 +858,8 @@ CFilterStatsProcessor::MakeHistHashMapDisjFilter(
 					cumulative_rows = CDouble(std::max(
 						num_rows_disj_child.Get(), cumulative_rows.Get()));
 				}
-				GPOS_DELETE(previous_histogram);
-				GPOS_DELETE(disjunctive_child_col_histogram);
+				previous_histogram->Release();
+				disjunctive_child_col_histogram->Release();
 				previous_histogram = new_histogram;
 			}
 
@@ -682,6 +949,13 @@ CFilterStatsProcessor::MakeHistSimpleFilter(CMemoryPool *mp,
 		CStatsPredArrayCmp *arraycmp_pred_stats =
 			CStatsPredArrayCmp::ConvertPredStats(pred_stats);
 
+		if (CStatsPred::EstatscmptNEq == arraycmp_pred_stats->GetCmpType())
+		{
+			return MakeHistArrayCmpAllFilter(
+				mp, arraycmp_pred_stats, filter_colids, hist_before,
+				last_scale_factor, target_last_colid);
+		}
+
 		return MakeHistArrayCmpAnyFilter(mp, arraycmp_pred_stats, filter_colids,
 										 hist_before, last_scale_factor,
 										 target_last_colid);
@@ -745,7 +1019,7 @@ CFilterStatsProcessor::MakeHistUnsupportedPred(
 	(void) filter_colids->ExchangeSet(colid);
 
 	// generate after histogram
-	CHistogram *result_histogram = hist_before->CopyHistogram();
+	CHistogram *result_histogram = hist_before->ShareHistogram();
 	GPOS_ASSERT(nullptr != result_histogram);
 
 	*last_scale_factor = *last_scale_factor * pred_stats->ScaleFactor();
@@ -770,7 +1044,7 @@ CFilterStatsProcessor::MakeHistLikeFilter(CStatsPredLike *pred_stats,
 
 	// note column id
 	(void) filter_colids->ExchangeSet(colid);
-	CHistogram *result_histogram = hist_before->CopyHistogram();
+	CHistogram *result_histogram = hist_before->ShareHistogram();
 
 	*last_scale_factor = *last_scale_factor * pred_stats->DefaultScaleFactor();
 	*target_last_colid = colid;
@@ -812,32 +1086,7 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 	// 4. Compute and adjust the resultant scale factor for the filter.
 
 	// First, de-duplicate the constants in the array list
-	CPointArray *points = pred_stats->GetPoints();
-	if (points->Size() > 1)
-	{
-		points->Sort(&CUtils::CPointCmp);
-	}
-
-	CPointArray *deduped_points = GPOS_NEW(mp) CPointArray(mp);
-	IDatum *prev_datum = nullptr;
-
-	for (ULONG ul = 0; ul < points->Size(); ++ul)
-	{
-		CPoint *point = (*points)[ul];
-		IDatum *datum = point->GetDatum();
-		GPOS_ASSERT(datum->StatsAreComparable(datum));
-		if (datum->IsNull())
-		{
-			continue;
-		}
-		if (prev_datum != nullptr && prev_datum->StatsAreEqual(datum))
-		{
-			continue;
-		}
-		point->AddRef();
-		deduped_points->Append(point);
-		prev_datum = datum;
-	}
+	CPointArray *deduped_points = MakeSortedDistinctPoints(mp, pred_stats);
 	CDouble dummy_rows(deduped_points->Size());
 
 	// Create buckets for the result histogram using the same bucket boundaries
@@ -923,12 +1172,146 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 	*target_last_colid = colid;
 
 	// clean up
-	GPOS_DELETE(dummy_histogram);
+	dummy_histogram->Release();
 	deduped_points->Release();
 
 	return result_histogram;
 }
 
+// create a new histogram after applying the "<> ALL (ARRAY[...])" filter
+CHistogram *
+CFilterStatsProcessor::MakeHistArrayCmpAllFilter(CMemoryPool *mp,
+												 CStatsPredArrayCmp *pred_stats,
+												 CBitSet *filter_colids,
+												 CHistogram *base_histogram,
+												 CDouble *last_scale_factor,
+												 ULONG *target_last_colid)
+{
+	GPOS_ASSERT(nullptr != pred_stats);
+	GPOS_ASSERT(nullptr != filter_colids);
+	GPOS_ASSERT(nullptr != base_histogram);
+	GPOS_ASSERT(pred_stats->GetCmpType() == CStatsPred::EstatscmptNEq);
+
+	// note column id
+	const ULONG colid = pred_stats->GetColId();
+	(void) filter_colids->ExchangeSet(colid);
+	*target_last_colid = colid;
+
+	if (!base_histogram->IsWellDefined())
+	{
+		*last_scale_factor =
+			*last_scale_factor / CHistogram::DefaultSelectivity;
+		return GPOS_NEW(mp) CHistogram(mp, false /* is_well_defined */);
+	}
+
+	// Evaluate statistics for "select * from foo where a not in (...)" the
+	// way a conjunction of "a <> const" filters is evaluated: each constant
+	// splits the bucket it falls in around itself, and constants outside
+	// of all buckets change nothing. The sorted, deduplicated list is merged
+	// with the buckets in a single pass, instead of building a new histogram
+	// per constant
+	CPointArray *deduped_points = MakeSortedDistinctPoints(mp, pred_stats);
+	const ULONG num_points = deduped_points->Size();
+
+	const CBucketArray *base_buckets = base_histogram->GetBuckets();
+	CBucketArray *result_buckets = GPOS_NEW(mp) CBucketArray(mp);
+	ULONG point_iter = 0;
+	for (ULONG bucket_iter = 0; bucket_iter < base_buckets->Size();
+		 ++bucket_iter)
+	{
+		CBucket *bucket = (*base_buckets)[bucket_iter];
+
+		// skip datums that are before the bucket
+		while (point_iter < num_points &&
+			   bucket->IsBefore((*deduped_points)[point_iter]))
+		{
+			point_iter++;
+		}
+
+		// split off the part of the bucket below each point it contains,
+		// and continue with the part above the point
+		CBucket *remaining_bucket = bucket->MakeBucketCopy(mp);
+		while (point_iter < num_points &&
+			   bucket->Contains((*deduped_points)[point_iter]))
+		{
+			CPoint *point = (*deduped_points)[point_iter];
+			point_iter++;
+			if (nullptr == remaining_bucket ||
+				!remaining_bucket->Contains(point))
+			{
+				continue;
+			}
+
+			CBucket *less_than_bucket = remaining_bucket->MakeBucketScaleUpper(
+				mp, point, false /*include_upper */);
+			if (nullptr != less_than_bucket)
+			{
+				result_buckets->Append(less_than_bucket);
+			}
+			CBucket *greater_than_bucket =
+				remaining_bucket->MakeBucketGreaterThan(mp, point);
+			GPOS_DELETE(remaining_bucket);
+			remaining_bucket = greater_than_bucket;
+		}
+
+		if (nullptr != remaining_bucket)
+		{
+			result_buckets->Append(remaining_bucket);
+		}
+	}
+
+	// "a <> const" is never true for a null
+	CHistogram *result_histogram = GPOS_NEW(mp) CHistogram(
+		mp, result_buckets, true /* is_well_defined */,
+		CDouble(0.0) /* null_freq */, base_histogram->GetDistinctRemain(),
+		base_histogram->GetFreqRemain());
+
+	CDouble local_scale_factor = result_histogram->NormalizeHistogram();
+	GPOS_ASSERT(DOUBLE(1.0) <= local_scale_factor.Get());
+
+	// update scale factor
+	*last_scale_factor = *last_scale_factor * local_scale_factor;
+
+	deduped_points->Release();
+
+	return result_histogram;
+}
+
+// sorted and deduplicated non-null points of an array comparison
+CPointArray *
+CFilterStatsProcessor::MakeSortedDistinctPoints(CMemoryPool *mp,
+												CStatsPredArrayCmp *pred_stats)
+{
+	CPointArray *points = pred_stats->GetPoints();
+	if (points->Size() > 1)
+	{
+		points->Sort(&CUtils::CPointCmp);
+	}
+
+	CPointArray *deduped_points = GPOS_NEW(mp) CPointArray(mp);
+	IDatum *prev_datum = nullptr;
+
+	for (ULONG ul = 0; ul < points->Size(); ++ul)
+	{
+		CPoint *point = (*points)[ul];
+		IDatum *datum = point->GetDatum();
+		GPOS_ASSERT(datum->StatsAreComparable(datum));
+		if (datum->IsNull())
+		{
+			continue;
+		}
+		if (prev_datum != nullptr && prev_datum->StatsAreEqual(datum))
+		{
+			continue;
+		}
+		point->AddRef();
+		deduped_points->Append(point);
+		prev_datum = datum;
+	}
+
+	return deduped_points;
+}
+
 // check if the column is a new column for statistic calculation
 BOOL
 CFilterStatsProcessor::IsNewStatsColumn(ULONG colid, ULONG last_colid)
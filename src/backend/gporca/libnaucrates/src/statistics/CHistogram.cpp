@@ -62,7 +62,9 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_columnar_buckets(nullptr),
+	  m_num_lookups(0)
 {
 	GPOS_ASSERT(nullptr != histogram_buckets);
 }
@@ -78,7 +80,9 @@ CHistogram::CHistogram(CMemoryPool *mp, BOOL is_well_defined)
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_columnar_buckets(nullptr),
+	  m_num_lookups(0)
 {
 	m_histogram_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 }
@@ -97,7 +101,9 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(is_col_stats_missing)
+	  m_is_col_stats_missing(is_col_stats_missing),
+	  m_columnar_buckets(nullptr),
+	  m_num_lookups(0)
 {
 	GPOS_ASSERT(m_histogram_buckets);
 	GPOS_ASSERT(CDouble(0.0) <= null_freq);
@@ -156,6 +162,54 @@ CHistogram::OsPrint(IOstream &os) const
 	return os;
 }
 
+// columnar copy of the buckets; built on the second lookup, and not tried
+// again if the buckets do not allow it
+const CColumnarBuckets *
+CHistogram::GetColumnarBuckets() const
+{
+	if (nullptr == m_columnar_buckets && 2 > m_num_lookups)
+	{
+		m_num_lookups++;
+		if (2 == m_num_lookups)
+		{
+			m_columnar_buckets =
+				CColumnarBuckets::PcbCreate(m_mp, m_histogram_buckets);
+		}
+	}
+
+	return m_columnar_buckets;
+}
+
+// drop the columnar copy of the buckets that are being replaced
+void
+CHistogram::ResetColumnarBuckets()
+{
+	GPOS_DELETE(m_columnar_buckets);
+	m_columnar_buckets = nullptr;
+	m_num_lookups = 0;
+}
+
+// index of the only bucket that may contain the point, found by a search
+// of the columnar buckets if possible; all buckets before it end before
+// the point
+ULONG
+CHistogram::FindBucketForPoint(const CPoint *point) const
+{
+	const CColumnarBuckets *columnar_buckets = GetColumnarBuckets();
+	DOUBLE value = 0.0;
+	if (nullptr == columnar_buckets ||
+		!columnar_buckets->FMapPoint(point, &value))
+	{
+		return 0;
+	}
+
+	const ULONG bucket_index = columnar_buckets->LookupPoint(value);
+	GPOS_ASSERT_IMP(0 < bucket_index,
+					(*m_histogram_buckets)[bucket_index - 1]->IsAfter(point));
+
+	return bucket_index;
+}
+
 // check if histogram is empty
 BOOL
 CHistogram::IsEmpty() const
@@ -176,7 +230,17 @@ CHistogram::MakeHistogramLessThanOrLessThanEqualFilter(
 	CBucketArray *new_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 	const ULONG num_buckets = m_histogram_buckets->Size();
 
-	for (ULONG bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	// buckets that end before the point are copied as they are
+	const ULONG first_bucket_index = FindBucketForPoint(point);
+	for (ULONG bucket_index = 0; bucket_index < first_bucket_index;
+		 bucket_index++)
+	{
+		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		new_buckets->Append(bucket->MakeBucketCopy(m_mp));
+	}
+
+	for (ULONG bucket_index = first_bucket_index; bucket_index < num_buckets;
+		 bucket_index++)
 	{
 		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
 		if (bucket->IsBefore(point))
@@ -301,7 +365,8 @@ CHistogram::MakeBucketsWithEqualityFilter(CPoint *point) const
 	const ULONG num_buckets = m_histogram_buckets->Size();
 	ULONG bucket_index = 0;
 
-	for (bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	for (bucket_index = FindBucketForPoint(point); bucket_index < num_buckets;
+		 bucket_index++)
 	{
 		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
 
@@ -403,7 +468,8 @@ CHistogram::MakeHistogramGreaterThanOrGreaterThanEqualFilter(
 
 	// find first bucket that contains point
 	ULONG bucket_index = 0;
-	for (bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	for (bucket_index = FindBucketForPoint(point); bucket_index < num_buckets;
+		 bucket_index++)
 	{
 		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
 		if (bucket->IsBefore(point))
@@ -459,11 +525,19 @@ CDouble
 CHistogram::GetFrequency() const
 {
 	CDouble frequency(0.0);
-	const ULONG num_of_buckets = m_histogram_buckets->Size();
-	for (ULONG bucket_index = 0; bucket_index < num_of_buckets; bucket_index++)
+	if (nullptr != m_columnar_buckets)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
-		frequency = frequency + bucket->GetFrequency();
+		frequency = m_columnar_buckets->GetFrequency();
+	}
+	else
+	{
+		const ULONG num_of_buckets = m_histogram_buckets->Size();
+		for (ULONG bucket_index = 0; bucket_index < num_of_buckets;
+			 bucket_index++)
+		{
+			CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+			frequency = frequency + bucket->GetFrequency();
+		}
 	}
 
 	if (CStatistics::Epsilon < m_null_freq)
@@ -479,11 +553,19 @@ CDouble
 CHistogram::GetNumDistinct() const
 {
 	CDouble distinct(0.0);
-	const ULONG num_of_buckets = m_histogram_buckets->Size();
-	for (ULONG bucket_index = 0; bucket_index < num_of_buckets; bucket_index++)
+	if (nullptr != m_columnar_buckets)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
-		distinct = distinct + bucket->GetNumDistinct();
+		distinct = m_columnar_buckets->GetNumDistinct();
+	}
+	else
+	{
+		const ULONG num_of_buckets = m_histogram_buckets->Size();
+		for (ULONG bucket_index = 0; bucket_index < num_of_buckets;
+			 bucket_index++)
+		{
+			CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+			distinct = distinct + bucket->GetNumDistinct();
+		}
 	}
 	CDouble distinct_null(0.0);
 	if (CStatistics::Epsilon < m_null_freq)
@@ -524,6 +606,7 @@ CHistogram::CapNDVs(CDouble rows)
 	}
 	m_histogram_buckets->Release();
 	m_histogram_buckets = histogram_buckets;
+	ResetColumnarBuckets();
 	m_distinct_remaining = m_distinct_remaining * scale_ratio;
 }
 
@@ -731,7 +814,7 @@ CHistogram::GetInequalityJoinScaleFactor(CDouble rows,
 	CHistogram *equijoin_histogram =
 		MakeJoinHistogramNormalize(CStatsPred::EstatscmptEq, rows,
 								   other_histogram, rows_other, &scale_factor);
-	GPOS_DELETE(equijoin_histogram);
+	equijoin_histogram->Release();
 
 	CDouble cartesian_product_num_rows = rows * rows_other;
 
@@ -994,6 +1077,7 @@ CHistogram::NormalizeHistogram()
 		}
 		m_histogram_buckets->Release();
 		m_histogram_buckets = histogram_buckets;
+		ResetColumnarBuckets();
 	}
 
 	m_null_freq = m_null_freq * scale_factor;
@@ -1106,11 +1190,18 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 		return MakeNDVBasedJoinHistogramEqualityFilter(histogram);
 	}
 
+	// columnar buckets, used to skip runs of buckets that end before the
+	// current bucket of the other histogram
+	const CColumnarBuckets *columnar_buckets1 = GetColumnarBuckets();
+	const CColumnarBuckets *columnar_buckets2 =
+		histogram->GetColumnarBuckets();
+
 	CBucketArray *join_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 	while (idx1 < buckets1 && idx2 < buckets2)
 	{
 		CBucket *bucket1 = (*m_histogram_buckets)[idx1];
 		CBucket *bucket2 = (*histogram->m_histogram_buckets)[idx2];
+		DOUBLE lower_bound = 0.0;
 
 		if (bucket1->Intersects(bucket2))
 		{
@@ -1145,11 +1236,21 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 		{
 			// buckets do not intersect there one bucket is before the other
 			idx1++;
+			if (idx1 < buckets1 && nullptr != columnar_buckets1 &&
+				columnar_buckets1->FMapLowerBound(bucket2, &lower_bound))
+			{
+				idx1 = columnar_buckets1->SkipBucketsBefore(lower_bound, idx1);
+			}
 		}
 		else
 		{
 			GPOS_ASSERT(bucket2->IsBefore(bucket1));
 			idx2++;
+			if (idx2 < buckets2 && nullptr != columnar_buckets2 &&
+				columnar_buckets2->FMapLowerBound(bucket1, &lower_bound))
+			{
+				idx2 = columnar_buckets2->SkipBucketsBefore(lower_bound, idx2);
+			}
 		}
 	}
 
@@ -104,16 +104,16 @@ CJoinStatsProcessor::JoinHistograms(
 		// just the scale factors.
 
 		GPOS_ASSERT(join_histogram->IsEmpty());
-		GPOS_DELETE(join_histogram);
+		join_histogram->Release();
 
 		// TODO:  Feb 21 2014, for all join condition except for "=" join predicate
 		// we currently do not compute new histograms for the join columns
 	}
 
 	// for an unsupported join predicate operator or in the case of
-	// missing histograms, copy input histograms and use default scale factor
-	*result_hist1 = histogram1->CopyHistogram();
-	*result_hist2 = histogram2->CopyHistogram();
+	// missing histograms, share input histograms and use default scale factor
+	*result_hist1 = histogram1->ShareHistogram();
+	*result_hist2 = histogram2->ShareHistogram();
 }
 
 //	derive statistics for the given join's predicate(s)
@@ -378,8 +378,8 @@ CJoinStatsProcessor::SetResultingJoinStats(
 										   result_col_hist_mapping);
 		}
 
-		GPOS_DELETE(outer_histogram_after);
-		GPOS_DELETE(inner_histogram_after);
+		outer_histogram_after->Release();
+		CRefCount::SafeRelease(inner_histogram_after);
 
 		// remember which tables the columns came from, this info is used to combine scale factors
 		CColumnFactory *col_factory = COptCtxt::PoctxtFromTLS()->Pcf();
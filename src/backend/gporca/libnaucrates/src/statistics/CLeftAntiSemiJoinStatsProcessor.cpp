@@ -43,7 +43,7 @@ CLeftAntiSemiJoinStatsProcessor::JoinHistogramsLASJ(
 
 	if (is_input_empty)
 	{
-		*result_hist1 = histogram1->CopyHistogram();
+		*result_hist1 = histogram1->ShareHistogram();
 		*result_hist2 = nullptr;
 
 		return;
@@ -69,9 +69,9 @@ CLeftAntiSemiJoinStatsProcessor::JoinHistogramsLASJ(
 	}
 
 	// for an unsupported join predicate operator or in the case of missing stats,
-	// copy input histograms and use default scale factor
+	// share input histograms and use default scale factor
 	*scale_factor = CDouble(CScaleFactorUtils::DefaultJoinPredScaleFactor);
-	*result_hist1 = histogram1->CopyHistogram();
+	*result_hist1 = histogram1->ShareHistogram();
 	*result_hist2 = nullptr;
 }
 
@@ -137,7 +137,7 @@ CLeftOuterJoinStatsProcessor::MakeLOJHistogram(
 						num_rows_inner_join);
 				CStatisticsUtils::AddHistogram(mp, colid, LOJ_histogram,
 											   LOJ_histograms);
-				GPOS_DELETE(LOJ_histogram);
+				LOJ_histogram->Release();
 			}
 			else
 			{
@@ -206,8 +206,8 @@ CLeftOuterJoinStatsProcessor::AddHistogramsLOJInner(
 		CStatisticsUtils::AddHistogram(mp, colid, LOJ_histogram,
 									   LOJ_histograms);
 
-		GPOS_DELETE(null_histogram);
-		GPOS_DELETE(LOJ_histogram);
+		null_histogram->Release();
+		LOJ_histogram->Release();
 	}
 }
 
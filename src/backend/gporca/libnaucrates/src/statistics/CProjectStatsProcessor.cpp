@@ -89,7 +89,7 @@ CProjectStatsProcessor::CalcProjStats(CMemoryPool *mp,
 		else
 		{
 			histograms_new->Insert(GPOS_NEW(mp) ULONG(colid),
-								   histogram->CopyHistogram());
+								   histogram->ShareHistogram());
 		}
 
 		// look up width
@@ -71,7 +71,8 @@ CStatistics::CStatistics(CMemoryPool *mp,
 	  m_num_rebinds(
 		  1.0),	 // by default, a stats object is rebound to parameters only once
 	  m_num_predicates(num_predicates),
-	  m_src_upper_bound_NDVs(nullptr)
+	  m_src_upper_bound_NDVs(nullptr),
+	  m_ext_stats(nullptr)
 {
 	GPOS_ASSERT(nullptr != m_colid_histogram_mapping);
 	GPOS_ASSERT(nullptr != m_colid_width_mapping);
@@ -79,6 +80,7 @@ CStatistics::CStatistics(CMemoryPool *mp,
 
 	// hash map for source id -> max source cardinality mapping
 	m_src_upper_bound_NDVs = GPOS_NEW(mp) CUpperBoundNDVPtrArray(mp);
+	m_ext_stats = GPOS_NEW(mp) CExtendedStatsArray(mp);
 
 	m_stats_conf =
 		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetStatsConf();
@@ -98,7 +100,8 @@ CStatistics::CStatistics(CMemoryPool *mp,
 	  m_num_rebinds(
 		  1.0),	 // by default, a stats object is rebound to parameters only once
 	  m_num_predicates(0),
-	  m_src_upper_bound_NDVs(nullptr)
+	  m_src_upper_bound_NDVs(nullptr),
+	  m_ext_stats(nullptr)
 {
 	GPOS_ASSERT(nullptr != m_colid_histogram_mapping);
 	GPOS_ASSERT(nullptr != m_colid_width_mapping);
@@ -106,6 +109,7 @@ CStatistics::CStatistics(CMemoryPool *mp,
 
 	// hash map for source id -> max source cardinality mapping
 	m_src_upper_bound_NDVs = GPOS_NEW(mp) CUpperBoundNDVPtrArray(mp);
+	m_ext_stats = GPOS_NEW(mp) CExtendedStatsArray(mp);
 
 	m_stats_conf =
 		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetStatsConf();
@@ -117,6 +121,7 @@ CStatistics::~CStatistics()
 	m_colid_histogram_mapping->Release();
 	m_colid_width_mapping->Release();
 	m_src_upper_bound_NDVs->Release();
+	m_ext_stats->Release();
 }
 
 // look up the width of a particular column
@@ -127,7 +132,8 @@ CStatistics::GetWidth(ULONG colid) const
 }
 
 
-//	cap the total number of distinct values (NDVs) in buckets to the number of rows
+//	cap the total number of distinct values (NDVs) in buckets to the number of rows;
+//	histograms shared with other maps are replaced by capped copies
 void
 CStatistics::CapNDVs(CDouble rows, UlongToHistogramMap *col_histogram_mapping)
 {
@@ -135,9 +141,21 @@ CStatistics::CapNDVs(CDouble rows, UlongToHistogramMap *col_histogram_mapping)
 	UlongToHistogramMapIter col_hist_mapping(col_histogram_mapping);
 	while (col_hist_mapping.Advance())
 	{
-		CHistogram *histogram =
-			const_cast<CHistogram *>(col_hist_mapping.Value());
-		histogram->CapNDVs(rows);
+		const CHistogram *histogram = col_hist_mapping.Value();
+		if (rows >= histogram->GetNumDistinct())
+		{
+			// no need for capping
+			continue;
+		}
+
+		CHistogram *histogram_capped = const_cast<CHistogram *>(histogram);
+		if (1 < histogram->RefCount())
+		{
+			histogram_capped = histogram->CopyHistogram();
+			col_histogram_mapping->Replace(col_hist_mapping.Key(),
+										   histogram_capped);
+		}
+		histogram_capped->CapNDVs(rows);
 	}
 }
 
@@ -174,6 +192,10 @@ CStatistics::OsPrint(IOstream &os) const
 		const CUpperBoundNDVs *upper_bound_NDVs = (*m_src_upper_bound_NDVs)[i];
 		upper_bound_NDVs->OsPrint(os);
 	}
+	for (ULONG i = 0; i < m_ext_stats->Size(); i++)
+	{
+		(*m_ext_stats)[i]->OsPrint(os);
+	}
 	os << "StatsEstimationRisk = " << StatsEstimationRisk() << std::endl;
 	os << "}" << std::endl;
 
@@ -498,7 +520,7 @@ CStatistics::CopyHistograms(CMemoryPool *mp) const
 		}
 		else
 		{
-			histogram_copy = histogram->CopyHistogram();
+			histogram_copy = histogram->ShareHistogram();
 		}
 
 		histograms_copy->Insert(GPOS_NEW(mp) ULONG(colid), histogram_copy);
@@ -625,6 +647,18 @@ CStatistics::CopyStatsWithRemap(CMemoryPool *mp,
 		}
 	}
 
+	// copy the multi-column statistics of the columns that are mapped
+	for (ULONG i = 0; i < m_ext_stats->Size(); i++)
+	{
+		CExtendedStats *ext_stats_copy =
+			(*m_ext_stats)[i]->CopyWithRemap(mp, colref_mapping);
+
+		if (nullptr != ext_stats_copy)
+		{
+			stats_copy->AddExtendedStats(ext_stats_copy);
+		}
+	}
+
 	return stats_copy;
 }
 
@@ -756,6 +790,15 @@ CStatistics::AddCardUpperBound(CUpperBoundNDVs *upper_bound_NDVs)
 	m_src_upper_bound_NDVs->Append(upper_bound_NDVs);
 }
 
+// add multi-column statistics of a source
+void
+CStatistics::AddExtendedStats(CExtendedStats *ext_stats)
+{
+	GPOS_ASSERT(nullptr != ext_stats);
+
+	m_ext_stats->Append(ext_stats);
+}
+
 // return the dxl representation of the statistics object
 CDXLStatsDerivedRelation *
 CStatistics::GetDxlStatsDrvdRelation(CMemoryPool *mp,
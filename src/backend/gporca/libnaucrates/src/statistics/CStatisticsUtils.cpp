@@ -12,6 +12,7 @@
 #include "naucrates/statistics/CStatisticsUtils.h"
 
 #include "gpos/base.h"
+#include "gpos/common/CBitSetIter.h"
 #include "gpos/error/CAutoTrace.h"
 
 #include "gpopt/base/CColRefSetIter.h"
@@ -708,7 +709,7 @@ CStatisticsUtils::UpdateDisjStatistics(
 					input_disjunct_rows, result_histogram, local_rows,
 					&output_rows);
 
-			GPOS_DELETE(previous_histogram);
+			previous_histogram->Release();
 			previous_histogram = new_histogram;
 		}
 
@@ -717,7 +718,7 @@ CStatisticsUtils::UpdateDisjStatistics(
 		);
 	}
 
-	GPOS_DELETE(previous_histogram);
+	CRefCount::SafeRelease(previous_histogram);
 }
 
 //---------------------------------------------------------------------------
@@ -805,7 +806,8 @@ CStatisticsUtils::GetColsNonUpdatableHistForDisj(CMemoryPool *mp,
 //		CStatisticsUtils::AddHistogram
 //
 //	@doc:
-//		Add histogram to histogram map if not already present.
+//		Add histogram to histogram map if not already present; the map
+//		shares the histogram, which must not be modified afterwards
 //
 //---------------------------------------------------------------------------
 void
@@ -819,13 +821,13 @@ CStatisticsUtils::AddHistogram(CMemoryPool *mp, ULONG colid,
 	if (nullptr == col_histogram_mapping->Find(&colid))
 	{
 		BOOL result GPOS_ASSERTS_ONLY = col_histogram_mapping->Insert(
-			GPOS_NEW(mp) ULONG(colid), histogram->CopyHistogram());
+			GPOS_NEW(mp) ULONG(colid), histogram->ShareHistogram());
 		GPOS_ASSERT(result);
 	}
 	else if (replace_old)
 	{
 		BOOL result GPOS_ASSERTS_ONLY =
-			col_histogram_mapping->Replace(&colid, histogram->CopyHistogram());
+			col_histogram_mapping->Replace(&colid, histogram->ShareHistogram());
 		GPOS_ASSERT(result);
 	}
 }
@@ -921,7 +923,7 @@ CStatisticsUtils::MergeHistogramMapsForDisjPreds(CMemoryPool *mp,
 					AddHistogram(mp, colid, normalized_union_histogram,
 								 merged_hmap, true /* fReplaceOld */);
 
-					GPOS_DELETE(normalized_union_histogram);
+					normalized_union_histogram->Release();
 				}
 				else
 				{
@@ -1351,6 +1353,86 @@ CStatisticsUtils::AddNdvForAllGrpCols(
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatisticsUtils::AddMultiColumnNdvs
+//
+//	@doc:
+//		Add the NDVs of the combinations of grouping columns that the
+//		extended statistics of the input have multi-column NDVs for, largest
+//		combination first, and return the grouping columns that are not part
+//		of any of these combinations. Correlated columns such as city and
+//		zip code then count as one column instead of multiplying their NDVs.
+//		As the input may have been filtered since the extended statistics
+//		were collected, the NDV of a combination is capped by the product of
+//		the current NDVs of its columns.
+//---------------------------------------------------------------------------
+ULongPtrArray *
+CStatisticsUtils::AddMultiColumnNdvs(
+	CMemoryPool *mp, const CStatistics *input_stats,
+	const ULongPtrArray
+		*grouping_columns,	   // array of grouping column ids from a source
+	CDoubleArray *output_ndvs  // output array of ndvs
+)
+{
+	GPOS_ASSERT(nullptr != grouping_columns);
+	GPOS_ASSERT(nullptr != input_stats);
+	GPOS_ASSERT(nullptr != output_ndvs);
+
+	const CExtendedStatsArray *ext_stats = input_stats->GetExtendedStats();
+	const ULONG num_cols = grouping_columns->Size();
+
+	CBitSet *uncovered_colids = GPOS_NEW(mp) CBitSet(mp);
+	for (ULONG i = 0; i < num_cols; i++)
+	{
+		uncovered_colids->ExchangeSet(*(*grouping_columns)[i]);
+	}
+
+	while (0 < ext_stats->Size() && 1 < uncovered_colids->Size())
+	{
+		const CExtendedStats::SNDistinct *ndistinct =
+			CExtendedStats::FindNDistinct(ext_stats, uncovered_colids);
+		if (nullptr == ndistinct)
+		{
+			break;
+		}
+
+		ULongPtrArray *covered_colids = GPOS_NEW(mp) ULongPtrArray(mp);
+		CBitSetIter bsi(*ndistinct->m_colids);
+		while (bsi.Advance())
+		{
+			covered_colids->Append(GPOS_NEW(mp) ULONG(bsi.Bit()));
+		}
+		CDoubleArray *covered_ndvs = GPOS_NEW(mp) CDoubleArray(mp);
+		AddNdvForAllGrpCols(mp, input_stats, covered_colids, covered_ndvs);
+
+		CDouble ndv_product(1.0);
+		for (ULONG i = 0; i < covered_ndvs->Size(); i++)
+		{
+			ndv_product = ndv_product * *(*covered_ndvs)[i];
+		}
+		output_ndvs->Append(GPOS_NEW(mp) CDouble(
+			std::min(ndistinct->m_ndistinct.Get(), ndv_product.Get())));
+
+		uncovered_colids->Difference(ndistinct->m_colids);
+		covered_ndvs->Release();
+		covered_colids->Release();
+	}
+
+	ULongPtrArray *uncovered_columns = GPOS_NEW(mp) ULongPtrArray(mp);
+	for (ULONG i = 0; i < num_cols; i++)
+	{
+		ULONG colid = *(*grouping_columns)[i];
+		if (uncovered_colids->Get(colid))
+		{
+			uncovered_columns->Append(GPOS_NEW(mp) ULONG(colid));
+		}
+	}
+	uncovered_colids->Release();
+
+	return uncovered_columns;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CStatisticsUtils::ExtractNDVForGrpCols
@@ -1503,7 +1585,10 @@ CStatisticsUtils::MaxNumGroupsForGivenSrcGprCols(
 	CDouble upper_bound_ndvs = input_stats->GetColUpperBoundNDVs(first_colref);
 
 	CDoubleArray *ndvs = GPOS_NEW(mp) CDoubleArray(mp);
-	AddNdvForAllGrpCols(mp, input_stats, src_grouping_cols, ndvs);
+	ULongPtrArray *uncovered_grouping_cols =
+		AddMultiColumnNdvs(mp, input_stats, src_grouping_cols, ndvs);
+	AddNdvForAllGrpCols(mp, input_stats, uncovered_grouping_cols, ndvs);
+	uncovered_grouping_cols->Release();
 
 	// take the minimum of (a) the estimated number of groups from the columns of this source,
 	// (b) input rows, and (c) cardinality upper bound for the given source in the
@@ -1638,7 +1723,7 @@ CStatisticsUtils::AddGrpColStats(CMemoryPool *mp,
 				result_histogram->SetNDVScaled();
 			}
 			AddHistogram(mp, grp_colid, result_histogram, output_histograms);
-			GPOS_DELETE(result_histogram);
+			result_histogram->Release();
 		}
 
 		const CDouble *width = input_stats->GetWidth(grp_colid);
@@ -1836,7 +1921,8 @@ CStatisticsUtils::AddWidthInfo(CMemoryPool *mp, UlongToDoubleMap *src_width,
 
 //	for the output statistics object, compute its upper bound cardinality
 // 	mapping based on the bounding method estimated output cardinality
-//  and information maintained in the current statistics object
+//  and information maintained in the current statistics object; the
+//  multi-column statistics of the sources are carried over as well
 void
 CStatisticsUtils::ComputeCardUpperBounds(
 	CMemoryPool *mp, const CStatistics *input_stats,
@@ -1873,6 +1959,17 @@ CStatisticsUtils::ComputeCardUpperBounds(
 			upper_bound_NDVs->CopyUpperBoundNDVs(mp, upper_bound_ndv_output);
 		output_stats->AddCardUpperBound(upper_bound_NDVs_copy);
 	}
+
+	// the multi-column statistics of the sources are bounded the same way:
+	// they are only used capped by the per-column estimates of the output,
+	// so they are shared as is
+	CExtendedStatsArray *input_ext_stats = input_stats->GetExtendedStats();
+	for (ULONG i = 0; i < input_ext_stats->Size(); i++)
+	{
+		CExtendedStats *ext_stats = (*input_ext_stats)[i];
+		ext_stats->AddRef();
+		output_stats->AddExtendedStats(ext_stats);
+	}
 }
 
 // EOF
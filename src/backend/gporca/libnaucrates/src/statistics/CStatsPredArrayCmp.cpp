@@ -26,7 +26,8 @@ CStatsPredArrayCmp::CStatsPredArrayCmp(ULONG colid,
 									   CPointArray *points)
 	: CStatsPred(colid), m_stats_cmp_type(stats_cmp_type), m_points(points)
 {
-	GPOS_ASSERT(CStatsPred::EstatscmptEq == m_stats_cmp_type);
+	GPOS_ASSERT(CStatsPred::EstatscmptEq == m_stats_cmp_type ||
+				CStatsPred::EstatscmptNEq == m_stats_cmp_type);
 }
 
 // EOF
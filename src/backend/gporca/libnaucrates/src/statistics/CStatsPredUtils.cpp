@@ -1096,20 +1096,23 @@ CStatsPredUtils::ProcessArrayCmp(CMemoryPool *mp, CExpression *predicate_expr,
 		(CScalarArrayCmp::EarrcmpAny == scalar_array_cmp_op->Earrcmpt());
 	BOOL is_array_cmp_eq = (stats_cmp_type == CStatsPred::EstatscmptEq);
 
+	// "a = ANY (ARRAY[...])" and "a <> ALL (ARRAY[...])" collect the points
+	// of the array into a CStatsPredArrayCmp, which is evaluated in a single
+	// pass over the histogram, however long the array is
+	BOOL is_array_cmp_points =
+		(is_array_cmp_any && is_array_cmp_eq) ||
+		(!is_array_cmp_any && stats_cmp_type == CStatsPred::EstatscmptNEq);
+	if (is_array_cmp_points)
+	{
+		points = GPOS_NEW(mp) CPointArray(mp);
+	}
+
 	if (is_array_cmp_any)
 	{
 		// in case of exprs of the form "a op ANY (ARRAY[...])", each element
 		// must be OR-d. So use a different array to collect the stats that
 		// will be later placed under a CStatsPredDisj.
 		pred_stats = GPOS_NEW(mp) CStatsPredPtrArry(mp);
-
-		// In case op is "=", ORCA supports a fast-path for deriving stats using
-		// CStatsPredArrayCmp. Collect "points" from the array list to create that.
-		// TODO: Support more cases in CStatsPredArrayCmp
-		if (is_array_cmp_eq)
-		{
-			points = GPOS_NEW(mp) CPointArray(mp);
-		}
 	}
 	else
 	{
@@ -1139,7 +1142,7 @@ CStatsPredUtils::ProcessArrayCmp(CMemoryPool *mp, CExpression *predicate_expr,
 					CStatsPredUnsupported(col_ref->Id(), stats_cmp_type);
 				pred_stats->Append(child_pred_stats);
 			}
-			else if (is_array_cmp_any && is_array_cmp_eq)
+			else if (is_array_cmp_points)
 			{
 				// fast-path using CStatsPredArrayCmp
 				GPOS_ASSERT(points != nullptr);
@@ -1158,16 +1161,21 @@ CStatsPredUtils::ProcessArrayCmp(CMemoryPool *mp, CExpression *predicate_expr,
 		child_expr->Release();
 	}
 
-	if (is_array_cmp_any)
+	if (is_array_cmp_points && !is_array_cmp_any && 0 == points->Size())
 	{
-		if (is_array_cmp_eq)
-		{
-			// "a = ANY (ARRAY[...])"
-			CStatsPredArrayCmp *pred_stats_array_cmp = GPOS_NEW(mp)
-				CStatsPredArrayCmp(col_ref->Id(), stats_cmp_type, points);
-			pred_stats->Append(pred_stats_array_cmp);
-		}
+		// "a <> ALL (ARRAY[])" filters nothing
+		points->Release();
+	}
+	else if (is_array_cmp_points)
+	{
+		// "a = ANY (ARRAY[...])" or "a <> ALL (ARRAY[...])"
+		CStatsPredArrayCmp *pred_stats_array_cmp = GPOS_NEW(mp)
+			CStatsPredArrayCmp(col_ref->Id(), stats_cmp_type, points);
+		pred_stats->Append(pred_stats_array_cmp);
+	}
 
+	if (is_array_cmp_any)
+	{
 		// "a op ANY (ARRAY[...])"
 		CStatsPredDisj *pred_stats_disj =
 			GPOS_NEW(mp) CStatsPredDisj(pred_stats);
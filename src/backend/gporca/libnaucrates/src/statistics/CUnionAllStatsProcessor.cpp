@@ -71,7 +71,7 @@ CUnionAllStatsProcessor::CreateStatsForUnionAll(
 						stats_second_child->Rows());
 				CStatisticsUtils::AddHistogram(
 					mp, output_colid, output_histogram, histograms_new);
-				GPOS_DELETE(output_histogram);
+				output_histogram->Release();
 			}
 			else
 			{
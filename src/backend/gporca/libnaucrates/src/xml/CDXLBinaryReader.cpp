@@ -0,0 +1,698 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryReader.cpp
+//
+//	@doc:
+//		Implementation of the streaming decoder of binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+
+#include <xercesc/util/XMLString.hpp>
+#include <xercesc/util/XMLUni.hpp>
+
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/clibwrapper.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/dxl/xml/CDXLMemoryManager.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/exception.h"
+
+using namespace gpdxl;
+
+// number of elements room is first made for in growing arrays
+#define GPDXL_BINARY_INITIAL_CAPACITY 64
+
+// grow the given array so that it has room for the given number of elements;
+// the capacity doubles until doubling it would overflow, and is then the
+// number of elements needed
+template <class T>
+static void
+Grow(CMemoryPool *mp, T **array, ULONG *capacity, ULONG size, ULONG needed)
+{
+	if (needed <= *capacity)
+	{
+		return;
+	}
+
+	ULONG new_capacity = *capacity;
+	if (GPDXL_BINARY_INITIAL_CAPACITY > new_capacity)
+	{
+		new_capacity = GPDXL_BINARY_INITIAL_CAPACITY;
+	}
+	while (new_capacity < needed)
+	{
+		if (gpos::ulong_max / 2 < new_capacity)
+		{
+			new_capacity = needed;
+			break;
+		}
+		new_capacity *= 2;
+	}
+
+	T *new_array = GPOS_NEW_ARRAY(mp, T, new_capacity);
+	if (0 < size)
+	{
+		clib::Memcpy(new_array, *array, size * GPOS_SIZEOF(T));
+	}
+	GPOS_DELETE_ARRAY(*array);
+
+	*array = new_array;
+	*capacity = new_capacity;
+}
+
+// ctor
+CDXLBinaryAttributes::CDXLBinaryAttributes(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_size(0),
+	  m_capacity(0),
+	  m_name_ids(nullptr),
+	  m_value_offsets(nullptr),
+	  m_names(nullptr),
+	  m_values(nullptr)
+{
+}
+
+// dtor
+CDXLBinaryAttributes::~CDXLBinaryAttributes()
+{
+	GPOS_DELETE_ARRAY(m_name_ids);
+	GPOS_DELETE_ARRAY(m_value_offsets);
+}
+
+// add an attribute whose value starts at the given offset
+void
+CDXLBinaryAttributes::Append(ULONG uri_id, ULONG local_name_id, ULONG qname_id,
+							 ULONG value_offset)
+{
+	if (m_size == m_capacity)
+	{
+		ULONG capacity = m_capacity;
+		Grow(m_mp, &m_value_offsets, &capacity, m_size, m_size + 1);
+
+		ULONG name_ids_capacity = 3 * m_capacity;
+		Grow(m_mp, &m_name_ids, &name_ids_capacity, 3 * m_size, 3 * capacity);
+		m_capacity = capacity;
+	}
+
+	m_name_ids[3 * m_size] = uri_id;
+	m_name_ids[3 * m_size + 1] = local_name_id;
+	m_name_ids[3 * m_size + 2] = qname_id;
+	m_value_offsets[m_size] = value_offset;
+	m_size++;
+}
+
+// namespace URI of an attribute
+const XMLCh *
+CDXLBinaryAttributes::getURI(const XMLSize_t index) const
+{
+	if (index >= m_size)
+	{
+		return nullptr;
+	}
+
+	return m_names[m_name_ids[3 * index]];
+}
+
+// local name of an attribute
+const XMLCh *
+CDXLBinaryAttributes::getLocalName(const XMLSize_t index) const
+{
+	if (index >= m_size)
+	{
+		return nullptr;
+	}
+
+	return m_names[m_name_ids[3 * index + 1]];
+}
+
+// qname of an attribute
+const XMLCh *
+CDXLBinaryAttributes::getQName(const XMLSize_t index) const
+{
+	if (index >= m_size)
+	{
+		return nullptr;
+	}
+
+	return m_names[m_name_ids[3 * index + 2]];
+}
+
+// type of an attribute
+const XMLCh *
+CDXLBinaryAttributes::getType(const XMLSize_t index) const
+{
+	if (index >= m_size)
+	{
+		return nullptr;
+	}
+
+	return XMLUni::fgCDATAString;
+}
+
+// value of an attribute
+const XMLCh *
+CDXLBinaryAttributes::getValue(const XMLSize_t index) const
+{
+	if (index >= m_size)
+	{
+		return nullptr;
+	}
+
+	return m_values + m_value_offsets[index];
+}
+
+// index of an attribute by namespace and local name
+bool
+CDXLBinaryAttributes::getIndex(const XMLCh *const uri,
+							   const XMLCh *const local_part,
+							   XMLSize_t &index) const
+{
+	for (ULONG ul = 0; ul < m_size; ul++)
+	{
+		if (XMLString::equals(local_part, getLocalName(ul)) &&
+			XMLString::equals(uri, getURI(ul)))
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// index of an attribute by namespace and local name, or -1
+int
+CDXLBinaryAttributes::getIndex(const XMLCh *const uri,
+							   const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return (int) index;
+	}
+
+	return -1;
+}
+
+// index of an attribute by qname
+bool
+CDXLBinaryAttributes::getIndex(const XMLCh *const qname,
+							   XMLSize_t &index) const
+{
+	for (ULONG ul = 0; ul < m_size; ul++)
+	{
+		if (XMLString::equals(qname, getQName(ul)))
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// index of an attribute by qname, or -1
+int
+CDXLBinaryAttributes::getIndex(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(qname, index))
+	{
+		return (int) index;
+	}
+
+	return -1;
+}
+
+// type of an attribute by namespace and local name
+const XMLCh *
+CDXLBinaryAttributes::getType(const XMLCh *const uri,
+							  const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return getType(index);
+	}
+
+	return nullptr;
+}
+
+// type of an attribute by qname
+const XMLCh *
+CDXLBinaryAttributes::getType(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(qname, index))
+	{
+		return getType(index);
+	}
+
+	return nullptr;
+}
+
+// value of an attribute by namespace and local name
+const XMLCh *
+CDXLBinaryAttributes::getValue(const XMLCh *const uri,
+							   const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return getValue(index);
+	}
+
+	return nullptr;
+}
+
+// value of an attribute by qname
+const XMLCh *
+CDXLBinaryAttributes::getValue(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(qname, index))
+	{
+		return getValue(index);
+	}
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CDXLBinaryReader
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::CDXLBinaryReader(CDXLMemoryManager *memory_manager,
+								   const CHAR *buffer)
+	: m_memory_manager(memory_manager),
+	  m_mp(memory_manager->Pmp()),
+	  m_buffer((const BYTE *) buffer),
+	  m_size(clib::Strlen(buffer)),
+	  m_pos(0),
+	  m_names(nullptr),
+	  m_num_names(0),
+	  m_names_capacity(0),
+	  m_wide_names(nullptr),
+	  m_open_elements(nullptr),
+	  m_num_open_elements(0),
+	  m_open_elements_capacity(0),
+	  m_values(nullptr),
+	  m_values_capacity(0),
+	  m_attrs(memory_manager->Pmp())
+{
+	GPOS_ASSERT(nullptr != buffer);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::~CDXLBinaryReader
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::~CDXLBinaryReader()
+{
+	for (ULONG ul = 0; ul < m_num_names; ul++)
+	{
+		GPOS_DELETE_ARRAY(m_names[ul]);
+		GPOS_DELETE(m_wide_names[ul]);
+	}
+	GPOS_DELETE_ARRAY(m_names);
+	GPOS_DELETE_ARRAY(m_wide_names);
+	GPOS_DELETE_ARRAY(m_open_elements);
+	GPOS_DELETE_ARRAY(m_values);
+}
+
+// raise an error for a malformed document
+void
+CDXLBinaryReader::RaiseMalformed() const
+{
+	GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLMalformedBinary, m_pos);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadNumber
+//
+//	@doc:
+//		Decode a varint written by CDXLBinaryWriter::WriteNumber; as no byte
+//		of a document is zero, the terminating null marks a truncated one
+//
+//---------------------------------------------------------------------------
+ULLONG
+CDXLBinaryReader::ReadNumber()
+{
+	ULLONG value = 0;
+	for (ULONG shift = 0; shift < 64; shift += 7)
+	{
+		const BYTE byte = m_buffer[m_pos];
+		if (0 == byte)
+		{
+			RaiseMalformed();
+		}
+		m_pos++;
+
+		value |= ((ULLONG)(byte & 0x7f)) << shift;
+		if (0 == (byte & 0x80))
+		{
+			return value - 1;
+		}
+	}
+
+	RaiseMalformed();
+	return 0;
+}
+
+// decode a name id
+ULONG
+CDXLBinaryReader::ReadNameId()
+{
+	const ULLONG id = ReadNumber();
+	if (id >= m_num_names)
+	{
+		RaiseMalformed();
+	}
+
+	return (ULONG) id;
+}
+
+// decode the length of a string; as each code unit takes at least one byte,
+// a length larger than the bytes left can only come from a malformed document,
+// and is rejected before any room is made for the string
+ULONG
+CDXLBinaryReader::ReadStringLength()
+{
+	const ULLONG length = ReadNumber();
+	if (m_size - m_pos < length)
+	{
+		RaiseMalformed();
+	}
+
+	return (ULONG) length;
+}
+
+// decode the given number of code units of a string, and null-terminate it
+void
+CDXLBinaryReader::ReadCodeUnits(XMLCh *str, ULONG length)
+{
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		const ULLONG code_unit = ReadNumber();
+		if (0 == code_unit || 0xffff < code_unit)
+		{
+			RaiseMalformed();
+		}
+		str[ul] = (XMLCh) code_unit;
+	}
+	str[length] = 0;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadString
+//
+//	@doc:
+//		Decode a string into the given buffer, at the given offset, growing
+//		the buffer as needed; return the offset past the string and its
+//		terminating null
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryReader::ReadString(XMLCh **buffer, ULONG *capacity, ULONG offset)
+{
+	const ULONG length = ReadStringLength();
+	if (gpos::ulong_max - offset <= length)
+	{
+		RaiseMalformed();
+	}
+
+	Grow(m_mp, buffer, capacity, offset, offset + length + 1);
+	ReadCodeUnits(*buffer + offset, length);
+
+	return offset + length + 1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadName
+//
+//	@doc:
+//		Decode the definition of a name, which takes the next id
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::ReadName(BOOL write_xml)
+{
+	if (m_num_names == m_names_capacity)
+	{
+		ULONG capacity = m_names_capacity;
+		Grow(m_mp, &m_names, &capacity, m_num_names, m_num_names + 1);
+
+		ULONG wide_names_capacity = m_names_capacity;
+		Grow(m_mp, &m_wide_names, &wide_names_capacity, m_num_names,
+			 capacity);
+		m_names_capacity = capacity;
+	}
+
+	const ULONG length = ReadStringLength();
+	CAutoRg<XMLCh> name;
+	name = GPOS_NEW_ARRAY(m_mp, XMLCh, length + 1);
+	ReadCodeUnits(name.Rgt(), length);
+
+	m_names[m_num_names] = name.RgtReset();
+	m_wide_names[m_num_names] = nullptr;
+	m_num_names++;
+
+	if (write_xml)
+	{
+		m_wide_names[m_num_names - 1] =
+			CDXLUtils::CreateDynamicStringFromXMLChArray(
+				m_memory_manager, m_names[m_num_names - 1]);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadStartElement
+//
+//	@doc:
+//		Decode the start of an element, push it on the open elements, and
+//		decode its attributes; namespace declarations are skipped unless
+//		asked for
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::ReadStartElement(BOOL include_namespace_decls)
+{
+	Grow(m_mp, &m_open_elements, &m_open_elements_capacity,
+		 3 * m_num_open_elements, 3 * m_num_open_elements + 3);
+
+	ULONG *element_name_ids = m_open_elements + 3 * m_num_open_elements;
+	element_name_ids[0] = ReadNameId();
+	element_name_ids[1] = ReadNameId();
+	element_name_ids[2] = ReadNameId();
+	m_num_open_elements++;
+
+	const ULLONG num_attrs = ReadNumber();
+
+	m_attrs.Clear();
+	ULONG values_size = 0;
+	for (ULLONG ull = 0; ull < num_attrs; ull++)
+	{
+		const ULONG uri_id = ReadNameId();
+		const ULONG local_name_id = ReadNameId();
+		const ULONG qname_id = ReadNameId();
+		const ULONG value_offset = values_size;
+		values_size = ReadString(&m_values, &m_values_capacity, values_size);
+
+		if (include_namespace_decls ||
+			!XMLString::equals(XMLUni::fgXMLNSURIName, m_names[uri_id]))
+		{
+			m_attrs.Append(uri_id, local_name_id, qname_id, value_offset);
+		}
+	}
+
+	// values are only in place once the buffer stops growing
+	m_attrs.SetNamesAndValues(m_names, m_values);
+}
+
+// check the magic bytes and the format version
+void
+CDXLBinaryReader::ReadHeader()
+{
+	if (!IsBinary((const CHAR *) m_buffer))
+	{
+		RaiseMalformed();
+	}
+	m_pos = GPOS_ARRAY_SIZE(GPDXL_BINARY_MAGIC) - 1;
+
+	if (GPDXL_BINARY_VERSION != ReadNumber())
+	{
+		RaiseMalformed();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Read
+//
+//	@doc:
+//		Decode the document, writing it to the serializer if one is given,
+//		and passing each element to the active parse handler otherwise
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Read(CParseHandlerManager *parse_handler_mgr,
+					   CXMLSerializer *xml_serializer)
+{
+	GPOS_ASSERT((nullptr == parse_handler_mgr) != (nullptr == xml_serializer));
+
+	const BOOL write_xml = (nullptr != xml_serializer);
+
+	ReadHeader();
+
+	if (write_xml)
+	{
+		xml_serializer->StartDocument();
+	}
+	else
+	{
+		parse_handler_mgr->GetCurrentParseHandler()->startDocument();
+	}
+
+	BOOL is_done = false;
+	while (!is_done)
+	{
+		switch (ReadNumber())
+		{
+			case EdxlbrName:
+			{
+				ReadName(write_xml);
+				break;
+			}
+
+			case EdxlbrStartElement:
+			{
+				ReadStartElement(write_xml /*include_namespace_decls*/);
+				const ULONG *name_ids =
+					m_open_elements + 3 * (m_num_open_elements - 1);
+
+				if (write_xml)
+				{
+					xml_serializer->OpenElement(nullptr /*pstrNamespace*/,
+												m_wide_names[name_ids[2]]);
+					for (ULONG ul = 0; ul < m_attrs.getLength(); ul++)
+					{
+						CWStringDynamic *value =
+							CDXLUtils::CreateDynamicStringFromXMLChArray(
+								m_memory_manager, m_attrs.getValue(ul));
+						xml_serializer->AddAttribute(
+							m_wide_names[m_attrs.GetQNameId(ul)], value);
+						GPOS_DELETE(value);
+					}
+					break;
+				}
+
+				CParseHandlerBase *parse_handler =
+					parse_handler_mgr->GetCurrentParseHandler();
+				if (nullptr == parse_handler)
+				{
+					RaiseMalformed();
+				}
+				parse_handler->startElement(m_names[name_ids[0]],
+											m_names[name_ids[1]],
+											m_names[name_ids[2]], m_attrs);
+				break;
+			}
+
+			case EdxlbrEndElement:
+			{
+				if (0 == m_num_open_elements)
+				{
+					RaiseMalformed();
+				}
+				m_num_open_elements--;
+				const ULONG *name_ids =
+					m_open_elements + 3 * m_num_open_elements;
+
+				if (write_xml)
+				{
+					xml_serializer->CloseElement(nullptr /*pstrNamespace*/,
+												 m_wide_names[name_ids[2]]);
+					break;
+				}
+
+				CParseHandlerBase *parse_handler =
+					parse_handler_mgr->GetCurrentParseHandler();
+				if (nullptr == parse_handler)
+				{
+					RaiseMalformed();
+				}
+				parse_handler->endElement(m_names[name_ids[0]],
+										  m_names[name_ids[1]],
+										  m_names[name_ids[2]]);
+				break;
+			}
+
+			case EdxlbrEnd:
+			{
+				if (0 != m_num_open_elements)
+				{
+					RaiseMalformed();
+				}
+				is_done = true;
+				break;
+			}
+
+			default:
+				RaiseMalformed();
+		}
+	}
+
+	if (!write_xml && nullptr != parse_handler_mgr->GetCurrentParseHandler())
+	{
+		parse_handler_mgr->GetCurrentParseHandler()->endDocument();
+	}
+}
+
+// pass the elements of the document to the active parse handler
+void
+CDXLBinaryReader::Parse(CParseHandlerManager *parse_handler_mgr)
+{
+	GPOS_ASSERT(nullptr != parse_handler_mgr);
+	GPOS_ASSERT(nullptr != parse_handler_mgr->GetCurrentParseHandler());
+
+	Read(parse_handler_mgr, nullptr /*xml_serializer*/);
+}
+
+// write the document as XML
+void
+CDXLBinaryReader::Serialize(CXMLSerializer *xml_serializer)
+{
+	GPOS_ASSERT(nullptr != xml_serializer);
+
+	Read(nullptr /*parse_handler_mgr*/, xml_serializer);
+}
+
+// does the given buffer start with the magic bytes of binary DXL
+BOOL
+CDXLBinaryReader::IsBinary(const CHAR *buffer)
+{
+	GPOS_ASSERT(nullptr != buffer);
+
+	const ULONG magic_size = GPOS_ARRAY_SIZE(GPDXL_BINARY_MAGIC) - 1;
+	return 0 == clib::Strncmp(buffer, GPDXL_BINARY_MAGIC, magic_size);
+}
+
+// EOF
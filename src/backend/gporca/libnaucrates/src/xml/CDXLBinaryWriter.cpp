@@ -0,0 +1,270 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryWriter.cpp
+//
+//	@doc:
+//		Implementation of the encoder of binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+#include "gpos/common/clibwrapper.h"
+
+using namespace gpdxl;
+
+// initial size of the buffer of the document
+#define GPDXL_BINARY_INITIAL_SIZE 4096
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::CDXLBinaryWriter
+//
+//	@doc:
+//		Ctor; writes the magic bytes and the format version
+//
+//---------------------------------------------------------------------------
+CDXLBinaryWriter::CDXLBinaryWriter(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_buffer(nullptr),
+	  m_size(0),
+	  m_capacity(0),
+	  m_name_to_id_map(GPOS_NEW(mp) NameToIdMap(mp))
+{
+	const ULONG magic_size = GPOS_ARRAY_SIZE(GPDXL_BINARY_MAGIC) - 1;
+
+	Reserve(magic_size);
+	clib::Memcpy(m_buffer, GPDXL_BINARY_MAGIC, magic_size);
+	m_size = magic_size;
+
+	WriteNumber(GPDXL_BINARY_VERSION);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::~CDXLBinaryWriter
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryWriter::~CDXLBinaryWriter()
+{
+	GPOS_DELETE_ARRAY(m_buffer);
+	m_name_to_id_map->Release();
+}
+
+// hash of a name
+ULONG
+CDXLBinaryWriter::HashName(const XMLCh *name)
+{
+	return HashByteArray((const BYTE *) name,
+						 XMLString::stringLen(name) * GPOS_SIZEOF(XMLCh));
+}
+
+// equality of names
+BOOL
+CDXLBinaryWriter::EqualNames(const XMLCh *name, const XMLCh *other_name)
+{
+	return XMLString::equals(name, other_name);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::Reserve
+//
+//	@doc:
+//		Make room for the given number of bytes, and a terminating null
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::Reserve(ULONG size)
+{
+	if (m_size + size < m_capacity)
+	{
+		return;
+	}
+
+	ULONG capacity = m_capacity;
+	if (GPDXL_BINARY_INITIAL_SIZE > capacity)
+	{
+		capacity = GPDXL_BINARY_INITIAL_SIZE;
+	}
+	while (capacity <= m_size + size)
+	{
+		capacity *= 2;
+	}
+
+	BYTE *buffer = GPOS_NEW_ARRAY(m_mp, BYTE, capacity);
+	if (0 < m_size)
+	{
+		clib::Memcpy(buffer, m_buffer, m_size);
+	}
+	GPOS_DELETE_ARRAY(m_buffer);
+
+	m_buffer = buffer;
+	m_capacity = capacity;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::WriteNumber
+//
+//	@doc:
+//		Write the number plus one as a varint, seven bits per byte with the
+//		high bit set on all bytes but the last; as the number written is
+//		positive, none of the bytes is zero
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::WriteNumber(ULLONG value)
+{
+	GPOS_ASSERT(gpos::ullong_max != value);
+
+	// a varint of a 64-bit number takes up to 10 bytes
+	Reserve(10);
+
+	ULLONG remaining = value + 1;
+	while (0x80 <= remaining)
+	{
+		m_buffer[m_size++] = (BYTE)(0x80 | (remaining & 0x7f));
+		remaining >>= 7;
+	}
+	m_buffer[m_size++] = (BYTE) remaining;
+}
+
+// write a string as its length followed by its code units
+void
+CDXLBinaryWriter::WriteString(const XMLCh *str)
+{
+	const XMLSize_t length = XMLString::stringLen(str);
+
+	WriteNumber(length);
+	for (XMLSize_t ul = 0; ul < length; ul++)
+	{
+		WriteNumber(str[ul]);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::GetNameId
+//
+//	@doc:
+//		Id of the given name; a name seen for the first time is given the
+//		next id, and a record defining it is written
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryWriter::GetNameId(const XMLCh *name)
+{
+	const ULONG *id = m_name_to_id_map->Find(name);
+	if (nullptr != id)
+	{
+		return *id;
+	}
+
+	const ULONG new_id = m_name_to_id_map->Size();
+	const XMLSize_t length = XMLString::stringLen(name);
+	XMLCh *name_copy = GPOS_NEW_ARRAY(m_mp, XMLCh, length + 1);
+	clib::Memcpy(name_copy, name, (length + 1) * GPOS_SIZEOF(XMLCh));
+
+	BOOL fInserted GPOS_ASSERTS_ONLY = m_name_to_id_map->Insert(
+		name_copy, GPOS_NEW(m_mp) ULONG(new_id));
+	GPOS_ASSERT(fInserted);
+
+	WriteNumber(EdxlbrName);
+	WriteString(name);
+
+	return new_id;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::startElement
+//
+//	@doc:
+//		Record the start of an element and its attributes
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::startElement(const XMLCh *const element_uri,
+							   const XMLCh *const element_local_name,
+							   const XMLCh *const element_qname,
+							   const Attributes &attrs)
+{
+	const XMLSize_t num_attrs = attrs.getLength();
+
+	// define the new names before the record that refers to them
+	(void) GetNameId(element_uri);
+	(void) GetNameId(element_local_name);
+	(void) GetNameId(element_qname);
+	for (XMLSize_t ul = 0; ul < num_attrs; ul++)
+	{
+		(void) GetNameId(attrs.getURI(ul));
+		(void) GetNameId(attrs.getLocalName(ul));
+		(void) GetNameId(attrs.getQName(ul));
+	}
+
+	WriteNumber(EdxlbrStartElement);
+	WriteNumber(GetNameId(element_uri));
+	WriteNumber(GetNameId(element_local_name));
+	WriteNumber(GetNameId(element_qname));
+	WriteNumber(num_attrs);
+	for (XMLSize_t ul = 0; ul < num_attrs; ul++)
+	{
+		WriteNumber(GetNameId(attrs.getURI(ul)));
+		WriteNumber(GetNameId(attrs.getLocalName(ul)));
+		WriteNumber(GetNameId(attrs.getQName(ul)));
+		WriteString(attrs.getValue(ul));
+	}
+}
+
+// record the end of an element
+void
+CDXLBinaryWriter::endElement(const XMLCh *const,  // element_uri
+							 const XMLCh *const,  // element_local_name
+							 const XMLCh *const	  // element_qname
+)
+{
+	WriteNumber(EdxlbrEndElement);
+}
+
+// record the end of the document
+void
+CDXLBinaryWriter::endDocument()
+{
+	WriteNumber(EdxlbrEnd);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::DetachBuffer
+//
+//	@doc:
+//		Return the encoded document, null-terminated, and its size excluding
+//		the terminating null; the caller owns the returned buffer
+//
+//---------------------------------------------------------------------------
+CHAR *
+CDXLBinaryWriter::DetachBuffer(ULONG *size)
+{
+	GPOS_ASSERT(nullptr != size);
+
+	Reserve(1);
+	m_buffer[m_size] = '\0';
+	*size = m_size;
+
+	CHAR *buffer = (CHAR *) m_buffer;
+	m_buffer = nullptr;
+	m_size = 0;
+	m_capacity = 0;
+
+	return buffer;
+}
+
+// EOF
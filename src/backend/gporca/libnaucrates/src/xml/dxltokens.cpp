@@ -493,6 +493,13 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenRelationStats, GPOS_WSZ_LIT("RelationStatistics")},
 		{EdxltokenColumnStats, GPOS_WSZ_LIT("ColumnStatistics")},
 		{EdxltokenColumnStatsBucket, GPOS_WSZ_LIT("StatsBucket")},
+		{EdxltokenExtStats, GPOS_WSZ_LIT("ExtendedStatistics")},
+		{EdxltokenMVNDistinct, GPOS_WSZ_LIT("MVNDistinct")},
+		{EdxltokenMVDependency, GPOS_WSZ_LIT("MVDependency")},
+		{EdxltokenMVDependencyDegree, GPOS_WSZ_LIT("Degree")},
+		{EdxltokenMVMCVList, GPOS_WSZ_LIT("MVMCVList")},
+		{EdxltokenMVMCVItem, GPOS_WSZ_LIT("MVMCVItem")},
+		{EdxltokenMVMCVBaseFrequency, GPOS_WSZ_LIT("BaseFrequency")},
 		{EdxltokenEmptyRelation, GPOS_WSZ_LIT("EmptyRelation")},
 
 		{EdxltokenIsNull, GPOS_WSZ_LIT("IsNull")},
@@ -577,6 +584,10 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenCheckConstraint, GPOS_WSZ_LIT("CheckConstraint")},
 
 		{EdxltokenPartConstraint, GPOS_WSZ_LIT("PartConstraint")},
+		{EdxltokenPartBounds, GPOS_WSZ_LIT("PartBounds")},
+		{EdxltokenPartBound, GPOS_WSZ_LIT("PartBound")},
+		{EdxltokenPartRangeBounds, GPOS_WSZ_LIT("PartRangeBounds")},
+		{EdxltokenPartRangeBound, GPOS_WSZ_LIT("PartRangeBound")},
 		{EdxltokenDefaultPartition, GPOS_WSZ_LIT("DefaultPartition")},
 		{EdxltokenPartConstraintUnbounded, GPOS_WSZ_LIT("Unbounded")},
 
@@ -0,0 +1,754 @@
+#!/usr/bin/env python3
+
+# Optimizer cost model calibration for the GPDB cost model (CCostModelParamsGPDB)
+#
+# This program runs a suite of synthetic micro-queries, each exercising a
+# few operators of the cost model (scans, filters, motions, joins,
+# aggregates, sorts), and fits the unit costs of those operators to the
+# measured execution times.
+#
+# For every query, the program:
+#
+# - explains the query with the current cost model parameters
+# - explains it again with each calibrated parameter perturbed in turn,
+#   through the optimizer_cost_model_params GUC, which tells how much of
+#   the estimated cost each parameter accounts for
+# - runs the query with EXPLAIN ANALYZE, one or more times, and records
+#   the execution time
+#
+# The parameters are then fitted by a regularized, non-negative least
+# squares regression of the estimated costs against the measured times,
+# and written out as a value of the optimizer_cost_model_params GUC,
+# which COptTasks::SetCostModelParams applies to the cost model.
+#
+# Finally, the queries are explained with the calibrated parameters, and
+# a validation report compares the ordering of the estimated costs with
+# that of the measured times, with the default and with the calibrated
+# parameters, over all the queries and among the alternative plans of
+# each query.
+#
+# Run this program with the -h or --help option to see argument syntax
+#
+# See comment "How to add a query" below in the program for how to
+# extend the suite.
+
+import argparse
+import math
+import re
+import sys
+import time
+
+try:
+    from gppylib.db import dbconn
+except ImportError as e:
+    sys.exit('ERROR: Cannot import modules.  Please check that you have sourced greenplum_path.sh.  Detail: ' + str(e))
+
+# constants
+# -----------------------------------------------------------------------------
+
+_help = """
+Calibrate the parameters of the optimizer cost model on this cluster. Optionally create the tables before running,
+and drop them afterwards. This explains and runs a suite of micro-queries, fits the cost model parameters to the
+measured execution times, and reports how well the estimated costs order the queries before and after calibration.
+"""
+
+COST_PATTERN = r"\(cost=[0-9.]+\.\.([0-9.]+) rows="
+EXECUTION_TIME_PATTERN = r"Execution [Tt]ime: ([0-9.]+) ms"
+FALLBACK_PATTERN = "Postgres query optimizer"
+
+# parameters calibrated by default; these are unit costs that the cost of
+# the operators they apply to grows linearly with
+DEFAULT_CALIBRATED_PARAMS = [
+    "TableScanCostUnit",
+    "IndexBlockCostUnit",
+    "IndexFilterCostUnit",
+    "IndexScanTupCostUnit",
+    "FilterColCostUnit",
+    "OutputTupCostUnit",
+    "GatherSendCostUnit",
+    "GatherRecvCostUnit",
+    "RedistributeSendCostUnit",
+    "RedistributeRecvCostUnit",
+    "BroadcastSendCostUnit",
+    "BroadcastRecvCostUnit",
+    "JoinFeedingTupColumnCostUnit",
+    "JoinFeedingTupWidthCostUnit",
+    "JoinOutputTupCostUnit",
+    "HJHashTableColumnCostUnit",
+    "HJHashTableWidthCostUnit",
+    "HJHashingTupWidthCostUnit",
+    "HashAggInputTupColumnCostUnit",
+    "HashAggInputTupWidthCostUnit",
+    "HashAggOutputTupWidthCostUnit",
+    "SortTupWidthCostUnit",
+    "TupDefaultProcCostUnit",
+    "BitmapPageCostLargerNDV",
+    "BitmapPageCostSmallerNDV",
+]
+
+# factor by which a parameter is multiplied to measure its share of a cost
+PERTURBATION_FACTOR = 1.5
+
+# cost differences below this are treated as rounding noise of the explain output
+COST_EPSILON = 0.05
+
+# global variables
+# -----------------------------------------------------------------------------
+
+glob_log_file = None
+glob_verbose = False
+glob_exe_timeout = 60000
+glob_dim_table_rows = 10000
+
+# SQL statements, DDL and DML
+# -----------------------------------------------------------------------------
+
+_drop_tables = """
+DROP TABLE IF EXISTS cal_cm_fact, cal_cm_dim;
+"""
+
+# the fact table. Parameters:
+# - WITH clause (optional), for append-only tables
+_create_fact_table = """
+CREATE TABLE cal_cm_fact(id int,
+                         k10 int,
+                         k1000 int,
+                         k100000 int,
+                         narrow int,
+                         wide text)
+%s
+DISTRIBUTED BY (id);
+"""
+
+_create_dim_table = """
+CREATE TABLE cal_cm_dim(id int,
+                        k int,
+                        txt text)
+DISTRIBUTED BY (id);
+"""
+
+_with_appendonly = """
+WITH (appendonly=true)
+"""
+
+# insert into the fact table. Parameters:
+# - integer stop value
+_insert_into_fact_table = """
+INSERT INTO cal_cm_fact
+SELECT x,
+       x%%10 + 1,
+       x%%1000 + 1,
+       x%%100000 + 1,
+       (x * 7919)%%1000003,
+       repeat('w', 200)
+FROM generate_series(1,%d) T(x)
+ORDER BY random();
+"""
+
+# insert into the dimension table. Parameters:
+# - integer stop value
+_insert_into_dim_table = """
+INSERT INTO cal_cm_dim SELECT x, x%%100 + 1, repeat('d', 100) FROM generate_series(1,%d) T(x);
+"""
+
+_create_indexes = ["""
+CREATE INDEX cal_cm_fact_i_btree_100000 ON cal_cm_fact USING btree(k100000);
+""",
+                   """
+CREATE INDEX cal_cm_fact_i_bitmap_1000 ON cal_cm_fact USING bitmap(k1000);
+"""]
+
+_analyze_tables = """
+ANALYZE cal_cm_fact;
+ANALYZE cal_cm_dim;
+"""
+
+# settings that force plan alternatives; every query resets them first
+_reset_forces = [
+    "RESET optimizer_enable_tablescan;",
+    "RESET optimizer_enable_indexscan;",
+    "RESET optimizer_enable_bitmapscan;",
+    "RESET optimizer_enable_hashjoin;",
+    "RESET optimizer_enable_indexjoin;",
+    "RESET optimizer_enable_hashagg;",
+    "RESET optimizer_enable_groupagg;",
+    "RESET optimizer_enable_motion_broadcast;",
+    "RESET optimizer_enable_motion_redistribute;",
+]
+
+_force_table_scan = ["SET optimizer_enable_indexscan TO off;",
+                     "SET optimizer_enable_bitmapscan TO off;"]
+
+_force_index_scan = ["SET optimizer_enable_tablescan TO off;",
+                     "SET optimizer_enable_bitmapscan TO off;"]
+
+_force_bitmap_scan = ["SET optimizer_enable_tablescan TO off;",
+                      "SET optimizer_enable_indexscan TO off;"]
+
+_force_hash_join = ["SET optimizer_enable_indexjoin TO off;"]
+
+_force_index_nlj = ["SET optimizer_enable_hashjoin TO off;"]
+
+_force_broadcast = ["SET optimizer_enable_motion_redistribute TO off;"]
+
+_force_redistribute = ["SET optimizer_enable_motion_broadcast TO off;"]
+
+_force_hash_agg = ["SET optimizer_enable_groupagg TO off;"]
+
+_force_group_agg = ["SET optimizer_enable_hashagg TO off;"]
+
+# How to add a query:
+#
+# Add a tuple to _queries, in the format
+# (query name, group name, SQL text, list of statements forcing the plan)
+#
+# Queries of the same group compute the same result with alternative plans;
+# the validation report checks that the cheapest of them is the fastest.
+# Use a group of its own for a query without alternatives. Vary the size of
+# the inputs of an operator across queries, so that the regression can tell
+# its per-tuple cost from the fixed costs.
+
+_queries = [
+    # scans and filters
+    ("scan_narrow", "scan_narrow",
+     "SELECT count(narrow) FROM cal_cm_fact", []),
+    ("scan_wide", "scan_wide",
+     "SELECT count(wide) FROM cal_cm_fact", []),
+    ("filter_1col", "filter_1col",
+     "SELECT count(*) FROM cal_cm_fact WHERE narrow % 7 = 1", []),
+    ("filter_3col", "filter_3col",
+     "SELECT count(*) FROM cal_cm_fact WHERE narrow % 7 = 1 AND k10 < 5 AND k1000 > 10", []),
+    # selective predicates, with alternative access paths
+    ("range_50_table_scan", "range_50",
+     "SELECT count(wide) FROM cal_cm_fact WHERE k100000 BETWEEN 1 AND 50", _force_table_scan),
+    ("range_50_index_scan", "range_50",
+     "SELECT count(wide) FROM cal_cm_fact WHERE k100000 BETWEEN 1 AND 50", _force_index_scan),
+    ("range_5000_table_scan", "range_5000",
+     "SELECT count(wide) FROM cal_cm_fact WHERE k100000 BETWEEN 1 AND 5000", _force_table_scan),
+    ("range_5000_index_scan", "range_5000",
+     "SELECT count(wide) FROM cal_cm_fact WHERE k100000 BETWEEN 1 AND 5000", _force_index_scan),
+    ("eq_1000_table_scan", "eq_1000",
+     "SELECT count(wide) FROM cal_cm_fact WHERE k1000 = 5", _force_table_scan),
+    ("eq_1000_bitmap_scan", "eq_1000",
+     "SELECT count(wide) FROM cal_cm_fact WHERE k1000 = 5", _force_bitmap_scan),
+    ("in_1000_table_scan", "in_1000",
+     "SELECT count(wide) FROM cal_cm_fact WHERE k1000 IN (5, 50, 500)", _force_table_scan),
+    ("in_1000_bitmap_scan", "in_1000",
+     "SELECT count(wide) FROM cal_cm_fact WHERE k1000 IN (5, 50, 500)", _force_bitmap_scan),
+    # gather motions of a growing number of narrow and wide rows
+    ("gather_narrow_10pct", "gather_narrow_10pct",
+     "SELECT id, narrow FROM cal_cm_fact WHERE k10 = 1", []),
+    ("gather_narrow_50pct", "gather_narrow_50pct",
+     "SELECT id, narrow FROM cal_cm_fact WHERE k10 <= 5", []),
+    ("gather_wide_10pct", "gather_wide_10pct",
+     "SELECT id, wide FROM cal_cm_fact WHERE k10 = 1", []),
+    # joins, with redistribute and broadcast motions
+    ("join_fact_fact", "join_fact_fact",
+     "SELECT count(*) FROM cal_cm_fact f1 JOIN cal_cm_fact f2 ON f1.k100000 = f2.id", []),
+    ("join_dim_broadcast", "join_dim",
+     "SELECT count(*) FROM cal_cm_fact f JOIN cal_cm_dim d ON f.k1000 = d.k", _force_broadcast),
+    ("join_dim_redistribute", "join_dim",
+     "SELECT count(*) FROM cal_cm_fact f JOIN cal_cm_dim d ON f.k1000 = d.k", _force_redistribute),
+    ("join_wide_build", "join_wide_build",
+     "SELECT count(*) FROM cal_cm_fact f1 JOIN (SELECT id, wide FROM cal_cm_fact WHERE k10 = 1) f2 "
+     "ON f1.k100000 = f2.id AND f1.wide = f2.wide", []),
+    # nested loop index joins against hash joins, for growing outer sides
+    ("nlj_10_hash_join", "nlj_10",
+     "SELECT count(*) FROM cal_cm_dim d JOIN cal_cm_fact f ON f.k100000 = d.id WHERE d.id <= 10", _force_hash_join),
+    ("nlj_10_index_join", "nlj_10",
+     "SELECT count(*) FROM cal_cm_dim d JOIN cal_cm_fact f ON f.k100000 = d.id WHERE d.id <= 10", _force_index_nlj),
+    ("nlj_1000_hash_join", "nlj_1000",
+     "SELECT count(*) FROM cal_cm_dim d JOIN cal_cm_fact f ON f.k100000 = d.id WHERE d.id <= 1000", _force_hash_join),
+    ("nlj_1000_index_join", "nlj_1000",
+     "SELECT count(*) FROM cal_cm_dim d JOIN cal_cm_fact f ON f.k100000 = d.id WHERE d.id <= 1000", _force_index_nlj),
+    # aggregates
+    ("agg_1000_hash_agg", "agg_1000",
+     "SELECT count(*) FROM (SELECT k1000, count(*) FROM cal_cm_fact GROUP BY k1000) t", _force_hash_agg),
+    ("agg_1000_group_agg", "agg_1000",
+     "SELECT count(*) FROM (SELECT k1000, count(*) FROM cal_cm_fact GROUP BY k1000) t", _force_group_agg),
+    ("agg_100000_hash_agg", "agg_100000",
+     "SELECT count(*) FROM (SELECT k100000, count(*) FROM cal_cm_fact GROUP BY k100000) t", _force_hash_agg),
+    ("agg_100000_group_agg", "agg_100000",
+     "SELECT count(*) FROM (SELECT k100000, count(*) FROM cal_cm_fact GROUP BY k100000) t", _force_group_agg),
+    # sorts of narrow and wide rows
+    ("sort_narrow", "sort_narrow",
+     "SELECT count(*) FROM (SELECT row_number() OVER (ORDER BY narrow) FROM cal_cm_fact) t", []),
+    ("sort_wide", "sort_wide",
+     "SELECT count(*) FROM (SELECT row_number() OVER (ORDER BY wide, narrow) FROM cal_cm_fact) t", []),
+]
+
+
+# -----------------------------------------------------------------------------
+
+def parseargs():
+    parser = argparse.ArgumentParser(description=_help)
+
+    parser.add_argument("--create", action="store_true",
+                        help="Create the tables to use in the calibration")
+    parser.add_argument("--execute", type=int, default="3",
+                        help="Number of times to execute each query (default is 3)")
+    parser.add_argument("--drop", action="store_true",
+                        help="Drop the tables used in the calibration when finished")
+    parser.add_argument("--params", default=",".join(DEFAULT_CALIBRATED_PARAMS),
+                        help="Comma-separated names of the cost model parameters to calibrate")
+    parser.add_argument("--ridge", type=float, default="0.1",
+                        help="Weight that pulls the parameters towards their current values, so that parameters "
+                             "the suite does not exercise keep them (default is 0.1)")
+    parser.add_argument("--maxRatio", type=float, default="100.0",
+                        help="Maximum ratio between a calibrated parameter and its current value (default is 100)")
+    parser.add_argument("--output", default="",
+                        help="Write the calibrated parameters to this file, in postgresql.conf format")
+    parser.add_argument("--verbose", action="store_true",
+                        help="Print more verbose output")
+    parser.add_argument("--logFile", default="",
+                        help="Log diagnostic output to a file")
+    parser.add_argument("--host", default="",
+                        help="Host to connect to (default is localhost or $PGHOST, if set).")
+    parser.add_argument("--port", type=int, default="0",
+                        help="Port on the host to connect to (default is 0 or $PGPORT, if set)")
+    parser.add_argument("--dbName", default="",
+                        help="Database name to connect to")
+    parser.add_argument("--appendOnly", action="store_true",
+                        help="Create an append-only fact table. Default is a heap table")
+    parser.add_argument("--numRows", type=int, default="10000000",
+                        help="Number of rows to INSERT INTO the fact table (default is 10 million)")
+
+    # Parse the command line arguments
+    args = parser.parse_args()
+    return args, parser
+
+
+def log_output(str):
+    if glob_verbose:
+        print(str)
+    if glob_log_file != None:
+        glob_log_file.write(str + "\n")
+
+
+# SQL related methods
+# -----------------------------------------------------------------------------
+
+def connect(host, port_num, db_name):
+    try:
+        dburl = dbconn.DbURL(hostname=host, port=port_num, dbname=db_name)
+        conn = dbconn.connect(dburl, encoding="UTF8", unsetSearchPath=False)
+
+    except Exception as e:
+        print(("Exception during connect: %s" % e))
+        quit()
+
+    return conn
+
+
+def execute_sql(conn, sqlStr):
+    try:
+        log_output("")
+        log_output("Executing query: %s" % sqlStr)
+        dbconn.execSQL(conn, sqlStr)
+    except Exception as e:
+        print("")
+        print(("Error executing query: %s; Reason: %s" % (sqlStr, e)))
+        dbconn.execSQL(conn, "abort")
+
+
+def execute_sql_arr(conn, sqlStrArr):
+    for sqlStr in sqlStrArr:
+        execute_sql(conn, sqlStr)
+
+
+def commit_db(conn):
+    execute_sql(conn, "commit")
+
+
+def query_lines(conn, sqlStr):
+    log_output("")
+    log_output("Executing query: %s" % sqlStr)
+    curs = dbconn.query(conn, sqlStr)
+    rows = curs.fetchall()
+    lines = [row[0] for row in rows]
+    for line in lines:
+        log_output(line)
+    return lines
+
+
+def set_cost_model_params(conn, params):
+    # params is a dictionary of parameter names and values
+    value = format_cost_model_params(params)
+    if value == "":
+        execute_sql(conn, "RESET optimizer_cost_model_params;")
+    else:
+        execute_sql(conn, "SET optimizer_cost_model_params TO '%s';" % value)
+
+
+def format_cost_model_params(params):
+    return ",".join("%s=%.6g" % (name, params[name]) for name in sorted(params))
+
+
+def create_db(conn, appendOnly, numRows):
+    execute_sql(conn, _drop_tables)
+    execute_sql(conn, _create_fact_table % (_with_appendonly if appendOnly else ""))
+    execute_sql(conn, _create_dim_table)
+    commit_db(conn)
+    execute_sql(conn, _insert_into_fact_table % numRows)
+    execute_sql(conn, _insert_into_dim_table % glob_dim_table_rows)
+    commit_db(conn)
+    execute_sql_arr(conn, _create_indexes)
+    commit_db(conn)
+    execute_sql(conn, _analyze_tables)
+    commit_db(conn)
+
+
+def drop_db(conn):
+    execute_sql(conn, _drop_tables)
+    commit_db(conn)
+
+
+# explain output parsing
+# -----------------------------------------------------------------------------
+
+# extract the total cost of the plan, its shape, and the execution time from
+# an explain output; the cost of the plan is that of its first node
+
+def parse_explain(lines):
+    cost = -1.0
+    shape = []
+    exec_time = -1.0
+    fallback = False
+    for line in lines:
+        m = re.search(COST_PATTERN, line)
+        if m:
+            if cost < 0.0:
+                cost = float(m.group(1))
+            # the shape of the plan is its node names, without the details
+            # of the nodes
+            shape.append(re.sub(r"\s*\(.*", "", line.strip().lstrip("->").strip()))
+        m = re.search(EXECUTION_TIME_PATTERN, line)
+        if m:
+            exec_time = float(m.group(1))
+        if re.search(FALLBACK_PATTERN, line):
+            fallback = True
+    return cost, tuple(shape), exec_time, fallback
+
+
+def explain_query(conn, query, params):
+    (name, group, sqlStr, forces) = query
+    execute_sql_arr(conn, _reset_forces)
+    execute_sql_arr(conn, forces)
+    set_cost_model_params(conn, params)
+    try:
+        return parse_explain(query_lines(conn, "EXPLAIN " + sqlStr))
+    except Exception as e:
+        log_output("\n*** ERROR explaining query:\n%s;\nReason: %s" % ("EXPLAIN " + sqlStr, e))
+        dbconn.execSQL(conn, "abort")
+        return -1.0, (), -1.0, True
+
+
+# run a query n times with EXPLAIN ANALYZE, unless it takes longer than a
+# timeout, and return the mean and the standard deviation of its execution time
+
+def timed_execute_n_times(conn, query, exec_n_times):
+    (name, group, sqlStr, forces) = query
+    execute_sql_arr(conn, _reset_forces)
+    execute_sql_arr(conn, forces)
+    set_cost_model_params(conn, {})
+    exec_times = []
+    for e in range(exec_n_times):
+        try:
+            (cost, shape, exec_time, fallback) = parse_explain(query_lines(conn, "EXPLAIN ANALYZE " + sqlStr))
+        except Exception as ex:
+            log_output("\n*** ERROR executing query:\n%s;\nReason: %s" % ("EXPLAIN ANALYZE " + sqlStr, ex))
+            dbconn.execSQL(conn, "abort")
+            break
+        if exec_time < 0.0:
+            break
+        exec_times.append(exec_time)
+        if exec_time > glob_exe_timeout:
+            # we exceeded the timeout, don't keep executing this long query
+            log_output("Query %s exceeded the timeout of %d msec" % (name, glob_exe_timeout))
+            break
+
+    if len(exec_times) == 0:
+        return -1.0, 0.0
+    mean = sum(exec_times) / len(exec_times)
+    variance = sum(t * t for t in exec_times) / len(exec_times) - mean * mean
+    return mean, math.sqrt(max(variance, 0.0))
+
+
+# measurements
+# -----------------------------------------------------------------------------
+
+# explain a query with each parameter perturbed in turn, and return the
+# share of the cost of its plan that each parameter accounts for, i.e. the
+# derivative of the cost with respect to the parameter, times the parameter
+
+def measure_cost_shares(conn, query, current_params, base_cost, base_shape):
+    shares = {}
+    for name in sorted(current_params):
+        value = current_params[name]
+        (cost, shape, exec_time, fallback) = explain_query(conn, query, {name: value * PERTURBATION_FACTOR})
+        if fallback or cost < 0.0:
+            return None
+        if shape != base_shape:
+            # the perturbation changed the plan, the difference of costs
+            # does not tell the share of the parameter
+            log_output("Plan of query %s changes with parameter %s, skipping the query" % (query[0], name))
+            return None
+        diff = cost - base_cost
+        share = diff / (PERTURBATION_FACTOR - 1.0) if abs(diff) > COST_EPSILON else 0.0
+        shares[name] = share
+    return shares
+
+
+def select_current_params(names):
+    # the calibration starts from the default values of the parameters;
+    # the optimizer does not report the values it uses, and the shares of
+    # the parameters are measured against the values given to it
+    return dict((name, _default_param_values[name]) for name in names)
+
+
+# default values of the calibrated parameters, as in CCostModelParamsGPDB.cpp
+_default_param_values = {
+    "TableScanCostUnit": 5.50e-07,
+    "IndexBlockCostUnit": 1.27e-06,
+    "IndexFilterCostUnit": 1.65e-04,
+    "IndexScanTupCostUnit": 3.66e-06,
+    "FilterColCostUnit": 3.29e-05,
+    "OutputTupCostUnit": 1.86e-06,
+    "GatherSendCostUnit": 4.58e-06,
+    "GatherRecvCostUnit": 2.20e-06,
+    "RedistributeSendCostUnit": 2.33e-06,
+    "RedistributeRecvCostUnit": 8.00e-07,
+    "BroadcastSendCostUnit": 4.965e-05,
+    "BroadcastRecvCostUnit": 1.35e-06,
+    "JoinFeedingTupColumnCostUnit": 8.69e-05,
+    "JoinFeedingTupWidthCostUnit": 6.09e-07,
+    "JoinOutputTupCostUnit": 3.50e-06,
+    "HJHashTableColumnCostUnit": 5.00e-05,
+    "HJHashTableWidthCostUnit": 3.00e-06,
+    "HJHashingTupWidthCostUnit": 1.97e-05,
+    "HashAggInputTupColumnCostUnit": 1.20e-04,
+    "HashAggInputTupWidthCostUnit": 1.12e-07,
+    "HashAggOutputTupWidthCostUnit": 5.61e-07,
+    "SortTupWidthCostUnit": 5.67e-06,
+    "TupDefaultProcCostUnit": 1.00e-06,
+    "BitmapPageCostLargerNDV": 83.1651,
+    "BitmapPageCostSmallerNDV": 204.3810,
+}
+
+
+# regression
+# -----------------------------------------------------------------------------
+
+# Fit the parameters to the measured times.
+#
+# The estimated cost of query q is linear in the calibrated parameters p:
+#
+#    cost_q(p') = rest_q + sum over p of share_qp * p' / p
+#
+# where share_qp is the part of the current cost that p accounts for, and
+# rest_q the part that the parameters that are not calibrated account for.
+# With scale, the number of msec per unit of cost, chosen so that the suite
+# costs the same in total before and after calibration, the multipliers
+# x_p = p' / p minimize
+#
+#    sum over q of ((rest_q + sum over p of share_qp * x_p) / target_q - 1)^2
+#    + ridge * sum over p of (x_p - 1)^2
+#
+# where target_q = time_q / scale, so that every query weighs the same
+# whatever its duration. This is solved by projected coordinate descent,
+# keeping every multiplier within [1 / max_ratio, max_ratio].
+
+def fit_params(samples, names, ridge, max_ratio, iterations=1000):
+    # samples is a list of (cost, shares, exec time) tuples
+    total_cost = sum(s[0] for s in samples)
+    total_time = sum(s[2] for s in samples)
+    scale = total_time / total_cost
+
+    rows = []
+    for (cost, shares, exec_time) in samples:
+        target = exec_time / scale
+        rest = cost - sum(shares[name] for name in names)
+        rows.append(([shares[name] / target for name in names], rest / target))
+
+    x = [1.0] * len(names)
+    residuals = [rest + sum(g) - 1.0 for (g, rest) in rows]
+    for it in range(iterations):
+        max_change = 0.0
+        for j in range(len(names)):
+            num = ridge
+            den = ridge
+            for i, (g, rest) in enumerate(rows):
+                num -= g[j] * (residuals[i] - g[j] * x[j])
+                den += g[j] * g[j]
+            new_x = min(max(num / den, 1.0 / max_ratio), max_ratio)
+            change = new_x - x[j]
+            if change != 0.0:
+                for i, (g, rest) in enumerate(rows):
+                    residuals[i] += g[j] * change
+                x[j] = new_x
+                max_change = max(max_change, abs(change))
+        if max_change < 1e-9:
+            break
+
+    return dict((names[j], x[j]) for j in range(len(names))), scale
+
+
+# validation
+# -----------------------------------------------------------------------------
+
+# fraction of the pairs of queries that the costs order the same way as the
+# measured times; Kendall's tau is twice this minus one
+
+def concordance(costs, times):
+    concordant = 0
+    pairs = 0
+    for i in range(len(costs)):
+        for j in range(i + 1, len(costs)):
+            if times[i] == times[j]:
+                continue
+            pairs += 1
+            if (costs[i] - costs[j]) * (times[i] - times[j]) > 0:
+                concordant += 1
+    if pairs == 0:
+        return 1.0
+    return float(concordant) / pairs
+
+
+def print_report(results, params, calibrated_params, scale):
+    print("")
+    print("Cost model calibration report")
+    print("=============================")
+    print("")
+    print("Calibrated parameters (current value, calibrated value, ratio):")
+    for name in sorted(calibrated_params):
+        print("  %-32s %12.6g %12.6g %8.3f" % (name, params[name], calibrated_params[name],
+                                             calibrated_params[name] / params[name]))
+    print("")
+    print("Scale: %.6g msec per unit of cost" % scale)
+    print("")
+    print("Queries (measured msec, current cost, calibrated cost, relative error of current and calibrated costs):")
+    for r in results:
+        print("  %-28s %12.3f %12.2f %12.2f %8.3f %8.3f" %
+              (r["name"], r["time"], r["cost"], r["calibrated_cost"],
+               r["cost"] * scale / r["time"] - 1.0, r["calibrated_cost"] * scale / r["time"] - 1.0))
+
+    times = [r["time"] for r in results]
+    print("")
+    print("Ordering of all queries (fraction of concordant pairs, Kendall's tau):")
+    c = concordance([r["cost"] for r in results], times)
+    print("  current parameters:    %6.3f %6.3f" % (c, 2 * c - 1))
+    c = concordance([r["calibrated_cost"] for r in results], times)
+    print("  calibrated parameters: %6.3f %6.3f" % (c, 2 * c - 1))
+
+    print("")
+    print("Choice among alternative plans (fastest plan, cheapest plan with current and with calibrated parameters):")
+    groups = {}
+    for r in results:
+        groups.setdefault(r["group"], []).append(r)
+    num_groups = 0
+    num_right = 0
+    num_right_calibrated = 0
+    for group in sorted(groups):
+        alternatives = groups[group]
+        if len(alternatives) < 2:
+            continue
+        fastest = min(alternatives, key=lambda r: r["time"])["name"]
+        cheapest = min(alternatives, key=lambda r: r["cost"])["name"]
+        cheapest_calibrated = min(alternatives, key=lambda r: r["calibrated_cost"])["name"]
+        num_groups += 1
+        num_right += (fastest == cheapest)
+        num_right_calibrated += (fastest == cheapest_calibrated)
+        print("  %-16s %-28s %-28s %-28s" % (group, fastest, cheapest, cheapest_calibrated))
+    print("  right choices: %d of %d with current parameters, %d of %d with calibrated parameters" %
+          (num_right, num_groups, num_right_calibrated, num_groups))
+
+
+def write_config(fileName, calibrated_params):
+    value = format_cost_model_params(calibrated_params)
+    lines = ["# cost model parameters calibrated by cal_cost_model.py on %s" % time.strftime("%Y-%m-%d %H:%M:%S"),
+             "# apply to a session with SET, or to the cluster with gpconfig -c optimizer_cost_model_params",
+             "optimizer_cost_model_params = '%s'" % value]
+    if fileName == "":
+        print("")
+        print("\n".join(lines))
+    else:
+        with open(fileName, "wt") as f:
+            f.write("\n".join(lines) + "\n")
+        print("")
+        print("Wrote calibrated parameters to %s" % fileName)
+
+
+def calibrate(conn, names, execute_n_times, ridge, max_ratio, outputFile):
+    params = select_current_params(names)
+
+    # explain each query, measure the shares of the parameters in its cost,
+    # and run it
+    measured = []
+    for query in _queries:
+        (cost, shape, exec_time, fallback) = explain_query(conn, query, {})
+        if fallback or cost <= 0.0:
+            log_output("Query %s is not planned by the optimizer, skipping it" % query[0])
+            continue
+        shares = measure_cost_shares(conn, query, params, cost, shape)
+        if shares is None:
+            continue
+        mean, stddev = timed_execute_n_times(conn, query, execute_n_times)
+        if mean <= 0.0:
+            continue
+        log_output("Query %s: cost %.2f, time %.3f +- %.3f msec" % (query[0], cost, mean, stddev))
+        measured.append((query, cost, shares, mean))
+
+    if len(measured) == 0:
+        print("No query of the suite could be measured")
+        return
+
+    multipliers, scale = fit_params([(cost, shares, t) for (query, cost, shares, t) in measured],
+                                    names, ridge, max_ratio)
+    calibrated_params = dict((name, params[name] * multipliers[name]) for name in names)
+
+    # explain the queries again with the calibrated parameters
+    results = []
+    for (query, cost, shares, t) in measured:
+        (calibrated_cost, shape, exec_time, fallback) = explain_query(conn, query, calibrated_params)
+        results.append({"name": query[0], "group": query[1], "time": t, "cost": cost,
+                        "calibrated_cost": calibrated_cost})
+    execute_sql_arr(conn, _reset_forces)
+    set_cost_model_params(conn, {})
+
+    print_report(results, params, calibrated_params, scale)
+    write_config(outputFile, calibrated_params)
+
+
+def main():
+    global glob_verbose
+    global glob_log_file
+
+    args, parser = parseargs()
+    if args.logFile != "":
+        glob_log_file = open(args.logFile, "wt", 1)
+    if args.verbose:
+        glob_verbose = True
+
+    names = [name for name in args.params.split(",") if name != ""]
+    for name in names:
+        if name not in _default_param_values:
+            sys.exit("ERROR: Cannot calibrate parameter %s" % name)
+
+    log_output("Connecting to host %s on port %d, database %s" % (args.host, args.port, args.dbName))
+    conn = connect(args.host, args.port, args.dbName)
+    execute_sql(conn, "SET optimizer TO on;")
+    if args.create:
+        create_db(conn, args.appendOnly, args.numRows)
+
+    calibrate(conn, names, max(args.execute, 1), args.ridge, args.maxRatio, args.output)
+
+    if args.drop:
+        drop_db(conn)
+
+    conn.close()
+    if glob_log_file != None:
+        glob_log_file.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,81 @@
+import unittest
+from unittest.mock import patch
+from unittest.mock import Mock
+
+import cal_cost_model
+from cal_cost_model import concordance
+from cal_cost_model import explain_query
+from cal_cost_model import fit_params
+from cal_cost_model import format_cost_model_params
+from cal_cost_model import parse_explain
+
+class TestStringMethods(unittest.TestCase):
+
+    def test_parse_explain(self):
+        lines = [" Finalize Aggregate  (cost=0.00..431.55 rows=1 width=8) (actual time=12.1..12.1 rows=1 loops=1)",
+                 "   ->  Gather Motion 3:1  (slice1; segments: 3)  (cost=0.00..431.55 rows=1 width=8)",
+                 "         ->  Seq Scan on cal_cm_fact  (cost=0.00..431.54 rows=334 width=4)",
+                 "               Filter: (k10 = 1)",
+                 " Optimizer: Pivotal Optimizer (GPORCA)",
+                 " Execution Time: 12.345 ms"]
+
+        (cost, shape, exec_time, fallback) = parse_explain(lines)
+        self.assertEqual(cost, 431.55)
+        self.assertEqual(shape, ("Finalize Aggregate", "Gather Motion 3:1", "Seq Scan on cal_cm_fact"))
+        self.assertEqual(exec_time, 12.345)
+        self.assertFalse(fallback)
+
+    def test_parse_explain_fallback(self):
+        lines = [" Seq Scan on cal_cm_fact  (cost=0.00..1.01 rows=1 width=4)",
+                 " Optimizer: Postgres query optimizer"]
+
+        (cost, shape, exec_time, fallback) = parse_explain(lines)
+        self.assertEqual(cost, 1.01)
+        self.assertEqual(exec_time, -1.0)
+        self.assertTrue(fallback)
+
+    @patch('gppylib.db.dbconn.execSQL')
+    @patch('gppylib.db.dbconn.query')
+    def test_explain_query_sets_params(self, mock_query, mock_exec):
+        mock_query.return_value = Mock()
+        mock_query.return_value.fetchall.return_value = [
+            [" Seq Scan on cal_cm_fact  (cost=0.00..8.02 rows=1 width=4)"]
+        ]
+
+        query = ("q", "g", "SELECT 1", ["SET optimizer_enable_hashjoin TO off;"])
+        (cost, shape, exec_time, fallback) = explain_query(Mock(), query, {"TableScanCostUnit": 1.0e-06})
+        self.assertEqual(cost, 8.02)
+        statements = [c[0][1] for c in mock_exec.call_args_list]
+        self.assertIn("SET optimizer_enable_hashjoin TO off;", statements)
+        self.assertEqual(statements[-1], "SET optimizer_cost_model_params TO 'TableScanCostUnit=1e-06';")
+
+    def test_format_cost_model_params(self):
+        self.assertEqual(format_cost_model_params({}), "")
+        self.assertEqual(format_cost_model_params({"SortTupWidthCostUnit": 5.67e-06, "FilterColCostUnit": 0.5}),
+                         "FilterColCostUnit=0.5,SortTupWidthCostUnit=5.67e-06")
+
+    def test_fit_params(self):
+        # parameter a is underestimated by a factor of 4 relative to b
+        samples = [(10.0, {"a": 2.0, "b": 8.0}, 16.0),
+                   (10.0, {"a": 8.0, "b": 2.0}, 34.0),
+                   (20.0, {"a": 5.0, "b": 15.0}, 35.0)]
+
+        (multipliers, scale) = fit_params(samples, ["a", "b"], 0.0, 100.0)
+        self.assertAlmostEqual(multipliers["a"] / multipliers["b"], 4.0, places=3)
+        self.assertAlmostEqual(scale, 85.0 / 40.0)
+
+    def test_fit_params_bounds(self):
+        samples = [(10.0, {"a": 5.0}, 1000.0), (10.0, {"a": 0.0}, 10.0)]
+
+        (multipliers, scale) = fit_params(samples, ["a"], 0.0, 2.0)
+        self.assertEqual(multipliers["a"], 2.0)
+        (multipliers, scale) = fit_params([(10.0, {"a": 5.0}, 10.0), (10.0, {"a": 0.0}, 1000.0)], ["a"], 0.0, 2.0)
+        self.assertEqual(multipliers["a"], 0.5)
+
+    def test_concordance(self):
+        self.assertEqual(concordance([1.0, 2.0, 3.0], [10.0, 20.0, 30.0]), 1.0)
+        self.assertEqual(concordance([3.0, 2.0, 1.0], [10.0, 20.0, 30.0]), 0.0)
+        self.assertAlmostEqual(concordance([1.0, 3.0, 2.0], [10.0, 20.0, 30.0]), 2.0 / 3.0)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -36,6 +36,10 @@ public:
 	static GPOS_RESULT EresUnittest_SerializeQuery();
 	static GPOS_RESULT EresUnittest_SerializePlan();
 	static GPOS_RESULT EresUnittest_Encoding();
+	static GPOS_RESULT EresUnittest_BinaryDXL();
+	static GPOS_RESULT EresUnittest_BinaryDXLTruncated();
+	static GPOS_RESULT EresUnittest_BinaryDXLOversizedString();
+	static GPOS_RESULT EresUnittest_ColStatsMdIdWithParts();
 
 };	// class CDXLUtilsTest
 }  // namespace gpdxl
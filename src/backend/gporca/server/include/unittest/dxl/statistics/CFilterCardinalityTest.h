@@ -165,6 +165,9 @@ public:
 	// testing ArryCmpAny predicates
 	static GPOS_RESULT EresUnittest_CStatisticsFilterArrayCmpAny();
 
+	// NOT IN filter against a conjunction of <> filters
+	static GPOS_RESULT EresUnittest_CStatisticsFilterArrayCmpAll();
+
 	// testing nested AND / OR predicates
 	static GPOS_RESULT EresUnittest_CStatisticsNestedPred();
 
@@ -51,6 +51,9 @@ public:
 
 	// merge union test with double values differing by less than epsilon
 	static GPOS_RESULT EresUnittest_MergeUnionDoubleLessThanEpsilon();
+
+	// columnar buckets tests
+	static GPOS_RESULT EresUnittest_ColumnarBuckets();
 };	// class CHistogramTest
 }  // namespace gpnaucrates
 
@@ -107,6 +107,15 @@ public:
 	// union all tests
 	static GPOS_RESULT EresUnittest_UnionAll();
 
+	// sharing of histograms among statistics
+	static GPOS_RESULT EresUnittest_SharedHistograms();
+
+	// use of extended statistics in cardinality estimation
+	static GPOS_RESULT EresUnittest_ExtendedStats();
+
+	// use of multi-column most common values in cardinality estimation
+	static GPOS_RESULT EresUnittest_ExtendedStatsMCV();
+
 	// statistics basic tests
 	static GPOS_RESULT EresUnittest_CStatisticsBasic();
 
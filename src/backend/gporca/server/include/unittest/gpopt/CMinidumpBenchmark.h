@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMinidumpBenchmark.h
+//
+//	@doc:
+//		Benchmark of the optimizer over minidumps
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CMinidumpBenchmark_H
+#define GPOPT_CMinidumpBenchmark_H
+
+#include "gpos/base.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMinidumpBenchmark
+//
+//	@doc:
+//		Optimizes each of a set of minidumps a number of times, and reports
+//		the time taken, the peak memory of the optimization's pool and the
+//		size of the search, as CSV or as JSON.
+//
+//		A previous CSV report may be given as baseline; a minidump whose
+//		mean wall time exceeds the baseline by more than the threshold
+//		counts as regressed, as does a minidump that fails to optimize.
+//
+//---------------------------------------------------------------------------
+class CMinidumpBenchmark
+{
+private:
+	// measurements of a minidump
+	struct SResult
+	{
+		// minidump file
+		const CHAR *m_file_name;
+
+		// did optimization raise an error
+		BOOL m_failed;
+
+		// wall time, in milliseconds
+		DOUBLE m_wall_ms_mean;
+		DOUBLE m_wall_ms_min;
+
+		// user CPU time, in milliseconds
+		DOUBLE m_cpu_ms_mean;
+
+		// highest peak of the optimization's memory pool, in bytes
+		ULLONG m_peak_memory;
+
+		// size of the search
+		ULONG m_num_groups;
+		ULONG m_num_group_exprs;
+		ULLONG m_num_jobs;
+
+		// mean wall time in baseline, negative if not in baseline
+		DOUBLE m_baseline_wall_ms;
+	};
+
+	// baseline entry
+	struct SBaselineEntry
+	{
+		// minidump file, points into the baseline buffer
+		const CHAR *m_file_name;
+
+		// mean wall time, in milliseconds
+		DOUBLE m_wall_ms_mean;
+	};
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of optimizations of each minidump
+	const ULONG m_iterations;
+
+	// regression threshold, as percentage of baseline time
+	const DOUBLE m_threshold;
+
+	// contents of baseline file, and the entries parsed from it
+	CHAR *m_baseline_buffer;
+	SBaselineEntry *m_baseline;
+	ULONG m_baseline_size;
+
+	// optimize the given minidump repeatedly and record measurements
+	void Measure(const CHAR *file_name, SResult *result) const;
+
+	// mean wall time of the given minidump in the baseline, or -1
+	DOUBLE DBaselineWallTime(const CHAR *file_name) const;
+
+	// does the result regress from the baseline
+	BOOL FRegressed(const SResult &result) const;
+
+	// write results as CSV
+	static void WriteCSV(IOstream &os, const SResult *results, ULONG size,
+						 ULONG iterations);
+
+	// write results as JSON
+	static void WriteJSON(IOstream &os, const SResult *results, ULONG size,
+						  ULONG iterations);
+
+public:
+	CMinidumpBenchmark(const CMinidumpBenchmark &) = delete;
+
+	// ctor
+	CMinidumpBenchmark(CMemoryPool *mp, ULONG iterations, DOUBLE threshold);
+
+	// dtor
+	~CMinidumpBenchmark();
+
+	// load a CSV report of a previous run as baseline
+	void LoadBaseline(const CHAR *file_name);
+
+	// benchmark the given minidumps, write the report to the given file,
+	// if any; return the number of failed or regressed minidumps
+	ULONG UlRun(const CHAR **file_names, ULONG size,
+				const CHAR *output_file_name);
+
+};	// class CMinidumpBenchmark
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CMinidumpBenchmark_H
+
+// EOF
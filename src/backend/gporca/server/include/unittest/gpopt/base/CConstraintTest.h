@@ -110,6 +110,7 @@ public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_CInterval();
+	static GPOS_RESULT EresUnittest_CIntervalManyPoints();
 	static GPOS_RESULT EresUnittest_CIntervalFromScalarExpr();
 	static GPOS_RESULT EresUnittest_CConjunction();
 	static GPOS_RESULT EresUnittest_CDisjunction();
@@ -118,6 +119,7 @@ public:
 	static GPOS_RESULT EresUnittest_CConstraintIntervalConvertsTo();
 	static GPOS_RESULT EresUnittest_CConstraintIntervalPexpr();
 	static GPOS_RESULT EresUnittest_CConstraintIntervalFromArrayExpr();
+	static GPOS_RESULT EresUnittest_CConstraintFromLargeArrayExpr();
 
 #ifdef GPOS_DEBUG
 	// tests for unconstrainable types
@@ -127,6 +129,9 @@ public:
 	// test constraints on date intervals
 	static GPOS_RESULT EresUnittest_ConstraintsOnDates();
 
+	// test native comparisons of text data
+	static GPOS_RESULT EresUnittest_NativeTextComparisons();
+
 	// print equivalence classes
 	static void PrintEquivClasses(CMemoryPool *mp, CColRefSetArray *pdrgpcrs,
 								  BOOL fExpected = false);
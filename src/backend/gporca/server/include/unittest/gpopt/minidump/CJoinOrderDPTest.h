@@ -6,7 +6,8 @@
 //		CJoinOrderDPTest.h
 //
 //	@doc:
-//		Testing guc for disabling dynamic join order algorithm
+//		Testing guc for disabling dynamic join order algorithm, and the
+//		join predicates produced by dynamic programming
 //---------------------------------------------------------------------------
 #ifndef GPOPT_CJoinOrderDPTest_H
 #define GPOPT_CJoinOrderDPTest_H
@@ -20,6 +21,8 @@ class CJoinOrderDPTest
 public:
 	// unittests
 	static gpos::GPOS_RESULT EresUnittest();
+	static gpos::GPOS_RESULT EresUnittest_RunTests();
+	static gpos::GPOS_RESULT EresUnittest_DPv2SnowflakeJoinPreds();
 };	// class CJoinOrderDPTest
 }  // namespace gpopt
 
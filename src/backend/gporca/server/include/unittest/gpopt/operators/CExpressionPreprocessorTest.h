@@ -171,6 +171,9 @@ public:
 	static GPOS_RESULT
 	EresUnittest_PreProcessConvert2InPredicateDeepExpressionTree();
 	static GPOS_RESULT EresUnittest_PreProcessConvertArrayWithEquals();
+	static GPOS_RESULT EresUnittest_PreProcessCopyOnWrite();
+	static GPOS_RESULT
+	EresUnittest_PreProcessRemoveUnusedCTEsAndSuperfluousLimits();
 
 };	// class CExpressionPreprocessorTest
 }  // namespace gpopt
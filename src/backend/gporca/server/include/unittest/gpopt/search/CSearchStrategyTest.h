@@ -62,6 +62,9 @@ public:
 	// test reading search strategy from XML file
 	static GPOS_RESULT EresUnittest_Parsing();
 
+	// test picking the search strategy from the size of the search space
+	static GPOS_RESULT EresUnittest_Adaptive();
+
 	// test search strategy that times out
 	static GPOS_RESULT EresUnittest_Timeout();
 
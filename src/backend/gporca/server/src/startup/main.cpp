@@ -10,7 +10,10 @@
 //---------------------------------------------------------------------------
 
 #include "gpos/_api.h"
+#include "gpos/common/CAutoRg.h"
 #include "gpos/common/CMainArgs.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/io/CFileWriter.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/test/CUnittest.h"
 #include "gpos/types.h"
@@ -27,6 +30,7 @@
 // test headers
 
 #include "unittest/base.h"
+#include "unittest/gpopt/CMinidumpBenchmark.h"
 #include "unittest/dxl/CDXLMemoryManagerTest.h"
 #include "unittest/dxl/CDXLUtilsTest.h"
 #include "unittest/dxl/CParseHandlerCostModelTest.h"
@@ -258,6 +262,11 @@ PvExec(void *pv)
 	BOOL fUnittest = false;
 	BOOL fPrintDXLPlan = false;
 	ULLONG ullPlanId = 0;
+	ULONG ulBenchmarkIterations = 0;
+	const CHAR *szBenchmarkOutput = nullptr;
+	const CHAR *szBenchmarkBaseline = nullptr;
+	DOUBLE dBenchmarkThreshold = 10.0;
+	const CHAR *szBinaryOutput = nullptr;
 
 	while (pma->Getopt(&ch))
 	{
@@ -297,6 +306,27 @@ PvExec(void *pv)
 				fPrintDXLPlan = true;
 				break;
 
+			case 'b':
+				ulBenchmarkIterations =
+					(ULONG) clib::Strtol(optarg, nullptr, 10 /*base*/);
+				break;
+
+			case 'o':
+				szBenchmarkOutput = optarg;
+				break;
+
+			case 'c':
+				szBenchmarkBaseline = optarg;
+				break;
+
+			case 'r':
+				dBenchmarkThreshold = clib::Strtod(optarg);
+				break;
+
+			case 'e':
+				szBinaryOutput = optarg;
+				break;
+
 			default:
 				// ignore other parameters
 				break;
@@ -310,7 +340,73 @@ PvExec(void *pv)
 		return nullptr;
 	}
 
-	if (fMinidump)
+	if (0 < ulBenchmarkIterations)
+	{
+		if (fUnittest)
+		{
+			GPOS_TRACE(GPOS_WSZ_LIT(
+				"Cannot specify -b and -U/-u options at the same time"));
+			return nullptr;
+		}
+
+		// benchmark the minidump given with -d, if any, and the ones that
+		// follow the options
+		InitDXL();
+
+		CMDCache::Init();
+
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+
+		const ULONG ulOperands = pma->UlOperands();
+		CAutoRg<const CHAR *> rgszFiles(
+			GPOS_NEW_ARRAY(mp, const CHAR *, ulOperands + 1));
+		ULONG ulFiles = 0;
+		if (fMinidump)
+		{
+			rgszFiles[ulFiles++] = file_name;
+		}
+		for (ULONG ul = 0; ul < ulOperands; ul++)
+		{
+			rgszFiles[ulFiles++] = pma->SzOperand(ul);
+		}
+
+		CMinidumpBenchmark mb(mp, ulBenchmarkIterations, dBenchmarkThreshold);
+		if (nullptr != szBenchmarkBaseline)
+		{
+			mb.LoadBaseline(szBenchmarkBaseline);
+		}
+		tests_failed = mb.UlRun(rgszFiles.Rgt(), ulFiles, szBenchmarkOutput);
+
+		CMDCache::Shutdown();
+	}
+	else if (nullptr != szBinaryOutput)
+	{
+		if (!fMinidump)
+		{
+			GPOS_TRACE(
+				GPOS_WSZ_LIT("Option -e requires a minidump given with -d"));
+			return nullptr;
+		}
+
+		// encode the minidump as binary DXL instead of optimizing it
+		InitDXL();
+
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+
+		CAutoRg<CHAR> szXML;
+		szXML = CDXLUtils::Read(mp, file_name);
+		ULONG ulSize = 0;
+		CAutoRg<CHAR> szBinary;
+		szBinary = CDXLUtils::EncodeBinaryDXL(mp, szXML.Rgt(), &ulSize);
+
+		CFileWriter fw;
+		fw.Open(szBinaryOutput, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+		fw.Write((const BYTE *) szBinary.Rgt(), ulSize);
+		fw.Close();
+	}
+	else if (fMinidump)
 	{
 		// initialize DXL support
 		InitDXL();
@@ -402,7 +498,7 @@ main(INT iArgs, const CHAR **rgszArgs)
 	GPOS_ASSERT(iArgs >= 0);
 
 	// setup args for unittest params
-	CMainArgs ma(iArgs, rgszArgs, "uU:d:xT:i:p");
+	CMainArgs ma(iArgs, rgszArgs, "uU:d:xT:i:pb:o:c:r:e:");
 
 	// initialize unittest framework
 	CUnittest::Init(rgut, GPOS_ARRAY_SIZE(rgut), ConfigureTests, Cleanup);
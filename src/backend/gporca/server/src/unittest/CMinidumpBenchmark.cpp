@@ -0,0 +1,418 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMinidumpBenchmark.cpp
+//
+//	@doc:
+//		Implementation of the benchmark of the optimizer over minidumps
+//---------------------------------------------------------------------------
+
+#include "unittest/gpopt/CMinidumpBenchmark.h"
+
+#include <fstream>
+
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/CTimerUser.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/io/COstreamBasic.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+
+#include "gpopt/engine/CEngine.h"
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "naucrates/dxl/CDXLUtils.h"
+
+#include "unittest/gpopt/CTestUtils.h"
+
+using namespace gpopt;
+
+// header of CSV reports
+#define GPOPT_BENCHMARK_CSV_HEADER                                   \
+	"minidump,iterations,status,wall_ms_mean,wall_ms_min,cpu_ms_mean," \
+	"peak_memory_bytes,groups,group_exprs,jobs"
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::CMinidumpBenchmark
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::CMinidumpBenchmark(CMemoryPool *mp, ULONG iterations,
+									   DOUBLE threshold)
+	: m_mp(mp),
+	  m_iterations(iterations),
+	  m_threshold(threshold),
+	  m_baseline_buffer(nullptr),
+	  m_baseline(nullptr),
+	  m_baseline_size(0)
+{
+	GPOS_ASSERT(0 < iterations);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::~CMinidumpBenchmark
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::~CMinidumpBenchmark()
+{
+	GPOS_DELETE_ARRAY(m_baseline);
+	GPOS_DELETE_ARRAY(m_baseline_buffer);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::LoadBaseline
+//
+//	@doc:
+//		Load the mean wall time of each minidump that optimized without
+//		error from a CSV report of a previous run
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::LoadBaseline(const CHAR *file_name)
+{
+	GPOS_ASSERT(nullptr == m_baseline_buffer);
+
+	m_baseline_buffer = CDXLUtils::Read(m_mp, file_name);
+
+	ULONG num_lines = 1;
+	for (const CHAR *sz = m_baseline_buffer; '\0' != *sz; sz++)
+	{
+		num_lines += ('\n' == *sz) ? 1 : 0;
+	}
+	m_baseline = GPOS_NEW_ARRAY(m_mp, SBaselineEntry, num_lines);
+
+	CHAR *line = m_baseline_buffer;
+	while (nullptr != line && '\0' != *line)
+	{
+		CHAR *next_line = clib::Strchr(line, '\n');
+		if (nullptr != next_line)
+		{
+			*next_line++ = '\0';
+		}
+
+		// fields are minidump, iterations, status and mean wall time
+		CHAR *fields[4] = {line, nullptr, nullptr, nullptr};
+		ULONG num_fields = 1;
+		for (; num_fields < GPOS_ARRAY_SIZE(fields); num_fields++)
+		{
+			CHAR *sep = clib::Strchr(fields[num_fields - 1], ',');
+			if (nullptr == sep)
+			{
+				break;
+			}
+			*sep = '\0';
+			fields[num_fields] = sep + 1;
+		}
+
+		if (GPOS_ARRAY_SIZE(fields) == num_fields &&
+			0 == clib::Strcmp(fields[2], "ok"))
+		{
+			m_baseline[m_baseline_size].m_file_name = fields[0];
+			m_baseline[m_baseline_size].m_wall_ms_mean =
+				clib::Strtod(fields[3]);
+			m_baseline_size++;
+		}
+
+		line = next_line;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::DBaselineWallTime
+//
+//	@doc:
+//		Mean wall time of the given minidump in the baseline, or -1 if it
+//		is not in the baseline
+//
+//---------------------------------------------------------------------------
+DOUBLE
+CMinidumpBenchmark::DBaselineWallTime(const CHAR *file_name) const
+{
+	for (ULONG ul = 0; ul < m_baseline_size; ul++)
+	{
+		if (0 == clib::Strcmp(m_baseline[ul].m_file_name, file_name))
+		{
+			return m_baseline[ul].m_wall_ms_mean;
+		}
+	}
+
+	return -1.0;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::FRegressed
+//
+//	@doc:
+//		Does the result fail, or take longer than the baseline allows
+//
+//---------------------------------------------------------------------------
+BOOL
+CMinidumpBenchmark::FRegressed(const SResult &result) const
+{
+	if (result.m_failed)
+	{
+		return true;
+	}
+
+	return 0.0 < result.m_baseline_wall_ms &&
+		   result.m_wall_ms_mean >
+			   result.m_baseline_wall_ms * (1.0 + m_threshold / 100.0);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::Measure
+//
+//	@doc:
+//		Optimize the given minidump repeatedly; each optimization gets a
+//		memory pool of its own, so that the pool's peak is that of a
+//		single optimization, and the minidump is loaded once, so that
+//		parsing it is not measured
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::Measure(const CHAR *file_name, SResult *result) const
+{
+	result->m_file_name = file_name;
+	result->m_failed = false;
+	result->m_wall_ms_mean = 0.0;
+	result->m_wall_ms_min = 0.0;
+	result->m_cpu_ms_mean = 0.0;
+	result->m_peak_memory = 0;
+	result->m_num_groups = 0;
+	result->m_num_group_exprs = 0;
+	result->m_num_jobs = 0;
+	result->m_baseline_wall_ms = DBaselineWallTime(file_name);
+
+	GPOS_TRY
+	{
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+
+		CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(mp, file_name);
+		GPOS_CHECK_ABORT;
+
+		COptimizerConfig *optimizer_config = pdxlmd->GetOptimizerConfig();
+		if (nullptr == optimizer_config)
+		{
+			optimizer_config = COptimizerConfig::PoconfDefault(mp);
+		}
+		else
+		{
+			optimizer_config->AddRef();
+		}
+
+		const ULONG ulSegments = CTestUtils::UlSegments(optimizer_config);
+
+		DOUBLE wall_ms_total = 0.0;
+		DOUBLE cpu_ms_total = 0.0;
+		for (ULONG ul = 0; ul < m_iterations; ul++)
+		{
+			CAutoMemoryPool ampOptimize;
+			CMemoryPool *pmpOptimize = ampOptimize.Pmp();
+			SEngineStats engine_stats;
+
+			CTimerUser cpu_timer;
+			cpu_timer.Restart();
+			CWallClock wall_timer;
+
+			CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+				pmpOptimize, pdxlmd, file_name, ulSegments, 1 /*ulSessionId*/,
+				1 /*ulCmdId*/, optimizer_config, nullptr /*pceeval*/,
+				&engine_stats);
+
+			const DOUBLE wall_ms = wall_timer.ElapsedUS() / 1000.0;
+			const DOUBLE cpu_ms = cpu_timer.ElapsedUS() / 1000.0;
+
+			pdxlnPlan->Release();
+			GPOS_CHECK_ABORT;
+
+			wall_ms_total += wall_ms;
+			cpu_ms_total += cpu_ms;
+			if (0 == ul || wall_ms < result->m_wall_ms_min)
+			{
+				result->m_wall_ms_min = wall_ms;
+			}
+			result->m_peak_memory = std::max(result->m_peak_memory,
+											 pmpOptimize->PeakAllocatedSize());
+			result->m_num_groups = engine_stats.m_num_groups;
+			result->m_num_group_exprs = engine_stats.m_num_group_exprs;
+			result->m_num_jobs = engine_stats.m_num_jobs;
+		}
+
+		result->m_wall_ms_mean = wall_ms_total / m_iterations;
+		result->m_cpu_ms_mean = cpu_ms_total / m_iterations;
+
+		optimizer_config->Release();
+		GPOS_DELETE(pdxlmd);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		result->m_failed = true;
+
+		CAutoTrace at(m_mp);
+		at.Os() << file_name << ": optimization failed with exception "
+				<< ex.Major() << "." << ex.Minor();
+
+		GPOS_RESET_EX;
+	}
+	GPOS_CATCH_END;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::WriteCSV
+//
+//	@doc:
+//		Write results as CSV, one line per minidump; this is the format
+//		read back as baseline
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::WriteCSV(IOstream &os, const SResult *results, ULONG size,
+							 ULONG iterations)
+{
+	os << GPOPT_BENCHMARK_CSV_HEADER << "\n";
+
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		const SResult &result = results[ul];
+		os << result.m_file_name << "," << iterations << ","
+		   << (result.m_failed ? "error" : "ok") << ","
+		   << result.m_wall_ms_mean << "," << result.m_wall_ms_min << ","
+		   << result.m_cpu_ms_mean << "," << result.m_peak_memory << ","
+		   << result.m_num_groups << "," << result.m_num_group_exprs << ","
+		   << result.m_num_jobs << "\n";
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::WriteJSON
+//
+//	@doc:
+//		Write results as a JSON array with an object per minidump
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::WriteJSON(IOstream &os, const SResult *results,
+							  ULONG size, ULONG iterations)
+{
+	os << "[";
+
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		const SResult &result = results[ul];
+
+		os << ((0 == ul) ? "\n" : ",\n") << "  {\"minidump\": \"";
+		for (const CHAR *sz = result.m_file_name; '\0' != *sz; sz++)
+		{
+			if ('"' == *sz || '\\' == *sz)
+			{
+				os << '\\';
+			}
+			os << *sz;
+		}
+		os << "\", \"iterations\": " << iterations << ", \"status\": \""
+		   << (result.m_failed ? "error" : "ok")
+		   << "\", \"wall_ms_mean\": " << result.m_wall_ms_mean
+		   << ", \"wall_ms_min\": " << result.m_wall_ms_min
+		   << ", \"cpu_ms_mean\": " << result.m_cpu_ms_mean
+		   << ", \"peak_memory_bytes\": " << result.m_peak_memory
+		   << ", \"groups\": " << result.m_num_groups
+		   << ", \"group_exprs\": " << result.m_num_group_exprs
+		   << ", \"jobs\": " << result.m_num_jobs << "}";
+	}
+
+	os << "\n]\n";
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::UlRun
+//
+//	@doc:
+//		Benchmark the given minidumps and report the results; the report
+//		is JSON if the output file name ends in ".json", CSV otherwise.
+//		Return the number of minidumps that failed or regressed
+//
+//---------------------------------------------------------------------------
+ULONG
+CMinidumpBenchmark::UlRun(const CHAR **file_names, ULONG size,
+						  const CHAR *output_file_name)
+{
+	CAutoRg<SResult> results(GPOS_NEW_ARRAY(m_mp, SResult, size));
+
+	ULONG num_regressed = 0;
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		SResult &result = results[ul];
+		Measure(file_names[ul], &result);
+
+		CAutoTrace at(m_mp);
+		at.Os() << result.m_file_name << ": wall " << result.m_wall_ms_mean
+				<< " ms, cpu " << result.m_cpu_ms_mean << " ms, peak memory "
+				<< result.m_peak_memory << " bytes, " << result.m_num_groups
+				<< " groups, " << result.m_num_group_exprs
+				<< " group exprs, " << result.m_num_jobs << " jobs";
+		if (0.0 < result.m_baseline_wall_ms)
+		{
+			at.Os() << ", baseline " << result.m_baseline_wall_ms << " ms";
+		}
+
+		if (FRegressed(result))
+		{
+			at.Os() << " *** REGRESSED ***";
+			num_regressed++;
+		}
+	}
+
+	if (nullptr != output_file_name)
+	{
+		const ULONG length = clib::Strlen(output_file_name);
+		const BOOL is_json =
+			5 <= length &&
+			0 == clib::Strcmp(output_file_name + length - 5, ".json");
+
+		std::wofstream wos(output_file_name);
+		COstreamBasic os(&wos);
+		if (is_json)
+		{
+			WriteJSON(os, results.Rgt(), size, m_iterations);
+		}
+		else
+		{
+			WriteCSV(os, results.Rgt(), size, m_iterations);
+		}
+	}
+
+	{
+		CAutoTrace at(m_mp);
+		at.Os() << "Benchmarked " << size << " minidumps, " << num_regressed
+				<< " failed or regressed by more than " << m_threshold << "%";
+	}
+
+	return num_regressed;
+}
+
+// EOF
@@ -15,6 +15,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRg.h"
 #include "gpos/common/CRandom.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamString.h"
@@ -23,8 +24,15 @@
 
 #include "naucrates/base/CQueryToDXLResult.h"
 #include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/dxl/operators/CDXLOperatorFactory.h"
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/exception.h"
+#include "naucrates/md/CMDIdColStats.h"
+
+#include "unittest/gpopt/CTestUtils.h"
 
 XERCES_CPP_NAMESPACE_USE
 
@@ -35,6 +43,32 @@ static const char *szQueryFile =
 	"../data/dxl/expressiontests/TableScanQuery.xml";
 static const char *szPlanFile = "../data/dxl/expressiontests/TableScanPlan.xml";
 
+//---------------------------------------------------------------------------
+//	@function:
+//		PstrSerializePlan
+//
+//	@doc:
+//		Parse the plan in the given DXL document and serialize it as XML
+//
+//---------------------------------------------------------------------------
+static CWStringDynamic *
+PstrSerializePlan(CMemoryPool *mp, const CHAR *dxl_string)
+{
+	ULLONG plan_id = gpos::ullong_max;
+	ULLONG plan_space_size = gpos::ullong_max;
+	CDXLNode *node = CDXLUtils::GetPlanDXLNode(
+		mp, dxl_string, nullptr /*xsd_file_path*/, &plan_id, &plan_space_size);
+
+	CWStringDynamic *str = GPOS_NEW(mp) CWStringDynamic(mp);
+	COstreamString oss(str);
+	CDXLUtils::SerializePlan(mp, oss, node, plan_id, plan_space_size,
+							 true /*serialize_document_header_footer*/,
+							 true /*indentation*/);
+	node->Release();
+
+	return str;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtilsTest::EresUnittest
@@ -50,6 +84,14 @@ CDXLUtilsTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_SerializeQuery),
 		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_SerializePlan),
 		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_Encoding),
+		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_BinaryDXL),
+		GPOS_UNITTEST_FUNC_THROW(
+			CDXLUtilsTest::EresUnittest_BinaryDXLTruncated, gpdxl::ExmaDXL,
+			gpdxl::ExmiDXLMalformedBinary),
+		GPOS_UNITTEST_FUNC_THROW(
+			CDXLUtilsTest::EresUnittest_BinaryDXLOversizedString,
+			gpdxl::ExmaDXL, gpdxl::ExmiDXLMalformedBinary),
+		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_ColStatsMdIdWithParts),
 	};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -231,4 +273,184 @@ CDXLUtilsTest::EresUnittest_Encoding()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtilsTest::EresUnittest_BinaryDXL
+//
+//	@doc:
+//		Testing that a plan parsed from binary DXL, and from the XML that
+//		binary DXL decodes to, is the plan parsed from the original XML
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLUtilsTest::EresUnittest_BinaryDXL()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> a_szXML;
+	a_szXML = CDXLUtils::Read(mp, szPlanFile);
+	GPOS_ASSERT(!CDXLUtils::IsBinaryDXL(a_szXML.Rgt()));
+
+	ULONG size = 0;
+	CAutoRg<CHAR> a_szBinary;
+	a_szBinary = CDXLUtils::EncodeBinaryDXL(mp, a_szXML.Rgt(), &size);
+
+	// binary DXL passes for a null-terminated string
+	if (!CDXLUtils::IsBinaryDXL(a_szBinary.Rgt()) ||
+		size != clib::Strlen(a_szBinary.Rgt()))
+	{
+		return GPOS_FAILED;
+	}
+
+	CAutoP<CWStringDynamic> a_pstrDecoded;
+	a_pstrDecoded = CDXLUtils::DecodeBinaryDXL(mp, a_szBinary.Rgt(),
+											   false /*indentation*/);
+	CAutoRg<CHAR> a_szDecoded;
+	a_szDecoded = CDXLUtils::CreateMultiByteCharStringFromWCString(
+		mp, a_pstrDecoded->GetBuffer());
+
+	CAutoP<CWStringDynamic> a_pstrFromXML;
+	a_pstrFromXML = PstrSerializePlan(mp, a_szXML.Rgt());
+	CAutoP<CWStringDynamic> a_pstrFromBinary;
+	a_pstrFromBinary = PstrSerializePlan(mp, a_szBinary.Rgt());
+	CAutoP<CWStringDynamic> a_pstrFromDecoded;
+	a_pstrFromDecoded = PstrSerializePlan(mp, a_szDecoded.Rgt());
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "XML size: " << clib::Strlen(a_szXML.Rgt())
+				<< ", binary size: " << size << std::endl;
+	}
+
+	if (!a_pstrFromXML->Equals(a_pstrFromBinary.Value()) ||
+		!a_pstrFromXML->Equals(a_pstrFromDecoded.Value()))
+	{
+		return GPOS_FAILED;
+	}
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtilsTest::EresUnittest_BinaryDXLTruncated
+//
+//	@doc:
+//		Testing that parsing truncated binary DXL raises an error
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLUtilsTest::EresUnittest_BinaryDXLTruncated()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> a_szXML;
+	a_szXML = CDXLUtils::Read(mp, szPlanFile);
+
+	ULONG size = 0;
+	CAutoRg<CHAR> a_szBinary;
+	a_szBinary = CDXLUtils::EncodeBinaryDXL(mp, a_szXML.Rgt(), &size);
+	a_szBinary[size / 2] = '\0';
+
+	// raises an exception
+	CAutoP<CWStringDynamic> a_pstr;
+	a_pstr = PstrSerializePlan(mp, a_szBinary.Rgt());
+
+	return GPOS_FAILED;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtilsTest::EresUnittest_BinaryDXLOversizedString
+//
+//	@doc:
+//		Testing that a string longer than what is left of a binary DXL
+//		document raises an error before any room is made for it
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLUtilsTest::EresUnittest_BinaryDXLOversizedString()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// magic bytes and version, then the definition of a name of 0xfffffff0
+	// code units, of which only one follows
+	const CHAR szBinary[] = GPDXL_BINARY_MAGIC
+		"\x02"
+		"\x02"
+		"\xf1\xff\xff\xff\x0f"
+		"\x42";
+
+	// raises an exception
+	CAutoP<CWStringDynamic> a_pstr;
+	a_pstr = CDXLUtils::DecodeBinaryDXL(mp, szBinary, false /*indentation*/);
+
+	return GPOS_FAILED;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtilsTest::EresUnittest_ColStatsMdIdWithParts
+//
+//	@doc:
+//		Test that column stats mdids listing the leaf partitions to merge
+//		the statistics of are parsed back from their string representation
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLUtilsTest::EresUnittest_ColStatsMdIdWithParts()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoP<CDXLMemoryManager> a_pmm(GPOS_NEW(mp) CDXLMemoryManager(mp));
+
+	// enough leaf partitions for the mdid not to fit into a static buffer
+	const ULONG num_parts = 20;
+	IMdIdArray *part_mdids = GPOS_NEW(mp) IMdIdArray(mp);
+	for (ULONG ul = 0; ul < num_parts; ul++)
+	{
+		part_mdids->Append(GPOS_NEW(mp) CMDIdGPDB(GPOPT_MDCACHE_TEST_OID + ul));
+	}
+
+	CMDIdColStats *mdid = GPOS_NEW(mp)
+		CMDIdColStats(mp, GPOS_NEW(mp) CMDIdGPDB(GPOPT_MDCACHE_TEST_OID),
+					  2 /* attno */, part_mdids);
+
+	CAutoRg<CHAR> a_sz;
+	a_sz = CDXLUtils::CreateMultiByteCharStringFromWCString(
+		mp, mdid->GetBuffer());
+	XMLCh *mdid_xml = XMLString::transcode(a_sz.Rgt(), a_pmm.Value());
+
+	IMDId *mdid_parsed = CDXLOperatorFactory::MakeMdIdFromStr(
+		a_pmm.Value(), mdid_xml, EdxltokenMdid, EdxltokenColumnStats);
+	XMLString::release(&mdid_xml, a_pmm.Value());
+
+	GPOS_RESULT eres = GPOS_FAILED;
+	if (mdid->Equals(mdid_parsed) &&
+		mdid->HashValue() == mdid_parsed->HashValue() &&
+		num_parts ==
+			CMDIdColStats::CastMdid(mdid_parsed)->GetPartMdIds()->Size())
+	{
+		eres = GPOS_OK;
+	}
+
+	// the statistics of the relation itself have a different mdid
+	CMDIdColStats *mdid_rel = GPOS_NEW(mp) CMDIdColStats(
+		GPOS_NEW(mp) CMDIdGPDB(GPOPT_MDCACHE_TEST_OID), 2 /* attno */);
+	if (mdid_rel->Equals(mdid) || mdid->Equals(mdid_rel))
+	{
+		eres = GPOS_FAILED;
+	}
+
+	mdid_rel->Release();
+	mdid_parsed->Release();
+	mdid->Release();
+
+	return eres;
+}
+
 // EOF
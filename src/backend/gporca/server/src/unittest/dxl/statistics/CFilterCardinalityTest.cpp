@@ -86,6 +86,8 @@ CFilterCardinalityTest::EresUnittest()
 			CFilterCardinalityTest::EresUnittest_CStatisticsFilter),
 		GPOS_UNITTEST_FUNC(
 			CFilterCardinalityTest::EresUnittest_CStatisticsFilterArrayCmpAny),
+		GPOS_UNITTEST_FUNC(
+			CFilterCardinalityTest::EresUnittest_CStatisticsFilterArrayCmpAll),
 		GPOS_UNITTEST_FUNC(
 			CFilterCardinalityTest::EresUnittest_CStatisticsFilterConj),
 		GPOS_UNITTEST_FUNC(
@@ -291,6 +293,75 @@ CFilterCardinalityTest::PstatspredArrayCmpAnyDuplicate(CMemoryPool *mp)
 	return GPOS_NEW(mp) CStatsPredConj(pdrgpstatspred);
 }
 
+// test that a 'col NOT IN (...)' filter estimates the same cardinality as
+// the conjunction of 'col <> const' filters over its constants
+GPOS_RESULT
+CFilterCardinalityTest::EresUnittest_CStatisticsFilterArrayCmpAll()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// generate histogram of the form [0, 10), [10, 20), [20, 30), [80, 90), [100,100]
+	UlongToHistogramMap *col_histogram_mapping =
+		GPOS_NEW(mp) UlongToHistogramMap(mp);
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(1),
+								  CCardinalityTestUtils::PhistExampleInt4(mp));
+	UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(1),
+								GPOS_NEW(mp) CDouble(4.0));
+
+	CStatistics *stats = GPOS_NEW(mp)
+		CStatistics(mp, col_histogram_mapping, colid_width_mapping,
+					CDouble(1000.0) /* rows */, false /* is_empty() */
+		);
+
+	// unsorted, with duplicates, with points in the same bucket, outside of
+	// all buckets, and on a singleton bucket
+	INT rgiVals[] = {25, 5, 100, 5, 7, 50, 200, 8, 25};
+	const ULONG ulVals = GPOS_ARRAY_SIZE(rgiVals);
+
+	CPointArray *arr = GPOS_NEW(mp) CPointArray(mp);
+	for (ULONG ul = 0; ul < ulVals; ul++)
+	{
+		arr->Append(CTestUtils::PpointInt4(mp, rgiVals[ul]));
+	}
+	CStatsPredPtrArry *pdrgpstatspred = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+	pdrgpstatspred->Append(
+		GPOS_NEW(mp) CStatsPredArrayCmp(1, CStatsPred::EstatscmptNEq, arr));
+	CStatsPredConj *pstatspredArrayCmp =
+		GPOS_NEW(mp) CStatsPredConj(pdrgpstatspred);
+
+	CStatsPredConj *pstatspredConj =
+		GPOS_NEW(mp) CStatsPredConj(PdrgpstatspredInteger(
+			mp, 1, CStatsPred::EstatscmptNEq, rgiVals, ulVals));
+
+	CStatistics *pstatsArrayCmp = CFilterStatsProcessor::MakeStatsFilter(
+		mp, stats, pstatspredArrayCmp, true /* do_cap_NDVs */);
+	CStatistics *pstatsConj = CFilterStatsProcessor::MakeStatsFilter(
+		mp, stats, pstatspredConj, true /* do_cap_NDVs */);
+
+	GPOS_TRACE(GPOS_WSZ_LIT("\n\nStats after NOT IN filter:\n"));
+	CCardinalityTestUtils::PrintStats(mp, pstatsArrayCmp);
+	GPOS_TRACE(GPOS_WSZ_LIT("\n\nStats after conjunction of <> filters:\n"));
+	CCardinalityTestUtils::PrintStats(mp, pstatsConj);
+
+	CDouble dRowsArrayCmp = pstatsArrayCmp->Rows();
+	CDouble dRowsConj = pstatsConj->Rows();
+	GPOS_RTL_ASSERT(dRowsArrayCmp < stats->Rows());
+	GPOS_RTL_ASSERT(
+		(dRowsArrayCmp - dRowsConj).Absolute() < 0.001 &&
+		"NOT IN filter and conjunction of <> filters have different row estimates");
+
+	pstatspredArrayCmp->Release();
+	pstatspredConj->Release();
+	pstatsArrayCmp->Release();
+	pstatsConj->Release();
+	stats->Release();
+
+	return GPOS_OK;
+}
+
 // reads a DXL document, generates the statistics object, performs a
 // filter operation on it, serializes it into a DXL document and
 // compares the generated DXL document with the expected DXL document.
@@ -17,10 +17,12 @@
 
 #include <stdint.h>
 
+#include "gpos/common/CAutoRef.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 
+#include "naucrates/statistics/CColumnarBuckets.h"
 #include "naucrates/statistics/CHistogram.h"
 #include "naucrates/statistics/CPoint.h"
 
@@ -42,7 +44,8 @@ CHistogramTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramValid),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_MergeUnion),
 		GPOS_UNITTEST_FUNC(
-			CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon)};
+			CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon),
+		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_ColumnarBuckets)};
 
 
 	CAutoMemoryPool amp;
@@ -158,18 +161,18 @@ CHistogramTest::EresUnittest_CHistogramInt4()
 	point3->Release();
 	ppoint4->Release();
 	ppoint5->Release();
-	GPOS_DELETE(histogram);
-	GPOS_DELETE(phist0);
-	GPOS_DELETE(histogram1);
-	GPOS_DELETE(histogram2);
-	GPOS_DELETE(phist3);
-	GPOS_DELETE(phist4);
-	GPOS_DELETE(phist5);
-	GPOS_DELETE(phist6);
-	GPOS_DELETE(phist7);
-	GPOS_DELETE(phist8);
-	GPOS_DELETE(phist9);
-	GPOS_DELETE(phist10);
+	histogram->Release();
+	phist0->Release();
+	histogram1->Release();
+	histogram2->Release();
+	phist3->Release();
+	phist4->Release();
+	phist5->Release();
+	phist6->Release();
+	phist7->Release();
+	phist8->Release();
+	phist9->Release();
+	phist10->Release();
 
 	return GPOS_OK;
 }
@@ -202,8 +205,8 @@ CHistogramTest::EresUnittest_CHistogramBool()
 
 	// clean up
 	point1->Release();
-	GPOS_DELETE(histogram);
-	GPOS_DELETE(histogram1);
+	histogram->Release();
+	histogram1->Release();
 
 	return GPOS_OK;
 }
@@ -231,7 +234,7 @@ CHistogramTest::EresUnittest_CHistogramValid()
 	CHistogram *histogram = GPOS_NEW(mp) CHistogram(mp, histogram_buckets);
 
 	// create an auto object
-	CAutoP<CHistogram> ahist;
+	CAutoRef<CHistogram> ahist;
 	ahist = histogram;
 
 	{
@@ -317,8 +320,8 @@ CHistogramTest::EresUnittest_Skew()
 		histogram2->OsPrint(at.Os());
 	}
 
-	GPOS_DELETE(histogram1);
-	GPOS_DELETE(histogram2);
+	histogram1->Release();
+	histogram2->Release();
 
 	return GPOS_OK;
 }
@@ -371,10 +374,10 @@ CHistogramTest::EresUnittest_MergeUnion()
 	}
 
 	GPOS_ASSERT(output_rows1 == output_rows2);
-	GPOS_DELETE(histogram1);
-	GPOS_DELETE(histogram2);
-	GPOS_DELETE(result1);
-	GPOS_DELETE(result2);
+	histogram1->Release();
+	histogram2->Release();
+	result1->Release();
+	result2->Release();
 
 	return GPOS_OK;
 }
@@ -425,10 +428,97 @@ CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon()
 		at.Os() << "Result 1: " << output_rows1 << std::endl;
 	}
 
-	GPOS_DELETE(histogram1);
-	GPOS_DELETE(histogram2);
-	GPOS_DELETE(result1);
+	histogram1->Release();
+	histogram2->Release();
+	result1->Release();
 
 	return GPOS_OK;
 }
+
+// columnar buckets find the same buckets as the bucket objects do
+GPOS_RESULT
+CHistogramTest::EresUnittest_ColumnarBuckets()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// histogram [0, 10), [10, 20), ... [80, 90), [100, 100]
+	CAutoRef<CHistogram> histogram(CCardinalityTestUtils::PhistExampleInt4(mp));
+	const CBucketArray *buckets = histogram->GetBuckets();
+
+	CColumnarBuckets *columnar_buckets =
+		CColumnarBuckets::PcbCreate(mp, buckets);
+	GPOS_RTL_ASSERT(nullptr != columnar_buckets);
+
+	CStatsPred::EStatsCmpType rgcmptype[] = {
+		CStatsPred::EstatscmptEq, CStatsPred::EstatscmptL,
+		CStatsPred::EstatscmptLEq, CStatsPred::EstatscmptG,
+		CStatsPred::EstatscmptGEq};
+
+	for (INT i = -5; i <= 105; i++)
+	{
+		CAutoRef<CPoint> point(CTestUtils::PpointInt4(mp, i));
+
+		// buckets before the one looked up end before the point, and the
+		// one looked up does not
+		DOUBLE value = 0.0;
+		GPOS_RTL_ASSERT(columnar_buckets->FMapPoint(point.Value(), &value));
+		const ULONG bucket_index = columnar_buckets->LookupPoint(value);
+		for (ULONG ul = 0; ul < buckets->Size(); ul++)
+		{
+			GPOS_RTL_ASSERT((ul < bucket_index) ==
+							(*buckets)[ul]->IsAfter(point.Value()));
+		}
+
+		// filters on a histogram used once, hence without columnar buckets,
+		// and on one used repeatedly agree
+		for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgcmptype); ul++)
+		{
+			CAutoRef<CHistogram> histogram_once(histogram->CopyHistogram());
+			CAutoRef<CHistogram> filtered_once(
+				histogram_once->MakeHistogramFilter(rgcmptype[ul],
+													point.Value()));
+			CAutoRef<CHistogram> filtered(
+				histogram->MakeHistogramFilter(rgcmptype[ul], point.Value()));
+
+			GPOS_RTL_ASSERT(filtered_once->GetNumBuckets() ==
+							filtered->GetNumBuckets());
+			GPOS_RTL_ASSERT(filtered_once->GetFrequency() ==
+							filtered->GetFrequency());
+			GPOS_RTL_ASSERT(filtered_once->GetNumDistinct() ==
+							filtered->GetNumDistinct());
+		}
+	}
+	GPOS_DELETE(columnar_buckets);
+
+	// equality joins with and without columnar buckets agree
+	CAutoRef<CHistogram> histogram_sparse(
+		CCardinalityTestUtils::PhistInt4Remain(mp, 3 /*num_of_buckets*/,
+											   10 /*dNDVPerBucket*/,
+											   false /*fNullFreq*/,
+											   0 /*num_NDV_remain*/));
+	CAutoRef<CHistogram> histogram_once(histogram->CopyHistogram());
+	CAutoRef<CHistogram> joined_once(histogram_once->MakeJoinHistogram(
+		CStatsPred::EstatscmptEq, histogram_sparse.Value()));
+	CAutoRef<CHistogram> joined(histogram->MakeJoinHistogram(
+		CStatsPred::EstatscmptEq, histogram_sparse.Value()));
+	GPOS_RTL_ASSERT(joined_once->GetNumBuckets() == joined->GetNumBuckets());
+	GPOS_RTL_ASSERT(joined_once->GetFrequency() == joined->GetFrequency());
+
+	// overlapping buckets do not allow columnar buckets
+	CBucketArray *overlapping_buckets = GPOS_NEW(mp) CBucketArray(mp);
+	overlapping_buckets->Append(CCardinalityTestUtils::PbucketInteger(
+		mp, 0, 10, true /*is_lower_closed*/, false /*is_upper_closed*/, 0.5,
+		5.0));
+	overlapping_buckets->Append(CCardinalityTestUtils::PbucketInteger(
+		mp, 5, 15, true /*is_lower_closed*/, false /*is_upper_closed*/, 0.5,
+		5.0));
+	GPOS_RTL_ASSERT(nullptr ==
+					CColumnarBuckets::PcbCreate(mp, overlapping_buckets));
+	overlapping_buckets->Release();
+
+	return GPOS_OK;
+}
+
 // EOF
@@ -173,7 +173,7 @@ CJoinCardinalityTest::EresUnittest_JoinNDVRemain()
 			eres = GPOS_FAILED;
 		}
 
-		GPOS_DELETE(join_histogram);
+		join_histogram->Release();
 	}
 	// clean up
 	col_histogram_mapping->Release();
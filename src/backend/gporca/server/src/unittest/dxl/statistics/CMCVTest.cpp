@@ -270,8 +270,8 @@ CMCVTest::EresUnittest_MergeHistMCV()
 		GPOS_DELETE(pstrOutput);
 		pdrgpdxlstatsderrelMCV->Release();
 		pdrgpdxlstatsderrelHist->Release();
-		GPOS_DELETE(phistMCV);
-		GPOS_DELETE(phistHist);
+		phistMCV->Release();
+		phistHist->Release();
 		pdrgpstats->Release();
 
 		if (GPOS_OK != eres)
@@ -32,6 +32,7 @@
 #include "naucrates/md/CMDTypeGenericGPDB.h"
 #include "naucrates/md/IMDType.h"
 #include "naucrates/statistics/CBucket.h"
+#include "naucrates/statistics/CExtendedStats.h"
 #include "naucrates/statistics/CFilterStatsProcessor.h"
 #include "naucrates/statistics/CGroupByStatsProcessor.h"
 #include "naucrates/statistics/CHistogram.h"
@@ -58,6 +59,9 @@ CStatisticsTest::EresUnittest()
 	CUnittest rgutSharedOptCtxt[] = {
 		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_CStatisticsBasic),
 		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_UnionAll),
+		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_SharedHistograms),
+		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_ExtendedStats),
+		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_ExtendedStatsMCV),
 		// TODO,  Mar 18 2013 temporarily disabling the test
 		// GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_CStatisticsSelectDerivation),
 	};
@@ -368,6 +372,251 @@ CStatisticsTest::EresUnittest_CStatisticsBucketTest()
 	return eres;
 }
 
+// copies of statistics share the histograms of their columns, and only
+// copy a histogram to modify it
+GPOS_RESULT
+CStatisticsTest::EresUnittest_SharedHistograms()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG colid_bool = 1;
+	const ULONG colid_int4 = 2;
+
+	UlongToHistogramMap *col_histogram_mapping =
+		GPOS_NEW(mp) UlongToHistogramMap(mp);
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(colid_bool),
+								  CCardinalityTestUtils::PhistExampleBool(mp));
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(colid_int4),
+								  CCardinalityTestUtils::PhistExampleInt4(mp));
+
+	UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid_bool),
+								GPOS_NEW(mp) CDouble(1.0));
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid_int4),
+								GPOS_NEW(mp) CDouble(4.0));
+
+	CStatistics *stats =
+		GPOS_NEW(mp) CStatistics(mp, col_histogram_mapping, colid_width_mapping,
+								 1000.0 /* rows */, false /* is_empty */);
+	const CHistogram *histogram_int4 = stats->GetHistogram(colid_int4);
+	const CDouble num_distinct = histogram_int4->GetNumDistinct();
+
+	GPOS_RESULT eres = GPOS_OK;
+
+	// a copy of the statistics shares all histograms
+	CStatistics *stats_copy = CStatistics::CastStats(stats->CopyStats(mp));
+	if (stats_copy->GetHistogram(colid_bool) !=
+			stats->GetHistogram(colid_bool) ||
+		stats_copy->GetHistogram(colid_int4) != histogram_int4)
+	{
+		eres = GPOS_FAILED;
+	}
+
+	// capping the NDVs of shared histograms leaves the originals untouched
+	UlongToHistogramMap *histograms = stats->CopyHistograms(mp);
+	CStatistics::CapNDVs(CDouble(2.0), histograms);
+	const CHistogram *histogram_capped = histograms->Find(&colid_int4);
+	if (histogram_capped == histogram_int4 ||
+		!histogram_capped->WereNDVsScaled() ||
+		histogram_int4->WereNDVsScaled() ||
+		histogram_int4->GetNumDistinct() != num_distinct)
+	{
+		eres = GPOS_FAILED;
+	}
+
+	histograms->Release();
+	stats_copy->Release();
+	stats->Release();
+
+	return eres;
+}
+
+// extended statistics give the number of distinct values of column groups,
+// and make equality filters on dependent columns as selective as on the
+// columns they depend on
+GPOS_RESULT
+CStatisticsTest::EresUnittest_ExtendedStats()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG colid1 = 1;
+	const ULONG colid2 = 2;
+
+	UlongToHistogramMap *col_histogram_mapping =
+		GPOS_NEW(mp) UlongToHistogramMap(mp);
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(colid1),
+								  CCardinalityTestUtils::PhistExampleInt4(mp));
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(colid2),
+								  CCardinalityTestUtils::PhistExampleInt4(mp));
+
+	UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid1),
+								GPOS_NEW(mp) CDouble(4.0));
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid2),
+								GPOS_NEW(mp) CDouble(4.0));
+
+	CStatistics *stats =
+		GPOS_NEW(mp) CStatistics(mp, col_histogram_mapping, colid_width_mapping,
+								 1000.0 /* rows */, false /* is_empty */);
+
+	// the first column determines the second
+	CBitSet *colids = GPOS_NEW(mp) CBitSet(mp);
+	(void) colids->ExchangeSet(colid1);
+	(void) colids->ExchangeSet(colid2);
+	CBitSet *from_colids = GPOS_NEW(mp) CBitSet(mp);
+	(void) from_colids->ExchangeSet(colid1);
+
+	const CDouble ndistinct(40.0);
+	CExtendedStats *ext_stats = GPOS_NEW(mp) CExtendedStats(mp);
+	ext_stats->AddNDistinct(colids, ndistinct);
+	ext_stats->AddDependency(from_colids, colid2, CDouble(1.0));
+	stats->AddExtendedStats(ext_stats);
+
+	// grouping on both columns takes their combined number of distinct values
+	CBitSet *grouping_colids = GPOS_NEW(mp) CBitSet(mp);
+	(void) grouping_colids->ExchangeSet(colid1);
+	(void) grouping_colids->ExchangeSet(colid2);
+	const CExtendedStats::SNDistinct *found_ndistinct =
+		CExtendedStats::FindNDistinct(stats->GetExtendedStats(),
+									  grouping_colids);
+	BOOL fGroupsMatch = nullptr != found_ndistinct &&
+						found_ndistinct->m_ndistinct == ndistinct;
+	grouping_colids->Release();
+
+	// an equality filter on both columns is as selective as one on the first
+	CStatsPredPtrArry *pdrgpstatspred = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+	pdrgpstatspred->Append(GPOS_NEW(mp) CStatsPredPoint(
+		colid1, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4(mp, 5)));
+	pdrgpstatspred->Append(GPOS_NEW(mp) CStatsPredPoint(
+		colid2, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4(mp, 5)));
+	CStatsPredConj *pred_conj = GPOS_NEW(mp) CStatsPredConj(pdrgpstatspred);
+
+	CStatsPredPtrArry *pdrgpstatspredFirst = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+	pdrgpstatspredFirst->Append(GPOS_NEW(mp) CStatsPredPoint(
+		colid1, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4(mp, 5)));
+	CStatsPredConj *pred_conj_first =
+		GPOS_NEW(mp) CStatsPredConj(pdrgpstatspredFirst);
+
+	CStatistics *filter_stats = CFilterStatsProcessor::MakeStatsFilter(
+		mp, stats, pred_conj, true /* do_cap_NDVs */);
+	CStatistics *filter_stats_first = CFilterStatsProcessor::MakeStatsFilter(
+		mp, stats, pred_conj_first, true /* do_cap_NDVs */);
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << std::endl << "Filter on both columns:" << std::endl;
+		filter_stats->OsPrint(at.Os());
+	}
+
+	BOOL fRowsMatch = filter_stats->Rows() == filter_stats_first->Rows();
+
+	filter_stats->Release();
+	filter_stats_first->Release();
+	pred_conj->Release();
+	pred_conj_first->Release();
+	stats->Release();
+
+	if (fGroupsMatch && fRowsMatch)
+	{
+		return GPOS_OK;
+	}
+
+	return GPOS_FAILED;
+}
+
+// the most common combinations of values of two columns give the rows of an
+// equality filter on both columns that matches one of them
+GPOS_RESULT
+CStatisticsTest::EresUnittest_ExtendedStatsMCV()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG colid1 = 1;
+	const ULONG colid2 = 2;
+
+	UlongToHistogramMap *col_histogram_mapping =
+		GPOS_NEW(mp) UlongToHistogramMap(mp);
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(colid1),
+								  CCardinalityTestUtils::PhistExampleInt4(mp));
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(colid2),
+								  CCardinalityTestUtils::PhistExampleInt4(mp));
+
+	UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid1),
+								GPOS_NEW(mp) CDouble(4.0));
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid2),
+								GPOS_NEW(mp) CDouble(4.0));
+
+	CStatistics *stats =
+		GPOS_NEW(mp) CStatistics(mp, col_histogram_mapping, colid_width_mapping,
+								 1000.0 /* rows */, false /* is_empty */);
+
+	// the columns always have the same value; 30% of the rows are (5, 5)
+	// and 20% are (15, 15), where the histograms give 2.5% of the rows to
+	// each value of each column
+	const INT mcv_values[] = {5, 15};
+	const DOUBLE mcv_freqs[] = {0.3, 0.2};
+	CExtendedStats::SMCVItemArray *items =
+		GPOS_NEW(mp) CExtendedStats::SMCVItemArray(mp);
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(mcv_values); ul++)
+	{
+		IDatumArray *values = GPOS_NEW(mp) IDatumArray(mp);
+		for (ULONG ulCol = 0; ulCol < 2; ulCol++)
+		{
+			CPoint *point = CTestUtils::PpointInt4(mp, mcv_values[ul]);
+			point->GetDatum()->AddRef();
+			values->Append(point->GetDatum());
+			point->Release();
+		}
+		items->Append(GPOS_NEW(mp) CExtendedStats::SMCVItem(
+			values, CDouble(mcv_freqs[ul]), CDouble(0.025 * 0.025)));
+	}
+
+	ULongPtrArray *colids = GPOS_NEW(mp) ULongPtrArray(mp);
+	colids->Append(GPOS_NEW(mp) ULONG(colid1));
+	colids->Append(GPOS_NEW(mp) ULONG(colid2));
+
+	CExtendedStats *ext_stats = GPOS_NEW(mp) CExtendedStats(mp);
+	ext_stats->AddMCVList(colids, items);
+	stats->AddExtendedStats(ext_stats);
+
+	// an equality filter on both columns that matches the first combination
+	// keeps its rows, and none of the rows of the other combinations
+	CStatsPredPtrArry *pdrgpstatspred = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+	pdrgpstatspred->Append(GPOS_NEW(mp) CStatsPredPoint(
+		colid1, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4(mp, 5)));
+	pdrgpstatspred->Append(GPOS_NEW(mp) CStatsPredPoint(
+		colid2, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4(mp, 5)));
+	CStatsPredConj *pred_conj = GPOS_NEW(mp) CStatsPredConj(pdrgpstatspred);
+
+	CStatistics *filter_stats = CFilterStatsProcessor::MakeStatsFilter(
+		mp, stats, pred_conj, true /* do_cap_NDVs */);
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << std::endl << "Filter on both columns:" << std::endl;
+		filter_stats->OsPrint(at.Os());
+	}
+
+	CDouble diff = filter_stats->Rows() - CDouble(300.0);
+	BOOL fRowsMatch = diff.Absolute() < CDouble(0.001);
+
+	filter_stats->Release();
+	pred_conj->Release();
+	stats->Release();
+
+	if (fRowsMatch)
+	{
+		return GPOS_OK;
+	}
+
+	return GPOS_FAILED;
+}
+
 // basic statistics test
 GPOS_RESULT
 CStatisticsTest::EresUnittest_CStatisticsBasic()
@@ -23,6 +23,7 @@
 #include "gpopt/base/CUtils.h"
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
 #include "naucrates/base/CDatumInt8GPDB.h"
 #include "naucrates/md/CMDIdGPDB.h"
 #include "naucrates/md/IMDScalarOp.h"
@@ -83,6 +84,7 @@ CConstraintTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(
 			EresUnittest_CConstraintIntervalFromArrayExprIncludesNull),
 		GPOS_UNITTEST_FUNC(CConstraintTest::EresUnittest_CInterval),
+		GPOS_UNITTEST_FUNC(CConstraintTest::EresUnittest_CIntervalManyPoints),
 		GPOS_UNITTEST_FUNC(
 			CConstraintTest::EresUnittest_CIntervalFromScalarExpr),
 		GPOS_UNITTEST_FUNC(CConstraintTest::EresUnittest_CConjunction),
@@ -96,12 +98,15 @@ CConstraintTest::EresUnittest()
 			CConstraintTest::EresUnittest_CConstraintIntervalPexpr),
 		GPOS_UNITTEST_FUNC(
 			CConstraintTest::EresUnittest_CConstraintIntervalFromArrayExpr),
+		GPOS_UNITTEST_FUNC(
+			CConstraintTest::EresUnittest_CConstraintFromLargeArrayExpr),
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC_THROW(CConstraintTest::EresUnittest_NegativeTests,
 								 gpos::CException::ExmaSystem,
 								 gpos::CException::ExmiAssert),
 #endif	// GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(CConstraintTest::EresUnittest_ConstraintsOnDates),
+		GPOS_UNITTEST_FUNC(CConstraintTest::EresUnittest_NativeTextComparisons),
 	};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -201,6 +206,81 @@ CConstraintTest::EresUnittest_CInterval()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintTest::EresUnittest_CIntervalManyPoints
+//
+//	@doc:
+//		Intersection and containment of an interval with many points, like
+//		one derived from a large IN list, and an interval with few ranges
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CConstraintTest::EresUnittest_CIntervalManyPoints()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, nullptr, CTestUtils::GetCostModel(mp));
+
+	IMDTypeInt8 *pmdtypeint8 =
+		(IMDTypeInt8 *) mda.PtMDType<IMDTypeInt8>(CTestUtils::m_sysidDefault);
+	IMDId *mdid = pmdtypeint8->MDId();
+
+	CExpression *pexprGet = CTestUtils::PexprLogicalGet(mp);
+	CColRef *colref = pexprGet->DeriveOutputColumns()->PcrAny();
+
+	// points 0, 2, 4, ..., 1998
+	const ULONG ulPoints = 1000;
+	SRangeInfo *rgPoints = GPOS_NEW_ARRAY(mp, SRangeInfo, ulPoints);
+	for (ULONG ul = 0; ul < ulPoints; ul++)
+	{
+		rgPoints[ul] = {CRange::EriIncluded, (INT)(2 * ul), CRange::EriIncluded,
+						(INT)(2 * ul)};
+	}
+	CConstraintInterval *pciPoints = GPOS_NEW(mp) CConstraintInterval(
+		mp, colref, Pdrgprng(mp, mdid, rgPoints, ulPoints), false /*is_null*/);
+	GPOS_DELETE_ARRAY(rgPoints);
+
+	// [100, 200) and [1990, 3000)
+	const SRangeInfo rgRanges[] = {
+		{CRange::EriIncluded, 100, CRange::EriExcluded, 200},
+		{CRange::EriIncluded, 1990, CRange::EriExcluded, 3000},
+	};
+	CConstraintInterval *pciRanges = GPOS_NEW(mp) CConstraintInterval(
+		mp, colref, Pdrgprng(mp, mdid, rgRanges, GPOS_ARRAY_SIZE(rgRanges)),
+		false /*is_null*/);
+
+	// the points in the ranges are shared with the interval of points
+	CConstraintInterval *pciIntersect = pciPoints->PciIntersect(mp, pciRanges);
+	CConstraintInterval *pciIntersectReversed =
+		pciRanges->PciIntersect(mp, pciPoints);
+	GPOS_RTL_ASSERT(55 == pciIntersect->Pdrgprng()->Size());
+	GPOS_RTL_ASSERT(pciIntersect->Equals(pciIntersectReversed));
+	GPOS_RTL_ASSERT((*pciPoints->Pdrgprng())[50] ==
+					(*pciIntersect->Pdrgprng())[0]);
+
+	// containment
+	GPOS_RTL_ASSERT(pciPoints->FContainsInterval(mp, pciIntersect));
+	GPOS_RTL_ASSERT(pciRanges->FContainsInterval(mp, pciIntersect));
+	GPOS_RTL_ASSERT(!pciPoints->FContainsInterval(mp, pciRanges));
+	GPOS_RTL_ASSERT(!pciIntersect->FContainsInterval(mp, pciPoints));
+
+	pciIntersectReversed->Release();
+	pciIntersect->Release();
+	pciRanges->Release();
+	pciPoints->Release();
+	pexprGet->Release();
+
+	return GPOS_OK;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintTest::EresUnittest_CConjunction
@@ -927,6 +1007,91 @@ CConstraintTest::EresUnittest_CConstraintIntervalFromArrayExpr()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintTest::EresUnittest_CConstraintFromLargeArrayExpr
+//
+//	@doc:
+//		Constraints from IN and NOT IN lists longer than the array expansion
+//		threshold, without array constraints
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CConstraintTest::EresUnittest_CConstraintFromLargeArrayExpr()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// lists of more than 3 elements are not expanded
+	CHint *phint = GPOS_NEW(mp) CHint(
+		gpos::int_max, /* min_num_of_parts_to_require_sort_on_insert */
+		gpos::int_max, /* join_arity_for_associativity_commutativity */
+		3,			   /* array_expansion_threshold */
+		JOIN_ORDER_DP_THRESHOLD, BROADCAST_THRESHOLD,
+		true, /* enforce_constraint_on_dml */
+		PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD);
+	COptimizerConfig *optimizer_config = GPOS_NEW(mp) COptimizerConfig(
+		GPOS_NEW(mp) CEnumeratorConfig(mp, 0 /*plan_id*/, 0 /*ullSamples*/),
+		CStatisticsConfig::PstatsconfDefault(mp),
+		CCTEConfig::PcteconfDefault(mp), CTestUtils::GetCostModel(mp), phint,
+		CWindowOids::GetWindowOids(mp));
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, nullptr, optimizer_config);
+
+	CAutoTraceFlag atf(EopttraceArrayConstraints, false);
+
+	IntPtrArray *pdrgpi = GPOS_NEW(mp) IntPtrArray(mp);
+	INT rgiVals[] = {5, 1, 2, 5, 3, 4};
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgiVals); ul++)
+	{
+		pdrgpi->Append(GPOS_NEW(mp) INT(rgiVals[ul]));
+	}
+
+	// an IN list becomes one point range per distinct element
+	CExpression *pexprIn = CTestUtils::PexprLogicalSelectArrayCmp(
+		mp, CScalarArrayCmp::EarrcmpAny, IMDType::EcmptEq, pdrgpi);
+	CColRefSetArray *pdrgpcrs = nullptr;
+	CConstraint *pcnstrIn =
+		CConstraint::PcnstrFromScalarExpr(mp, (*pexprIn)[1], &pdrgpcrs);
+	GPOS_RTL_ASSERT(nullptr != pcnstrIn);
+	GPOS_RTL_ASSERT(CConstraint::EctInterval == pcnstrIn->Ect());
+	CConstraintInterval *pciIn = dynamic_cast<CConstraintInterval *>(pcnstrIn);
+	GPOS_RTL_ASSERT(5 == pciIn->Pdrgprng()->Size());
+	CRefCount::SafeRelease(pdrgpcrs);
+
+	// a NOT IN list becomes the ranges between the distinct elements
+	CExpression *pexprNotIn = CTestUtils::PexprLogicalSelectArrayCmp(
+		mp, CScalarArrayCmp::EarrcmpAll, IMDType::EcmptNEq, pdrgpi);
+	pdrgpcrs = nullptr;
+	CConstraint *pcnstrNotIn =
+		CConstraint::PcnstrFromScalarExpr(mp, (*pexprNotIn)[1], &pdrgpcrs);
+	GPOS_RTL_ASSERT(nullptr != pcnstrNotIn);
+	GPOS_RTL_ASSERT(CConstraint::EctInterval == pcnstrNotIn->Ect());
+	CConstraintInterval *pciNotIn =
+		dynamic_cast<CConstraintInterval *>(pcnstrNotIn);
+	GPOS_RTL_ASSERT(6 == pciNotIn->Pdrgprng()->Size());
+	CRefCount::SafeRelease(pdrgpcrs);
+
+	// the IN and NOT IN lists of the same elements exclude each other
+	CConstraintInterval *pciIntersect = pciIn->PciIntersect(mp, pciNotIn);
+	GPOS_RTL_ASSERT(pciIntersect->FContradiction());
+
+	pciIntersect->Release();
+	pcnstrNotIn->Release();
+	pcnstrIn->Release();
+	pexprNotIn->Release();
+	pexprIn->Release();
+	pdrgpi->Release();
+
+	return GPOS_OK;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintTest::EresUnittest_CConstraintIntervalFromArrayExprIncludesNull
@@ -1460,4 +1625,83 @@ CConstraintTest::EresUnittest_ConstraintsOnDates()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintTest::EresUnittest_NativeTextComparisons
+//
+//	@doc:
+//		Text data are compared by the comparator itself; the evaluator used
+//		here only supports dates, so any comparison reaching it fails
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CConstraintTest::EresUnittest_NativeTextComparisons()
+{
+	CAutoTraceFlag atf(EopttraceEnableConstantExpressionEvaluation,
+					   true /*value*/);
+	CAutoTraceFlag atfCollation(EopttraceDefaultCollationIsC, true /*value*/);
+
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	CConstExprEvaluatorForDates *pceeval =
+		GPOS_NEW(mp) CConstExprEvaluatorForDates(mp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, pceeval, CTestUtils::GetCostModel(mp));
+	const IComparator *pcomp GPOS_ASSERTS_ONLY =
+		COptCtxt::PoctxtFromTLS()->Pcomp();
+
+	// 'abc' with a 4-byte and with a 1-byte header, 'abd' and 'ab'
+	CWStringDynamic strAbc(mp, GPOS_WSZ_LIT("HAAAAGFiYw=="));
+	CWStringDynamic strAbcShort(mp, GPOS_WSZ_LIT("CWFiYw=="));
+	CWStringDynamic strAbd(mp, GPOS_WSZ_LIT("HAAAAGFiZA=="));
+	CWStringDynamic strAb(mp, GPOS_WSZ_LIT("GAAAAGFi"));
+
+	// 'ab  ' with trailing blanks
+	CWStringDynamic strAbBlanks(mp, GPOS_WSZ_LIT("IAAAAGFiICA="));
+
+	IDatum *pdatumAbc = CTestUtils::CreateGenericDatum(
+		mp, &mda, GPOS_NEW(mp) CMDIdGPDB(CMDIdGPDB::m_mdid_text), &strAbc, 0);
+	IDatum *pdatumAbcShort = CTestUtils::CreateGenericDatum(
+		mp, &mda, GPOS_NEW(mp) CMDIdGPDB(CMDIdGPDB::m_mdid_text),
+		&strAbcShort, 0);
+	IDatum *pdatumAbd = CTestUtils::CreateGenericDatum(
+		mp, &mda, GPOS_NEW(mp) CMDIdGPDB(CMDIdGPDB::m_mdid_text), &strAbd, 0);
+	IDatum *pdatumAb = CTestUtils::CreateGenericDatum(
+		mp, &mda, GPOS_NEW(mp) CMDIdGPDB(CMDIdGPDB::m_mdid_text), &strAb, 0);
+	IDatum *pdatumBpAb = CTestUtils::CreateGenericDatum(
+		mp, &mda, GPOS_NEW(mp) CMDIdGPDB(CMDIdGPDB::m_mdid_bpchar), &strAb, 0);
+	IDatum *pdatumBpAbBlanks = CTestUtils::CreateGenericDatum(
+		mp, &mda, GPOS_NEW(mp) CMDIdGPDB(CMDIdGPDB::m_mdid_bpchar),
+		&strAbBlanks, 0);
+
+	// text data compare by their contents, whatever their headers
+	GPOS_ASSERT(pcomp->Equals(pdatumAbc, pdatumAbcShort));
+	GPOS_ASSERT(!pcomp->Equals(pdatumAbc, pdatumAbd));
+	GPOS_ASSERT(pcomp->IsLessThan(pdatumAbcShort, pdatumAbd));
+	GPOS_ASSERT(pcomp->IsLessThan(pdatumAb, pdatumAbc));
+	GPOS_ASSERT(pcomp->IsGreaterThanOrEqual(pdatumAbc, pdatumAbcShort));
+	GPOS_ASSERT(!pcomp->IsGreaterThan(pdatumAb, pdatumAbd));
+
+	// trailing blanks of bpchar data are insignificant
+	GPOS_ASSERT(pcomp->Equals(pdatumBpAb, pdatumBpAbBlanks));
+	GPOS_ASSERT(!pcomp->IsLessThan(pdatumBpAb, pdatumBpAbBlanks));
+
+	pdatumBpAbBlanks->Release();
+	pdatumBpAb->Release();
+	pdatumAb->Release();
+	pdatumAbd->Release();
+	pdatumAbcShort->Release();
+	pdatumAbc->Release();
+
+	return GPOS_OK;
+}
+
 // EOF
@@ -208,7 +208,7 @@ CRangeTest::EresUnittest_CRangeFromScalar()
 
 	CConstExprEvaluatorDefault *pceeval =
 		GPOS_NEW(mp) CConstExprEvaluatorDefault();
-	CDefaultComparator comp(pceeval);
+	CDefaultComparator comp(mp, pceeval);
 	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgecmpt); ul++)
 	{
 		pdatumint4->AddRef();
@@ -238,7 +238,7 @@ CRangeTest::EresInitAndCheckRanges(CMemoryPool *mp, IMDId *mdid, PfPdatum pf)
 {
 	CConstExprEvaluatorDefault *pceeval =
 		GPOS_NEW(mp) CConstExprEvaluatorDefault();
-	CDefaultComparator comp(pceeval);
+	CDefaultComparator comp(mp, pceeval);
 
 	// generate ranges
 	mdid->AddRef();
@@ -6,24 +6,122 @@
 //		CJoinOrderDPTest.cpp
 //
 //	@doc:
-//		Testing guc for disabling dynamic join order algorithm
+//		Testing guc for disabling dynamic join order algorithm, and the
+//		join predicates produced by dynamic programming
 //---------------------------------------------------------------------------
 #include "unittest/gpopt/minidump/CJoinOrderDPTest.h"
 
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/test/CUnittest.h"
+
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/xforms/CJoinOrderDPv2.h"
+
 #include "unittest/gpopt/CTestUtils.h"
 
+//---------------------------------------------------------------------------
+//	@function:
+//		FHasJoinGraphPreds
+//
+//	@doc:
+//		Check that every inner join in the given join order has the
+//		predicate of the join graph that connects its children: the given
+//		conjuncts, in their order, that reference both children and are
+//		covered by them, or a true constant for a cross product
+//
+//---------------------------------------------------------------------------
+static BOOL
+FHasJoinGraphPreds(CMemoryPool *mp, CExpression *pexpr,
+				   CExpressionArray *pdrgpexprConjuncts)
+{
+	if (!pexpr->Pop()->FLogical())
+	{
+		return true;
+	}
+
+	for (ULONG ul = 0; ul < pexpr->Arity(); ul++)
+	{
+		if (!FHasJoinGraphPreds(mp, (*pexpr)[ul], pdrgpexprConjuncts))
+		{
+			return false;
+		}
+	}
+
+	if (COperator::EopLogicalInnerJoin != pexpr->Pop()->Eopid())
+	{
+		return true;
+	}
+
+	CColRefSet *pcrsLeft = (*pexpr)[0]->DeriveOutputColumns();
+	CColRefSet *pcrsRight = (*pexpr)[1]->DeriveOutputColumns();
+	CColRefSet *pcrsJoin = GPOS_NEW(mp) CColRefSet(mp, *pcrsLeft);
+	pcrsJoin->Include(pcrsRight);
+
+	CExpressionArray *pdrgpexprExpected = GPOS_NEW(mp) CExpressionArray(mp);
+	for (ULONG ul = 0; ul < pdrgpexprConjuncts->Size(); ul++)
+	{
+		CExpression *pexprConj = (*pdrgpexprConjuncts)[ul];
+		CColRefSet *pcrsUsed = pexprConj->DeriveUsedColumns();
+		if (!pcrsLeft->IsDisjoint(pcrsUsed) &&
+			!pcrsRight->IsDisjoint(pcrsUsed) && pcrsJoin->ContainsAll(pcrsUsed))
+		{
+			pexprConj->AddRef();
+			pdrgpexprExpected->Append(pexprConj);
+		}
+	}
+	pcrsJoin->Release();
 
+	CExpression *pexprPred = (*pexpr)[2];
+	BOOL fMatch = true;
+	if (0 == pdrgpexprExpected->Size())
+	{
+		fMatch = CUtils::FScalarConstTrue(pexprPred);
+	}
+	else
+	{
+		CExpressionArray *pdrgpexprActual =
+			CPredicateUtils::PdrgpexprConjuncts(mp, pexprPred);
+		fMatch = pdrgpexprActual->Size() == pdrgpexprExpected->Size();
+		for (ULONG ul = 0; fMatch && ul < pdrgpexprActual->Size(); ul++)
+		{
+			fMatch = (*pdrgpexprActual)[ul]->Matches((*pdrgpexprExpected)[ul]);
+		}
+		pdrgpexprActual->Release();
+	}
+	pdrgpexprExpected->Release();
+
+	return fMatch;
+}
 
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrderDPTest::EresUnittest
 //
 //	@doc:
-//		Unittest for testing guc for disabling dynamic join order algorithm
+//		Unittest for dynamic join order algorithms
 //
 //---------------------------------------------------------------------------
 gpos::GPOS_RESULT
 CJoinOrderDPTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(EresUnittest_RunTests),
+		GPOS_UNITTEST_FUNC(EresUnittest_DPv2SnowflakeJoinPreds)};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPTest::EresUnittest_RunTests
+//
+//	@doc:
+//		Unittest for testing guc for disabling dynamic join order algorithm
+//
+//---------------------------------------------------------------------------
+gpos::GPOS_RESULT
+CJoinOrderDPTest::EresUnittest_RunTests()
 {
 	ULONG ulTestCounter = 0;
 	const CHAR *rgszFileNames[] = {
@@ -35,4 +133,119 @@ CJoinOrderDPTest::EresUnittest()
 		rgszFileNames, &ulTestCounter, GPOS_ARRAY_SIZE(rgszFileNames), true,
 		true);
 }
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPTest::EresUnittest_DPv2SnowflakeJoinPreds
+//
+//	@doc:
+//		Expand a 15-way snowflake join with DPv2, the algorithm behind
+//		optimizer_join_order = exhaustive2, and check that each join of the
+//		top join orders has the predicate the full join graph gives for
+//		its children. DPv2 only looks at the edges both children reference,
+//		which must not change the predicates, and thus the plans.
+//
+//---------------------------------------------------------------------------
+gpos::GPOS_RESULT
+CJoinOrderDPTest::EresUnittest_DPv2SnowflakeJoinPreds()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// array of relation names
+	CWStringConst rgscRel[] = {
+		GPOS_WSZ_LIT("Rel10"), GPOS_WSZ_LIT("Rel3"),  GPOS_WSZ_LIT("Rel4"),
+		GPOS_WSZ_LIT("Rel6"),  GPOS_WSZ_LIT("Rel7"),  GPOS_WSZ_LIT("Rel8"),
+		GPOS_WSZ_LIT("Rel12"), GPOS_WSZ_LIT("Rel13"), GPOS_WSZ_LIT("Rel5"),
+		GPOS_WSZ_LIT("Rel14"), GPOS_WSZ_LIT("Rel15"), GPOS_WSZ_LIT("Rel1"),
+		GPOS_WSZ_LIT("Rel11"), GPOS_WSZ_LIT("Rel2"),  GPOS_WSZ_LIT("Rel9"),
+	};
+
+	// array of relation IDs
+	ULONG rgulRel[] = {
+		GPOPT_TEST_REL_OID10, GPOPT_TEST_REL_OID3,	GPOPT_TEST_REL_OID4,
+		GPOPT_TEST_REL_OID6,  GPOPT_TEST_REL_OID7,	GPOPT_TEST_REL_OID8,
+		GPOPT_TEST_REL_OID12, GPOPT_TEST_REL_OID13, GPOPT_TEST_REL_OID5,
+		GPOPT_TEST_REL_OID14, GPOPT_TEST_REL_OID15, GPOPT_TEST_REL_OID1,
+		GPOPT_TEST_REL_OID11, GPOPT_TEST_REL_OID2,	GPOPT_TEST_REL_OID9,
+	};
+
+	const ULONG ulRels = GPOS_ARRAY_SIZE(rgscRel);
+	GPOS_ASSERT(GPOS_ARRAY_SIZE(rgulRel) == ulRels);
+
+	// the last relations hang off the first dimensions of the star
+	const ULONG ulOuterDims = 3;
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache());
+	mda.RegisterProvider(CTestUtils::m_sysidDefault, pmdp);
+
+	GPOS_RESULT eres = GPOS_OK;
+	{
+		// install opt context in TLS
+		CAutoOptCtxt aoc(mp, &mda, nullptr, /* pceeval */
+						 CTestUtils::GetCostModel(mp));
+
+		CExpressionArray *pdrgpexprAtoms = GPOS_NEW(mp) CExpressionArray(mp);
+		for (ULONG ul = 0; ul < ulRels; ul++)
+		{
+			pdrgpexprAtoms->Append(CTestUtils::PexprLogicalGet(
+				mp, &rgscRel[ul], &rgscRel[ul], rgulRel[ul]));
+		}
+
+		// the first relation is the fact table, joined to every dimension
+		CExpressionArray *pdrgpexprConjuncts =
+			GPOS_NEW(mp) CExpressionArray(mp);
+		CColRef *pcrFact = (*pdrgpexprAtoms)[0]->DeriveOutputColumns()->PcrAny();
+		for (ULONG ul = 1; ul < ulRels; ul++)
+		{
+			CColRef *pcrLeft = pcrFact;
+			if (ulRels - ulOuterDims <= ul)
+			{
+				pcrLeft = (*pdrgpexprAtoms)[ul - (ulRels - ulOuterDims) + 1]
+							  ->DeriveOutputColumns()
+							  ->PcrAny();
+			}
+			CColRef *pcrRight =
+				(*pdrgpexprAtoms)[ul]->DeriveOutputColumns()->PcrAny();
+			pdrgpexprConjuncts->Append(
+				CUtils::PexprScalarEqCmp(mp, pcrLeft, pcrRight));
+		}
+
+		pdrgpexprConjuncts->AddRef();
+		CJoinOrderDPv2 jodp(mp, pdrgpexprAtoms, pdrgpexprConjuncts,
+							GPOS_NEW(mp) CExpressionArray(mp),
+							nullptr /*childPredIndexes*/,
+							GPOS_NEW(mp) CColRefSet(mp) /*outerRefs*/);
+		jodp.PexprExpand();
+
+		ULONG ulJoinOrders = 0;
+		CExpression *pexprJoinOrder = nullptr;
+		while (nullptr != (pexprJoinOrder = jodp.GetNextOfTopK()))
+		{
+			if (!FHasJoinGraphPreds(mp, pexprJoinOrder, pdrgpexprConjuncts))
+			{
+				CAutoTrace at(mp);
+				at.Os() << std::endl
+						<< "UNEXPECTED JOIN PREDICATES:" << std::endl
+						<< *pexprJoinOrder << std::endl;
+				eres = GPOS_FAILED;
+			}
+			pexprJoinOrder->Release();
+			ulJoinOrders++;
+		}
+
+		if (0 == ulJoinOrders)
+		{
+			eres = GPOS_FAILED;
+		}
+
+		pdrgpexprConjuncts->Release();
+	}
+
+	return eres;
+}
+
 // EOF
@@ -22,6 +22,7 @@
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/mdcache/CAutoMDAccessor.h"
 #include "gpopt/operators/CExpressionUtils.h"
+#include "gpopt/operators/CLogicalCTEAnchor.h"
 #include "gpopt/operators/CLogicalInnerJoin.h"
 #include "gpopt/operators/CLogicalLeftOuterJoin.h"
 #include "gpopt/operators/CLogicalNAryJoin.h"
@@ -67,7 +68,10 @@ CExpressionPreprocessorTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(EresUnittest_PreProcessConvert2InPredicate),
 		GPOS_UNITTEST_FUNC(EresUnittest_PreProcessConvertArrayWithEquals),
 		GPOS_UNITTEST_FUNC(
-			EresUnittest_PreProcessConvert2InPredicateDeepExpressionTree)};
+			EresUnittest_PreProcessConvert2InPredicateDeepExpressionTree),
+		GPOS_UNITTEST_FUNC(EresUnittest_PreProcessCopyOnWrite),
+		GPOS_UNITTEST_FUNC(
+			EresUnittest_PreProcessRemoveUnusedCTEsAndSuperfluousLimits)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
 }
@@ -2607,4 +2611,136 @@ CExpressionPreprocessorTest::
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionPreprocessorTest::EresUnittest_PreProcessCopyOnWrite
+//
+//	@doc:
+//		Test that a preprocessing pass returns its input when it changes
+//		nothing, and shares the subtrees it does not change otherwise
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CExpressionPreprocessorTest::EresUnittest_PreProcessCopyOnWrite()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// reset metadata cache
+	CMDCache::Reset();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	CAutoOptCtxt aoc(mp, &mda, nullptr /*pceeval*/,
+					 CTestUtils::GetCostModel(mp));
+
+	CExpression *pexprGet = CTestUtils::PexprLogicalGet(mp);
+	CColRef *colref = pexprGet->DeriveOutputColumns()->PcrAny();
+
+	// a = 1 is already in the order the pass produces, nothing is copied
+	pexprGet->AddRef();
+	CAutoRef<CExpression> apexprOrdered(CUtils::PexprLogicalSelect(
+		mp, pexprGet,
+		CUtils::PexprScalarEqCmp(mp, colref,
+								 CUtils::PexprScalarConstInt4(mp, 1 /*val*/))));
+
+	CAutoRef<CExpression> apexprOrderedResult(
+		CExpressionPreprocessor::PexprReorderScalarCmpChildren(
+			mp, apexprOrdered.Value()));
+	GPOS_RTL_ASSERT(apexprOrderedResult.Value() == apexprOrdered.Value());
+
+	// 1 = a is reordered, the select is rebuilt over the same get
+	pexprGet->AddRef();
+	CAutoRef<CExpression> apexprReversed(CUtils::PexprLogicalSelect(
+		mp, pexprGet,
+		CUtils::PexprScalarEqCmp(mp, CUtils::PexprScalarConstInt4(mp, 1),
+								 colref)));
+
+	CAutoRef<CExpression> apexprReversedResult(
+		CExpressionPreprocessor::PexprReorderScalarCmpChildren(
+			mp, apexprReversed.Value()));
+	GPOS_RTL_ASSERT(apexprReversedResult.Value() != apexprReversed.Value());
+	GPOS_RTL_ASSERT((*apexprReversedResult)[0] == pexprGet);
+	GPOS_RTL_ASSERT(CUtils::FScalarIdent((*(*apexprReversedResult)[1])[0]));
+
+	pexprGet->Release();
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionPreprocessorTest::
+//			EresUnittest_PreProcessRemoveUnusedCTEsAndSuperfluousLimits
+//
+//	@doc:
+//		Test that unused CTE anchors and superfluous limits are removed in
+//		the same traversal, without copying the subtrees below them
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CExpressionPreprocessorTest::
+	EresUnittest_PreProcessRemoveUnusedCTEsAndSuperfluousLimits()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// reset metadata cache
+	CMDCache::Reset();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	CAutoOptCtxt aoc(mp, &mda, nullptr /*pceeval*/,
+					 CTestUtils::GetCostModel(mp));
+
+	// a CTE without consumers
+	const ULONG ulCTEId = 0;
+	CAutoRef<CExpression> apexprProducer(
+		CTestUtils::PexprLogicalCTEProducerOverSelect(mp, ulCTEId));
+	CCTEInfo *pcteinfo = COptCtxt::PoctxtFromTLS()->Pcteinfo();
+	pcteinfo->AddCTEProducer(apexprProducer.Value());
+	pcteinfo->MarkUnusedCTEs();
+	GPOS_RTL_ASSERT(!pcteinfo->FUsed(ulCTEId));
+
+	CExpression *pexprGet = CTestUtils::PexprLogicalGet(mp);
+	pexprGet->AddRef();
+	CExpression *pexprAnchor = GPOS_NEW(mp)
+		CExpression(mp, GPOS_NEW(mp) CLogicalCTEAnchor(mp, ulCTEId), pexprGet);
+
+	// a limit without offset or count over the anchor: both are skipped,
+	// and the get is returned as is
+	pexprAnchor->AddRef();
+	CAutoRef<CExpression> apexprLimit(CTestUtils::PexprLogicalLimit(
+		mp, pexprAnchor, 0 /*iStart*/, 0 /*iRows*/, true /*fGlobal*/,
+		false /*fHasCount*/));
+
+	CAutoRef<CExpression> apexprLimitResult(
+		CExpressionPreprocessor::PexprRemoveUnusedCTEsAndSuperfluousLimits(
+			mp, apexprLimit.Value()));
+	GPOS_RTL_ASSERT(apexprLimitResult.Value() == pexprGet);
+
+	// a limit with a count is kept, over the get that replaces the anchor
+	CAutoRef<CExpression> apexprCount(CTestUtils::PexprLogicalLimit(
+		mp, pexprAnchor, 0 /*iStart*/, 10 /*iRows*/, true /*fGlobal*/,
+		true /*fHasCount*/));
+
+	CAutoRef<CExpression> apexprCountResult(
+		CExpressionPreprocessor::PexprRemoveUnusedCTEsAndSuperfluousLimits(
+			mp, apexprCount.Value()));
+	GPOS_RTL_ASSERT(COperator::EopLogicalLimit ==
+					apexprCountResult->Pop()->Eopid());
+	GPOS_RTL_ASSERT((*apexprCountResult)[0] == pexprGet);
+	GPOS_RTL_ASSERT((*apexprCountResult)[1] == (*apexprCount)[1]);
+
+	pexprGet->Release();
+
+	return GPOS_OK;
+}
+
 // EOF
@@ -43,6 +43,7 @@ CSearchStrategyTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(
 			CSearchStrategyTest::EresUnittest_MultiThreadedOptimize),
 		GPOS_UNITTEST_FUNC(CSearchStrategyTest::EresUnittest_Parsing),
+		GPOS_UNITTEST_FUNC(CSearchStrategyTest::EresUnittest_Adaptive),
 		GPOS_UNITTEST_FUNC_THROW(CSearchStrategyTest::EresUnittest_Timeout,
 								 gpopt::ExmaGPOPT, gpopt::ExmiNoPlanFound),
 		GPOS_UNITTEST_FUNC_THROW(
@@ -159,6 +160,52 @@ CSearchStrategyTest::EresUnittest_Parsing()
 
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CSearchStrategyTest::EresUnittest_Adaptive
+//
+//	@doc:
+//		Test adaptive search strategy
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSearchStrategyTest::EresUnittest_Adaptive()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// a query with no joins is optimized in a single stage
+	SSearchSpaceEstimate estimate_trivial;
+	CSearchStageArray *search_stage_array =
+		CSearchStage::PdrgpssAdaptive(mp, estimate_trivial);
+	GPOS_RTL_ASSERT(1 == search_stage_array->Size());
+	search_stage_array->Release();
+
+	// a query with many joins gets a greedy stage without time threshold,
+	// followed by a stage with all xforms and a time threshold
+	SSearchSpaceEstimate estimate_joins;
+	estimate_joins.m_num_groups = 20;
+	estimate_joins.m_num_joins = 10;
+	estimate_joins.m_num_xform_candidates = 200;
+	search_stage_array = CSearchStage::PdrgpssAdaptive(mp, estimate_joins);
+	GPOS_RTL_ASSERT(2 == search_stage_array->Size());
+	CSearchStage *pss_greedy = (*search_stage_array)[0];
+	CSearchStage *pss_all = (*search_stage_array)[1];
+	GPOS_RTL_ASSERT(gpos::ulong_max == pss_greedy->TimeThreshold());
+	GPOS_RTL_ASSERT(gpos::ulong_max != pss_all->TimeThreshold());
+	GPOS_RTL_ASSERT(
+		!pss_greedy->GetXformSet()->Get(CXform::ExfJoinAssociativity));
+	GPOS_RTL_ASSERT(pss_all->GetXformSet()->Get(CXform::ExfJoinAssociativity));
+	search_stage_array->Release();
+
+	// optimize a join using the adaptive strategy picked by the engine
+	CAutoTraceFlag atf(EopttraceEnableAdaptiveSearch, true);
+	Optimize(mp, CTestUtils::PexprLogicalNAryJoin, nullptr, BuildMemo);
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CSearchStrategyTest::EresUnittest_Timeout
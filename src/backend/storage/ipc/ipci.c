@@ -67,6 +67,7 @@
 #include "executor/instrument.h"
 #include "executor/spi.h"
 #include "utils/workfile_mgr.h"
+#include "utils/mdcache_shmem.h"
 #include "utils/session_state.h"
 #include "replication/gp_replication.h"
 
@@ -194,6 +195,7 @@ CreateSharedMemoryAndSemaphores(int port)
 		size = add_size(size, CheckpointerShmemSize());
 		size = add_size(size, CancelBackendMsgShmemSize());
 		size = add_size(size, WorkFileShmemSize());
+		size = add_size(size, MDCacheShmemSize());
 		size = add_size(size, ShareInputShmemSize());
 
 #ifdef FAULT_INJECTOR
@@ -357,6 +359,7 @@ CreateSharedMemoryAndSemaphores(int port)
 	AsyncShmemInit();
 	BackendCancelShmemInit();
 	WorkFileShmemInit();
+	MDCacheShmemInit();
 	ShareInputShmemInit();
 
 	/*
@@ -176,6 +176,13 @@ typedef struct SISeg
 	int			lastBackend;	/* index of last active procState entry, +1 */
 	int			maxBackends;	/* size of procState array */
 
+	/*
+	 * GPDB: total number of messages ever inserted.  Unlike maxMsgNum this
+	 * never wraps around, so it can serve as a catalog version number for
+	 * caches shared across backends (see SIGetTotalMessageCount).
+	 */
+	uint64		totalMsgs;
+
 	slock_t		msgnumLock;		/* spinlock protecting maxMsgNum */
 
 	/*
@@ -230,6 +237,7 @@ CreateSharedInvalidationState(void)
 	/* Clear message counters, save size of procState array, init spinlock */
 	shmInvalBuffer->minMsgNum = 0;
 	shmInvalBuffer->maxMsgNum = 0;
+	shmInvalBuffer->totalMsgs = 0;
 	shmInvalBuffer->nextThreshold = CLEANUP_MIN;
 	shmInvalBuffer->lastBackend = 0;
 	shmInvalBuffer->maxBackends = MaxBackends;
@@ -451,6 +459,7 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 		int			nthistime = Min(n, WRITE_QUANTUM);
 		int			numMsgs;
 		int			max;
+		uint64		total;
 		int			i;
 
 		n -= nthistime;
@@ -478,6 +487,7 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 		 * Insert new message(s) into proper slot of circular buffer
 		 */
 		max = segP->maxMsgNum;
+		total = segP->totalMsgs + nthistime;
 		while (nthistime-- > 0)
 		{
 			segP->buffer[max % MAXNUMMESSAGES] = *data++;
@@ -487,6 +497,7 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 		/* Update current value of maxMsgNum using spinlock */
 		SpinLockAcquire(&segP->msgnumLock);
 		segP->maxMsgNum = max;
+		segP->totalMsgs = total;
 		SpinLockRelease(&segP->msgnumLock);
 
 		/*
@@ -507,6 +518,29 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 	}
 }
 
+/*
+ * SIGetTotalMessageCount
+ *		Return the number of invalidation messages ever inserted into the
+ *		queue.
+ *
+ * GPDB: the result changes whenever any backend commits a catalog change,
+ * so it can be used to validate data cached across backends: an entry built
+ * after reading the counter (and after absorbing pending invalidations) is
+ * current for as long as the counter keeps the same value.
+ */
+uint64
+SIGetTotalMessageCount(void)
+{
+	SISeg	   *segP = shmInvalBuffer;
+	uint64		total;
+
+	SpinLockAcquire(&segP->msgnumLock);
+	total = segP->totalMsgs;
+	SpinLockRelease(&segP->msgnumLock);
+
+	return total;
+}
+
 /*
  * SIGetDataEntries
  *		get next SI message(s) for current backend, if there are any
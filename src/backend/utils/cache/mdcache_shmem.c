@@ -0,0 +1,309 @@
+/*-------------------------------------------------------------------------
+ *
+ * mdcache_shmem.c
+ *	  Cross-backend cache of serialized GPORCA metadata objects
+ *
+ * Every backend running GPORCA keeps a private metadata cache (MDCache) of
+ * objects translated from the relcache and syscaches.  A new backend starts
+ * with an empty cache and pays the full translation cost for every object
+ * its first queries touch.  This module provides an optional second tier,
+ * sized by optimizer_shared_mdcache_size, where backends publish the DXL
+ * serialization of the objects they translate so that other backends can
+ * parse them instead of translating them again.
+ *
+ * Validation is deliberately coarse: the contents are tagged with the
+ * number of shared invalidation messages sent so far (see
+ * SIGetTotalMessageCount).  As long as that count has not changed, no
+ * catalog change has been committed since the objects were built, and every
+ * entry is current.  As soon as the count moves, all entries are stale, and
+ * the first backend to publish a new object discards them.  This keeps
+ * readers free of any per-object dependency tracking, at the price of
+ * flushing the whole tier on any DDL or ANALYZE.
+ *
+ * Objects are keyed by database as well as by mdid: mdids are built from
+ * OIDs, which are only unique within a database, and databases created from
+ * the same template start out with the same OIDs for different objects.
+ *
+ * Portions Copyright (c) 2023-Present VMware, Inc. or its affiliates.
+ *
+ *
+ * IDENTIFICATION
+ *	    src/backend/utils/cache/mdcache_shmem.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/xact.h"
+#include "miscadmin.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "storage/sinval.h"
+#include "storage/sinvaladt.h"
+#include "utils/guc.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
+#include "utils/mdcache_shmem.h"
+#include "utils/memutils.h"
+
+/* Assumed average size of a serialized object, used to size the hash table */
+#define MDCACHE_SHMEM_AVG_OBJECT_SIZE	1024
+
+typedef struct MDCacheShmemKey
+{
+	Oid			dbid;			/* database the object belongs to */
+	char		mdid[MDCACHE_SHMEM_KEYSIZE];	/* serialized mdid */
+} MDCacheShmemKey;
+
+typedef struct MDCacheShmemEntry
+{
+	MDCacheShmemKey key;		/* hash key */
+	Size		offset;			/* start of the object in the data area */
+	Size		len;			/* length of the object in bytes */
+} MDCacheShmemEntry;
+
+typedef struct MDCacheShmemHeader
+{
+	uint64		version;		/* version the contents are valid for, 0 if
+								 * none */
+	Size		used;			/* bytes used in the data area */
+	Size		capacity;		/* total size of the data area */
+	char		data[FLEXIBLE_ARRAY_MEMBER];
+} MDCacheShmemHeader;
+
+static MDCacheShmemHeader *mdcache_shmem = NULL;
+static HTAB *mdcache_shmem_hash = NULL;
+
+static Size
+MDCacheShmemCapacity(void)
+{
+	return (Size) optimizer_shared_mdcache_size * 1024L;
+}
+
+static long
+MDCacheShmemMaxEntries(void)
+{
+	return Max(MDCacheShmemCapacity() / MDCACHE_SHMEM_AVG_OBJECT_SIZE, 64);
+}
+
+/*
+ * Return the current catalog version.  Zero is reserved to mean "no
+ * version", so the message count is offset by one.
+ */
+static uint64
+MDCacheShmemCurrentVersion(void)
+{
+	return SIGetTotalMessageCount() + 1;
+}
+
+/*
+ * Shared memory initialization
+ */
+Size
+MDCacheShmemSize(void)
+{
+	Size		size;
+
+	if (optimizer_shared_mdcache_size <= 0)
+		return 0;
+
+	size = offsetof(MDCacheShmemHeader, data);
+	size = add_size(size, MDCacheShmemCapacity());
+	size = MAXALIGN(size);
+	size = add_size(size, hash_estimate_size(MDCacheShmemMaxEntries(),
+											 sizeof(MDCacheShmemEntry)));
+
+	return size;
+}
+
+void
+MDCacheShmemInit(void)
+{
+	Size		size;
+	bool		found;
+	HASHCTL		hctl;
+
+	if (optimizer_shared_mdcache_size <= 0)
+		return;
+
+	size = offsetof(MDCacheShmemHeader, data);
+	size = add_size(size, MDCacheShmemCapacity());
+
+	mdcache_shmem = (MDCacheShmemHeader *)
+		ShmemInitStruct("Optimizer Shared MDCache", size, &found);
+	if (!found)
+	{
+		mdcache_shmem->version = 0;
+		mdcache_shmem->used = 0;
+		mdcache_shmem->capacity = MDCacheShmemCapacity();
+	}
+
+	memset(&hctl, 0, sizeof(hctl));
+	hctl.keysize = sizeof(MDCacheShmemKey);
+	hctl.entrysize = sizeof(MDCacheShmemEntry);
+
+	mdcache_shmem_hash = ShmemInitHash("Optimizer Shared MDCache Hash",
+									   MDCacheShmemMaxEntries(),
+									   MDCacheShmemMaxEntries(),
+									   &hctl,
+									   HASH_ELEM | HASH_BLOBS | HASH_FIXED_SIZE);
+}
+
+/*
+ * Discard all entries and start accepting objects of the given version.
+ * Caller must hold OptimizerMDCacheLock exclusively.
+ */
+static void
+MDCacheShmemReset(uint64 version)
+{
+	HASH_SEQ_STATUS status;
+	MDCacheShmemEntry *entry;
+
+	hash_seq_init(&status, mdcache_shmem_hash);
+	while ((entry = (MDCacheShmemEntry *) hash_seq_search(&status)) != NULL)
+		hash_search(mdcache_shmem_hash, &entry->key, HASH_REMOVE, NULL);
+
+	mdcache_shmem->used = 0;
+	mdcache_shmem->version = version;
+}
+
+/*
+ * MDCacheShmemBeginOptimization
+ *		Return the catalog version that objects looked up or published by
+ *		the current optimization are tagged with, or 0 if the shared cache
+ *		must not be used.
+ *
+ * The version is read before absorbing pending invalidations, so every
+ * object translated afterwards reflects at least all catalog changes counted
+ * in it.  A transaction that has modified the catalog sees uncommitted
+ * state, which must neither be published nor be shadowed by what other
+ * backends published, so such transactions bypass the cache.
+ */
+uint64
+MDCacheShmemBeginOptimization(void)
+{
+	uint64		version;
+
+	if (mdcache_shmem == NULL)
+		return 0;
+
+	if (TransactionIdIsValid(GetTopTransactionIdIfAny()))
+		return 0;
+
+	version = MDCacheShmemCurrentVersion();
+	AcceptInvalidationMessages();
+
+	return version;
+}
+
+/*
+ * Build the hash key of the object with the given serialized mdid in the
+ * current database.  The key is hashed as a blob, so it is zero-padded.
+ */
+static void
+MDCacheShmemMakeKey(MDCacheShmemKey *hkey, const char *key)
+{
+	memset(hkey, 0, sizeof(MDCacheShmemKey));
+	hkey->dbid = MyDatabaseId;
+	strlcpy(hkey->mdid, key, MDCACHE_SHMEM_KEYSIZE);
+}
+
+/*
+ * MDCacheShmemLookup
+ *		Look up the serialized object with the given key in the current
+ *		database.
+ *
+ * Returns a palloc'd copy of the object and sets *len, or returns NULL if
+ * there is no current entry.  Never throws: the copy is allocated without
+ * raising out-of-memory errors, so that the lock cannot be left held when
+ * called from the optimizer.
+ */
+char *
+MDCacheShmemLookup(uint64 version, const char *key, Size *len)
+{
+	MDCacheShmemKey hkey;
+	MDCacheShmemEntry *entry;
+	char	   *result = NULL;
+
+	if (mdcache_shmem == NULL || version == 0 ||
+		strlen(key) >= MDCACHE_SHMEM_KEYSIZE)
+		return NULL;
+
+	MDCacheShmemMakeKey(&hkey, key);
+
+	LWLockAcquire(OptimizerMDCacheLock, LW_SHARED);
+
+	if (mdcache_shmem->version == version &&
+		MDCacheShmemCurrentVersion() == version)
+	{
+		entry = (MDCacheShmemEntry *) hash_search(mdcache_shmem_hash, &hkey,
+												  HASH_FIND, NULL);
+		if (entry != NULL)
+		{
+			result = MemoryContextAllocExtended(CurrentMemoryContext,
+												entry->len,
+												MCXT_ALLOC_NO_OOM);
+			if (result != NULL)
+			{
+				memcpy(result, mdcache_shmem->data + entry->offset,
+					   entry->len);
+				*len = entry->len;
+			}
+		}
+	}
+
+	LWLockRelease(OptimizerMDCacheLock);
+
+	return result;
+}
+
+/*
+ * MDCacheShmemInsert
+ *		Publish a serialized object of the current database, built under
+ *		the given catalog version.
+ *
+ * The object is silently dropped if the catalog has changed since, if the
+ * key is already present, or if the cache is full.  A full cache is only
+ * emptied when the catalog version changes; this favors objects translated
+ * early, which tend to be the commonly used ones.
+ */
+void
+MDCacheShmemInsert(uint64 version, const char *key, const char *data,
+				   Size len)
+{
+	MDCacheShmemKey hkey;
+	MDCacheShmemEntry *entry;
+	bool		found;
+
+	if (mdcache_shmem == NULL || version == 0 ||
+		strlen(key) >= MDCACHE_SHMEM_KEYSIZE)
+		return;
+
+	MDCacheShmemMakeKey(&hkey, key);
+
+	LWLockAcquire(OptimizerMDCacheLock, LW_EXCLUSIVE);
+
+	if (MDCacheShmemCurrentVersion() != version)
+	{
+		LWLockRelease(OptimizerMDCacheLock);
+		return;
+	}
+
+	if (mdcache_shmem->version != version)
+		MDCacheShmemReset(version);
+
+	if (len <= mdcache_shmem->capacity - mdcache_shmem->used)
+	{
+		entry = (MDCacheShmemEntry *) hash_search(mdcache_shmem_hash, &hkey,
+												  HASH_ENTER_NULL, &found);
+		if (entry != NULL && !found)
+		{
+			entry->offset = mdcache_shmem->used;
+			entry->len = len;
+			memcpy(mdcache_shmem->data + entry->offset, data, len);
+			mdcache_shmem->used += len;
+		}
+	}
+
+	LWLockRelease(OptimizerMDCacheLock);
+}
@@ -80,6 +80,8 @@ static bool check_verify_gpfdists_cert(bool *newval, void **extra, GucSource sou
 static bool check_dispatch_log_stats(bool *newval, void **extra, GucSource source);
 static bool check_gp_hashagg_default_nbatches(int *newval, void **extra, GucSource source);
 static bool check_gp_workfile_compression(bool *newval, void **extra, GucSource source);
+static bool check_optimizer_cost_model_params(char **newval, void **extra, GucSource source);
+static bool check_optimizer_search_strategy(char **newval, void **extra, GucSource source);
 
 /* Helper function for guc setter */
 bool gpvars_check_gp_resqueue_priority_default_value(char **newval,
@@ -97,6 +99,11 @@ static int guc_array_compare(const void *a, const void *b);
 
 extern struct config_generic *find_option(const char *name, bool create_placeholders, int elevel);
 
+#ifdef USE_ORCA
+extern const char *CheckCostModelParams(const char *params);
+extern const char *CheckSearchStrategy(const char *stages);
+#endif
+
 extern int listenerBacklog;
 
 /* GUC lists for gp_guc_list_show().  (List of struct config_generic) */
@@ -272,7 +279,10 @@ int			optimizer_minidump;
 int			optimizer_cost_model;
 bool		optimizer_metadata_caching;
 int			optimizer_mdcache_size;
+int			optimizer_shared_mdcache_size;
+int			optimizer_plan_cache_size;
 bool		optimizer_use_gpdb_allocators;
+bool		optimizer_use_arena_memory_pools;
 
 /* Optimizer debugging GUCs */
 bool		optimizer_print_query;
@@ -291,6 +301,8 @@ bool		optimizer_print_xform_results;
 /* array of xforms disable flags */
 bool		optimizer_xforms[OPTIMIZER_XFORMS_COUNT] = {[0 ... OPTIMIZER_XFORMS_COUNT - 1] = false};
 char	   *optimizer_search_strategy_path = NULL;
+char	   *optimizer_cost_model_params = NULL;
+char	   *optimizer_search_strategy = NULL;
 
 /* GUCs to tell Optimizer to enable a physical operator */
 bool		optimizer_enable_indexjoin;
@@ -344,6 +356,7 @@ double		optimizer_damping_factor_filter;
 double		optimizer_damping_factor_join;
 double		optimizer_damping_factor_groupby;
 bool		optimizer_dpe_stats;
+bool		optimizer_merge_partition_stats;
 bool		optimizer_enable_derive_stats_all_groups;
 
 /* Costing related GUCs used by the Optimizer */
@@ -374,6 +387,7 @@ bool		optimizer_remove_order_below_dml;
 bool		optimizer_multilevel_partitioning;
 bool 		optimizer_parallel_union;
 bool		optimizer_array_constraints;
+bool		optimizer_adaptive_search;
 bool		optimizer_cte_inlining;
 bool		optimizer_enable_space_pruning;
 bool		optimizer_enable_associativity;
@@ -1985,6 +1999,16 @@ struct config_bool ConfigureNamesBool_gp[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"optimizer_merge_partition_stats", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Derive the statistics of a partitioned table from those of the leaf partitions that survive static partition elimination."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_merge_partition_stats,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"optimizer_enable_indexjoin", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Enable index nested loops join plans in the optimizer."),
@@ -2612,6 +2636,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_adaptive_search", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Pick the optimizer's search stages and their time budgets from the estimated size of the search space."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_adaptive_search,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_use_gpdb_allocators", PGC_POSTMASTER, RESOURCES_MEM,
 			gettext_noop("Enable ORCA to use GPDB Memory Contexts"),
@@ -2623,6 +2658,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_use_arena_memory_pools", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Enable ORCA to use bump-allocating memory contexts for its per-query memory pools."),
+			gettext_noop("Such contexts allocate from malloc, outside of VMEM tracking."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_use_arena_memory_pools,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"vmem_process_interrupt", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Checks for interrupts before reserving VMEM"),
@@ -3891,6 +3937,29 @@ struct config_int ConfigureNamesInt_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_plan_cache_size", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the size of the cache of plans produced by GPORCA."),
+			gettext_noop("0 disables plan caching. Plans are only cached when "
+						 "optimizer_metadata_caching is on."),
+			GUC_UNIT_KB
+		},
+		&optimizer_plan_cache_size,
+		0, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_shared_mdcache_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the size of the MDCache shared by all backends."),
+			gettext_noop("0 disables the shared MDCache."),
+			GUC_UNIT_KB
+		},
+		&optimizer_shared_mdcache_size,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"memory_profiler_dataset_size", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Set the size in GB"),
@@ -4261,6 +4330,30 @@ struct config_string ConfigureNamesString_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_search_strategy", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Sets the search stages used by gp optimizer, overriding optimizer_search_strategy_path."),
+			gettext_noop("Stages are separated by semicolons, each given as "
+						 "time_threshold:cost_threshold:xform,xform,..."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_search_strategy,
+		"",
+		check_optimizer_search_strategy, NULL, NULL
+	},
+
+	{
+		{"optimizer_cost_model_params", PGC_USERSET, QUERY_TUNING_COST,
+			gettext_noop("Overrides parameters of the gp optimizer cost model."),
+			gettext_noop("Parameters are separated by commas, each given as "
+						 "name=value."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_cost_model_params,
+		"",
+		check_optimizer_cost_model_params, NULL, NULL
+	},
+
 	{
 		{"gp_default_storage_options", PGC_USERSET, APPENDONLY_TABLES,
 			gettext_noop("default options for appendonly storage."),
@@ -4680,6 +4773,61 @@ check_optimizer(bool *newval, void **extra, GucSource source)
 	return true;
 }
 
+/*
+ * Reject a malformed optimizer_cost_model_params, or one that names a
+ * parameter the cost model does not have, when it is set rather than when
+ * a query is optimized.
+ */
+static bool
+check_optimizer_cost_model_params(char **newval, void **extra, GucSource source)
+{
+#ifdef USE_ORCA
+	const char *invalid_pos;
+
+	if (*newval == NULL)
+		return true;
+
+	invalid_pos = CheckCostModelParams(*newval);
+	if (invalid_pos != NULL)
+	{
+		GUC_check_errdetail("Expected a comma-separated list of name=value "
+							"cost model parameters, found \"%s\".",
+							invalid_pos);
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+/*
+ * Reject a malformed optimizer_search_strategy when it is set rather than
+ * when a query is optimized. The names of the xforms can only be checked
+ * once the optimizer is initialized.
+ */
+static bool
+check_optimizer_search_strategy(char **newval, void **extra, GucSource source)
+{
+#ifdef USE_ORCA
+	const char *invalid_pos;
+
+	if (*newval == NULL || **newval == '\0')
+		return true;
+
+	invalid_pos = CheckSearchStrategy(*newval);
+	if (invalid_pos != NULL)
+	{
+		GUC_check_errdetail("Expected semicolon-separated search stages, "
+							"each given as time_threshold:cost_threshold:"
+							"xform,xform,..., found \"%s\".",
+							invalid_pos);
+		return false;
+	}
+#endif
+
+	return true;
+}
+
 static bool
 check_verify_gpfdists_cert(bool *newval, void **extra, GucSource source)
 {
@@ -33,6 +33,24 @@ typedef struct MCVFreqPair
 	TypInfo *typinfo; /* type information of datum type */
 } MCVFreqPair;
 
+/*
+ * Statistics of a column of a partitioned table, merged from those of its
+ * leaf partitions by merge_leaf_att_stats()
+ */
+typedef struct MergedLeafStats
+{
+	float4		totalTuples;	/* total number of tuples of the leaves */
+	float4		stanullfrac;
+	int32		stawidth;
+	float4		stadistinct;	/* as in pg_statistic */
+	int			num_mcv;
+	Datum	   *mcv_values;
+	float4	   *mcv_freqs;
+	int			num_hist;
+	Datum	   *hist_values;
+	bool		hll_inconsistent;	/* leaf HLL counters could not be merged */
+} MergedLeafStats;
+
 /* extern functions called by commands/analyze.c */
 extern MCVFreqPair **aggregate_leaf_partition_MCVs(Oid relationOid,
 												   AttrNumber attnum,
@@ -58,6 +76,11 @@ extern int aggregate_leaf_partition_histograms(Oid relationOid,
 extern bool needs_sample(VacAttrStats **vacattrstats, int attr_cnt);
 extern AttrNumber fetch_leaf_attnum(Oid leafRelid, const char* attname);
 extern HeapTuple fetch_leaf_att_stats(Oid leafRelid, AttrNumber leafAttNum);
+extern bool merge_leaf_att_stats(Oid relid, AttrNumber attnum,
+								 List *leaf_oids, int stattarget,
+								 Oid eqopr, Oid ltopr,
+								 MemoryContext result_context,
+								 MergedLeafStats *result);
 extern bool leaf_parts_analyzed(Oid attrelid, Oid relid_exclude, List *va_cols, int elevel);
 
 #endif  /* ANALYZEUTILS_H */
@@ -40,6 +40,12 @@ public:
 	static void InitGPOPT();
 
 	static void TerminateGPOPT();
+
+	// check the value of the optimizer_cost_model_params GUC
+	static const char *CheckCostModelParams(const char *params);
+
+	// check the value of the optimizer_search_strategy GUC
+	static const char *CheckSearchStrategy(const char *stages);
 };
 
 extern "C" {
@@ -49,6 +55,8 @@ extern PlannedStmt *GPOPTOptimizedPlan(Query *query,
 extern char *SerializeDXLPlan(Query *query);
 extern void InitGPOPT();
 extern void TerminateGPOPT();
+extern const char *CheckCostModelParams(const char *params);
+extern const char *CheckSearchStrategy(const char *stages);
 }
 
 #endif	// CGPOptimizer_H
@@ -56,6 +56,10 @@ struct Motion;
 struct Var;
 struct Const;
 struct ArrayExpr;
+struct MVNDistinct;
+struct MVDependencies;
+struct MCVList;
+struct MergedLeafStats;
 
 #include "gpopt/utils/RelationWrapper.h"
 
@@ -142,6 +146,9 @@ bool AggregateExists(Oid oid);
 // add member to Bitmapset
 Bitmapset *BmsAddMember(Bitmapset *a, int x);
 
+// next member of Bitmapset after the given one, or -2 if there is none
+int BmsNextMember(const Bitmapset *a, int prevbit);
+
 // create a copy of an object
 void *CopyObject(void *from);
 
@@ -262,6 +269,9 @@ List *GetCheckConstraintOids(Oid rel_oid);
 // part constraint expression tree
 Node *GetRelationPartConstraints(Relation rel);
 
+// bound constraint of a partition, in terms of the columns of its parent
+Node *GetPartitionBoundConstraint(Relation parent, Oid part_oid);
+
 // get the cast function for the specified source and destination types
 bool GetCastFunc(Oid src_oid, Oid dest_oid, bool *is_binary_coercible,
 				 Oid *cast_fn_oid, CoercionPathType *pathtype);
@@ -584,6 +594,36 @@ void CloseRelation(Relation rel);
 // return a list of index oids for a given relation
 List *GetRelationIndexes(Relation relation);
 
+// return a list of the oids of the extended statistics of a relation
+List *GetExtStatisticsOids(Relation rel);
+
+// return the ndistinct coefficients of an extended statistics object, or
+// NULL if they have not been built
+MVNDistinct *GetMVNDistinct(Oid stat_oid);
+
+// return the functional dependencies of an extended statistics object, or
+// NULL if they have not been built
+MVDependencies *GetMVDependencies(Oid stat_oid);
+
+// return the most common combinations of values of an extended statistics
+// object, or NULL if they have not been built
+MCVList *GetMCVList(Oid stat_oid);
+
+// return the attnos of the columns of an extended statistics object, in
+// the order of the values of its most common combinations
+List *GetExtStatisticsKeys(Oid stat_oid);
+
+// free the ndistinct coefficients of an extended statistics object
+void FreeMVNDistinct(MVNDistinct *ndistinct);
+
+// free the functional dependencies of an extended statistics object
+void FreeMVDependencies(MVDependencies *dependencies);
+
+// merge the statistics of a column of a partitioned table from those of the
+// given leaf partitions; return false if they cannot be merged
+bool MergeLeafAttStats(Oid rel_oid, AttrNumber attno, List *leaf_oids,
+					   MergedLeafStats *result);
+
 // build an array of triggers for this relation
 void BuildRelationTriggers(Relation rel);
 
@@ -645,6 +685,9 @@ int FindNodes(Node *node, List *nodeTags);
 // look for nodes with non-default collation; returns 1 if any exist, -1 otherwise
 int CheckCollation(Node *node);
 
+// does the database default collation order strings bytewise
+bool DefaultCollationIsC();
+
 Node *CoerceToCommonType(ParseState *pstate, Node *node, Oid target_type,
 						 const char *context);
 
@@ -714,9 +757,40 @@ FaultInjectorType_e InjectFaultInOptTasks(const char *fault_name);
 #endif
 
 // Does the metadata cache need to be reset (because of a catalog
-// table has been changed?)
+// table has been changed in a way that cannot be handled by evicting
+// individual entries?)
 bool MDCacheNeedsReset(void);
 
+// are there invalidations of individual metadata cache entries to apply?
+bool MDCacheHasPendingInvalidations(void);
+
+// has the given relation been invalidated since the last query?
+bool MDCacheRelationIsInvalid(Oid relid);
+
+// has the type, function, aggregate or constraint with the given OID been
+// invalidated since the last query?
+bool MDCacheObjectIsInvalid(Oid oid);
+
+// has the cast between the given types been invalidated since the last query?
+bool MDCacheCastIsInvalid(Oid src_oid, Oid dest_oid);
+
+// have statistics of the given relation been invalidated since the last query?
+bool MDCacheStatsAreInvalid(Oid relid);
+
+// have extended statistics of the given relation been invalidated since the
+// last query?
+bool MDCacheExtStatsAreInvalid(Oid relid);
+
+// catalog version for the shared metadata cache, or 0 if it cannot be used
+uint64 SharedMDCacheBeginOptimization(void);
+
+// look up a serialized metadata object in the shared metadata cache
+char *SharedMDCacheLookup(uint64 version, const char *key, Size *len);
+
+// publish a serialized metadata object in the shared metadata cache
+void SharedMDCacheInsert(uint64 version, const char *key, const char *data,
+						 Size len);
+
 // returns true if a query cancel is requested in GPDB
 bool IsAbortRequested(void);
 
@@ -740,6 +814,8 @@ void *GPDBMemoryContextAlloc(MemoryContext context, Size size);
 
 MemoryContext GPDBAllocSetContextCreate();
 
+MemoryContext GPDBGenerationContextCreate();
+
 void GPDBMemoryContextDelete(MemoryContext context);
 
 List *GetRelChildIndexes(Oid reloid);
@@ -49,6 +49,17 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
+	// catalog version of the shared metadata cache entries visible to this
+	// provider, 0 if the shared cache is not used
+	ULLONG m_shared_mdcache_version;
+
+	// look up the requested object in the shared metadata cache
+	IMDCacheObject *GetSharedMDObj(CMemoryPool *mp, const CHAR *key) const;
+
+	// publish the given object in the shared metadata cache
+	void PublishSharedMDObj(CMemoryPool *mp, const CHAR *key,
+							const IMDCacheObject *md_obj) const;
+
 public:
 	CMDProviderRelcache(const CMDProviderRelcache &) = delete;
 
@@ -87,6 +87,18 @@ private:
 					 CleanupDelete<SCTEConsumerInfo> >
 		HMUlCTEConsumerInfo;
 
+	// hash of a wide character name
+	static ULONG HashName(const WCHAR *name);
+
+	// equality of wide character names
+	static BOOL EqualNames(const WCHAR *name, const WCHAR *other_name);
+
+	// hash map of wide character names to their multibyte conversions;
+	// the conversions are palloc'd and live as long as the plan
+	typedef CHashMap<WCHAR, CHAR, HashName, EqualNames,
+					 CleanupDeleteArray<WCHAR>, CleanupNULL<CHAR> >
+		NameToMultiByteMap;
+
 	CMemoryPool *m_mp;
 
 	// counter for generating plan ids
@@ -105,6 +117,9 @@ private:
 	// list of all rtable entries
 	List *m_rtable_entries_list;
 
+	// map of relation oids to the index of their first rtable entry
+	UlongToUlongMap *m_rel_oid_to_rte_index_map;
+
 	// list of oids of partitioned tables
 	List *m_partitioned_tables_list;
 
@@ -137,6 +152,9 @@ private:
 
 	UlongToUlongMap *m_part_selector_to_param_map;
 
+	// multibyte conversions of the column, alias and relation names
+	// translated so far
+	NameToMultiByteMap *m_name_to_multibyte_map;
 
 public:
 	// ctor/dtor
@@ -258,6 +276,12 @@ public:
 	ULONG GetParamIdForSelector(OID oid_type, const ULONG selectorId);
 
 	Index FindRTE(Oid reloid);
+
+	// multibyte conversion of the given name; names repeat across the
+	// target lists and range table entries of a plan, e.g. the children of
+	// an Append over many partitions, so each distinct name is converted
+	// once and the conversion is shared by the plan nodes using it
+	CHAR *GetMultiByteName(const CWStringBase *name);
 };
 
 }  // namespace gpdxl
@@ -33,6 +33,7 @@ extern "C" {
 #include "naucrates/md/CMDAggregateGPDB.h"
 #include "naucrates/md/CMDCheckConstraintGPDB.h"
 #include "naucrates/md/CMDFunctionGPDB.h"
+#include "naucrates/md/CMDMCVList.h"
 #include "naucrates/md/CMDPartConstraintGPDB.h"
 #include "naucrates/md/CMDRelationExternalGPDB.h"
 #include "naucrates/md/CMDRelationGPDB.h"
@@ -48,6 +49,7 @@ extern "C" {
 struct RelationData;
 typedef struct RelationData *Relation;
 struct LogicalIndexes;
+struct MCVList;
 
 namespace gpdxl
 {
@@ -187,11 +189,34 @@ private:
 	// retrieve relstats object from the relcache
 	static IMDCacheObject *RetrieveRelStats(CMemoryPool *mp, IMDId *mdid);
 
+	// retrieve extended stats object from the relcache
+	static IMDCacheObject *RetrieveExtStats(CMemoryPool *mp, IMDId *mdid);
+
+	// translate the most common values list of an extended stats object
+	static CMDMCVList *RetrieveExtStatsMCVList(CMemoryPool *mp, OID stat_oid,
+											   const MCVList *mcv_list);
+
 	// retrieve column stats object from the relcache
 	static IMDCacheObject *RetrieveColStats(CMemoryPool *mp,
 											CMDAccessor *md_accessor,
 											IMDId *mdid);
 
+	// retrieve the stats of a column of a partitioned table, merged from
+	// those of the leaf partitions listed in the mdid; null if they cannot
+	// be merged
+	static CDXLColStats *RetrieveMergedColStats(CMemoryPool *mp,
+												CMDIdColStats *mdid_col_stats,
+												AttrNumber attno,
+												CMDName *md_colname,
+												OID att_type);
+
+	// create a column stats object from statistics in pg_statistic form
+	static CDXLColStats *CreateDXLColStats(
+		CMemoryPool *mp, CMDIdColStats *mdid_col_stats, CMDName *md_colname,
+		OID att_type, CDouble width, CDouble null_freq, CDouble num_distinct,
+		const Datum *mcv_values, const float4 *mcv_frequencies,
+		ULONG num_mcv_values, const Datum *hist_values, ULONG num_hist_values);
+
 	// retrieve cast object from the relcache
 	static IMDCacheObject *RetrieveCast(CMemoryPool *mp, IMDId *mdid);
 
@@ -273,12 +298,28 @@ private:
 		Node *part_constraint, ULongPtrArray *level_with_default_part_array,
 		BOOL is_unbounded);
 
+	// column descriptors for translating the part constraints of a relation
+	static CDXLColDescrArray *CreatePartConstraintColDescrs(
+		CMemoryPool *mp, CMDColumnArray *mdcol_array);
+
 	// retrieve part constraint for relation
 	static CDXLNode *RetrievePartConstraintForRel(CMemoryPool *mp,
 												  CMDAccessor *md_accessor,
 												  Relation rel,
 												  CMDColumnArray *mdcol_array);
 
+	// retrieve the bound constraints of the partitions of a relation
+	static CDXLNodeArray *RetrievePartBoundsForRel(CMemoryPool *mp,
+												   CMDAccessor *md_accessor,
+												   Relation rel,
+												   CMDColumnArray *mdcol_array);
+
+	// retrieve the sorted bounds of a relation range partitioned on one
+	// column, and the partition of each slot between them
+	static void RetrievePartRangeBoundsForRel(
+		CMemoryPool *mp, CMDAccessor *md_accessor, Relation rel,
+		CDXLDatumArray **part_range_bounds, IntPtrArray **part_range_slots);
+
 	// retrieve part constraint from a GPDB node
 	static CMDPartConstraintGPDB *RetrievePartConstraintFromNode(
 		CMemoryPool *mp, CMDAccessor *md_accessor,
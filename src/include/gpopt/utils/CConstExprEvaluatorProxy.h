@@ -16,6 +16,8 @@
 #define GPDXL_CConstExprEvaluator_H
 
 #include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/common/CHashMapIter.h"
 
 #include "gpopt/eval/IConstDXLNodeEvaluator.h"
 #include "gpopt/mdcache/CMDAccessor.h"
@@ -72,21 +74,43 @@ private:
 	// pointer to metadata cache accessor
 	CMDAccessor *m_md_accessor;
 
+	// map of operator oids to translated comparisons without arguments
+	typedef CHashMap<ULONG, OpExpr, gpos::HashValue<ULONG>,
+					 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
+					 CleanupNULL<OpExpr> >
+		OidToOpExprMap;
+
+	// iterator over the comparison templates
+	typedef CHashMapIter<ULONG, OpExpr, gpos::HashValue<ULONG>,
+						 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
+						 CleanupNULL<OpExpr> >
+		OidToOpExprMapIter;
+
 	// translator for the DXL input -> GPDB Expr
 	CTranslatorDXLToScalar m_dxl2scalar_translator;
 
+	// translated comparisons of two constants, by operator, with their
+	// arguments left out; comparisons are evaluated many times with the
+	// same operator, and this saves the metadata lookups of the operator
+	OidToOpExprMap *m_cmp_templates;
+
+	// translate 'dxl_expr' to a GPDB Expr, from a cached template when it
+	// compares two constants
+	Expr *TranslateExpr(const CDXLNode *dxl_expr);
+
 public:
 	// ctor
 	CConstExprEvaluatorProxy(CMemoryPool *mp, CMDAccessor *md_accessor)
 		: m_mp(mp),
 		  m_emptymapcidvar(m_mp),
 		  m_md_accessor(md_accessor),
-		  m_dxl2scalar_translator(m_mp, m_md_accessor, 0)
+		  m_dxl2scalar_translator(m_mp, m_md_accessor, 0),
+		  m_cmp_templates(GPOS_NEW(m_mp) OidToOpExprMap(m_mp))
 	{
 	}
 
 	// dtor
-	~CConstExprEvaluatorProxy() override = default;
+	~CConstExprEvaluatorProxy() override;
 
 	// evaluate given constant expressionand return the DXL representation of the result.
 	// if the expression has variables, an error is thrown.
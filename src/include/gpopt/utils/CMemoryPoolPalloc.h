@@ -25,6 +25,9 @@ class CMemoryPoolPalloc : public CMemoryPool
 private:
 	MemoryContext m_cxt{nullptr};
 
+	// is the context a bump-allocating generation context
+	BOOL m_is_arena{false};
+
 	// When destroying arrays, we need to call the destructor of each element
 	// To do this, we need the size of the allocation, which we then divide by the
 	// the size of the element to get number of elements to iterate through.
@@ -35,8 +38,8 @@ private:
 	};
 
 public:
-	// ctor
-	CMemoryPoolPalloc();
+	// ctor; arena pools use a generation context, other pools an AllocSet
+	explicit CMemoryPoolPalloc(EPoolKind kind = EpkGeneral);
 
 	// allocate memory
 	void *NewImpl(const ULONG bytes, const CHAR *file, const ULONG line,
@@ -35,10 +35,19 @@ namespace gpdxl
 class CDXLNode;
 }
 
+namespace gpmd
+{
+class IMDCacheObject;
+class IMDId;
+}
+
 namespace gpopt
 {
 class CExpression;
 class CMDAccessor;
+class CMDKey;
+class CPlanCacheEntry;
+class CPlanCacheKey;
 class CQueryContext;
 class COptimizerConfig;
 class ICostModel;
@@ -116,6 +125,11 @@ struct SOptContext
 class COptTasks
 {
 private:
+	// number of optimizer exceptions after which the metadata cache was
+	// kept, and after which it was dropped, in this backend
+	static ULLONG m_mdcache_kept_on_exception;
+	static ULLONG m_mdcache_dropped_on_exception;
+
 	// execute a task given the argument
 	static void Execute(void *(*func)(void *), void *func_arg);
 
@@ -136,12 +150,64 @@ private:
 		const CDXLNode *dxlnode, bool can_set_tag,
 		DistributionHashOpsKind distribution_hashops);
 
-	// load search strategy from given path
-	static CSearchStageArray *LoadSearchStrategy(CMemoryPool *mp, char *path);
+	// check if a metadata object is affected by pending catalog invalidations
+	static BOOL IsInvalidMdId(const gpmd::IMDId *mdid, void *context);
+
+	// check if a metadata cache entry is affected by pending catalog
+	// invalidations
+	static BOOL IsInvalidMDCacheEntry(CMDKey *const &md_key,
+									  gpmd::IMDCacheObject *md_obj,
+									  void *context);
+
+	// check if a plan cache entry depends on an object affected by pending
+	// catalog invalidations
+	static BOOL IsInvalidPlanCacheEntry(CPlanCacheKey *const &plan_key,
+										CPlanCacheEntry *plan_entry,
+										void *context);
+
+	// evict the metadata and plan cache entries affected by catalog changes
+	// since the last optimized query
+	static void InvalidateMDCache(CMemoryPool *mp);
+
+	// does the given optimizer exception require dropping the metadata cache?
+	static BOOL ShouldDropMDCache(CException &ex);
+
+	// serialize the query and the optimizer inputs into a plan cache key
+	static CWStringDynamic *CreatePlanCacheKey(
+		CMemoryPool *mp, const CDXLNode *query_dxl,
+		const CDXLNodeArray *query_output_dxlnode_array,
+		const CDXLNodeArray *cte_dxlnode_array,
+		const COptimizerConfig *optimizer_config, ULONG num_segments);
+
+	// load search strategy from given file
+	static CSearchStageArray *LoadSearchStrategyFile(CMemoryPool *mp,
+													 const char *path);
+
+	// parse search stages defined in a GUC, or only check the definition;
+	// return where it is malformed, if anywhere
+	static const char *ParseSearchStages(CMemoryPool *mp, const char *stages,
+										 CSearchStageArray **search_stage_array);
+
+	// create fresh copies of the given search stages
+	static CSearchStageArray *CopySearchStrategy(
+		CMemoryPool *mp, const CSearchStageArray *search_stage_array);
+
+	// drop the search strategy cached by a previous query
+	static void ResetSearchStrategyCache();
+
+	// load search strategy from given GUC value or path, reusing the
+	// strategy parsed by a previous query if they did not change
+	static CSearchStageArray *LoadSearchStrategy(CMemoryPool *mp, char *path,
+												 char *stages);
 
 	// helper for converting wide character string to regular string
 	static CHAR *CreateMultiByteCharStringFromWCString(const WCHAR *wcstr);
 
+	// override cost model parameters with those defined in a GUC, or only
+	// check the definition; return where it is malformed, if anywhere
+	static const char *OverrideCostModelParams(
+		ICostModelParams *cost_model_params, const char *params);
+
 	// set cost model parameters
 	static void SetCostModelParams(ICostModel *cost_model);
 
@@ -164,6 +230,14 @@ public:
 
 	// enable/disable a given xforms
 	static bool SetXform(char *xform_str, bool should_disable);
+
+	// check a definition of cost model parameters for the GUC; return where
+	// it is malformed, or null if it is well formed
+	static const char *CheckCostModelParams(const char *params);
+
+	// check a definition of search stages for the GUC; return where it is
+	// malformed, or null if it is well formed
+	static const char *CheckSearchStrategy(const char *stages);
 };
 
 #endif	// COptTasks_H
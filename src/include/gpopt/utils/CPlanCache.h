@@ -0,0 +1,190 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPlanCache.h
+//
+//	@doc:
+//		Cache of DXL plans produced by GPORCA, keyed on the DXL query and
+//		the optimizer configuration used to optimize it
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPOPT_CPlanCache_H
+#define GPOPT_CPlanCache_H
+
+#include "gpos/base.h"
+#include "gpos/common/CRefCount.h"
+#include "gpos/memory/CCache.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/md/IMDId.h"
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCacheKey
+//
+//	@doc:
+//		Key of a cached plan: the serialized DXL query followed by the
+//		serialized inputs of the optimizer that may change its result
+//
+//---------------------------------------------------------------------------
+class CPlanCacheKey
+{
+private:
+	// serialized query and optimizer inputs
+	CWStringDynamic *m_str;
+
+	// precomputed hash value
+	ULONG m_hash;
+
+public:
+	CPlanCacheKey(const CPlanCacheKey &) = delete;
+
+	// ctor, copies the given string
+	CPlanCacheKey(CMemoryPool *mp, const CWStringBase *str);
+
+	// dtor
+	~CPlanCacheKey();
+
+	// equality function for using plan cache keys in a cache
+	static BOOL FEqualKey(CPlanCacheKey *const &left,
+						  CPlanCacheKey *const &right);
+
+	// hash function for using plan cache keys in a cache
+	static ULONG UlHashKey(CPlanCacheKey *const &key);
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCacheEntry
+//
+//	@doc:
+//		A cached plan, along with the metadata objects it was built from
+//		and the columns found to have no statistics while optimizing it
+//
+//---------------------------------------------------------------------------
+class CPlanCacheEntry : public CRefCount
+{
+private:
+	// serialized DXL plan
+	CHAR *m_plan_dxl;
+
+	// metadata objects accessed while optimizing the query
+	IMdIdArray *m_mdids;
+
+	// column statistics found missing while optimizing the query
+	IMdIdArray *m_missing_stats_mdids;
+
+public:
+	CPlanCacheEntry(const CPlanCacheEntry &) = delete;
+
+	// ctor, copies the given plan and mdids
+	CPlanCacheEntry(CMemoryPool *mp, const CHAR *plan_dxl,
+					const IMdIdArray *mdids,
+					const IMdIdArray *missing_stats_mdids);
+
+	// dtor
+	~CPlanCacheEntry() override;
+
+	// serialized DXL plan
+	const CHAR *
+	GetPlanDXL() const
+	{
+		return m_plan_dxl;
+	}
+
+	// metadata objects the plan depends on
+	const IMdIdArray *
+	GetMdIds() const
+	{
+		return m_mdids;
+	}
+
+	// column statistics the plan was built without
+	const IMdIdArray *
+	GetMissingStatsMdIds() const
+	{
+		return m_missing_stats_mdids;
+	}
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCache
+//
+//	@doc:
+//		A wrapper for a generic cache to hide the details of plan cache
+//		creation and encapsulate a singleton cache object. Entries are
+//		not validated on lookup; callers must invalidate the entries that
+//		depend on changed metadata objects, the same way they invalidate
+//		the metadata cache.
+//
+//---------------------------------------------------------------------------
+class CPlanCache
+{
+public:
+	typedef CCache<CPlanCacheEntry *, CPlanCacheKey *> PlanCache;
+
+private:
+	// pointer to the underlying cache
+	static PlanCache *m_pcache;
+
+	// the maximum size of the cache
+	static ULLONG m_ullCacheQuota;
+
+	// private ctor
+	CPlanCache() = default;
+
+	// private dtor
+	~CPlanCache() = default;
+
+public:
+	CPlanCache(const CPlanCache &) = delete;
+
+	// initialize underlying cache
+	static void Init();
+
+	// has cache been initialized?
+	static BOOL
+	FInitialized()
+	{
+		return (nullptr != m_pcache);
+	}
+
+	// destroy global instance
+	static void Shutdown();
+
+	// set the maximum size of the cache
+	static void SetCacheQuota(ULLONG ullCacheQuota);
+
+	// get the maximum size of the cache
+	static ULLONG ULLGetCacheQuota();
+
+	// reset global instance
+	static void Reset();
+
+	// return a copy of the plan cached for the given key, or nullptr
+	static CHAR *Lookup(CMemoryPool *mp, const CWStringBase *key,
+						IMdIdArray *missing_stats_mdids);
+
+	// cache the plan produced for the given key
+	static void Insert(const CWStringBase *key, const CHAR *plan_dxl,
+					   const IMdIdArray *mdids,
+					   const IMdIdArray *missing_stats_mdids);
+
+	// remove the entries accepted by the given filter
+	static ULONG Invalidate(PlanCache::EntryFilterFuncPtr filter_func,
+							void *context);
+};
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPlanCache_H
+
+// EOF
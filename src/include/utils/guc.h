@@ -457,6 +457,8 @@ extern int optimizer_minidump;
 extern int  optimizer_cost_model;
 extern bool optimizer_metadata_caching;
 extern int	optimizer_mdcache_size;
+extern int	optimizer_shared_mdcache_size;
+extern int	optimizer_plan_cache_size;
 
 /* Optimizer debugging GUCs */
 extern bool optimizer_print_query;
@@ -475,6 +477,8 @@ extern bool optimizer_print_xform_results;
 /* array of xforms disable flags */
 extern bool optimizer_xforms[OPTIMIZER_XFORMS_COUNT];
 extern char *optimizer_search_strategy_path;
+extern char *optimizer_search_strategy;
+extern char *optimizer_cost_model_params;
 
 /* GUCs to tell Optimizer to enable a physical operator */
 extern bool optimizer_enable_indexjoin;
@@ -529,6 +533,7 @@ extern double optimizer_damping_factor_filter;
 extern double optimizer_damping_factor_join;
 extern double optimizer_damping_factor_groupby;
 extern bool optimizer_dpe_stats;
+extern bool optimizer_merge_partition_stats;
 extern bool optimizer_enable_derive_stats_all_groups;
 
 /* Costing or tuning related GUCs used by the Optimizer */
@@ -559,6 +564,7 @@ extern bool optimizer_remove_order_below_dml;
 extern bool optimizer_multilevel_partitioning;
 extern bool optimizer_parallel_union;
 extern bool optimizer_array_constraints;
+extern bool optimizer_adaptive_search;
 extern bool optimizer_cte_inlining;
 extern bool optimizer_enable_space_pruning;
 extern bool optimizer_enable_associativity;
@@ -569,6 +575,7 @@ extern bool optimizer_analyze_root_partition;
 extern bool optimizer_analyze_midlevel_partition;
 
 extern bool optimizer_use_gpdb_allocators;
+extern bool optimizer_use_arena_memory_pools;
 
 /* optimizer GUCs for replicated table */
 extern bool optimizer_replicated_table_insert;
@@ -0,0 +1,28 @@
+/*-------------------------------------------------------------------------
+ *
+ * mdcache_shmem.h
+ *	  Cross-backend cache of serialized GPORCA metadata objects
+ *
+ * Portions Copyright (c) 2023-Present VMware, Inc. or its affiliates.
+ *
+ *
+ * IDENTIFICATION
+ *	    src/include/utils/mdcache_shmem.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef MDCACHE_SHMEM_H
+#define MDCACHE_SHMEM_H
+
+/* Maximum length of a serialized mdid used in keys, including terminator */
+#define MDCACHE_SHMEM_KEYSIZE	128
+
+extern Size MDCacheShmemSize(void);
+extern void MDCacheShmemInit(void);
+
+extern uint64 MDCacheShmemBeginOptimization(void);
+extern char *MDCacheShmemLookup(uint64 version, const char *key, Size *len);
+extern void MDCacheShmemInsert(uint64 version, const char *key,
+							   const char *data, Size len);
+
+#endif							/* MDCACHE_SHMEM_H */
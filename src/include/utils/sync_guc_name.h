@@ -99,6 +99,7 @@
 		"optimizer_cte_inlining_bound",
 		"optimizer_mdcache_size",
 		"optimizer_partition_selection_log",
+		"optimizer_plan_cache_size",
 		"optimizer_plan_id",
 		"optimizer_push_group_by_below_setop_threshold",
 		"optimizer_samples_number",
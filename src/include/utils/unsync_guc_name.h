@@ -343,6 +343,7 @@
 		"old_snapshot_threshold",
 		"operator_precedence_warning",
 		"optimizer",
+		"optimizer_adaptive_search",
 		"optimizer_analyze_midlevel_partition",
 		"optimizer_analyze_root_partition",
 		"optimizer_apply_left_outer_to_union_all_disregarding_stats",
@@ -350,6 +351,7 @@
 		"optimizer_array_expansion_threshold",
 		"optimizer_control",
 		"optimizer_cost_model",
+		"optimizer_cost_model_params",
 		"optimizer_cost_threshold",
 		"optimizer_cte_inlining",
 		"optimizer_damping_factor_filter",
@@ -409,6 +411,7 @@
 		"optimizer_join_order_threshold",
 		"optimizer_log",
 		"optimizer_log_failure",
+		"optimizer_merge_partition_stats",
 		"optimizer_metadata_caching",
 		"optimizer_minidump",
 		"optimizer_multilevel_partitioning",
@@ -435,10 +438,13 @@
 		"optimizer_remove_order_below_dml",
 		"optimizer_replicated_table_insert",
 		"optimizer_sample_plans",
+		"optimizer_search_strategy",
 		"optimizer_search_strategy_path",
 		"optimizer_segments",
+		"optimizer_shared_mdcache_size",
 		"optimizer_sort_factor",
 		"optimizer_trace_fallback",
+		"optimizer_use_arena_memory_pools",
 		"optimizer_use_external_constant_expression_evaluation_for_ints",
 		"optimizer_use_gpdb_allocators",
 		"parallel_leader_participation",
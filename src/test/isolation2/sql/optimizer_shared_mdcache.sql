@@ -0,0 +1,36 @@
+-- The shared metadata cache of the optimizer must keep the objects of
+-- different databases apart. Databases created from the same template
+-- inherit its objects with the same OIDs, so the same mdid can name
+-- different objects in each of them.
+
+!\retcode gpconfig -c optimizer_shared_mdcache_size -v 1024 --masteronly;
+!\retcode gpstop -ari;
+
+1: CREATE DATABASE mdcache_template;
+2:@db_name mdcache_template: CREATE TABLE mdcache_t(a int) DISTRIBUTED BY (a);
+2q:
+1: CREATE DATABASE mdcache_db1 TEMPLATE mdcache_template;
+1: CREATE DATABASE mdcache_db2 TEMPLATE mdcache_template;
+
+-- mdcache_t has the same OID in both databases, but not the same columns
+3:@db_name mdcache_db1: INSERT INTO mdcache_t VALUES (1);
+4:@db_name mdcache_db2: ALTER TABLE mdcache_t ADD COLUMN b int;
+4: INSERT INTO mdcache_t VALUES (1, 2);
+
+-- the first query publishes the relation of mdcache_db1, which the second
+-- must not use
+3: SET optimizer TO on;
+4: SET optimizer TO on;
+3: SELECT * FROM mdcache_t;
+4: SELECT * FROM mdcache_t;
+3: SELECT * FROM mdcache_t;
+
+3q:
+4q:
+1: DROP DATABASE mdcache_db1;
+1: DROP DATABASE mdcache_db2;
+1: DROP DATABASE mdcache_template;
+1q:
+
+!\retcode gpconfig -r optimizer_shared_mdcache_size --masteronly;
+!\retcode gpstop -ari;
@@ -0,0 +1,22 @@
+--
+-- The optimizer evaluates the comparisons of constants of types it cannot
+-- compare by itself, such as arrays, in the backend. The translation of a
+-- comparison operator is reused for all the comparisons with the operator,
+-- and array comparisons share one operator across element types, so the
+-- collation of each comparison must follow its own arguments.
+--
+CREATE SCHEMA orca_const_eval;
+SET search_path TO orca_const_eval;
+SET optimizer_enable_constant_expression_evaluation TO on;
+
+CREATE TABLE arr (ia int[], ta text[]) DISTRIBUTED RANDOMLY;
+INSERT INTO arr VALUES ('{1}', '{a}'), ('{3}', '{b}'), ('{7}', '{d}');
+
+-- int[], without a collation, then text[]
+SELECT * FROM arr WHERE ia > '{1}' AND ia < '{5}' AND ta > '{a}' AND ta < '{c}';
+
+-- text[], with a collation, then int[]
+SELECT * FROM arr WHERE ta > '{a}' AND ta < '{c}' AND ia > '{1}' AND ia < '{5}';
+
+RESET optimizer_enable_constant_expression_evaluation;
+DROP SCHEMA orca_const_eval CASCADE;
@@ -0,0 +1,34 @@
+--
+-- Test that the metadata cache of GPORCA survives an expected fallback to
+-- the planner. Whether the cache is kept is logged at DEBUG1, and the plans
+-- that are only valid with it are still hit; other DEBUG1 messages vary and
+-- are ignored.
+--
+-- start_matchignore
+-- m/^DEBUG1:  (?!\[OPT\]:)/
+-- m/^LOG:  /
+-- end_matchignore
+CREATE SCHEMA orca_mdcache_fallback;
+SET search_path TO orca_mdcache_fallback;
+
+CREATE TABLE fb (a int, b int) DISTRIBUTED BY (a);
+
+SET log_statement = 'none';
+SET log_min_duration_statement = -1;
+SET optimizer_trace_fallback = on;
+SET optimizer_plan_cache_size = '1MB';
+SET client_min_messages = 'debug1';
+
+SELECT count(*) FROM fb WHERE b = 1;
+
+-- aggregates with FILTER are not supported by GPORCA
+SELECT count(*) FILTER (WHERE b = 1) FROM fb;
+
+SELECT count(*) FROM fb WHERE b = 1;
+
+RESET client_min_messages;
+RESET optimizer_plan_cache_size;
+RESET optimizer_trace_fallback;
+RESET log_min_duration_statement;
+RESET log_statement;
+DROP SCHEMA orca_mdcache_fallback CASCADE;
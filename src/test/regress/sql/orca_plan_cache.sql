@@ -0,0 +1,61 @@
+--
+-- Test the cache of plans produced by GPORCA, optimizer_plan_cache_size.
+-- Hits are logged at DEBUG1; other DEBUG1 messages vary and are ignored.
+--
+-- start_matchignore
+-- m/^DEBUG1:  (?!\[OPT\]:)/
+-- m/^LOG:  Missing statistics for column/
+-- end_matchignore
+CREATE SCHEMA orca_plan_cache;
+SET search_path TO orca_plan_cache;
+
+CREATE TABLE pc (a int, b int) DISTRIBUTED BY (a);
+INSERT INTO pc SELECT i, i % 5 FROM generate_series(1, 20) i;
+ANALYZE pc;
+
+-- remove the statistics, so that the optimizer reports them missing
+-- start_ignore
+SET allow_system_table_mods = on;
+DELETE FROM pg_statistic WHERE starelid = 'pc'::regclass;
+RESET allow_system_table_mods;
+-- end_ignore
+
+SET log_statement = 'none';
+SET log_min_duration_statement = -1;
+SET optimizer_plan_cache_size = '1MB';
+SET client_min_messages = 'debug1';
+
+-- the first run caches the plan, the second one hits it, and reports the
+-- missing statistics the same way
+SELECT count(*) FROM pc WHERE b = 1;
+SELECT count(*) FROM pc WHERE b = 1;
+
+-- a different optimizer configuration does not hit the plan cached for
+-- another one
+SET optimizer_enable_hashagg = off;
+SELECT count(*) FROM pc WHERE b = 1;
+RESET optimizer_enable_hashagg;
+SELECT count(*) FROM pc WHERE b = 1;
+
+-- disabling the cache drops its plans
+SET optimizer_plan_cache_size = 0;
+SELECT count(*) FROM pc WHERE b = 1;
+SET optimizer_plan_cache_size = '1MB';
+SELECT count(*) FROM pc WHERE b = 1;
+SELECT count(*) FROM pc WHERE b = 1;
+
+-- DDL on a relation evicts the plans that depend on it
+ALTER TABLE pc ADD COLUMN c int;
+SELECT count(*) FROM pc WHERE b = 1;
+SELECT count(*) FROM pc WHERE b = 1;
+
+-- so does ANALYZE, and the statistics are no longer reported missing
+ANALYZE pc;
+SELECT count(*) FROM pc WHERE b = 1;
+SELECT count(*) FROM pc WHERE b = 1;
+
+RESET client_min_messages;
+RESET optimizer_plan_cache_size;
+RESET log_min_duration_statement;
+RESET log_statement;
+DROP SCHEMA orca_plan_cache CASCADE;
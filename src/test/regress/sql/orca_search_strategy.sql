@@ -0,0 +1,55 @@
+--
+-- Test the search strategy of GPORCA, set by optimizer_search_strategy or
+-- by a file at optimizer_search_strategy_path. The strategy is cached, and
+-- is logged at DEBUG1 whenever it is loaded; other DEBUG1 messages vary and
+-- are ignored.
+--
+-- start_matchignore
+-- m/^DEBUG1:  (?!\[OPT\]: loaded search strategy)/
+-- end_matchignore
+CREATE SCHEMA orca_search_strategy;
+SET search_path TO orca_search_strategy;
+
+CREATE TABLE ss (a int, b int) DISTRIBUTED BY (a);
+INSERT INTO ss SELECT i, i FROM generate_series(1, 10) i;
+ANALYZE ss;
+
+-- malformed search stages are rejected when they are set
+SET optimizer_search_strategy = '1000:2e6:';
+SET optimizer_search_strategy = '1000:2e6:CXformGet2TableScan,';
+SET optimizer_search_strategy = '1000:2e6:CXformNoSuchXform';
+SET optimizer_search_strategy = '1000:2e6:CXformGet2TableScan;junk';
+SET optimizer_search_strategy = '1000:2e6:CXformGet2TableScan:1';
+SHOW optimizer_search_strategy;
+
+COPY (SELECT '<?xml version="1.0" encoding="UTF-8"?><dxl:DXLMessage xmlns:dxl="http://greenplum.com/dxl/2010/12/"><dxl:SearchStrategy><dxl:SearchStage TimeThreshold="1000" CostThreshold="2E6"><dxl:Xform Name="CXformGet2TableScan"/><dxl:Xform Name="CXformSelect2Filter"/></dxl:SearchStage></dxl:SearchStrategy></dxl:DXLMessage>')
+TO '/tmp/orca_search_strategy.xml';
+
+SET log_statement = 'none';
+SET log_min_duration_statement = -1;
+SET optimizer_search_strategy_path = '/tmp/orca_search_strategy.xml';
+SET client_min_messages = 'debug1';
+
+-- the file is only loaded by the first query
+SELECT a FROM ss WHERE a = 1;
+SELECT a FROM ss WHERE a = 1;
+
+-- and loaded again once it changes
+RESET client_min_messages;
+COPY (SELECT '<?xml version="1.0" encoding="UTF-8"?><dxl:DXLMessage xmlns:dxl="http://greenplum.com/dxl/2010/12/"><dxl:SearchStrategy><dxl:SearchStage TimeThreshold="1000" CostThreshold="2E6"><dxl:Xform Name="CXformGet2TableScan"/><dxl:Xform Name="CXformSelect2Filter"/><dxl:Xform Name="CXformInnerJoin2HashJoin"/></dxl:SearchStage></dxl:SearchStrategy></dxl:DXLMessage>')
+TO '/tmp/orca_search_strategy.xml';
+SET client_min_messages = 'debug1';
+SELECT a FROM ss WHERE a = 1;
+SELECT a FROM ss WHERE a = 1;
+
+-- search stages set by the GUC override the file
+SET optimizer_search_strategy = '1000:2e6:CXformGet2TableScan,CXformSelect2Filter';
+SELECT a FROM ss WHERE a = 1;
+SELECT a FROM ss WHERE a = 1;
+
+RESET client_min_messages;
+RESET optimizer_search_strategy;
+RESET optimizer_search_strategy_path;
+RESET log_min_duration_statement;
+RESET log_statement;
+DROP SCHEMA orca_search_strategy CASCADE;